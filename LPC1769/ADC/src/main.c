@@ -6,10 +6,17 @@
  * Using an analog temperature sensor, the temperature inside the oven is monitored and displayed via three LEDs
  * (Green: Less than 40 degrees, Yellow: Less than 70 degrees, Red: Greater than 70 degrees).
  * 
- * This program uses Timer0 to trigger periodic ADC conversions every 60 seconds, reading the temperature value
- * and turning on the corresponding LED based on the temperature range. The temperature sensor is connected to ADC channel 7,
- * and the ADC is configured with a 12-bit resolution, providing 4096 discrete values between 0V and Vref (typically 3.3V).
- * The ADC sampling frequency is set to 100 kHz, and 8 readings are averaged to improve accuracy.
+ * This program uses Timer0 to start a reading every 60 seconds, and turns on the corresponding LED based on the
+ * temperature range. The LEDs are only written when a reading moves to another range by more than a hysteresis, so a
+ * temperature hovering around a threshold does not make them blink from one reading to the next. The temperature
+ * sensor is connected to ADC channel 7, and the ADC is configured with a 12-bit resolution, providing 4096 discrete
+ * values between 0V and Vref (typically 3.3V). A reading is the average of 8 conversions taken at 10 kHz, converted to
+ * tenths of a degree (10 mV per degree) through a fixed-point table before it is compared with the thresholds.
+ *
+ * The conversions are started in hardware by the rising edges of the MAT1.0 match output of Timer1, so the sampling
+ * instants do not depend on the interrupt latency, and the GPDMA moves each result to memory. The CPU only runs at the
+ * start of a reading (Timer0 interrupt) and once its 8 results are in memory (DMA interrupt). The ADC is powered down
+ * between two readings.
  */
 
 #ifdef __USE_CMSIS
@@ -22,17 +29,26 @@
 
 #include "lpc17xx_timer.h"    /* Timer0 */
 #include "lpc17xx_gpio.h"    /* GPIO */
+#include "lpc17xx_classify.h"    /* Threshold classifier */
 #include "lpc17xx_pinsel.h"    /* Pin Configuration */
 #include "lpc17xx_adc.h"    /* ADC */
+#include "lpc17xx_gpdma.h"    /* GPDMA */
+#include "sensor_lut.h"    /* Sensor linearization */
 
 /* Pin Definitions */
 #define GREEN_LED ((uint32_t)(1 << 20)) /* P0.20 connected to LED */
 #define YELLOW_LED ((uint32_t)(1 << 21)) /* P0.21 connected to LED */
 #define RED_LED ((uint32_t)(1 << 22)) /* P0.22 connected to LED */
+#define ALL_LEDS (GREEN_LED | YELLOW_LED | RED_LED)
 #define ADC_INPUT ((uint32_t)(1 << 2)) /* P0.2 connected to ADC */
 
-#define GREEN_TMP 40
-#define YELLOW_TMP 70
+#define GREEN_TMP 400 /* 40.0 degrees */
+#define YELLOW_TMP 700 /* 70.0 degrees */
+#define TMP_HYSTERESIS 20 /* Temperatures must pass a threshold by 2 degrees to change the LEDs */
+
+/* Transfer function of the sensor, in tenths of a degree: 10 mV per degree, 3.3 V reference */
+#define SENSOR_DECIDEGREES(code) ((int32_t)((code) * 3300.0 / 4096.0 + 0.5))
+#define LED_INPUT 0 /* Classifier input of the readings */
 
 #define SECOND 10000
 
@@ -41,62 +57,103 @@
 #define OUTPUT 1
 
 /* Define frequency variables */
-#define ADC_FREQ 100000 /* 100 kHz */
+#define ADC_FREQ 100000 /* 100 kHz conversion rate, 10 us per conversion */
+#define ADC_SAMPLE_FREQ 10000 /* 10 kHz sampling rate, one MAT1.0 rising edge per sample */
+#define ADC_SAMPLES 8 /* Conversions averaged in a reading */
 
 /* Boolean Values */
 #define TRUE  1
 #define FALSE 0
 
 static uint32_t adc_read_value = 0;
+static int32_t temperature = 0; /* Last reading, in tenths of a degree */
+static uint32_t adc_samples[ADC_SAMPLES]; /* ADGDR words of a reading, written by the GPDMA */
+static GPDMA_Channel_CFG_Type adc_dma_cfg; /* Transfer of a reading, submitted by each Timer0 match */
+
+/* Sensor table, computed by the compiler, and calibration of the board (ADC code offset, temperature offset) */
+static const int32_t sensor_table[SENSOR_TABLE_POINTS] = SENSOR_TABLE(SENSOR_DECIDEGREES);
+static SENSOR_Type oven_sensor = {sensor_table, 0, 0, 0};
+
+/* LED of each temperature range: green up to GREEN_TMP, yellow up to YELLOW_TMP, red above */
+static const uint16_t led_thresholds[] = {GREEN_TMP + 1, YELLOW_TMP + 1};
+static const uint32_t led_pins[] = {GREEN_LED, YELLOW_LED, RED_LED};
+static const CLASSIFY_Table_Type led_bands = {led_thresholds, led_pins, 3, PINSEL_PORT_0, TMP_HYSTERESIS, 1};
 
 /* Function declarations */
 void configure_port(void);
 void configure_adc(void);
+Status configure_dma(void);
 void configure_timer_and_match(void);
+void configure_classifier(void);
 void start_timer(void);
-void turn_on_led(void);
+void adc_reading_done(uint32_t channel, void* arg);
 
 /**
- * @brief Initialize the GPIO pins for the LEDs.
+ * @brief Initialize the GPIO pins for the LEDs and the ADC input.
  */
 void configure_port(void)
 {
-    PINSEL_CFG_Type pin_cfg_struct; /* Create a variable to store the configuration of the pin */
-
-    /* Configure P0.20, P0.21, and P0.22 as GPIO for LED outputs */
-    pin_cfg_struct.Portnum = PINSEL_PORT_0;           /* Port number is 0 */
-    pin_cfg_struct.Pinnum = PINSEL_PIN_20;            /* Pin number 20 */
-    pin_cfg_struct.Funcnum = PINSEL_FUNC_0;           /* Function number is 0 (GPIO) */
-    pin_cfg_struct.Pinmode = PINSEL_PINMODE_PULLUP;   /* Pin mode is pull-up */
-    pin_cfg_struct.OpenDrain = PINSEL_PINMODE_NORMAL; /* Normal mode */
-
-    /* Configure the green LED pin */
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    static const PINSEL_CFG_Type pins[] = {
+        {PINSEL_PORT_0, PINSEL_PIN_20, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},  /* Green LED */
+        {PINSEL_PORT_0, PINSEL_PIN_21, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},  /* Yellow LED */
+        {PINSEL_PORT_0, PINSEL_PIN_22, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},  /* Red LED */
+        {PINSEL_PORT_0, PINSEL_PIN_2, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL}, /* AD0.7 */
+    };
 
-    /* Configure the yellow LED pin */
-    pin_cfg_struct.Pinnum = PINSEL_PIN_21;
-    PINSEL_ConfigPin(&pin_cfg_struct);
-
-    /* Configure the red LED pin */
-    pin_cfg_struct.Pinnum = PINSEL_PIN_22;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    PINSEL_ConfigPins(pins, sizeof(pins) / sizeof(pins[0])); /* One update per PINSEL and PINMODE register */
 
     /* Set the LED pins as output */
     GPIO_SetDir(PINSEL_PORT_0, GREEN_LED | YELLOW_LED | RED_LED, OUTPUT);
 }
 
 /**
- * @brief Configure the ADC to sample the temperature sensor at 100 kHz.
+ * @brief Configure the ADC to convert channel 7 on each rising edge of MAT1.0, for the GPDMA.
+ * @note The DMA request of the ADC is the interrupt flag of the channel: ADINTEN7 is set and the ADC interrupt stays
+ *       disabled in the NVIC. The ADC is left powered down until the first reading.
  */
 void configure_adc(void)
 {
-    ADC_Init(LPC_ADC, ADC_FREQ); /* Initialize the ADC peripheral with a 100 kHz sampling frequency */
+    ADC_Init(LPC_ADC, ADC_FREQ); /* Initialize the ADC peripheral with a 100 kHz conversion rate */
     ADC_ChannelCmd(LPC_ADC, ADC_CHANNEL_7, ENABLE); /* Enable ADC channel 7 */
-    ADC_IntConfig(LPC_ADC, ADC_CHANNEL_7, ENABLE); /* Enable interrupt for ADC channel 7 */
+    ADC_IntConfig(LPC_ADC, ADC_ADGINTEN, DISABLE); /* Only the channel 7 flag requests a transfer */
+    ADC_IntConfig(LPC_ADC, ADC_ADINTEN7, ENABLE); /* Channel 7 result requests a DMA transfer */
+    ADC_EdgeStartConfig(LPC_ADC, ADC_START_ON_RISING); /* Convert on the rising edges... */
+    ADC_StartCmd(LPC_ADC, ADC_START_ON_MAT10); /* ...of the MAT1.0 match output */
+    ADC_PowerdownCmd(LPC_ADC, DISABLE); /* Power down until the first reading */
 }
 
 /**
- * @brief Configure Timer0 to trigger an interrupt every 60 seconds.
+ * @brief Configure the GPDMA channel that moves the 8 results of a reading from ADGDR to memory.
+ * @return SUCCESS, or ERROR when no GPDMA channel is free.
+ */
+Status configure_dma(void)
+{
+    int32_t channel;
+
+    GPDMA_Init(); /* Initialize the GPDMA controller */
+
+    channel = GPDMA_AllocChannel(GPDMA_PRIO_MEDIUM); /* Any free channel */
+    if (channel < 0)
+    {
+        return ERROR; /* All the channels are taken */
+    }
+    adc_dma_cfg.ChannelNum = (uint8_t)channel;
+    adc_dma_cfg.SrcMemAddr = 0; /* Source is peripheral (ADC) */
+    adc_dma_cfg.DstMemAddr = (uint32_t)adc_samples; /* Destination is the sample buffer */
+    adc_dma_cfg.TransferSize = ADC_SAMPLES; /* One transfer per conversion */
+    adc_dma_cfg.TransferWidth = 0; /* Width is not used for ADC */
+    adc_dma_cfg.TransferType = GPDMA_TRANSFERTYPE_P2M; /* Peripheral to memory */
+    adc_dma_cfg.SrcConn = GPDMA_CONN_ADC; /* ADC is the source */
+    adc_dma_cfg.DstConn = 0; /* Memory as destination */
+    adc_dma_cfg.DMALLI = 0; /* No linked list */
+
+    NVIC_EnableIRQ(DMA_IRQn); /* End of a reading, served by GPDMA_IntHandler() */
+    return SUCCESS;
+}
+
+/**
+ * @brief Configure Timer0 to trigger an interrupt every 60 seconds, and Timer1 to toggle MAT1.0 at twice the
+ *        sampling rate.
  */
 void configure_timer_and_match(void)
 {
@@ -117,6 +174,29 @@ void configure_timer_and_match(void)
     match_cfg_struct.MatchValue = (uint32_t)(60 * SECOND); /* Match value set for 60 seconds */
 
     TIM_ConfigMatch(LPC_TIM0, &match_cfg_struct); /* Configure the match */
+
+    timer_cfg_struct.PrescaleValue = (uint32_t) 1; /* Timer1 counts microseconds */
+
+    TIM_Init(LPC_TIM1, TIM_TIMER_MODE, &timer_cfg_struct); /* Initialize Timer1, started by each reading */
+
+    match_cfg_struct.MatchChannel = 0; /* Match channel 0, drives MAT1.0 */
+    match_cfg_struct.IntOnMatch = DISABLE; /* No interrupt, the ADC is started in hardware */
+    match_cfg_struct.StopOnMatch = DISABLE; /* Do not stop the timer on match */
+    match_cfg_struct.ResetOnMatch = ENABLE; /* Reset the timer on match */
+    match_cfg_struct.ExtMatchOutputType = TIM_EXTMATCH_TOGGLE; /* Toggle MAT1.0, one rising edge per period */
+    match_cfg_struct.MatchValue = (uint32_t)(1000000 / (2 * ADC_SAMPLE_FREQ) - 1); /* Half period, TC counts 0 to MR0 */
+
+    TIM_ConfigMatch(LPC_TIM1, &match_cfg_struct); /* Configure the match */
+}
+
+/**
+ * @brief Configure the classifier that drives the LEDs from the readings.
+ * @note Readings come once a minute, so a single reading in a new range is enough to change the LEDs.
+ */
+void configure_classifier(void)
+{
+    CLASSIFY_Init(NULL, NULL); /* No callback, the classifier drives the LEDs itself */
+    CLASSIFY_SetTable(LED_INPUT, &led_bands); /* The first reading lights its LED */
 }
 
 /**
@@ -129,55 +209,47 @@ void start_timer(void)
 }
 
 /**
- * @brief Turn on the appropriate LED based on the temperature value.
+ * @brief GPDMA callback, the 8 results of the reading are in memory.
+ *        Stops the sampling, powers the ADC down, averages the results and updates the LED state.
  */
-void turn_on_led(void)
+void adc_reading_done(uint32_t channel, void* arg)
 {
-    if (adc_read_value <= GREEN_TMP)
-    {
-        GPIO_SetValue(PINSEL_PORT_0, GREEN_LED);
-        GPIO_ClearValue(PINSEL_PORT_0, RED_LED | YELLOW_LED);
-    }
-    else if (adc_read_value <= YELLOW_TMP)
-    {
-        GPIO_SetValue(PINSEL_PORT_0, YELLOW_LED);
-        GPIO_ClearValue(PINSEL_PORT_0, RED_LED | GREEN_LED);
-    }
-    else
+    TIM_Cmd(LPC_TIM1, DISABLE); /* Stop the sampling edges */
+    LPC_TIM1->EMR &= ~TIM_EM(0); /* MAT1.0 low, the first toggle of the next reading is a rising edge */
+    ADC_PowerdownCmd(LPC_ADC, DISABLE); /* Power down until the next reading */
+
+    adc_read_value = 0;
+    for (uint32_t lecture = 0; lecture < ADC_SAMPLES; ++lecture)
     {
-        GPIO_SetValue(PINSEL_PORT_0, RED_LED);
-        GPIO_ClearValue(PINSEL_PORT_0, YELLOW_LED | GREEN_LED);
+        adc_read_value += ADC_GDR_RESULT(adc_samples[lecture]); /* Result field of the ADGDR word */
     }
+    adc_read_value /= ADC_SAMPLES; /* Calculate the average value */
+    temperature = SENSOR_Convert(&oven_sensor, adc_read_value); /* Tenths of a degree, no floating point */
+    CLASSIFY_Update(LED_INPUT, (temperature > 0) ? (uint16_t)temperature : 0); /* The LEDs change with the range */
 }
 
 // ----------------- Interrupt Handler Functions -----------------
 
 /**
  * @brief Timer0 Interrupt Handler.
- *        Clears the interrupt flag and starts an ADC conversion.
+ *        Clears the interrupt flag and starts a reading: the ADC is powered up, the GPDMA transfer is armed and
+ *        Timer1 starts producing the sampling edges.
  */
 void TIMER0_IRQHandler()
 {
     TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT); /* Clear the interrupt flag */
-    ADC_StartCmd(LPC_ADC, ADC_START_NOW); /* Start the ADC conversion */
+    ADC_PowerdownCmd(LPC_ADC, ENABLE); /* Power up the ADC for the reading */
+    GPDMA_Submit(&adc_dma_cfg, adc_reading_done, NULL, NULL); /* Results to memory, callback after the last one */
+    TIM_ResetCounter(LPC_TIM1); /* First sampling edge half a period from now */
+    TIM_Cmd(LPC_TIM1, ENABLE); /* Start the sampling edges */
 }
 
 /**
- * @brief ADC Interrupt Handler.
- *        Averages 8 ADC readings and updates the LED state.
+ * @brief DMA Interrupt Handler, dispatches the end of the reading to adc_reading_done().
  */
-void ADC_IRQHandler()
+void DMA_IRQHandler()
 {
-    NVIC_DisableIRQ(ADC_IRQn); /* Disable the ADC interrupt */
-    adc_read_value = 0;
-    for (uint32_t lecture = 0; lecture < 8; ++lecture)
-    {
-        while (!(ADC_ChannelGetStatus(LPC_ADC, ADC_CHANNEL_7, ADC_DATA_DONE))); /* Wait for the ADC conversion to finish */
-        adc_read_value += ADC_ChannelGetData(LPC_ADC, ADC_CHANNEL_7); /* Read the ADC value */
-    }
-    adc_read_value /= 8; /* Calculate the average value */
-    turn_on_led(); /* Call logic of LED switching */
-    NVIC_EnableIRQ(ADC_IRQn); /* Enable the ADC interrupt */
+    GPDMA_IntHandler();
 }
 
 /**
@@ -188,12 +260,20 @@ int main(void)
     SystemInit(); /* Initialize the system clock (default: 100 MHz) */
     configure_port(); /* Configure the GPIO ports */
     configure_adc(); /* Configure the ADC */
-    configure_timer_and_match(); /* Configure Timer0 */
+    if (configure_dma() != SUCCESS) /* Configure the GPDMA */
+    {
+        while (TRUE)
+        {
+            __WFI(); /* No DMA channel: no readings */
+        }
+    }
+    configure_timer_and_match(); /* Configure Timer0 and Timer1 */
+    configure_classifier(); /* Configure the LED ranges */
     start_timer(); /* Start Timer0 */
 
     while (TRUE)
     {
-        /* Wait for interrupts */
+        __WFI(); /* Wait for interrupts */
     }
 
     return 0; /* Program should never reach this point */
@@ -1,19 +1,25 @@
 /*
  * @file main.c
- * @brief Timer0 Example
+ * @brief Measures the duty cycle of a PWM signal with the capture inputs of Timer1
  *
- * This example demonstrates the use of Timer0 to toggle four LEDs at different frequencies using match interrupts.
- * It also explains the timer resolution and the maximum time the timer can count before overflowing.
+ * The PWM signal is wired to both P1.18 (CAP1.0) and P1.19 (CAP1.1): CR0 captures its rising edges and CR1 its falling
+ * edges. The capture interrupt only stores the timestamps of the edges in the ring of lpc17xx_pulse.h, the TC being
+ * extended to 64 bits with MR3. Every 100 ms the main loop asks for the duty cycle averaged over the last 10 periods,
+ * computed in Q16 fixed point from the ring, and shows it on four LEDs (P0.20 to P0.23) as a bar: one LED per 25 %.
+ * The LEDs are off when no period ended during the last 100 ms.
  *
- * Timer Resolution:
- *   - Prescaler = 0, Clock = 100 MHz: Timer Resolution = 10 ns
- *   - Prescaler = 100, Clock = 100 MHz: Timer Resolution = 1.01 µs
+ * A tachometer giving one pulse per revolution is wired to both P0.4 (CAP2.0) and P1.26 (CAP0.0). Timer2 counts its
+ * rising edges in counter mode and Timer0 timestamps the last one, with no interrupt per edge: Timer0 interrupts once
+ * per 100 ms window only (lpc17xx_freqcnt.h). The main loop converts the frequency of the last window to revolutions
+ * per minute, with the half width of its confidence window, into two variables to watch with the debugger.
  *
- * Maximum Time before Overflow:
- *   - Prescaler = 0: Maximum Time = 429.5 seconds (approx. 7 minutes 9.5 seconds)
- *   - Prescaler = 100: Maximum Time = 71.58 minutes (approx. 1 hour 11 minutes)
+ * Timer Resolution:
+ *   - Prescaler = 1, PCLK = CCLK = 100 MHz: Timer Resolution = 10 ns
+ *   - Timer2 in counter mode, PCLK = CCLK = 100 MHz: up to 50 MHz on CAP2.0
  *
- * In this example, we configure Timer0 to toggle four LEDs (P0.20 to P0.23) at different frequencies.
+ * The previous version computed the period in the interrupt handler with a floating point multiply, on the rising
+ * edges only. The handler now reads and writes a few registers per edge, without division, so signals of tens of kHz
+ * are measured without missing edges.
  */
 
 #ifdef __USE_CMSIS
@@ -24,9 +30,12 @@
 #include <cr_section_macros.h> /* MCUXpresso-specific macros */
 #endif
 
-#include "lpc17xx_gpio.h"   /* GPIO */
-#include "lpc17xx_pinsel.h" /* Pin Configuration */
-#include "lpc17xx_timer.h"  /* Timer0 */
+#include "lpc17xx_freqcnt.h" /* Gated frequency counter */
+#include "lpc17xx_gpio.h"    /* GPIO */
+#include "lpc17xx_pinsel.h"  /* Pin Configuration */
+#include "lpc17xx_pulse.h"   /* Capture based pulse measurement */
+#include "lpc17xx_systime.h" /* Tickless time base */
+#include "lpc17xx_timer.h"   /* Counter input selection */
 
 /* Pin Definitions */
 #define LED0 ((uint32_t)(1 << 20)) // P0.20
@@ -34,65 +43,33 @@
 #define LED2 ((uint32_t)(1 << 22)) // P0.22
 #define LED3 ((uint32_t)(1 << 23)) // P0.23
 
-/* Frequency Definitions for LEDs */
-#define FREQ_LED0 2    // LED0 frequency in Hz (2 Hz)
-#define FREQ_LED1 1    // LED1 frequency in Hz (1 Hz)
-#define FREQ_LED2 0.5  // LED2 frequency in Hz (0.5 Hz)
-#define FREQ_LED3 0.25 // LED3 frequency in Hz (0.25 Hz)
+#define LEDS (LED0 | LED1 | LED2 | LED3)
 
-#define PRESCALE 100 // Prescaler value for 100 MHz clock, 1 µs resolution
+#define PRESCALE     1   // CPU clock cycles per timer tick: 10 ns at 100 MHz
+#define OVERFLOW_MR  3   // Match register extending the TC of Timer1 to 64 bits
+#define PERIODS      10  // Periods averaged by each measurement
+#define REFRESH_TIME 100 // Time between two measurements, in milliseconds
+#define GATE_MR      0   // Match register of Timer0 ending the windows of the tachometer
+#define GATE_CAP     0   // Capture channel of Timer0 wired to the tachometer
+#define PULSES_REV   1   // Tachometer pulses per revolution
 
 #define OUTPUT 1 // GPIO direction for output
 #define INPUT  0 // GPIO direction for input
 
-/* Half Period for Timer Match (assuming prescaler value gives 1µs resolution) */
-#define HALF_PERIOD 500000 // Half period for toggling, derived from timer clock
+/* Tachometer speed and half width of its confidence window, in revolutions per minute: watch with the debugger */
+volatile uint32_t speed_rpm = 0;
+volatile uint32_t speed_error_rpm = 0;
 
 /* Function Prototypes */
-void configure_timer_and_match(void);
 void configure_port(void);
-void start_timer(void);
-
-/**
- * @brief Configure Timer0 and match channels for toggling LEDs at different frequencies.
- */
-void configure_timer_and_match(void)
-{
-    TIM_TIMERCFG_Type timer_cfg_struct;
-    TIM_MATCHCFG_Type match_cfg_struct;
-
-    // Configure Timer0 in microsecond mode with a prescaler
-    timer_cfg_struct.PrescaleOption = TIM_PRESCALE_USVAL; // Prescaler in microseconds
-    timer_cfg_struct.PrescaleValue = PRESCALE;            // Prescaler for 100 MHz clock -> 1 µs resolution
-    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &timer_cfg_struct);
-
-    // Configure match channel for LED0 (2 Hz toggle rate)
-    match_cfg_struct.MatchChannel = 0;
-    match_cfg_struct.IntOnMatch = ENABLE;
-    match_cfg_struct.StopOnMatch = DISABLE;
-    match_cfg_struct.ResetOnMatch = ENABLE;
-    match_cfg_struct.ExtMatchOutputType = TIM_EXTMATCH_TOGGLE;
-    match_cfg_struct.MatchValue = (uint32_t)(HALF_PERIOD / FREQ_LED0); // Half period for toggle
-    TIM_ConfigMatch(LPC_TIM0, &match_cfg_struct);
-
-    // Configure match channel for LED1 (1 Hz toggle rate)
-    match_cfg_struct.MatchChannel = 1;
-    match_cfg_struct.MatchValue = (uint32_t)(HALF_PERIOD / FREQ_LED1);
-    TIM_ConfigMatch(LPC_TIM0, &match_cfg_struct);
-
-    // Configure match channel for LED2 (0.5 Hz toggle rate)
-    match_cfg_struct.MatchChannel = 2;
-    match_cfg_struct.MatchValue = (uint32_t)(HALF_PERIOD / FREQ_LED2);
-    TIM_ConfigMatch(LPC_TIM0, &match_cfg_struct);
-
-    // Configure match channel for LED3 (0.25 Hz toggle rate)
-    match_cfg_struct.MatchChannel = 3;
-    match_cfg_struct.MatchValue = (uint32_t)(HALF_PERIOD / FREQ_LED3);
-    TIM_ConfigMatch(LPC_TIM0, &match_cfg_struct);
-}
+void configure_capture(void);
+void configure_tachometer(void);
+void show_duty(uint32_t duty);
+void update_speed(void);
 
 /**
- * @brief Configure GPIO for LEDs on pins P0.20 to P0.23.
+ * @brief Configure P0.20 to P0.23 as GPIO outputs for the LEDs, P1.18 and P1.19 as CAP1.0 and CAP1.1, and P0.4 and
+ * P1.26 as CAP2.0 and CAP0.0.
  */
 void configure_port(void)
 {
@@ -116,113 +93,134 @@ void configure_port(void)
     PINSEL_ConfigPin(&pin_cfg_struct);
 
     // Set P0.20 to P0.23 as output for LEDs
-    GPIO_SetDir(PINSEL_PORT_0, LED0 | LED1 | LED2 | LED3, OUTPUT);
+    GPIO_SetDir(PINSEL_PORT_0, LEDS, OUTPUT);
+    GPIO_ClearValue(PINSEL_PORT_0, LEDS);
+
+    // P1.18 as CAP1.0 (rising edges) and P1.19 as CAP1.1 (falling edges), both driven by the signal
+    pin_cfg_struct.Portnum = PINSEL_PORT_1;
+    pin_cfg_struct.Pinnum = PINSEL_PIN_18;
+    pin_cfg_struct.Funcnum = PINSEL_FUNC_3;
+    pin_cfg_struct.Pinmode = PINSEL_PINMODE_TRISTATE; // The signal drives the pins
+    PINSEL_ConfigPin(&pin_cfg_struct);
+
+    pin_cfg_struct.Pinnum = PINSEL_PIN_19;
+    PINSEL_ConfigPin(&pin_cfg_struct);
+
+    // P1.26 as CAP0.0 and P0.4 as CAP2.0, both driven by the tachometer
+    pin_cfg_struct.Pinnum = PINSEL_PIN_26;
+    PINSEL_ConfigPin(&pin_cfg_struct);
+
+    pin_cfg_struct.Portnum = PINSEL_PORT_0;
+    pin_cfg_struct.Pinnum = PINSEL_PIN_4;
+    PINSEL_ConfigPin(&pin_cfg_struct);
 }
 
 /**
- * @brief Start Timer0.
+ * @brief Start Timer1 on the CPU clock, capturing both edges of the signal.
  */
-void start_timer(void)
+void configure_capture(void)
 {
-    // Start Timer0
-    TIM_Cmd(LPC_TIM0, ENABLE);
+    PULSE_Init(LPC_TIM1, OVERFLOW_MR, PRESCALE);
+}
 
-    // Enable Timer0 interrupt
-    NVIC_EnableIRQ(TIMER0_IRQn);
+/**
+ * @brief Count the tachometer pulses with Timer2, in windows of REFRESH_TIME ended by Timer0.
+ */
+void configure_tachometer(void)
+{
+    FREQCNT_CFG_Type freqcnt_cfg;
+
+    freqcnt_cfg.CounterTIM = LPC_TIM2;
+    freqcnt_cfg.CounterInput = TIM_COUNTER_INCAP0; // CAP2.0
+    freqcnt_cfg.GateTIM = LPC_TIM0;
+    freqcnt_cfg.GateCapture = GATE_CAP; // CAP0.0
+    freqcnt_cfg.GateMatch = GATE_MR;
+    freqcnt_cfg.WindowUs = REFRESH_TIME * 1000;
+    FREQCNT_Init(&freqcnt_cfg);
 }
 
 /**
- * @brief Timer0 interrupt handler to toggle LEDs.
+ * @brief Timer0 interrupt handler: ends a window of the tachometer.
  */
 void TIMER0_IRQHandler(void)
 {
-    // Check and clear match interrupt for each channel
-
-    if (TIM_GetIntStatus(LPC_TIM0, TIM_MR0_INT))
-    {
-        TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
-        GPIO_SetValue(PINSEL_PORT_0, LED0); // Toggle LED0
-    }
-    if (TIM_GetIntStatus(LPC_TIM0, TIM_MR1_INT))
-    {
-        TIM_ClearIntPending(LPC_TIM0, TIM_MR1_INT);
-        GPIO_SetValue(PINSEL_PORT_0, LED1); // Toggle LED1
-    }
-    if (TIM_GetIntStatus(LPC_TIM0, TIM_MR2_INT))
-    {
-        TIM_ClearIntPending(LPC_TIM0, TIM_MR2_INT);
-        GPIO_SetValue(PINSEL_PORT_0, LED2); // Toggle LED2
-    }
-    if (TIM_GetIntStatus(LPC_TIM0, TIM_MR3_INT))
-    {
-        TIM_ClearIntPending(LPC_TIM0, TIM_MR3_INT);
-        GPIO_SetValue(PINSEL_PORT_0, LED3); // Toggle LED3
-    }
+    FREQCNT_IntHandler();
 }
 
-int main(void)
+/**
+ * @brief Timer1 interrupt handler: stores the captured edges.
+ */
+void TIMER1_IRQHandler(void)
 {
-    SystemInit(); // Initialize system clock
-
-    configure_port();            // Configure GPIO for LEDs
-    configure_timer_and_match(); // Configure Timer0 and match channels
-
-    start_timer(); // Start Timer0
-
-    while (TRUE)
-    {
-        // Infinite loop
-    }
+    PULSE_IntHandler();
+}
 
-    return 0; // This line should never be reached
+// Overwrite the interrupt handler routine for SysTick
+void SysTick_Handler(void)
+{
+    SYSTIME_IntHandler(); /* Count the elapsed period and write the next reload value */
 }
 
 /**
- * @brief Configure Timer1 for capture event on P1.18 (CAP1.0).
+ * @brief Light one LED per 25 % of duty cycle, rounded to the nearest LED.
+ * @param duty Duty cycle, Q16: PULSE_Q16_ONE is 100 %.
  */
-void configTimer1(void)
+void show_duty(uint32_t duty)
 {
-    // P1.18 as CAP1.0
-    PINSEL_CFG_Type pinCfg;
-    pinCfg.Portnum = PINSEL_PORT_1;
-    pinCfg.Pinnum = PINSEL_PIN_18;
-    pinCfg.Funcnum = PINSEL_FUNC_3;
-    pinCfg.Pinmode = PINSEL_PINMODE_NORMAL;
-    PINSEL_ConfigPin(&pinCfg);
-
-    // Timer1 Configuration
-    TIM_TIMERCFG_Type timCfg;
-    timCfg.PrescaleOption = TIM_PRESCALE_TICKVAL;
-    timCfg.PrescaleValue = PRESCALE;
-
-    // CAP1.0 Configuration for rising edge capture
-    TIM_CAPTURECFG_Type capCfg;
-    capCfg.CaptureChannel = 0;
-    capCfg.FallingEdge = DISABLE;
-    capCfg.IntOnCaption = ENABLE;
-    capCfg.RisingEdge = ENABLE;
-
-    // Initialize Timer1 in timer mode
-    TIM_Init(LPC_TIM1, TIM_TIMER_MODE, &timCfg);
-    TIM_ConfigCapture(LPC_TIM1, &capCfg);
-    TIM_Cmd(LPC_TIM1, ENABLE);
-
-    // Enable Timer1 interrupt
-    NVIC_EnableIRQ(TIMER1_IRQn);
+    static const uint32_t bar[5] = {0, LED0, LED0 | LED1, LED0 | LED1 | LED2, LEDS};
+    uint32_t leds = (duty * 4 + PULSE_Q16_ONE / 2) / PULSE_Q16_ONE;
+
+    leds = (leds > 4) ? 4 : leds;
+    GPIO_ClearValue(PINSEL_PORT_0, LEDS & ~bar[leds]);
+    GPIO_SetValue(PINSEL_PORT_0, bar[leds]);
 }
 
 /**
- * @brief Timer1 interrupt handler for capture event.
+ * @brief Convert the frequency of the last window of the tachometer to revolutions per minute.
  */
-void TIMER1_IRQHandler(void)
+void update_speed(void)
 {
-    TIM_ClearIntPending(LPC_TIM1, TIM_CR0_INT); // Clear capture interrupt
+    FREQCNT_Result_Type tach;
 
-    static uint32_t oldCount = 0;
-    uint32_t count = TIM_GetCaptureValue(LPC_TIM1, TIM_COUNTER_INCAP1);
+    if (FREQCNT_Read(&tach) == SUCCESS)
+    {
+        speed_rpm = (uint32_t)((tach.FrequencyHz * 60 / PULSES_REV + FREQCNT_Q16_ONE / 2) / FREQCNT_Q16_ONE);
+        speed_error_rpm = (uint32_t)((tach.ErrorHz * 60 / PULSES_REV + FREQCNT_Q16_ONE - 1) / FREQCNT_Q16_ONE);
+    }
+}
+
+int main(void)
+{
+    PULSE_Result_Type pwm;
+    uint64_t deadline;
+    uint64_t timeout;
+
+    SystemInit(); // Initialize system clock
 
-    // Calculate period in microseconds
-    uint32_t period = (count - oldCount) * 0.05; // Assuming 20 MHz clock (50 ns resolution)
-    oldCount = count;                            // Update old count
-    // We can use the period value here
+    configure_port();    // Configure GPIO for LEDs and the capture inputs
+    configure_capture(); // Start Timer1 capturing both edges
+    configure_tachometer(); // Start Timer2 counting the tachometer pulses, gated by Timer0
+    SYSTIME_Init();      // Time base of the main loop
+
+    timeout = (uint64_t)PULSE_GetTickHz() * REFRESH_TIME / 1000;
+    deadline = SYSTIME_Now();
+
+    while (TRUE)
+    {
+        deadline += SYSTIME_MS(REFRESH_TIME);
+        SYSTIME_SleepUntil(deadline); // The capture interrupts run meanwhile
+
+        if ((PULSE_Measure(PERIODS, &pwm) == SUCCESS) && (PULSE_Now() - pwm.LastEdge < timeout))
+        {
+            show_duty(pwm.Duty);
+        }
+        else
+        {
+            show_duty(0); // Fewer than PERIODS periods yet, or no signal
+        }
+
+        update_speed();
+    }
+
+    return 0; // This line should never be reached
 }
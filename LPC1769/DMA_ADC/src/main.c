@@ -1,6 +1,6 @@
 /*
  * @file main.c
- * @brief Timer0, ADC, and DMA example for LPC1769
+ * @brief ADC and ping-pong DMA example for LPC1769
  *
  * A traditional wood-fired oven is monitored using an analog temperature sensor.
  * The temperature inside the oven is displayed using three LEDs:
@@ -8,205 +8,226 @@
  * - Yellow: Less than 50 degrees
  * - Red: Greater than 70 degrees
  *
- * This program uses Timer0 to trigger periodic ADC conversions every 60 seconds.
- * DMA is used to transfer ADC conversion data to a memory buffer automatically.
- * The temperature sensor is connected to ADC channel 7 (P0.2), and the ADC is configured
- * with a 12-bit resolution. DMA transfers the data to a buffer and the average reading is used to control LEDs.
+ * The temperature sensor is connected to ADC channel 7 (P0.2). The ADC converts continuously in burst mode at its
+ * maximum rate, and the DMA moves every result to memory through two linked list items that alternate between two
+ * buffers (ping-pong). While the DMA fills one buffer, the main loop filters the other one, so the sampling never
+ * stops and the CPU only reads buffers the DMA has completed. The terminal count interrupt of each buffer hands it to
+ * the main loop and counts the buffers the main loop was too slow to release.
+ *
+ * The filter oversamples and decimates: each sample is added once to a running sum, and every 16 samples give a
+ * 14-bit reading, without a division. The last reading of each buffer is converted to tenths of a degree through a
+ * fixed-point table (10 mV per degree), then goes through a threshold classifier: the LEDs are only written when the
+ * temperature moves to another band, by more than a hysteresis and for several buffers in a row, so they do not
+ * flicker near a threshold.
  */
 
 #include "LPC17xx.h"
 #include "lpc17xx_adc.h"
+#include "lpc17xx_classify.h"
+#include "lpc17xx_filter.h"
 #include "lpc17xx_gpdma.h"
 #include "lpc17xx_gpio.h"
 #include "lpc17xx_pinsel.h"
-#include "lpc17xx_timer.h"
+#include "sensor_lut.h"
 
 /* Pin Definitions */
 #define GREEN_LED     ((uint32_t)(1 << 20)) /* P0.20 connected to LED */
 #define YELLOW_LED    ((uint32_t)(1 << 21)) /* P0.21 connected to LED */
 #define RED_LED       ((uint32_t)(1 << 22)) /* P0.22 connected to LED */
+#define ALL_LEDS      (GREEN_LED | YELLOW_LED | RED_LED)
 #define ADC_INPUT_PIN ((uint32_t)(1 << 2))  /* P0.2 connected to ADC channel 7 */
 
 /* Temperature Thresholds */
-#define GREEN_TMP  30
-#define YELLOW_TMP 50
-#define RED_TMP 70
-
-/* Timer and ADC settings */
-#define SECOND          10000
-#define ADC_FREQ        100000        /* 100 kHz */
+#define GREEN_TMP      300 /* 30.0 degrees */
+#define YELLOW_TMP     500 /* 50.0 degrees */
+#define RED_TMP        700 /* 70.0 degrees */
+#define TMP_HYSTERESIS 20  /* Temperatures must pass a threshold by 2 degrees to change the LEDs */
+#define TMP_DEBOUNCE   4   /* Buffers in a row in the new band before the LEDs change, 4 ms */
+#define LED_INPUT      0   /* Classifier input of the readings */
+
+/* Transfer function of the sensor, in tenths of a degree: 10 mV per degree, 3.3 V reference */
+#define SENSOR_DECIDEGREES(code) ((int32_t)((code) * 3300.0 / 4096.0 + 0.5))
+
+/* ADC and DMA settings */
+#define ADC_FREQ        200000        /* 200 kHz requested, 192 kHz with a 25 MHz PCLK (12.5 MHz ADC clock) */
 #define ADC_CHANNEL     ADC_CHANNEL_7 /* Using ADC channel 7 */
-#define DMA_BUFFER_SIZE 16            /* Buffer size for averaging */
+#define DMA_BUFFER_SIZE 200           /* Samples per buffer, about 1 ms of signal */
+#define ADC_EXTRA_BITS  2             /* Oversampling by 16, 14-bit readings at 12 kHz */
+
+/* Control word of each linked list item: ADGDR words to memory, terminal count interrupt at the end of the buffer */
+#define ADC_DMA_CONTROL                                                                                                \
+    (GPDMA_DMACCxControl_TransferSize(DMA_BUFFER_SIZE) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |                \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_DI | GPDMA_DMACCxControl_I)
 
 #define OUTPUT 1 // GPIO direction for output
 
 /* Global Variables */
-static uint16_t adc_dma_buffer[DMA_BUFFER_SIZE]; /* Buffer to store ADC results */
-static uint32_t adc_avg_value = 0;
+static uint32_t adc_dma_buffer[2][DMA_BUFFER_SIZE]; /* ADGDR words, filled alternately by the DMA */
+static GPDMA_LLI_Type adc_dma_lli[2];               /* Each item reloads the channel for the other buffer */
+
+static FILTER_Decimate_Type adc_filter;                                       /* Results dropped for OVERRUN counted */
+static uint16_t adc_readings[(DMA_BUFFER_SIZE >> (2 * ADC_EXTRA_BITS)) + 1]; /* Readings of the last buffer */
+static uint16_t adc_avg_value = 0;                                            /* Last reading, 14 bits */
+
+/* Sensor table, computed by the compiler, and calibration of the board (14-bit reading offset, temperature offset) */
+static const int32_t sensor_table[SENSOR_TABLE_POINTS] = SENSOR_TABLE(SENSOR_DECIDEGREES);
+static SENSOR_Type oven_sensor = {sensor_table, ADC_EXTRA_BITS, 0, 0};
+
+/* LED of each temperature band, in tenths of a degree: green up to GREEN_TMP, yellow up to YELLOW_TMP, red above */
+static const uint16_t led_thresholds[] = {GREEN_TMP + 1, YELLOW_TMP + 1};
+static const uint32_t led_pins[] = {GREEN_LED, YELLOW_LED, RED_LED};
+static const CLASSIFY_Table_Type led_bands = {led_thresholds, led_pins, 3, PINSEL_PORT_0, TMP_HYSTERESIS, TMP_DEBOUNCE};
+
+/* Hand-off between the DMA interrupt and the main loop. adc_ready holds the number of buffers completed (shifted left
+ * by one) and the index of the last one (bit 0), in a single word so the main loop reads both at once. */
+static volatile uint32_t adc_ready = 0;
+static volatile uint32_t adc_consumed = 0;        /* Buffers released by the main loop */
+static volatile uint32_t adc_buffer_overruns = 0; /* Buffers rewritten by the DMA while the main loop still held them */
 
 /* Function declarations */
 void configure_port(void);
 void configure_adc(void);
-void dma_setup(void);
-void configure_timer_and_match(void);
-void start_timer(void);
-void turn_on_led(uint16_t avg_adc_value);
-uint16_t average_adc_buffer(void);
+Status dma_setup(void);
+void configure_filter(void);
+void configure_classifier(void);
+void dma_buffer_done(uint32_t channel, void* arg);
+uint16_t filter_adc_buffer(const uint32_t* samples);
 
 /**
- * @brief Configure the GPIO pins for the LEDs.
+ * @brief Configure the GPIO pins for the LEDs and the ADC input.
  */
 void configure_port(void)
 {
-    PINSEL_CFG_Type pin_cfg_struct;
-
-    /* Configure P0.20, P0.21, and P0.22 as GPIO for LED outputs */
-    pin_cfg_struct.Portnum = PINSEL_PORT_0;
-    pin_cfg_struct.Funcnum = PINSEL_FUNC_0;           /* GPIO function */
-    pin_cfg_struct.Pinmode = PINSEL_PINMODE_PULLUP;   /* Pin mode is pull-up */
-    pin_cfg_struct.OpenDrain = PINSEL_PINMODE_NORMAL; /* Normal mode */
-
-    /* Configure green LED (P0.20) */
-    pin_cfg_struct.Pinnum = PINSEL_PIN_20;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    static const PINSEL_CFG_Type pins[] = {
+        {PINSEL_PORT_0, PINSEL_PIN_20, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},  /* Green LED */
+        {PINSEL_PORT_0, PINSEL_PIN_21, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},  /* Yellow LED */
+        {PINSEL_PORT_0, PINSEL_PIN_22, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},  /* Red LED */
+        {PINSEL_PORT_0, PINSEL_PIN_2, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL}, /* AD0.7 */
+    };
 
-    /* Configure yellow LED (P0.21) */
-    pin_cfg_struct.Pinnum = PINSEL_PIN_21;
-    PINSEL_ConfigPin(&pin_cfg_struct);
-
-    /* Configure red LED (P0.22) */
-    pin_cfg_struct.Pinnum = PINSEL_PIN_22;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    PINSEL_ConfigPins(pins, sizeof(pins) / sizeof(pins[0]));
 
     /* Set all LED pins as output */
     GPIO_SetDir(PINSEL_PORT_0, GREEN_LED | YELLOW_LED | RED_LED, OUTPUT);
 }
 
 /**
- * @brief Configure ADC to sample from channel 7 (P0.2) using DMA.
+ * @brief Configure ADC to sample channel 7 (P0.2) for the DMA.
+ * @note The DMA request of the ADC is the interrupt flag of the channel: ADINTEN7 is set, the global DONE interrupt
+ *       (not allowed in burst mode) is cleared, and the ADC interrupt stays disabled in the NVIC.
  */
 void configure_adc(void)
 {
-    /* Initialize ADC */
-    ADC_Init(LPC_ADC, ADC_FREQ);                  /* Initialize the ADC at 100 kHz */
-    ADC_ChannelCmd(LPC_ADC, ADC_CHANNEL, ENABLE); /* Enable ADC channel 7 */
-    ADC_BurstCmd(LPC_ADC, DISABLE);               /* Disable burst mode (timer-triggered) */
-    ADC_DMACmd(LPC_ADC, ENABLE);                  /* Enable DMA for ADC */
+    ADC_Init(LPC_ADC, ADC_FREQ);                   /* Initialize the ADC at its maximum rate */
+    ADC_ChannelCmd(LPC_ADC, ADC_CHANNEL, ENABLE);  /* Enable ADC channel 7 */
+    ADC_IntConfig(LPC_ADC, ADC_ADGINTEN, DISABLE); /* No global DONE request in burst mode */
+    ADC_IntConfig(LPC_ADC, ADC_ADINTEN7, ENABLE);  /* Channel 7 result requests a DMA transfer */
 }
 
 /**
- * @brief Configure DMA to transfer ADC conversion data to memory buffer.
+ * @brief Configure the oversample-and-decimate filter of the samples.
  */
-void dma_setup(void)
+void configure_filter(void)
 {
-    /* Initialize the DMA controller */
-    GPDMA_Init();
-
-    /* Configure DMA for ADC transfers */
-    GPDMA_Channel_CFG_Type dma_config;
-    dma_config.ChannelNum = 0;
-    dma_config.SrcMemAddr = 0;                        /* Source is peripheral (ADC) */
-    dma_config.DstMemAddr = (uint32_t)adc_dma_buffer; /* Destination is memory buffer */
-    dma_config.TransferSize = DMA_BUFFER_SIZE;        /* Number of transfers */
-    dma_config.TransferWidth = 0;                     /* Width is not used for ADC */
-    dma_config.TransferType = GPDMA_TRANSFERTYPE_P2M; /* Peripheral to memory */
-    dma_config.SrcConn = GPDMA_CONN_ADC;              /* ADC is the source */
-    dma_config.DstConn = 0;                           /* Memory as destination */
-    dma_config.DMALLI = 0;                            /* No linked list */
-
-    GPDMA_Setup(&dma_config); /* Setup the DMA transfer */
-
-    /* Enable DMA channel */
-    GPDMA_ChannelCmd(0, ENABLE);
+    FILTER_DecimateInit(&adc_filter, ADC_EXTRA_BITS); /* 4^2 samples per reading */
 }
 
 /**
- * @brief Configure Timer0 to trigger ADC conversion every 60 seconds.
+ * @brief Configure the classifier that drives the LEDs from the readings.
+ * @note The first reading lights its LED, then the LEDs only change with the band of the readings.
  */
-void configure_timer_and_match(void)
+void configure_classifier(void)
 {
-    /* Timer0 Configuration */
-    TIM_TIMERCFG_Type timer_cfg;
-    timer_cfg.PrescaleOption = TIM_PRESCALE_USVAL;
-    timer_cfg.PrescaleValue = 100; /* 1 µs resolution */
-
-    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &timer_cfg);
-
-    /* Match Configuration (every 60 seconds) */
-    TIM_MATCHCFG_Type match_cfg;
-    match_cfg.MatchChannel = 0;
-    match_cfg.IntOnMatch = ENABLE;
-    match_cfg.ResetOnMatch = ENABLE;
-    match_cfg.StopOnMatch = DISABLE;
-    match_cfg.ExtMatchOutputType = TIM_EXTMATCH_NOTHING;
-    match_cfg.MatchValue = SECOND * 60; /* 60 seconds */
-
-    TIM_ConfigMatch(LPC_TIM0, &match_cfg);
-
-    NVIC_EnableIRQ(TIMER0_IRQn); /* Enable Timer0 interrupt */
+    CLASSIFY_Init(NULL, NULL);                /* No callback, the classifier drives the LEDs itself */
+    CLASSIFY_SetTable(LED_INPUT, &led_bands); /* May be replaced at any time by another table */
 }
 
 /**
- * @brief Start Timer0.
+ * @brief Configure DMA to move the ADC results into the two buffers, alternately and forever.
+ * @note The channel starts on buffer 0 with item 1 as next item: item 1 fills buffer 1 and links to item 0, which
+ *       fills buffer 0 and links back to item 1.
+ * @return SUCCESS, or ERROR when no GPDMA channel is free.
  */
-void start_timer(void)
+Status dma_setup(void)
 {
-    TIM_Cmd(LPC_TIM0, ENABLE); /* Start Timer0 */
-}
+    GPDMA_Channel_CFG_Type dma_config;
+    int32_t channel;
 
-/**
- * @brief Turn on the appropriate LED based on the average ADC value.
- * @param avg_adc_value The averaged ADC value (temperature reading).
- */
-void turn_on_led(uint16_t avg_adc_value)
-{
-    if (avg_adc_value <= GREEN_TMP)
+    for (uint32_t i = 0; i < 2; i++)
     {
-        GPIO_SetValue(PINSEL_PORT_0, GREEN_LED);              /* Green LED on */
-        GPIO_ClearValue(PINSEL_PORT_0, YELLOW_LED | RED_LED); /* Other LEDs off */
+        adc_dma_lli[i].SrcAddr = (uint32_t)&LPC_ADC->ADGDR;
+        adc_dma_lli[i].DstAddr = (uint32_t)adc_dma_buffer[i];
+        adc_dma_lli[i].NextLLI = (uint32_t)&adc_dma_lli[i ^ 1];
+        adc_dma_lli[i].Control = ADC_DMA_CONTROL;
     }
-    else if (avg_adc_value <= YELLOW_TMP)
-    {
-        GPIO_SetValue(PINSEL_PORT_0, YELLOW_LED);            /* Yellow LED on */
-        GPIO_ClearValue(PINSEL_PORT_0, GREEN_LED | RED_LED); /* Other LEDs off */
-    }
-    else
+
+    /* Initialize the DMA controller */
+    GPDMA_Init();
+
+    /* Configure DMA for ADC transfers, on a high priority channel so no result waits */
+    channel = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    if (channel < 0)
     {
-        GPIO_SetValue(PINSEL_PORT_0, RED_LED);                  /* Red LED on */
-        GPIO_ClearValue(PINSEL_PORT_0, GREEN_LED | YELLOW_LED); /* Other LEDs off */
+        return ERROR; /* All the channels are taken */
     }
+    dma_config.ChannelNum = (uint8_t)channel;
+    dma_config.SrcMemAddr = 0;                           /* Source is peripheral (ADC) */
+    dma_config.DstMemAddr = (uint32_t)adc_dma_buffer[0]; /* First buffer */
+    dma_config.TransferSize = DMA_BUFFER_SIZE;           /* Number of transfers */
+    dma_config.TransferWidth = 0;                        /* Width is not used for ADC */
+    dma_config.TransferType = GPDMA_TRANSFERTYPE_P2M;    /* Peripheral to memory */
+    dma_config.SrcConn = GPDMA_CONN_ADC;                 /* ADC is the source */
+    dma_config.DstConn = 0;                              /* Memory as destination */
+    dma_config.DMALLI = (uint32_t)&adc_dma_lli[1];       /* Then buffer 1, then buffer 0 again */
+
+    NVIC_EnableIRQ(DMA_IRQn);                                      /* Completion interrupt, served by GPDMA_IntHandler() */
+    return GPDMA_Submit(&dma_config, dma_buffer_done, NULL, NULL); /* Setup and start the DMA transfers */
 }
 
 /**
- * @brief Calculate the average value from the ADC buffer.
- * @return The averaged ADC value.
+ * @brief DMA terminal count callback, a buffer holds DMA_BUFFER_SIZE new samples.
+ * @note The completed buffer is the one the channel is not writing now. It is found from the destination address
+ *       rather than by alternation, so it stays right when the interrupt is served after two terminal counts.
  */
-uint16_t average_adc_buffer(void)
+void dma_buffer_done(uint32_t channel, void* arg)
 {
-    uint32_t sum = 0;
-    for (uint32_t i = 0; i < DMA_BUFFER_SIZE; i++)
+    LPC_GPDMACH_TypeDef* dma_channel = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + (channel << 5));
+    uint32_t dst = dma_channel->DMACCDestAddr;
+    uint32_t writing = (dst - (uint32_t)adc_dma_buffer[1] < sizeof(adc_dma_buffer[1])) ? 1 : 0;
+    uint32_t count = (adc_ready >> 1) + 1;
+
+    /* The DMA now writes the buffer completed before this one: the main loop must have released it */
+    if (adc_consumed != count - 1)
     {
-        sum += adc_dma_buffer[i];
+        adc_buffer_overruns++;
     }
-    return (uint16_t)(sum / DMA_BUFFER_SIZE);
+    adc_ready = (count << 1) | (writing ^ 1);
 }
 
 /**
- * @brief Timer0 Interrupt Handler.
- *        Reads the ADC data via DMA and updates the LEDs.
+ * @brief DMA Interrupt Handler, dispatches the completion of each channel to its callback.
  */
-void TIMER0_IRQHandler(void)
+void DMA_IRQHandler(void)
 {
-    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT); /* Clear the interrupt flag */
-
-    /* Average the ADC buffer */
-    adc_avg_value = average_adc_buffer();
+    GPDMA_IntHandler();
+}
 
-    /* Update LEDs based on the average temperature */
-    turn_on_led(adc_avg_value);
+/**
+ * @brief Filter a completed buffer.
+ * @param samples The DMA_BUFFER_SIZE ADGDR words of the buffer.
+ * @return The last reading, 14 bits.
+ * @note Each sample is read once. The readings span buffers: the samples left over at the end of a buffer start the
+ *       first reading of the next one.
+ */
+uint16_t filter_adc_buffer(const uint32_t* samples)
+{
+    uint32_t count = FILTER_DecimateBlock(&adc_filter, samples, DMA_BUFFER_SIZE, adc_readings);
 
-    /* Restart the DMA transfer for the next buffer */
-    GPDMA_ChannelCmd(0, ENABLE);
+    if (count != 0)
+    {
+        adc_avg_value = adc_readings[count - 1];
+    }
+    return adc_avg_value;
 }
 
 /**
@@ -214,17 +235,44 @@ void TIMER0_IRQHandler(void)
  */
 int main(void)
 {
-    SystemInit();                /* Initialize system clock */
-    configure_port();            /* Configure GPIO ports */
-    configure_adc();             /* Configure ADC */
-    dma_setup();                 /* Set up DMA for ADC */
-    configure_timer_and_match(); /* Configure Timer0 */
-    start_timer();               /* Start Timer0 */
+    SystemInit();           /* Initialize system clock */
+    configure_port();       /* Configure GPIO ports */
+    configure_adc();        /* Configure ADC */
+    configure_filter();     /* Configure the sample filter */
+    configure_classifier(); /* Configure the LED bands */
+    if (dma_setup() != SUCCESS) /* Set up DMA for ADC */
+    {
+        while (1)
+        {
+            __WFI(); /* No DMA channel: nothing to sample */
+        }
+    }
+
+    ADC_BurstCmd(LPC_ADC, ENABLE); /* Start the continuous conversions */
 
     while (1)
     {
-        __wfi(); /* Wait for interrupt */
+        uint32_t ready;
+
+        /* Test and sleep with the interrupts masked: a buffer completed in between wakes __WFI() up, and its
+         * handler runs at __enable_irq() */
+        __disable_irq();
+        ready = adc_ready;
+        if ((ready >> 1) == adc_consumed)
+        {
+            __WFI(); /* Wait for the next buffer */
+            __enable_irq();
+            continue;
+        }
+        __enable_irq();
+
+        /* Filter the last completed buffer, the LEDs change if the last temperature is in another band */
+        int32_t temperature = SENSOR_Convert(&oven_sensor, filter_adc_buffer(adc_dma_buffer[ready & 1]));
+        CLASSIFY_Update(LED_INPUT, (temperature > 0) ? (uint16_t)temperature : 0);
+
+        /* Release the buffer, the DMA may write it again from the next terminal count on */
+        adc_consumed = ready >> 1;
     }
 
     return 0;
-}
\ No newline at end of file
+}
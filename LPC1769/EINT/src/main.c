@@ -98,7 +98,7 @@ int main(void)
 
     while (TRUE)
     {
-        /* Wait for SysTick interrupt */
+        __WFI(); /* Sleep until the next external interrupt */
     }
 
     return 0; /* Program should never reach this point */
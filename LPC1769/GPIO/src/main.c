@@ -3,6 +3,8 @@
  * @brief This project demonstrates how to configure GPIO pins in the LPC1769 using CMSIS.
  * The GPIO pins are configured as output and input, and the LED connected to P0.22 is toggled
  * based on the state of the input pin P0.0.
+ * The input is sampled every 50 ms: the delay sleeps in __WFI() on the tickless SysTick time base
+ * (lpc17xx_systime.h), where a busy loop took a time that depended on the optimization level.
  */
 
 #ifdef __USE_CMSIS
@@ -13,8 +15,9 @@
 #include <cr_section_macros.h> /* MCUXpresso-specific macros */
 #endif
 
-#include "lpc17xx_gpio.h"   /* GPIO handling */
-#include "lpc17xx_pinsel.h" /* Pin function selection */
+#include "lpc17xx_gpio.h"    /* GPIO handling */
+#include "lpc17xx_pinsel.h"  /* Pin function selection */
+#include "lpc17xx_systime.h" /* Tickless time base */
 
 /* Pin Definitions */
 #define LED_PIN   ((uint32_t)(1 << 22)) /* P0.22 connected to LED */
@@ -24,6 +27,9 @@
 #define INPUT  0
 #define OUTPUT 1
 
+/* Sampling period of the input, expressed in milliseconds */
+#define SAMPLE_TIME 50
+
 /* Boolean Values */
 #define TRUE  1
 #define FALSE 0
@@ -80,6 +86,12 @@ void configure_port(void)
     GPIO_SetDir(PINSEL_PORT_0, INPUT_PIN, INPUT); /* Set the P0.0 pin as input */
 }
 
+// Overwrite the interrupt handler routine for SysTick
+void SysTick_Handler(void)
+{
+    SYSTIME_IntHandler(); /* Count the elapsed period and write the next reload value */
+}
+
 /**
  * @brief Main function.
  * Initializes the system and toggles the LED based on the input pin state.
@@ -90,13 +102,11 @@ int main(void)
 
     configure_port(); /* Configure GPIO pins */
 
+    SYSTIME_Init(); /* Start the time base of the delays */
+
     while (TRUE)
     {
-        /* Simple delay loop */
-        for (volatile int i = 0; i < 1000000; i++) /* Use volatile to prevent optimization */
-        {
-            __asm("nop"); /* No operation */
-        }
+        SYSTIME_DelayMs(SAMPLE_TIME); /* Sleep instead of spinning */
 
         /* Toggle LED based on the input pin state */
         if (GPIO_ReadValue(PINSEL_PORT_0) & INPUT_PIN)
@@ -1,6 +1,9 @@
 /*
  * @file main.c
- * @brief
+ * @brief Toggles the LED on P0.22 every 100 ms from the main loop, and on each rising edge of P0.0
+ *
+ * The main loop sleeps in __WFI() until the next deadline of the tickless SysTick time base (lpc17xx_systime.h). The
+ * GPIO interrupt wakes it up in between, and toggles the LED at once.
  */
 
 #ifdef __USE_CMSIS
@@ -11,9 +14,10 @@
 #include <cr_section_macros.h> /* MCUXpresso-specific macros */
 #endif
 
+#include "lpc17xx_fgpio.h"   /* Fast GPIO access */
 #include "lpc17xx_gpio.h"    /* GPIO handling */
 #include "lpc17xx_pinsel.h"  /* Pin function selection */
-#include "lpc17xx_systick.h" /* SysTick handling */
+#include "lpc17xx_systime.h" /* Tickless time base */
 
 /* Pin Definitions */
 #define LED_PIN    ((uint32_t)(1 << 22)) /* P0.22 connected to LED */
@@ -24,7 +28,7 @@
 #define OUTPUT 1
 
 /* Define time variables */
-#define SYSTICK_TIME 100 /* Expressed in milliseconds */
+#define SYSTICK_TIME 100 /* Toggle period, expressed in milliseconds */
 
 /* Define edge variable */
 #define EDGE_RISING 0
@@ -33,6 +37,9 @@
 #define TRUE  1
 #define FALSE 0
 
+/* Function prototypes */
+void toggle_led(void);
+
 /**
  * @brief Initialize the GPIO peripheral
  *
@@ -66,15 +73,13 @@ void configure_port(void)
 
 void configure_systick(void)
 {
-    SYSTICK_InternalInit(SYSTICK_TIME); /* Initialize the SysTick timer with a time interval of 10 ms */
+    SYSTIME_Init(); /* Start the SysTick on the CPU clock, with its interrupt */
 }
 
 // Overwrite the interrupt handler routine for SysTick
 void SysTick_Handler(void)
 {
-    SYSTICK_ClearCounterFlag(); /* Clear interrupt flag */
-
-    toggle_led();
+    SYSTIME_IntHandler(); /* Count the elapsed period and write the next reload value */
 }
 
 // Overwrite the interrupt handle routine for GPIO
@@ -94,14 +99,7 @@ void EINT3_IRQHandler(void)
  */
 void toggle_led(void)
 {
-    if (GPIO_ReadValue(PINSEL_PORT_0) & LED_PIN)
-    {
-        GPIO_ClearValue(PINSEL_PORT_0, LED_PIN); /* Turn off LED */
-    }
-    else
-    {
-        GPIO_SetValue(PINSEL_PORT_0, LED_PIN); /* Turn on LED */
-    }
+    FGPIO_Toggle(PINSEL_PORT_0, LED_PIN);
 }
 
 /**
@@ -109,21 +107,25 @@ void toggle_led(void)
  */
 int main(void)
 {
+    uint64_t deadline;
+
     SystemInit(); /* Initialize the system clock (default: 100 MHz) */
 
     configure_port(); /* Configure GPIO pins */
 
     configure_systick(); /* Configure SysTick timer */
 
-    SYSTICK_IntCmd(ENABLE); /* Enable SysTick interrupt */
-
-    SYSTICK_Cmd(ENABLE); /* Enable SysTick counter */
-
     NVIC_SetPriority(EINT3_IRQn, 0); /* Set the priority of the GPIO interrupt */
+    NVIC_EnableIRQ(EINT3_IRQn);      /* Enable the GPIO interrupt */
+
+    deadline = SYSTIME_Now();
 
     while (TRUE)
     {
-        /* Wait for SysTick interrupt */
+        deadline += SYSTIME_MS(SYSTICK_TIME);
+        SYSTIME_SleepUntil(deadline); /* Sleep until the next toggle, the GPIO interrupt runs meanwhile */
+
+        toggle_led();
     }
 
     return 0; /* Program should never reach this point */
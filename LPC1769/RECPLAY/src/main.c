@@ -0,0 +1,148 @@
+/*
+ * @file main.c
+ * @brief Record and playback example
+ *
+ * A voice memo for the goat roasting contest: the signal on AD0.0 (P0.23) is recorded continuously into the second
+ * bank of the AHB SRAM, the last 100 ms of it at 40 kHz. A press on the switch (P2.10, EINT0) plays the recording back
+ * on the DAC output (P0.26) in a loop, and the LED on P0.22 lights up. The next press records again, from where the
+ * playback stopped.
+ *
+ * The GPDMA moves every sample (lpc17xx_recplay): the CPU only runs in the EINT0 interrupt, to switch modes, and in the
+ * DMA interrupt, once per block of 1024 recorded samples, to keep the DAC value field of each word.
+ */
+
+#ifdef __USE_CMSIS
+#include "LPC17xx.h"
+#endif
+
+#ifdef __USE_MCUEXPRESSO
+#include <cr_section_macros.h> /* MCUXpresso-specific macros */
+#endif
+
+#include "lpc17xx_exti.h"    /* External interrupt handling */
+#include "lpc17xx_gpdma.h"   /* GPDMA */
+#include "lpc17xx_gpio.h"    /* GPIO handling */
+#include "lpc17xx_pinsel.h"  /* Pin function selection */
+#include "lpc17xx_recplay.h" /* ADC record and DAC playback */
+
+/* Pin Definitions */
+#define PLAY_LED ((uint32_t)(1 << 22)) /* P0.22 connected to LED, lit during playback */
+
+/* GPIO Direction Definitions */
+#define OUTPUT 1
+
+/* Recording */
+#define SAMPLE_RATE 40000 /* Conversions and DAC updates per second */
+#define SAMPLES     4096  /* The whole 16 kB bank: 102 ms at 40 kHz */
+
+/* Boolean Values */
+#define TRUE 1
+
+static RECPLAY_AHBRAM1 uint32_t samples[SAMPLES]; /* Recorded words, written and read by the GPDMA */
+static const RECPLAY_CFG_Type recplay_cfg = {samples, SAMPLES, 0, SAMPLE_RATE, SAMPLE_RATE};
+
+/* Function prototypes */
+
+/**
+ * @brief Configure P2.10 as EINT0, interrupting on the falling edge of a switch press
+ */
+void configure_switch(void);
+
+/**
+ * @brief Configure the LED, the ADC, the DAC and the GPDMA, and start recording
+ * @return SUCCESS, or ERROR if the recording cannot start
+ */
+Status configure_recplay(void);
+
+/**
+ * @brief Switch between recording and playback
+ */
+void EINT0_IRQHandler(void);
+
+/**
+ * @brief Serve the GPDMA interrupt, once per recorded block
+ */
+void DMA_IRQHandler(void);
+
+void configure_switch(void)
+{
+    PINSEL_CFG_Type pin_cfg;
+    EXTI_InitTypeDef exti_cfg;
+
+    pin_cfg.Portnum = PINSEL_PORT_2;
+    pin_cfg.Pinnum = PINSEL_PIN_10;
+    pin_cfg.Funcnum = PINSEL_FUNC_1; /* EINT0 */
+    pin_cfg.Pinmode = PINSEL_PINMODE_PULLUP;
+    pin_cfg.OpenDrain = PINSEL_PINMODE_NORMAL;
+    PINSEL_ConfigPin(&pin_cfg);
+
+    exti_cfg.EXTI_Line = EXTI_EINT0;
+    exti_cfg.EXTI_Mode = EXTI_MODE_EDGE_SENSITIVE;
+    exti_cfg.EXTI_polarity = EXTI_POLARITY_LOW_ACTIVE_OR_FALLING_EDGE;
+    EXTI_Config(&exti_cfg);
+    EXTI_ClearEXTIFlag(EXTI_EINT0);
+}
+
+Status configure_recplay(void)
+{
+    GPIO_SetDir(PINSEL_PORT_0, PLAY_LED, OUTPUT);
+    GPIO_ClearValue(PINSEL_PORT_0, PLAY_LED);
+
+    GPDMA_Init();
+    if (RECPLAY_Init(&recplay_cfg) != SUCCESS)
+    {
+        return ERROR;
+    }
+    NVIC_EnableIRQ(DMA_IRQn);
+    return RECPLAY_Record();
+}
+
+void EINT0_IRQHandler(void)
+{
+    EXTI_ClearEXTIFlag(EXTI_EINT0);
+
+    if (RECPLAY_GetMode() == RECPLAY_RECORD)
+    {
+        RECPLAY_Play();
+        GPIO_SetValue(PINSEL_PORT_0, PLAY_LED);
+    }
+    else
+    {
+        RECPLAY_Record();
+        GPIO_ClearValue(PINSEL_PORT_0, PLAY_LED);
+    }
+}
+
+void DMA_IRQHandler(void)
+{
+    GPDMA_IntHandler();
+}
+
+/**
+ * @brief Main function.
+ */
+int main(void)
+{
+    SystemInit(); /* Initialize the system clock (default: 100 MHz) */
+
+    if (configure_recplay() != SUCCESS)
+    {
+        while (TRUE)
+        {
+            __WFI(); /* No GPDMA channel: nothing to do */
+        }
+    }
+    configure_switch();
+
+    /* A block must be masked before the recording comes back to it: the DMA interrupt goes before the switch */
+    NVIC_SetPriority(DMA_IRQn, 0);
+    NVIC_SetPriority(EINT0_IRQn, 1);
+    NVIC_EnableIRQ(EINT0_IRQn);
+
+    while (TRUE)
+    {
+        __WFI(); /* Sleep, the GPDMA records or plays */
+    }
+
+    return 0; /* Program should never reach this point */
+}
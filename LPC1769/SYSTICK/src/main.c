@@ -1,6 +1,14 @@
 /*
  * @file main.c
- * @brief
+ * @brief Toggles the LED on P0.22 every 10 ms from the main loop, on the tickless SysTick time base
+ *
+ * The SysTick no longer interrupts every 10 ms to toggle the LED: it counts the cycles of the time base
+ * (lpc17xx_systime.h), and its reload value is written with the next deadline of the main loop. Between two toggles
+ * the core sleeps in __WFI().
+ *
+ * The same deadlines deploy two antennas, each one driven by a servo on PWM1 (lpc17xx_pwmsync.h): P2.0 (PWM1.1) and
+ * P2.1 (PWM1.2), 20 ms frames. Every 10 ms the pulses of both servos grow by SERVO_STEP_US, from SERVO_STOWED_US to
+ * SERVO_DEPLOYED_US, in one frame committed at once: the servos always receive the same pulse width in a period.
  */
 
 #ifdef __USE_CMSIS
@@ -11,19 +19,28 @@
 #include <cr_section_macros.h> /* MCUXpresso-specific macros */
 #endif
 
+#include "lpc17xx_bitband.h" /* Bit-band access */
 #include "lpc17xx_gpio.h"    /* GPIO handling */
 #include "lpc17xx_pinsel.h"  /* Pin function selection */
-#include "lpc17xx_systick.h" /* SysTick handling */
+#include "lpc17xx_pwmsync.h" /* Synchronized PWM1 channels */
+#include "lpc17xx_systime.h" /* Tickless time base */
 
 /* Pin Definitions */
 #define LED_PIN ((uint32_t)(1 << 22)) /* P0.22 connected to LED */
+#define LED_BIT 22                    /* Bit of the LED in the port 0 registers */
 
 /* GPIO Direction Definitions */
 #define INPUT  0
 #define OUTPUT 1
 
 /* Define time variables */
-#define SYSTICK_TIME 10 /* Expressed in milliseconds */
+#define SYSTICK_TIME 10 /* Toggle period, expressed in milliseconds */
+
+/* Antenna deployment servos */
+#define SERVO_FRAME_US    20000 /* Period of the servo pulses, in microseconds */
+#define SERVO_STOWED_US   1000  /* Pulse width of the stowed position, in microseconds */
+#define SERVO_DEPLOYED_US 2000  /* Pulse width of the deployed position, in microseconds */
+#define SERVO_STEP_US     5     /* Growth of the pulse width every SYSTICK_TIME, in microseconds */
 
 /* Boolean Values */
 #define TRUE  1
@@ -49,47 +66,88 @@ void configure_port(void)
 
     /* Set the pins as input or output */
     GPIO_SetDir(PINSEL_PORT_0, LED_PIN, OUTPUT); /* Set the P0.22 pin as output */
+
+    /* P2.0 and P2.1 as PWM1.1 and PWM1.2, for the servos */
+    led_pin_cfg.Portnum = PINSEL_PORT_2;
+    led_pin_cfg.Pinnum = PINSEL_PIN_0;
+    led_pin_cfg.Funcnum = PINSEL_FUNC_1;
+    led_pin_cfg.Pinmode = PINSEL_PINMODE_TRISTATE; /* The pins drive the servos */
+    PINSEL_ConfigPin(&led_pin_cfg);
+
+    led_pin_cfg.Pinnum = PINSEL_PIN_1;
+    PINSEL_ConfigPin(&led_pin_cfg);
 }
 
 void configure_systick(void)
 {
-    SYSTICK_InternalInit(SYSTICK_TIME); /* Initialize the SysTick timer with a time interval of 10 ms */
+    SYSTIME_Init(); /* Start the SysTick on the CPU clock, with its interrupt */
+}
+
+/**
+ * @brief Start PWM1 with the servo frames, both antennas stowed.
+ */
+void configure_servos(void)
+{
+    PWMSYNC_CFG_Type servo_cfg;
+
+    servo_cfg.PeriodUs = SERVO_FRAME_US;
+    servo_cfg.Channels = PWMSYNC_CH(1) | PWMSYNC_CH(2);
+    servo_cfg.DoubleEdge = 0;
+    servo_cfg.Reserved = 0;
+    PWMSYNC_Init(&servo_cfg);
+}
+
+/**
+ * @brief Send the same pulse width to both servos, from the next frame on.
+ * @param pulse_us Pulse width, in microseconds.
+ */
+void move_servos(uint32_t pulse_us)
+{
+    PWMSYNC_Frame_Type frame = {{0}, {0}};
+
+    frame.High[0] = PWMSYNC_UsTicks(pulse_us); /* PWM1.1 */
+    frame.High[1] = frame.High[0];             /* PWM1.2 */
+    PWMSYNC_Commit(&frame);
 }
 
 // Overwrite the interrupt handler routine for SysTick
 void SysTick_Handler(void)
 {
-    SYSTICK_ClearCounterFlag(); /* Clear interrupt flag */
-
-    if (GPIO_ReadValue(PINSEL_PORT_0) & LED_PIN)
-    {
-        GPIO_ClearValue(PINSEL_PORT_0, LED_PIN); /* Turn off LED */
-    }
-    else
-    {
-        GPIO_SetValue(PINSEL_PORT_0, LED_PIN); /* Turn on LED */
-    }
+    SYSTIME_IntHandler(); /* Count the elapsed period and write the next reload value */
 }
 
 /**
  * @brief Main function.
- * TODO: Add description
+ * Toggles the LED at fixed deadlines: each one is the previous one plus SYSTICK_TIME, so the period does not drift.
  */
 int main(void)
 {
+    uint64_t deadline;
+    uint32_t pulse_us = SERVO_STOWED_US;
+
     SystemInit(); /* Initialize the system clock (default: 100 MHz) */
 
     configure_port(); /* Configure GPIO pins */
 
     configure_systick(); /* Configure SysTick timer */
 
-    SYSTICK_IntCmd(ENABLE); /* Enable SysTick interrupt */
+    configure_servos(); /* Start the servo frames */
+    move_servos(pulse_us);
 
-    SYSTICK_Cmd(ENABLE); /* Enable SysTick counter */
+    deadline = SYSTIME_Now();
 
     while (TRUE)
     {
-        /* Wait for SysTick interrupt */
+        deadline += SYSTIME_MS(SYSTICK_TIME);
+        SYSTIME_SleepUntil(deadline); /* Sleep until the next toggle */
+
+        BITBAND(LPC_GPIO0->FIOPIN, LED_BIT) ^= 1; /* Toggle the LED: one load and one store of the bit-band alias */
+
+        if (pulse_us < SERVO_DEPLOYED_US)
+        {
+            pulse_us += SERVO_STEP_US;
+            move_servos(pulse_us); /* Both antennas open together */
+        }
     }
 
     return 0; /* Program should never reach this point */
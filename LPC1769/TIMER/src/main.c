@@ -32,7 +32,15 @@
  *
  * Which is approximately 1 hour and 11 minutes.
  *
- * In this example, we will configure Timer0 to toggle four LEDs at different frequencies.
+ * In this example, Timer0 toggles four LEDs at four unrelated rates. The periods are software timers of the timer wheel
+ * (lpc17xx_twheel.h): the TC runs freely with 100 µs ticks, and MR0 is written with the next deadline of the four
+ * timers only, so the interrupt occurs at the toggles and nowhere else.
+ *
+ * Timer1 drives a hobby servo on P1.22 (MAT1.0): a pulse of 1 to 2 ms every 20 ms, played by the match sequencer
+ * (lpc17xx_matseq.h). MR0 toggles the pin and holds the time to the next edge, the GPDMA loads the following one from
+ * a table on each match: no interrupt per edge, and no jitter from the LED interrupts. A deferred timer of the wheel
+ * sweeps the pulse from end to end by rewriting the table. Timer2 and Timer3, and the other match and capture
+ * registers of Timer0, stay free for other work.
  */
 
 #ifdef __USE_CMSIS
@@ -43,9 +51,12 @@
 #include <cr_section_macros.h> /* MCUXpresso-specific macros */
 #endif
 
+#include "lpc17xx_fgpio.h"  /* Fast GPIO */
+#include "lpc17xx_gpdma.h"  /* GPDMA channels */
 #include "lpc17xx_gpio.h"   /* GPIO */
+#include "lpc17xx_matseq.h" /* DMA driven match sequencer */
 #include "lpc17xx_pinsel.h" /* Pin Configuration */
-#include "lpc17xx_timer.h"  /* Timer */
+#include "lpc17xx_twheel.h" /* Timer wheel */
 
 /* Pin Definitions */
 #define LED0 ((uint32_t)(1 << 20)) // P0.20
@@ -53,142 +64,170 @@
 #define LED2 ((uint32_t)(1 << 22)) // P0.22
 #define LED3 ((uint32_t)(1 << 23)) // P0.23
 
-#define HALF_PERIOD                                                                                                    \
-    500000 // Half period for toggle, the number 500000 was derived from the assumption of dividing the timer clock by 2
-
 #define OUTPUT 1 // GPIO direction for output
 
+#define TICK_US 100 // Tick of the wheel: 100 µs
+
 /*
- * Because all match channels share the same Timer, its difficult to have different frequencies for each LED using just
- * one Timer. To solve this problem, we can take advantage that all LEDs share a base frequency and use a match counter
- * to keep track of the number of times the match value has been reached. This way, we can toggle the LEDs at different
- * frequencies without using multiple timers.
- *
- * This isnt the right solution, because it forces us to make all LEDs share a base frequency, in this case, LED0.
- * The other LEDs will have to toggle at a rate proportional to the base frequency, for example:
+ * The old version of this example shared one match interrupt between the four LEDs with a match counter, which forced
+ * every period to be a power of two times the one of LED0. With one software timer per LED, each half period is free:
  *
- * LED1 has half the frequency of LED0
- * LED2 has half the frequency of LED1
- * LED3 has half the frequency of LED2.
+ * LED0 toggles every 250 ms (2 Hz)
+ * LED1 toggles every 300 ms (1.67 Hz)
+ * LED2 toggles every 700 ms (0.71 Hz)
+ * LED3 toggles every 1100 ms (0.45 Hz), from the main loop
  *
- * The file alternative.c shows a different approach to this problem, giving us more versatility and the ability to
- * adapt to situations where the frequencies of the different LEDs are not shared or do not mantain a defined
- * relationship.
+ * The file alternative.c reaches the same result with the four hardware timers.
  */
-#define FREQ_LED0 2 // LED0 frequency in Hz -> Match at 25000 (2.5s) -> Toggle each time match is reached
-#define FREQ_LED1 1 // LED1 frequency in Hz -> Match at 50000 (5s) -> Toggle every time the match counter is raised by 2
-#define FREQ_LED2                                                                                                      \
-    0.5 // LED2 frequency in Hz -> Match at 100000 (10s) -> Toggle every time the match counter is raised by 4
-#define FREQ_LED3                                                                                                      \
-    0.25 // LED3 frequency in Hz -> Match at 200000 (20s) -> Toggle every time the match counter is raised by 8
-uint8_t match_counter = 0;
+#define HALF_PERIOD_LED0 (250000 / TICK_US) // In ticks
+#define HALF_PERIOD_LED1 (300000 / TICK_US)
+#define HALF_PERIOD_LED2 (700000 / TICK_US)
+#define HALF_PERIOD_LED3 (1100000 / TICK_US)
+
+/* Servo frame on MAT1.0, in 1 µs ticks */
+#define SERVO_PRESCALE 100    // CPU clock cycles per tick of Timer1
+#define SERVO_FRAME    20000  // One pulse every 20 ms
+#define SERVO_MIN      1000   // Pulse width at one end, in µs
+#define SERVO_MAX      2000   // Pulse width at the other end
+#define SERVO_STEP     50     // Change of the pulse width at each step of the sweep
+#define SERVO_STEP_US  100000 // Time between two steps of the sweep
+
+static TWHEEL_Timer_Type led_timers[4];
+static TWHEEL_Timer_Type sweep_timer;
+
+/* Table of the sequencer: the output is low, then rises for the pulse, then falls for the rest of the frame */
+static uint32_t servo_frame[2] = {MATSEQ_TICKS(SERVO_FRAME - SERVO_MIN), MATSEQ_TICKS(SERVO_MIN)};
+static int32_t servo_pulse = SERVO_MIN;
+static int32_t servo_step = SERVO_STEP;
 
 /* Prototype Functions */
-void configure_timer_and_match(void);
 void configure_port(void);
-void start_timer(void);
-void toggle_led(uint32_t led);
+void configure_timers(void);
+Status configure_servo(void);
+void toggle_led(void* led);
+void sweep_servo(void* arg);
 
-void configure_timer_and_match(void)
+void configure_port(void)
 {
-    TIM_TIMERCFG_Type timer_cfg_struct;
-    TIM_MATCHCFG_Type match_cfg_struct;
-
-    // Configure Timer0 in microsecond mode with a prescaler
-    timer_cfg_struct.PrescaleOption = TIM_PRESCALE_USVAL; // Prescaler in microseconds
-    timer_cfg_struct.PrescaleValue =
-        100; // Prescaler for 100 MHz clock -> 1 µs resolution. Every 100us the timer will increment by 1
-    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &timer_cfg_struct);
-
-    // Configure match channel for LED0 (2 Hz toggle rate)
-    match_cfg_struct.MatchChannel = 0;
-    match_cfg_struct.IntOnMatch = ENABLE;
-    match_cfg_struct.StopOnMatch = DISABLE;
-    match_cfg_struct.ResetOnMatch = ENABLE;
-    match_cfg_struct.ExtMatchOutputType = TIM_EXTMATCH_NOTHING;
-    match_cfg_struct.MatchValue = (uint32_t)(HALF_PERIOD / FREQ_LED0); // Half period for toggle
-    TIM_ConfigMatch(LPC_TIM0, &match_cfg_struct);
+    // P0.20 to P0.23 as GPIO with pull-up: PINSEL1 and PINMODE1 are written once for the four pins
+    static const PINSEL_CFG_Type led_pins[] = {
+        {PINSEL_PORT_0, PINSEL_PIN_20, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+        {PINSEL_PORT_0, PINSEL_PIN_21, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+        {PINSEL_PORT_0, PINSEL_PIN_22, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+        {PINSEL_PORT_0, PINSEL_PIN_23, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+    };
+    static const PINSEL_CFG_Type servo_pin = {PINSEL_PORT_1, PINSEL_PIN_22, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP,
+                                              PINSEL_PINMODE_NORMAL};
+
+    PINSEL_ConfigPins(led_pins, sizeof(led_pins) / sizeof(led_pins[0]));
+
+    // Set P0.20 to P0.23 as output
+    GPIO_SetDir(PINSEL_PORT_0, LED0 | LED1 | LED2 | LED3, OUTPUT);
+
+    // P1.22 as MAT1.0 for the servo
+    PINSEL_ConfigPins(&servo_pin, 1);
 }
 
-void configure_port(void)
+/**
+ * @brief Start the wheel on MR0 of Timer0, then one periodic timer per LED.
+ */
+void configure_timers(void)
 {
-    PINSEL_CFG_Type pin_cfg_struct;
-
-    // Configure P0.20 to P0.23 as GPIO
-    pin_cfg_struct.Portnum = PINSEL_PORT_0;
-    pin_cfg_struct.Pinnum = PINSEL_PIN_20;
-    pin_cfg_struct.Funcnum = PINSEL_FUNC_0;
-    pin_cfg_struct.Pinmode = PINSEL_PINMODE_PULLUP;
-    pin_cfg_struct.OpenDrain = PINSEL_PINMODE_NORMAL;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    static const uint32_t half_periods[4] = {HALF_PERIOD_LED0, HALF_PERIOD_LED1, HALF_PERIOD_LED2, HALF_PERIOD_LED3};
+    static const uint32_t leds[4] = {LED0, LED1, LED2, LED3};
 
-    pin_cfg_struct.Pinnum = PINSEL_PIN_21;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    TWHEEL_Init(LPC_TIM0, 0, TICK_US);
 
-    pin_cfg_struct.Pinnum = PINSEL_PIN_22;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        // LED3 shows a deferred timer: the interrupt only queues it, the main loop toggles it
+        TWHEEL_MODE_Type mode = (i == 3) ? TWHEEL_DEFERRED : TWHEEL_ISR;
 
-    pin_cfg_struct.Pinnum = PINSEL_PIN_23;
-    PINSEL_ConfigPin(&pin_cfg_struct);
+        TWHEEL_TimerInit(&led_timers[i], toggle_led, (void*)(uintptr_t)leds[i], mode);
+        TWHEEL_Start(&led_timers[i], half_periods[i], half_periods[i]);
+    }
 
-    // Set P0.20 to P0.23 as output
-    GPIO_SetDir(PINSEL_PORT_0, LED0 | LED1 | LED2 | LED3, OUTPUT);
+    TWHEEL_TimerInit(&sweep_timer, sweep_servo, NULL, TWHEEL_DEFERRED);
+    TWHEEL_Start(&sweep_timer, SERVO_STEP_US / TICK_US, SERVO_STEP_US / TICK_US);
 }
 
-void toggle_led(uint32_t led)
+/**
+ * @brief Play the servo frame on MAT1.0 in a loop, with 1 µs ticks.
+ * @return SUCCESS, or ERROR when no GPDMA channel is free or the frame is out of range.
+ */
+Status configure_servo(void)
 {
-    if (GPIO_ReadValue(PINSEL_PORT_0) & led)
-    {
-        GPIO_ClearValue(PINSEL_PORT_0, led);
-    }
-    else
+    MATSEQ_Type frame;
+
+    GPDMA_Init();
+    if (MATSEQ_Init(LPC_TIM1, 0, SERVO_PRESCALE) != SUCCESS)
     {
-        GPIO_SetValue(PINSEL_PORT_0, led);
+        return ERROR;
     }
+
+    frame.Intervals = servo_frame;
+    frame.Count = 2;
+    frame.Repeat = ENABLE;
+    frame.IdleLevel = 0;
+    return MATSEQ_Start(&frame);
 }
 
-void TIMER0_IRQHandler(void)
+void toggle_led(void* led)
 {
-    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
-    toggle_led(LED0);
-    match_counter++;
-    switch (match_counter)
-    {
-        case 2:
-        case 6: toggle_led(LED1); break;
-        case 4:
-            toggle_led(LED1);
-            toggle_led(LED2);
-            break;
-        case 8:
-            toggle_led(LED1);
-            toggle_led(LED2);
-            toggle_led(LED3);
-            match_counter = 0;
-            break;
-    }
+    FGPIO_Toggle(PINSEL_PORT_0, (uint32_t)(uintptr_t)led);
 }
 
 /**
- * @brief Start Timer0.
+ * @brief Move the servo pulse by one step, turning back at each end.
+ * @param arg Not used.
+ *
+ * The GPDMA reads the pulse width at the rising edge and the rest of the frame at the falling edge: a frame between
+ * the two writes lasts SERVO_STEP µs more or less, which the servo does not notice.
  */
-void start_timer(void)
+void sweep_servo(void* arg)
+{
+    (void)arg;
+
+    if ((servo_pulse + servo_step < SERVO_MIN) || (servo_pulse + servo_step > SERVO_MAX))
+    {
+        servo_step = -servo_step;
+    }
+    servo_pulse += servo_step;
+
+    servo_frame[1] = MATSEQ_TICKS((uint32_t)servo_pulse);
+    servo_frame[0] = MATSEQ_TICKS(SERVO_FRAME - (uint32_t)servo_pulse);
+}
+
+void TIMER0_IRQHandler(void)
 {
-    TIM_Cmd(LPC_TIM0, ENABLE); /* Start Timer0 */
+    TWHEEL_IntHandler(); // Clears the MR0 flag, toggles the due LEDs and writes the next deadline
 }
 
 int main(void)
 {
     SystemInit(); // Initialize system clock
 
-    configure_port();            // Configure GPIO
-    configure_timer_and_match(); // Configure timer and match channels
-
-    start_timer(); // Start timer
+    configure_port(); // Configure GPIO
+    if (configure_servo() != SUCCESS) // Play the servo frame, without interrupt
+    {
+        while (TRUE)
+        {
+            __WFI(); // No GPDMA channel: no servo frames
+        }
+    }
+    configure_timers(); // Configure the timer wheel, the four LED timers and the sweep of the servo
 
     while (TRUE)
     {
-        // Infinite loop
+        // Sleep until the next deadline, unless a timer was queued since the last pass. With PRIMASK set, __WFI()
+        // still wakes on the interrupt, which then runs at __enable_irq()
+        __disable_irq();
+        if (!TWHEEL_IsDeferredPending())
+        {
+            __WFI();
+        }
+        __enable_irq();
+        TWHEEL_RunDeferred(); // Toggle LED3 and move the servo when they are due
     }
 
     return 0; // This never should be reached
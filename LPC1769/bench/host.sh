@@ -0,0 +1,88 @@
+#!/bin/sh
+# Runs every benchmark of the host build (bench_host, linked with the simulator) and prints its host instructions and
+# register accesses per call. With a baseline file, fails when a benchmark costs more instructions than its baseline
+# plus BENCH_TOLERANCE percent, more register accesses than its baseline, or has no baseline; with -w, writes the
+# counts to the baseline file instead.
+#
+# Usage: host.sh [-w] bench_host [baseline.txt]
+
+BENCH_HOST_CALLS=${BENCH_HOST_CALLS:-10}
+BENCH_TOLERANCE=${BENCH_TOLERANCE:-0}
+
+write=0
+if [ "$1" = "-w" ]; then
+    write=1
+    shift
+fi
+bin=$1
+baseline=$2
+
+if [ -z "$bin" ] || { [ $write -eq 1 ] && [ -z "$baseline" ]; }; then
+    echo "usage: $0 [-w] bench_host [baseline.txt]" >&2
+    exit 2
+fi
+
+if [ -n "$baseline" ] && [ $write -eq 0 ] && [ ! -f "$baseline" ]; then
+    echo "$0: no baseline $baseline, record it with 'make host-baseline'" >&2
+    exit 2
+fi
+
+results=$("$bin" "$BENCH_HOST_CALLS") || {
+    echo "$0: $bin failed" >&2
+    exit 2
+}
+
+status=0
+printf '%-28s %12s %8s %8s %12s %10s\n' benchmark insns/call reads writes bytes/insn baseline
+
+# Word splitting of $results is intended: one "<name> <insns> <reads> <writes> <bytes>" line per benchmark
+set -- $results
+while [ $# -ge 5 ]; do
+    name=$1
+    per_call=$2
+    reads=$3
+    writes=$4
+    bytes=$5
+    shift 5
+
+    if [ "$bytes" -gt 0 ] && [ "$per_call" -gt 0 ]; then
+        # Fixed point with 3 decimals
+        milli=$(( bytes * 1000 / per_call ))
+        per_insn=$(printf '%d.%03d' $(( milli / 1000 )) $(( milli % 1000 )))
+    else
+        per_insn=-
+    fi
+
+    reference=-
+    verdict=
+    if [ -n "$baseline" ] && [ $write -eq 0 ]; then
+        line=$(awk -v n="$name" '$1 == n { print $2, $3, $4 }' "$baseline")
+        if [ -z "$line" ]; then
+            verdict=MISSING
+            status=1
+        else
+            set -- $line "$@"
+            reference=$1
+            if [ $(( per_call * 100 )) -gt $(( $1 * (100 + BENCH_TOLERANCE) )) ] || [ "$reads" -gt "$2" ] ||
+                [ "$writes" -gt "$3" ]; then
+                verdict=REGRESSION
+                status=1
+            fi
+            shift 3
+        fi
+    fi
+
+    printf '%-28s %12s %8s %8s %12s %10s %s\n' "$name" "$per_call" "$reads" "$writes" "$per_insn" "$reference" \
+        "$verdict"
+done
+
+if [ $write -eq 1 ]; then
+    {
+        echo "# Host instructions, register reads and register writes per call of each benchmark, written by"
+        echo "# 'make host-baseline': $(gcc --version | head -n 1), x86-64, $BENCH_HOST_CALLS calls"
+        printf '%s\n' "$results" | awk '{ print $1, $2, $3, $4 }'
+    } > "$baseline"
+    echo "Baseline written to $baseline"
+fi
+
+exit $status
@@ -0,0 +1,100 @@
+#!/bin/sh
+# Runs every benchmark of bench.elf under qemu-arm with the instruction counting plugin and prints its instructions per
+# call. With a baseline file, fails when a benchmark costs more than its baseline plus BENCH_TOLERANCE percent, or has no
+# baseline; with -w, writes the counts to the baseline file instead.
+#
+# Usage: run.sh [-w] bench.elf [baseline.txt]
+
+QEMU=${QEMU:-qemu-arm}
+QEMU_CPU=${QEMU_CPU:-cortex-m3}
+QEMU_PLUGIN=${QEMU_PLUGIN:-libinsn.so}
+BENCH_CALLS=${BENCH_CALLS:-1000}
+BENCH_TOLERANCE=${BENCH_TOLERANCE:-0}
+
+write=0
+if [ "$1" = "-w" ]; then
+    write=1
+    shift
+fi
+elf=$1
+baseline=$2
+
+if [ -z "$elf" ] || { [ $write -eq 1 ] && [ -z "$baseline" ]; }; then
+    echo "usage: $0 [-w] bench.elf [baseline.txt]" >&2
+    exit 2
+fi
+
+if [ -n "$baseline" ] && [ $write -eq 0 ] && [ ! -f "$baseline" ]; then
+    echo "$0: no baseline $baseline, record it with 'make baseline'" >&2
+    exit 2
+fi
+
+log=$(mktemp) || exit 2
+trap 'rm -f "$log"' EXIT
+
+# Instructions executed by one run of the benchmark $1 with $2 calls
+count() {
+    "$QEMU" -cpu "$QEMU_CPU" -plugin "$QEMU_PLUGIN" -d plugin -D "$log" "$elf" "$1" "$2" >/dev/null || return 1
+    awk '/insns:/ { n = $NF } END { if (n == "") exit 1; print n }' "$log"
+}
+
+cases=$("$QEMU" -cpu "$QEMU_CPU" "$elf" list) || {
+    echo "$0: cannot run $elf with $QEMU" >&2
+    exit 2
+}
+
+status=0
+results=""
+printf '%-28s %12s %12s %10s\n' benchmark insns/call bytes/insn baseline
+
+# Word splitting of $cases is intended: one "<name> <bytes>" pair per line
+set -- $cases
+while [ $# -ge 2 ]; do
+    name=$1
+    bytes=$2
+    shift 2
+
+    empty=$(count "$name" 0) && full=$(count "$name" "$BENCH_CALLS") || {
+        echo "$0: $name failed" >&2
+        status=1
+        continue
+    }
+    per_call=$(( (full - empty) / BENCH_CALLS ))
+
+    if [ "$bytes" -gt 0 ] && [ "$per_call" -gt 0 ]; then
+        # Fixed point with 3 decimals
+        milli=$(( bytes * 1000 / per_call ))
+        per_insn=$(printf '%d.%03d' $(( milli / 1000 )) $(( milli % 1000 )))
+    else
+        per_insn=-
+    fi
+
+    reference=-
+    verdict=
+    if [ -n "$baseline" ] && [ $write -eq 0 ]; then
+        reference=$(awk -v n="$name" '$1 == n { print $2 }' "$baseline")
+        if [ -z "$reference" ]; then
+            reference=-
+            verdict=MISSING
+            status=1
+        elif [ $(( per_call * 100 )) -gt $(( reference * (100 + BENCH_TOLERANCE) )) ]; then
+            verdict=REGRESSION
+            status=1
+        fi
+    fi
+
+    printf '%-28s %12s %12s %10s %s\n' "$name" "$per_call" "$per_insn" "$reference" "$verdict"
+    results="$results$name $per_call
+"
+done
+
+if [ $write -eq 1 ]; then
+    {
+        echo "# Instructions per call of each benchmark, written by 'make baseline'"
+        echo "# qemu-arm -cpu $QEMU_CPU, $BENCH_CALLS calls"
+        printf '%s' "$results"
+    } > "$baseline"
+    echo "Baseline written to $baseline"
+fi
+
+exit $status
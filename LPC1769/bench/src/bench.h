@@ -0,0 +1,26 @@
+/*
+ * @file bench.h
+ * @brief Instruction count benchmarks of the driver and kernel hot paths
+ *
+ * A benchmark is a fixture that prepares the register image and the buffers once, and a call of the code under test.
+ * The harness runs each benchmark twice under QEMU with an instruction counting plugin, with 0 and with N calls: the
+ * difference divided by N is the cost of one call, without the start-up and fixture code.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    const char* name;
+    uint32_t bytes;      /* Payload bytes handled by one call, 0 when not meaningful */
+    void (*setup)(void); /* Register image and buffers, run once before the calls */
+    void (*run)(void);   /* One call of the code under test */
+} bench_case_t;
+
+extern const bench_case_t bench_cases[];
+extern const uint32_t bench_case_count;
+
+#endif /* BENCH_H */
@@ -0,0 +1,502 @@
+/*
+ * @file bench_cases.c
+ * @brief Fixtures and calls of the benchmarked code paths
+ *
+ * Add a benchmark by writing its setup() and run() functions and a line in bench_cases[], then record its count with
+ * 'make baseline'. run() must do the same work on every call, so that the per call count does not depend on N.
+ */
+
+#include "bench.h"
+#include "lpc17xx_adc.h"
+#include "lpc17xx_bitband.h"
+#include "lpc17xx_classify.h"
+#include "lpc17xx_dds.h"
+#include "lpc17xx_fgpio.h"
+#include "lpc17xx_filter.h"
+#include "lpc17xx_freqcnt.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_pulse.h"
+#include "lpc17xx_pwm.h"
+#include "lpc17xx_pwmsync.h"
+#include "lpc17xx_ssp.h"
+#include "lpc17xx_timer.h"
+#include "lpc17xx_twheel.h"
+#include "sensor_lut.h"
+
+/* The UART driver is compiled here, and not linked from the library, to reach its static uart_set_divisors() */
+#include "lpc17xx_uart.c"
+
+/* DMA_ADC/src/main.c, built as is with its main() renamed */
+void configure_filter(void);
+uint16_t filter_adc_buffer(const uint32_t* samples);
+
+/* bench_dsp.c, DSP library kernels on blocks of DSP_BLOCK samples */
+#define DSP_BLOCK_Q15_BYTES (64U * 2U)
+#define DSP_BLOCK_Q31_BYTES (64U * 4U)
+void dsp_inputs_setup(void);
+void dsp_fir_q15_setup(void);
+void dsp_fir_q15_run(void);
+void dsp_fir_q31_setup(void);
+void dsp_fir_q31_run(void);
+void dsp_biquad_q15_setup(void);
+void dsp_biquad_q15_run(void);
+void dsp_biquad_q31_setup(void);
+void dsp_biquad_q31_run(void);
+void dsp_cfft_q15_setup(void);
+void dsp_cfft_q15_run(void);
+void dsp_dot_prod_q15_run(void);
+void dsp_add_q15_run(void);
+void dsp_rms_q15_run(void);
+void dsp_pid_q15_setup(void);
+void dsp_pid_q15_run(void);
+
+/* One buffer of DMA_ADC/src/main.c (DMA_BUFFER_SIZE): 200 ADGDR words */
+#define AVERAGE_ADC_SAMPLES 200U
+#define AVERAGE_ADC_BYTES   (AVERAGE_ADC_SAMPLES * 4U)
+
+/* Moving average length of the ADC example (8 conversions averaged) */
+#define MOVING_AVERAGE_LOG2 3U
+#define MOVING_AVERAGE_SIZE (1U << MOVING_AVERAGE_LOG2)
+
+/* One DMA block of the DDS engine: DACR words */
+#define DDS_WORDS 64U
+#define DDS_BYTES (DDS_WORDS * 4U)
+
+#define UART_SEND_LENGTH 16U
+#define SSP_LENGTH       8U
+#define M2M_WORDS        16U
+#define LED_PIN          ((uint32_t)(1 << 22))
+
+static uint32_t m2m_src[M2M_WORDS];
+static uint32_t m2m_dst[M2M_WORDS];
+static GPDMA_Channel_CFG_Type gpdma_cfg;
+
+static uint8_t uart_buffer[UART_SEND_LENGTH];
+
+static uint8_t ssp_tx[SSP_LENGTH];
+static uint8_t ssp_rx[SSP_LENGTH];
+static SSP_DATA_SETUP_Type ssp_cfg;
+
+static PINSEL_CFG_Type pin_cfg;
+
+static uint32_t adc_samples[AVERAGE_ADC_SAMPLES];
+static uint16_t adc_averages[AVERAGE_ADC_SAMPLES];
+static uint32_t adc_outputs[AVERAGE_ADC_SAMPLES];
+static uint16_t boxcar_history[MOVING_AVERAGE_SIZE];
+static FILTER_Boxcar_Type boxcar;
+static FILTER_Cic_Type cic;
+static FILTER_Decimate_Type decimate;
+
+static uint32_t dds_words[DDS_WORDS];
+
+/* Results of the functions without side effects: a discarded result lets the compiler drop the call */
+static volatile int32_t bench_result;
+
+static void no_setup(void)
+{
+}
+
+static void gpdma_setup_setup(void)
+{
+    gpdma_cfg.ChannelNum = 0;
+    gpdma_cfg.TransferSize = M2M_WORDS;
+    gpdma_cfg.TransferWidth = GPDMA_WIDTH_WORD;
+    gpdma_cfg.SrcMemAddr = (uint32_t)m2m_src;
+    gpdma_cfg.DstMemAddr = (uint32_t)m2m_dst;
+    gpdma_cfg.TransferType = GPDMA_TRANSFERTYPE_M2M;
+    gpdma_cfg.SrcConn = 0;
+    gpdma_cfg.DstConn = 0;
+    gpdma_cfg.DMALLI = 0;
+}
+
+static void gpdma_setup_run(void)
+{
+    GPDMA_Setup(&gpdma_cfg);
+}
+
+static void gpdma_count_done(uint32_t channel, void* arg)
+{
+    (*(uint32_t*)arg)++;
+}
+
+static uint32_t gpdma_done_count;
+
+static void gpdma_int_handler_setup(void)
+{
+    /* Two channels with a completion callback, both flagged at terminal count on every call: the clear registers
+     * have no effect on the static image */
+    gpdma_cfg.ChannelNum = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    GPDMA_Submit(&gpdma_cfg, gpdma_count_done, NULL, &gpdma_done_count);
+    gpdma_cfg.ChannelNum = GPDMA_AllocChannel(GPDMA_PRIO_LOW);
+    GPDMA_Submit(&gpdma_cfg, gpdma_count_done, NULL, &gpdma_done_count);
+    *(volatile uint32_t*)&LPC_GPDMA->DMACIntTCStat = (1UL << 0) | (1UL << 6);
+}
+
+static void gpdma_int_handler_run(void)
+{
+    GPDMA_IntHandler();
+}
+
+static void uart_send_setup(void)
+{
+    /* Transmit holding register always empty: every FIFO load goes through at once */
+    *(volatile uint32_t*)&LPC_UART2->LSR = UART_LSR_THRE | UART_LSR_TEMT;
+}
+
+static void uart_send_run(void)
+{
+    UART_Send(LPC_UART2, uart_buffer, UART_SEND_LENGTH, BLOCKING);
+}
+
+static void uart_set_divisors_run(void)
+{
+    uart_set_divisors(LPC_UART2, 115200);
+}
+
+static void ssp_readwrite_setup(void)
+{
+    /* 8-bit frames, transmit FIFO never full, receive FIFO empty */
+    LPC_SSP0->CR0 = SSP_DATABIT_8;
+    *(volatile uint32_t*)&LPC_SSP0->SR = SSP_SR_TNF;
+    ssp_cfg.tx_data = ssp_tx;
+    ssp_cfg.rx_data = ssp_rx;
+    ssp_cfg.length = SSP_LENGTH;
+}
+
+static void ssp_readwrite_run(void)
+{
+    /* Interrupt mode: the calling context fills the transmit FIFO, the receive side runs in SSP0_IRQHandler. With a
+     * static register image the receive FIFO never fills, so polling mode would never return. */
+    SSP_ReadWrite(LPC_SSP0, &ssp_cfg, SSP_TRANSFER_INTERRUPT);
+}
+
+static void pinsel_config_pin_setup(void)
+{
+    pin_cfg.Portnum = PINSEL_PORT_0;
+    pin_cfg.Pinnum = PINSEL_PIN_22;
+    pin_cfg.Funcnum = PINSEL_FUNC_0;
+    pin_cfg.Pinmode = PINSEL_PINMODE_PULLUP;
+    pin_cfg.OpenDrain = PINSEL_PINMODE_NORMAL;
+}
+
+static void pinsel_config_pin_run(void)
+{
+    PINSEL_ConfigPin(&pin_cfg);
+}
+
+/* LED pins of the TIMER example, configured one call per pin (before) and as a table */
+static const PINSEL_CFG_Type led_pins[] = {
+    {PINSEL_PORT_0, PINSEL_PIN_20, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_21, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_22, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_23, PINSEL_FUNC_0, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+};
+
+static void pinsel_config_pin_x4_run(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(led_pins) / sizeof(led_pins[0]); i++)
+    {
+        pin_cfg = led_pins[i];
+        PINSEL_ConfigPin(&pin_cfg);
+    }
+}
+
+static void pinsel_config_pins_run(void)
+{
+    PINSEL_ConfigPins(led_pins, sizeof(led_pins) / sizeof(led_pins[0]));
+}
+
+/* Read-modify-write toggle of the INT and TIMER examples before the fast GPIO path */
+static void toggle_led_run(void)
+{
+    if (GPIO_ReadValue(PINSEL_PORT_0) & LED_PIN)
+    {
+        GPIO_ClearValue(PINSEL_PORT_0, LED_PIN);
+    }
+    else
+    {
+        GPIO_SetValue(PINSEL_PORT_0, LED_PIN);
+    }
+}
+
+static void fgpio_toggle_run(void)
+{
+    FGPIO_Toggle(PINSEL_PORT_0, LED_PIN);
+}
+
+static void bitband_toggle_run(void)
+{
+    BITBAND(LPC_GPIO0->FIOPIN, 22) ^= 1;
+}
+
+/* Averaging loop of DMA_ADC before the filter stage: the whole buffer is summed again and divided */
+static uint16_t __attribute__((noinline)) resum_adc_buffer(const uint32_t* samples)
+{
+    uint32_t sum = 0;
+    uint32_t flags = 0;
+
+    for (uint32_t i = 0; i < AVERAGE_ADC_SAMPLES; i++)
+    {
+        sum += ADC_GDR_RESULT(samples[i]);
+        flags |= samples[i];
+    }
+    return (uint16_t)((flags & ADC_GDR_OVERRUN_FLAG) ? 0 : sum / AVERAGE_ADC_SAMPLES);
+}
+
+static void average_adc_buffer_run(void)
+{
+    bench_result = resum_adc_buffer(adc_samples);
+}
+
+/* Moving average done the way of the ADC example: a fresh sum of the last samples and a division for each sample */
+static void moving_average_resum_run(void)
+{
+    for (uint32_t i = MOVING_AVERAGE_SIZE; i < AVERAGE_ADC_SAMPLES; i++)
+    {
+        uint32_t sum = 0;
+
+        for (uint32_t j = i - MOVING_AVERAGE_SIZE; j < i; j++)
+        {
+            sum += ADC_GDR_RESULT(adc_samples[j]);
+        }
+        adc_averages[i] = (uint16_t)(sum / MOVING_AVERAGE_SIZE);
+    }
+}
+
+static void filter_boxcar_setup(void)
+{
+    FILTER_BoxcarInit(&boxcar, boxcar_history, MOVING_AVERAGE_LOG2);
+}
+
+static void filter_boxcar_run(void)
+{
+    (void)FILTER_BoxcarBlock(&boxcar, adc_samples, AVERAGE_ADC_SAMPLES);
+}
+
+static void filter_cic_setup(void)
+{
+    FILTER_CicInit(&cic, 3, 8, 9);
+}
+
+static void filter_cic_run(void)
+{
+    (void)FILTER_CicBlock(&cic, adc_samples, AVERAGE_ADC_SAMPLES, adc_outputs);
+}
+
+static void filter_decimate_setup(void)
+{
+    FILTER_DecimateInit(&decimate, 2);
+}
+
+static void filter_decimate_run(void)
+{
+    (void)FILTER_DecimateBlock(&decimate, adc_samples, AVERAGE_ADC_SAMPLES, adc_averages);
+}
+
+/* 1234.567 Hz at 100 kHz, full scale: the amplitude does not ramp */
+/* ADC code of 45 degrees at 10 mV per degree, read at run time so that the conversions are not folded */
+static volatile uint16_t temperature_code = 558;
+
+/* Temperature of the STM32 DMA example before the sensor tables: double precision, software floating point */
+static uint16_t __attribute__((noinline)) soft_float_temperature(uint16_t temp)
+{
+    return (uint16_t)((temp * 3.3 / 4096.0) * 100);
+}
+
+static void temperature_soft_float_run(void)
+{
+    bench_result = soft_float_temperature(temperature_code);
+}
+
+/* Same conversion through a sensor table, in tenths of a degree */
+#define SENSOR_DECIDEGREES(code) ((int32_t)((code) * 3300.0 / 4096.0 + 0.5))
+static const int32_t sensor_table[SENSOR_TABLE_POINTS] = SENSOR_TABLE(SENSOR_DECIDEGREES);
+static const SENSOR_Type sensor = {sensor_table, 0, 0, 0};
+
+static int32_t __attribute__((noinline)) lut_temperature(uint16_t temp)
+{
+    return SENSOR_Convert(&sensor, temp);
+}
+
+static void sensor_convert_run(void)
+{
+    bench_result = lut_temperature(temperature_code);
+}
+
+static void dds_fill_block_setup(void)
+{
+    static const DDS_CFG_Type cfg = {53024249, 0, DDS_AMPLITUDE_MAX};
+
+    DDS_Configure(&cfg);
+}
+
+static void dds_fill_block_run(void)
+{
+    DDS_FillBlock(dds_words, DDS_WORDS);
+}
+
+static void filter_adc_buffer_run(void)
+{
+    (void)filter_adc_buffer(adc_samples);
+}
+
+/* LED bands of DMA_ADC, in 14-bit readings, and a reading inside the yellow band */
+static const uint16_t classify_thresholds[] = {(30 << 2) + 1, (50 << 2) + 1};
+static const uint32_t classify_pins[] = {(uint32_t)(1 << 20), (uint32_t)(1 << 21), LED_PIN};
+static const CLASSIFY_Table_Type classify_table = {classify_thresholds, classify_pins, 3, PINSEL_PORT_0, 8, 4};
+#define CLASSIFY_READING (40U << 2)
+
+static void classify_update_setup(void)
+{
+    CLASSIFY_Init(NULL, NULL);
+    (void)CLASSIFY_SetTable(0, &classify_table);
+    CLASSIFY_Update(0, CLASSIFY_READING);
+}
+
+static void classify_update_run(void)
+{
+    CLASSIFY_Update(0, CLASSIFY_READING);
+}
+
+/* A hundred timers in the wheel, spread over its levels, and one timer started and stopped among them */
+#define TWHEEL_BACKGROUND 100
+static TWHEEL_Timer_Type twheel_background[TWHEEL_BACKGROUND];
+static TWHEEL_Timer_Type twheel_timer;
+
+static void twheel_callback(void* arg)
+{
+    (void)arg;
+}
+
+static void twheel_start_stop_setup(void)
+{
+    (void)TWHEEL_Init(LPC_TIM0, 0, 100);
+    for (uint32_t i = 0; i < TWHEEL_BACKGROUND; i++)
+    {
+        TWHEEL_TimerInit(&twheel_background[i], twheel_callback, NULL, TWHEEL_ISR);
+        (void)TWHEEL_Start(&twheel_background[i], 1000000 + i * 97003, 0);
+    }
+    TWHEEL_TimerInit(&twheel_timer, twheel_callback, NULL, TWHEEL_ISR);
+}
+
+static void twheel_start_stop_run(void)
+{
+    (void)TWHEEL_Start(&twheel_timer, 5000, 5000);
+    TWHEEL_Stop(&twheel_timer);
+}
+
+static uint32_t pulse_capture;
+
+static void pulse_int_handler_setup(void)
+{
+    /* Both capture flags set on every call: IR is write-one-to-clear, it keeps its value on the static image */
+    (void)PULSE_Init(LPC_TIM1, 3, 1);
+    LPC_TIM1->IR = TIM_IR_CLR(TIM_CR0_INT) | TIM_IR_CLR(TIM_CR1_INT);
+}
+
+static void pulse_int_handler_run(void)
+{
+    /* One period of a 20 kHz signal at 100 MHz later: a new falling edge, then a new rising edge */
+    pulse_capture += 5000;
+    *(volatile uint32_t*)&LPC_TIM1->CR1 = pulse_capture - 2500;
+    *(volatile uint32_t*)&LPC_TIM1->CR0 = pulse_capture;
+    PULSE_IntHandler();
+}
+
+static uint32_t freqcnt_time;
+
+static void freqcnt_int_handler_setup(void)
+{
+    FREQCNT_CFG_Type freqcnt_cfg;
+
+    freqcnt_cfg.CounterTIM = LPC_TIM2;
+    freqcnt_cfg.CounterInput = TIM_COUNTER_INCAP0;
+    freqcnt_cfg.GateTIM = LPC_TIM0;
+    freqcnt_cfg.GateCapture = 0;
+    freqcnt_cfg.GateMatch = 0;
+    freqcnt_cfg.WindowUs = 100000;
+    (void)FREQCNT_Init(&freqcnt_cfg);
+    /* Match flag set on every call: IR is write-one-to-clear, it keeps its value on the static image */
+    LPC_TIM0->IR = TIM_IR_CLR(0);
+    freqcnt_time = LPC_TIM0->MR0;
+}
+
+static void freqcnt_int_handler_run(void)
+{
+    /* One 100 ms window of a 10 kHz signal later, read right after the match: the reciprocal path */
+    LPC_TIM0->TC = freqcnt_time + 40;
+    *(volatile uint32_t*)&LPC_TIM0->CR0 = freqcnt_time - 2000;
+    LPC_TIM2->TC += 1000;
+    freqcnt_time += 10000000;
+    FREQCNT_IntHandler();
+}
+
+/* Six single edge channels of PWM1, 1 kHz */
+static PWMSYNC_Frame_Type pwm_frame = {{10000, 20000, 30000, 40000, 50000, 60000}, {0}};
+static PWM_Match_T pwm_matches[7];
+
+static void pwm_frame_setup(void)
+{
+    PWMSYNC_CFG_Type pwmsync_cfg = {1000, 0x3F, 0, 0};
+
+    PWMSYNC_Init(&pwmsync_cfg);
+    for (uint32_t n = 1; n <= PWMSYNC_CHANNELS; n++)
+    {
+        pwm_matches[n].Matchvalue = pwm_frame.High[n - 1];
+        pwm_matches[n].Status = SET;
+    }
+}
+
+static void pwm_multi_match_update_run(void)
+{
+    PWM_MultiMatchUpdate(LPC_PWM1, pwm_matches, PWM_MATCH_UPDATE_NEXT_RST);
+}
+
+static void pwmsync_commit_run(void)
+{
+    PWMSYNC_Commit(&pwm_frame);
+}
+
+const bench_case_t bench_cases[] = {
+    {"GPDMA_Setup", 0, gpdma_setup_setup, gpdma_setup_run},
+    {"GPDMA_IntHandler", 0, gpdma_int_handler_setup, gpdma_int_handler_run},
+    {"UART_Send", UART_SEND_LENGTH, uart_send_setup, uart_send_run},
+    {"SSP_ReadWrite", SSP_LENGTH, ssp_readwrite_setup, ssp_readwrite_run},
+    {"uart_set_divisors", 0, no_setup, uart_set_divisors_run},
+    {"PINSEL_ConfigPin", 0, pinsel_config_pin_setup, pinsel_config_pin_run},
+    {"PINSEL_ConfigPin_x4", 0, no_setup, pinsel_config_pin_x4_run},
+    {"PINSEL_ConfigPins", 0, no_setup, pinsel_config_pins_run},
+    {"average_adc_buffer", AVERAGE_ADC_BYTES, no_setup, average_adc_buffer_run},
+    {"moving_average_resum", AVERAGE_ADC_BYTES, no_setup, moving_average_resum_run},
+    {"FILTER_BoxcarBlock", AVERAGE_ADC_BYTES, filter_boxcar_setup, filter_boxcar_run},
+    {"FILTER_CicBlock", AVERAGE_ADC_BYTES, filter_cic_setup, filter_cic_run},
+    {"FILTER_DecimateBlock", AVERAGE_ADC_BYTES, filter_decimate_setup, filter_decimate_run},
+    {"filter_adc_buffer", AVERAGE_ADC_BYTES, configure_filter, filter_adc_buffer_run},
+    {"CLASSIFY_Update", 0, classify_update_setup, classify_update_run},
+    {"temperature_soft_float", 0, no_setup, temperature_soft_float_run},
+    {"SENSOR_Convert", 0, no_setup, sensor_convert_run},
+    {"TWHEEL_Start_Stop", 0, twheel_start_stop_setup, twheel_start_stop_run},
+    {"PULSE_IntHandler", 0, pulse_int_handler_setup, pulse_int_handler_run},
+    {"FREQCNT_IntHandler", 0, freqcnt_int_handler_setup, freqcnt_int_handler_run},
+    {"PWM_MultiMatchUpdate", 0, pwm_frame_setup, pwm_multi_match_update_run},
+    {"PWMSYNC_Commit", 0, pwm_frame_setup, pwmsync_commit_run},
+    {"DDS_FillBlock", DDS_BYTES, dds_fill_block_setup, dds_fill_block_run},
+    {"arm_fir_q15", DSP_BLOCK_Q15_BYTES, dsp_fir_q15_setup, dsp_fir_q15_run},
+    {"arm_fir_q31", DSP_BLOCK_Q31_BYTES, dsp_fir_q31_setup, dsp_fir_q31_run},
+    {"arm_biquad_df1_q15", DSP_BLOCK_Q15_BYTES, dsp_biquad_q15_setup, dsp_biquad_q15_run},
+    {"arm_biquad_df1_q31", DSP_BLOCK_Q31_BYTES, dsp_biquad_q31_setup, dsp_biquad_q31_run},
+    {"arm_cfft_radix4_q15", DSP_BLOCK_Q31_BYTES, dsp_cfft_q15_setup, dsp_cfft_q15_run},
+    {"arm_dot_prod_q15", DSP_BLOCK_Q15_BYTES, dsp_inputs_setup, dsp_dot_prod_q15_run},
+    {"arm_add_q15", DSP_BLOCK_Q15_BYTES, dsp_inputs_setup, dsp_add_q15_run},
+    {"arm_rms_q15", DSP_BLOCK_Q15_BYTES, dsp_inputs_setup, dsp_rms_q15_run},
+    {"arm_pid_q15", DSP_BLOCK_Q15_BYTES, dsp_pid_q15_setup, dsp_pid_q15_run},
+    {"toggle_led", 0, no_setup, toggle_led_run},
+    {"FGPIO_Toggle", 0, no_setup, fgpio_toggle_run},
+    {"BITBAND_toggle", 0, no_setup, bitband_toggle_run},
+};
+
+const uint32_t bench_case_count = sizeof(bench_cases) / sizeof(bench_cases[0]);
@@ -0,0 +1,175 @@
+/*
+ * @file bench_dsp.c
+ * @brief Fixtures and calls of the DSP library kernels
+ *
+ * Built apart from bench_cases.c because arm_math.h needs -fno-strict-aliasing. Every kernel processes a block of
+ * DSP_BLOCK samples per call, so that the instructions per call divided by DSP_BLOCK is the cost of one sample. The
+ * bytes of the bench_cases[] lines are the input samples of one call.
+ */
+
+#include "arm_math.h"
+
+#define DSP_BLOCK    64U
+#define DSP_FIR_TAPS 32U
+#define DSP_STAGES   2U
+
+static q15_t q15_a[DSP_BLOCK];
+static q15_t q15_b[DSP_BLOCK];
+static q15_t q15_out[DSP_BLOCK];
+static q31_t q31_a[DSP_BLOCK];
+static q31_t q31_out[DSP_BLOCK];
+
+static q15_t fir_coeffs_q15[DSP_FIR_TAPS];
+static q15_t fir_state_q15[DSP_FIR_TAPS + DSP_BLOCK - 1U];
+static arm_fir_instance_q15 fir_q15;
+
+static q31_t fir_coeffs_q31[DSP_FIR_TAPS];
+static q31_t fir_state_q31[DSP_FIR_TAPS + DSP_BLOCK - 1U];
+static arm_fir_instance_q31 fir_q31;
+
+/* Two 2nd order low-pass sections, b = {0.0625, 0.125, 0.0625} and a = {1.25, -0.5} in Q14 and Q30
+ * (postShift 1), unity gain at DC */
+static q15_t biquad_coeffs_q15[6U * DSP_STAGES] = {1024, 0, 2048, 1024, 20480, -8192,
+                                                   1024, 0, 2048, 1024, 20480, -8192};
+static q15_t biquad_state_q15[4U * DSP_STAGES];
+static arm_biquad_casd_df1_inst_q15 biquad_q15;
+
+static q31_t biquad_coeffs_q31[5U * DSP_STAGES] = {67108864, 134217728, 67108864, 1342177280, -536870912,
+                                                   67108864, 134217728, 67108864, 1342177280, -536870912};
+static q31_t biquad_state_q31[4U * DSP_STAGES];
+static arm_biquad_casd_df1_inst_q31 biquad_q31;
+
+/* DSP_BLOCK complex points, {re, im} */
+static q15_t cfft_buffer[2U * DSP_BLOCK];
+static arm_cfft_radix4_instance_q15 cfft;
+
+static arm_pid_instance_q15 pid;
+
+/* Results kept global so that the calls are not optimized away */
+volatile q63_t dsp_result_q63;
+volatile q15_t dsp_result_q15;
+
+/* Triangle wave spanning about half of the range, and a different one for the second operand */
+static void fill_inputs(void)
+{
+    for (uint32_t i = 0; i < DSP_BLOCK; i++)
+    {
+        int32_t ramp = (int32_t)(i & 31U) - 16;
+
+        q15_a[i] = (q15_t)(ramp * 1024);
+        q15_b[i] = (q15_t)(ramp * -512 + 100);
+        q31_a[i] = (q31_t)ramp << 26;
+    }
+}
+
+void dsp_fir_q15_setup(void)
+{
+    fill_inputs();
+    for (uint32_t i = 0; i < DSP_FIR_TAPS; i++)
+    {
+        fir_coeffs_q15[i] = (q15_t)(32768U / DSP_FIR_TAPS);
+    }
+    arm_fir_init_q15(&fir_q15, DSP_FIR_TAPS, fir_coeffs_q15, fir_state_q15, DSP_BLOCK);
+}
+
+void dsp_fir_q15_run(void)
+{
+    arm_fir_q15(&fir_q15, q15_a, q15_out, DSP_BLOCK);
+}
+
+void dsp_fir_q31_setup(void)
+{
+    fill_inputs();
+    for (uint32_t i = 0; i < DSP_FIR_TAPS; i++)
+    {
+        fir_coeffs_q31[i] = (q31_t)(0x80000000UL / DSP_FIR_TAPS);
+    }
+    arm_fir_init_q31(&fir_q31, DSP_FIR_TAPS, fir_coeffs_q31, fir_state_q31, DSP_BLOCK);
+}
+
+void dsp_fir_q31_run(void)
+{
+    arm_fir_q31(&fir_q31, q31_a, q31_out, DSP_BLOCK);
+}
+
+void dsp_biquad_q15_setup(void)
+{
+    fill_inputs();
+    arm_biquad_cascade_df1_init_q15(&biquad_q15, DSP_STAGES, biquad_coeffs_q15, biquad_state_q15, 1);
+}
+
+void dsp_biquad_q15_run(void)
+{
+    arm_biquad_cascade_df1_q15(&biquad_q15, q15_a, q15_out, DSP_BLOCK);
+}
+
+void dsp_biquad_q31_setup(void)
+{
+    fill_inputs();
+    arm_biquad_cascade_df1_init_q31(&biquad_q31, DSP_STAGES, biquad_coeffs_q31, biquad_state_q31, 1);
+}
+
+void dsp_biquad_q31_run(void)
+{
+    arm_biquad_cascade_df1_q31(&biquad_q31, q31_a, q31_out, DSP_BLOCK);
+}
+
+void dsp_cfft_q15_setup(void)
+{
+    arm_cfft_radix4_init_q15(&cfft, DSP_BLOCK, 0, 1);
+}
+
+/* The transform is in place: the input is copied first, its cost is part of the count */
+void dsp_cfft_q15_run(void)
+{
+    for (uint32_t i = 0; i < DSP_BLOCK; i++)
+    {
+        cfft_buffer[2U * i] = q15_a[i];
+        cfft_buffer[2U * i + 1U] = 0;
+    }
+    arm_cfft_radix4_q15(&cfft, cfft_buffer);
+}
+
+void dsp_dot_prod_q15_run(void)
+{
+    q63_t result;
+
+    arm_dot_prod_q15(q15_a, q15_b, DSP_BLOCK, &result);
+    dsp_result_q63 = result;
+}
+
+void dsp_add_q15_run(void)
+{
+    arm_add_q15(q15_a, q15_b, q15_out, DSP_BLOCK);
+}
+
+void dsp_rms_q15_run(void)
+{
+    q15_t result;
+
+    arm_rms_q15(q15_a, DSP_BLOCK, &result);
+    dsp_result_q15 = result;
+}
+
+void dsp_inputs_setup(void)
+{
+    fill_inputs();
+}
+
+void dsp_pid_q15_setup(void)
+{
+    fill_inputs();
+    pid.Kp = 16384;
+    pid.Ki = 1024;
+    pid.Kd = 2048;
+    arm_pid_init_q15(&pid, 1);
+}
+
+/* One controller update per sample, the inline arm_pid_q15() of arm_math.h */
+void dsp_pid_q15_run(void)
+{
+    for (uint32_t i = 0; i < DSP_BLOCK; i++)
+    {
+        q15_out[i] = arm_pid_q15(&pid, q15_a[i]);
+    }
+}
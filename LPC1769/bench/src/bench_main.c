@@ -0,0 +1,48 @@
+/*
+ * @file bench_main.c
+ * @brief Benchmark runner, started by run.sh under qemu-arm
+ *
+ * Usage: bench.elf list               prints "<name> <bytes per call>" for every benchmark
+ *        bench.elf <name> <calls>     runs the fixture of the benchmark, then the code under test <calls> times
+ *
+ * The arguments and the output go through ARM semihosting (newlib rdimon), which qemu-arm serves in user mode.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && strcmp(argv[1], "list") == 0)
+    {
+        for (uint32_t i = 0; i < bench_case_count; i++)
+        {
+            printf("%s %lu\n", bench_cases[i].name, (unsigned long)bench_cases[i].bytes);
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (argc == 3)
+    {
+        for (uint32_t i = 0; i < bench_case_count; i++)
+        {
+            if (strcmp(argv[1], bench_cases[i].name) == 0)
+            {
+                uint32_t calls = (uint32_t)strtoul(argv[2], NULL, 0);
+
+                bench_cases[i].setup();
+                while (calls--)
+                {
+                    bench_cases[i].run();
+                }
+                return EXIT_SUCCESS;
+            }
+        }
+    }
+
+    fprintf(stderr, "usage: %s list | <benchmark> <calls>\n", argv[0]);
+    return EXIT_FAILURE;
+}
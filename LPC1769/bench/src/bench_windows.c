@@ -0,0 +1,23 @@
+/*
+ * @file bench_windows.c
+ * @brief Peripheral address windows backed by plain memory
+ *
+ * qemu-arm runs the benchmarks as a user-mode process, where the LPC17xx peripherals do not exist. bench_windows.ld
+ * places these arrays at the addresses of the fast GPIO, APB0, APB1 and AHB blocks, so that the drivers run unchanged
+ * on a zero-filled register image. Registers have no side effects: a fixture presets the status bits that the code
+ * under test polls.
+ *
+ * The bit-band aliases of the GPIO, APB0 and APB1 blocks are plain memory as well: a bit-band store costs one
+ * instruction as on the target, but does not reach the register image.
+ */
+
+#include <stdint.h>
+
+uint8_t bench_gpio_window[0x4000] __attribute__((section(".lpc_gpio"), used));
+uint8_t bench_apb0_window[0x80000] __attribute__((section(".lpc_apb0"), used));
+uint8_t bench_apb1_window[0x80000] __attribute__((section(".lpc_apb1"), used));
+uint8_t bench_ahb_window[0x10000] __attribute__((section(".lpc_ahb"), used));
+
+uint8_t bench_gpio_alias[0x4000 * 32] __attribute__((section(".lpc_gpio_alias"), used));
+uint8_t bench_apb0_alias[0x80000 * 32] __attribute__((section(".lpc_apb0_alias"), used));
+uint8_t bench_apb1_alias[0x80000 * 32] __attribute__((section(".lpc_apb1_alias"), used));
@@ -0,0 +1,618 @@
+/**********************************************************************
+ * @file		arm_basic_math_q.c
+ * @brief	Q15 and Q31 basic math functions of the DSP library:
+ * 			add, sub, mult, scale, abs, offset and dot product
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Q15 vector addition, saturated
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_add_q15(q15_t* pSrcA, q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t a01 = ARM_READ_Q15x2(pSrcA);
+        q31_t b01 = ARM_READ_Q15x2(pSrcB);
+        q31_t a23 = ARM_READ_Q15x2(pSrcA + 2);
+        q31_t b23 = ARM_READ_Q15x2(pSrcB + 2);
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15(ARM_Q15_LO(a01) + ARM_Q15_LO(b01)),
+                                      ARM_SAT_Q15(ARM_Q15_HI(a01) + ARM_Q15_HI(b01)), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15(ARM_Q15_LO(a23) + ARM_Q15_LO(b23)),
+                                          ARM_SAT_Q15(ARM_Q15_HI(a23) + ARM_Q15_HI(b23)), 16));
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t)ARM_SAT_Q15((q31_t)*pSrcA++ + *pSrcB++);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q15_t)ARM_SAT_Q15((q31_t)pSrcA[i] + pSrcB[i]);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 vector addition, saturated
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_add_q31(q31_t* pSrcA, q31_t* pSrcB, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        pDst[0] = arm_qadd_q31(pSrcA[0], pSrcB[0]);
+        pDst[1] = arm_qadd_q31(pSrcA[1], pSrcB[1]);
+        pDst[2] = arm_qadd_q31(pSrcA[2], pSrcB[2]);
+        pDst[3] = arm_qadd_q31(pSrcA[3], pSrcB[3]);
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = arm_qadd_q31(*pSrcA++, *pSrcB++);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = arm_qadd_q31(pSrcA[i], pSrcB[i]);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q15 vector subtraction pSrcA - pSrcB, saturated
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_sub_q15(q15_t* pSrcA, q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t a01 = ARM_READ_Q15x2(pSrcA);
+        q31_t b01 = ARM_READ_Q15x2(pSrcB);
+        q31_t a23 = ARM_READ_Q15x2(pSrcA + 2);
+        q31_t b23 = ARM_READ_Q15x2(pSrcB + 2);
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15(ARM_Q15_LO(a01) - ARM_Q15_LO(b01)),
+                                      ARM_SAT_Q15(ARM_Q15_HI(a01) - ARM_Q15_HI(b01)), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15(ARM_Q15_LO(a23) - ARM_Q15_LO(b23)),
+                                          ARM_SAT_Q15(ARM_Q15_HI(a23) - ARM_Q15_HI(b23)), 16));
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t)ARM_SAT_Q15((q31_t)*pSrcA++ - *pSrcB++);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q15_t)ARM_SAT_Q15((q31_t)pSrcA[i] - pSrcB[i]);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 vector subtraction pSrcA - pSrcB, saturated
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_sub_q31(q31_t* pSrcA, q31_t* pSrcB, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        pDst[0] = arm_qsub_q31(pSrcA[0], pSrcB[0]);
+        pDst[1] = arm_qsub_q31(pSrcA[1], pSrcB[1]);
+        pDst[2] = arm_qsub_q31(pSrcA[2], pSrcB[2]);
+        pDst[3] = arm_qsub_q31(pSrcA[3], pSrcB[3]);
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = arm_qsub_q31(*pSrcA++, *pSrcB++);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = arm_qsub_q31(pSrcA[i], pSrcB[i]);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q15 vector multiplication, saturated
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[out]	pDst		Output vector, (a * b) >> 15
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_mult_q15(q15_t* pSrcA, q15_t* pSrcB, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t a01 = ARM_READ_Q15x2(pSrcA);
+        q31_t b01 = ARM_READ_Q15x2(pSrcB);
+        q31_t a23 = ARM_READ_Q15x2(pSrcA + 2);
+        q31_t b23 = ARM_READ_Q15x2(pSrcB + 2);
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15((ARM_Q15_LO(a01) * ARM_Q15_LO(b01)) >> 15),
+                                      ARM_SAT_Q15((ARM_Q15_HI(a01) * ARM_Q15_HI(b01)) >> 15), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15((ARM_Q15_LO(a23) * ARM_Q15_LO(b23)) >> 15),
+                                          ARM_SAT_Q15((ARM_Q15_HI(a23) * ARM_Q15_HI(b23)) >> 15), 16));
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t)ARM_SAT_Q15(((q31_t)*pSrcA++ * *pSrcB++) >> 15);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q15_t)ARM_SAT_Q15(((q31_t)pSrcA[i] * pSrcB[i]) >> 15);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 vector multiplication, saturated
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[out]	pDst		Output vector, the high word of a * b saturated
+ * 							to 31 bits and shifted left by 1
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_mult_q31(q31_t* pSrcA, q31_t* pSrcB, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        /* SMULL, keeping the high word. Only -1 * -1 reaches 2^30 and saturates. */
+        q31_t p0 = (q31_t)(((q63_t)pSrcA[0] * pSrcB[0]) >> 32);
+        q31_t p1 = (q31_t)(((q63_t)pSrcA[1] * pSrcB[1]) >> 32);
+        q31_t p2 = (q31_t)(((q63_t)pSrcA[2] * pSrcB[2]) >> 32);
+        q31_t p3 = (q31_t)(((q63_t)pSrcA[3] * pSrcB[3]) >> 32);
+
+        pDst[0] = (q31_t)__SSAT(p0, 31) << 1;
+        pDst[1] = (q31_t)__SSAT(p1, 31) << 1;
+        pDst[2] = (q31_t)__SSAT(p2, 31) << 1;
+        pDst[3] = (q31_t)__SSAT(p3, 31) << 1;
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        q31_t p = (q31_t)(((q63_t)*pSrcA++ * *pSrcB++) >> 32);
+
+        *pDst++ = (q31_t)__SSAT(p, 31) << 1;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        q31_t p = (q31_t)(((q63_t)pSrcA[i] * pSrcB[i]) >> 32);
+
+        pDst[i] = ((p > 0x3FFFFFFF) ? 0x3FFFFFFF : p) * 2;
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Multiply a Q15 vector by a scalar, saturated
+ * @param[in]	pSrc		Input vector
+ * @param[in]	scaleFract	Fractional part of the scale
+ * @param[in]	shift		Exponent of the scale, at most 15: the scale is
+ * 							scaleFract * 2^shift
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_scale_q15(q15_t* pSrc, q15_t scaleFract, int8_t shift, q15_t* pDst, uint32_t blockSize)
+{
+    int32_t kShift = 15 - shift;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in01 = ARM_READ_Q15x2(pSrc);
+        q31_t in23 = ARM_READ_Q15x2(pSrc + 2);
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15((ARM_Q15_LO(in01) * scaleFract) >> kShift),
+                                      ARM_SAT_Q15((ARM_Q15_HI(in01) * scaleFract) >> kShift), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15((ARM_Q15_LO(in23) * scaleFract) >> kShift),
+                                          ARM_SAT_Q15((ARM_Q15_HI(in23) * scaleFract) >> kShift), 16));
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t)ARM_SAT_Q15(((q31_t)*pSrc++ * scaleFract) >> kShift);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q15_t)ARM_SAT_Q15(((q31_t)pSrc[i] * scaleFract) >> kShift);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Multiply a Q31 vector by a scalar, saturated
+ * @param[in]	pSrc		Input vector
+ * @param[in]	scaleFract	Fractional part of the scale
+ * @param[in]	shift		Exponent of the scale, from -32 to 30: the scale
+ * 							is scaleFract * 2^shift
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ *
+ * Note: the product keeps its high word (2.30) before the shift, as the
+ * SMULL of the M3 gives it.
+ **********************************************************************/
+void arm_scale_q31(q31_t* pSrc, q31_t scaleFract, int8_t shift, q31_t* pDst, uint32_t blockSize)
+{
+    int32_t kShift = shift + 1;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize;
+
+    if (kShift < 0)
+    {
+        while (blkCnt > 0u)
+        {
+            *pDst++ = (q31_t)(((q63_t)*pSrc++ * scaleFract) >> 32) >> -kShift;
+            blkCnt--;
+        }
+        return;
+    }
+    blkCnt = blockSize >> 2;
+    while (blkCnt > 0u)
+    {
+        for (uint32_t i = 0; i < 4u; i++)
+        {
+            q31_t in = (q31_t)(((q63_t)pSrc[i] * scaleFract) >> 32);
+            q31_t out = (q31_t)((uint32_t)in << kShift);
+
+            pDst[i] = (in != (out >> kShift)) ? (ARM_Q31_MAX ^ (in >> 31)) : out;
+        }
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        q31_t in = (q31_t)(((q63_t)*pSrc++ * scaleFract) >> 32);
+        q31_t out = (q31_t)((uint32_t)in << kShift);
+
+        *pDst++ = (in != (out >> kShift)) ? (ARM_Q31_MAX ^ (in >> 31)) : out;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        q63_t in = ((q63_t)pSrc[i] * scaleFract) >> 32;
+
+        pDst[i] = (kShift < 0) ? (q31_t)(in >> -kShift) : clip_q63_to_q31(in * ((q63_t)1 << kShift));
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q15 vector absolute value, saturated (-1 gives 0x7FFF)
+ * @param[in]	pSrc		Input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_abs_q15(q15_t* pSrc, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in01 = ARM_READ_Q15x2(pSrc);
+        q31_t in23 = ARM_READ_Q15x2(pSrc + 2);
+        q31_t x0 = ARM_Q15_LO(in01);
+        q31_t x1 = ARM_Q15_HI(in01);
+        q31_t x2 = ARM_Q15_LO(in23);
+        q31_t x3 = ARM_Q15_HI(in23);
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15((x0 > 0) ? x0 : -x0), ARM_SAT_Q15((x1 > 0) ? x1 : -x1), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15((x2 > 0) ? x2 : -x2), ARM_SAT_Q15((x3 > 0) ? x3 : -x3), 16));
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        q31_t x = *pSrc++;
+
+        *pDst++ = (q15_t)ARM_SAT_Q15((x > 0) ? x : -x);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (pSrc[i] == (q15_t)ARM_Q15_MIN) ? (q15_t)ARM_Q15_MAX : (q15_t)((pSrc[i] > 0) ? pSrc[i] : -pSrc[i]);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 vector absolute value, saturated (-1 gives 0x7FFFFFFF)
+ * @param[in]	pSrc		Input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_abs_q31(q31_t* pSrc, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        for (uint32_t i = 0; i < 4u; i++)
+        {
+            q31_t x = pSrc[i];
+
+            /* x ^ sign - sign is -x for x < 0, and 0x80000000 for -1: the sign of the result flags it */
+            x = (q31_t)((uint32_t)(x ^ (x >> 31)) - (uint32_t)(x >> 31));
+            pDst[i] = (x < 0) ? ARM_Q31_MAX : x;
+        }
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        q31_t x = *pSrc++;
+
+        x = (q31_t)((uint32_t)(x ^ (x >> 31)) - (uint32_t)(x >> 31));
+        *pDst++ = (x < 0) ? ARM_Q31_MAX : x;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (pSrc[i] == ARM_Q31_MIN) ? ARM_Q31_MAX : ((pSrc[i] > 0) ? pSrc[i] : -pSrc[i]);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Add a constant to a Q15 vector, saturated
+ * @param[in]	pSrc		Input vector
+ * @param[in]	offset		Constant added to every sample
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_offset_q15(q15_t* pSrc, q15_t offset, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in01 = ARM_READ_Q15x2(pSrc);
+        q31_t in23 = ARM_READ_Q15x2(pSrc + 2);
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15(ARM_Q15_LO(in01) + offset),
+                                      ARM_SAT_Q15(ARM_Q15_HI(in01) + offset), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15(ARM_Q15_LO(in23) + offset),
+                                          ARM_SAT_Q15(ARM_Q15_HI(in23) + offset), 16));
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t)ARM_SAT_Q15((q31_t)*pSrc++ + offset);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q15_t)ARM_SAT_Q15((q31_t)pSrc[i] + offset);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Add a constant to a Q31 vector, saturated
+ * @param[in]	pSrc		Input vector
+ * @param[in]	offset		Constant added to every sample
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_offset_q31(q31_t* pSrc, q31_t offset, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        pDst[0] = arm_qadd_q31(pSrc[0], offset);
+        pDst[1] = arm_qadd_q31(pSrc[1], offset);
+        pDst[2] = arm_qadd_q31(pSrc[2], offset);
+        pDst[3] = arm_qadd_q31(pSrc[3], offset);
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = arm_qadd_q31(*pSrc++, offset);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = arm_qadd_q31(pSrc[i], offset);
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Dot product of Q15 vectors
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[in]	blockSize	Number of samples
+ * @param[out]	result		Sum of the 2.30 products, in 34.30 format
+ * @return		None
+ **********************************************************************/
+void arm_dot_prod_q15(q15_t* pSrcA, q15_t* pSrcB, uint32_t blockSize, q63_t* result)
+{
+    q63_t sum = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t a01 = ARM_READ_Q15x2(pSrcA);
+        q31_t b01 = ARM_READ_Q15x2(pSrcB);
+        q31_t a23 = ARM_READ_Q15x2(pSrcA + 2);
+        q31_t b23 = ARM_READ_Q15x2(pSrcB + 2);
+
+        sum += (q63_t)(ARM_Q15_LO(a01) * ARM_Q15_LO(b01));
+        sum += (q63_t)(ARM_Q15_HI(a01) * ARM_Q15_HI(b01));
+        sum += (q63_t)(ARM_Q15_LO(a23) * ARM_Q15_LO(b23));
+        sum += (q63_t)(ARM_Q15_HI(a23) * ARM_Q15_HI(b23));
+        pSrcA += 4;
+        pSrcB += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        sum += (q63_t)((q31_t)*pSrcA++ * *pSrcB++);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        sum += (q63_t)pSrcA[i] * pSrcB[i];
+    }
+#endif
+    *result = sum;
+}
+
+/*********************************************************************/ /**
+ * @brief		Dot product of Q31 vectors
+ * @param[in]	pSrcA		First input vector
+ * @param[in]	pSrcB		Second input vector
+ * @param[in]	blockSize	Number of samples
+ * @param[out]	result		Sum of the 2.62 products shifted right by 14,
+ * 							in 16.48 format
+ * @return		None
+ **********************************************************************/
+void arm_dot_prod_q31(q31_t* pSrcA, q31_t* pSrcB, uint32_t blockSize, q63_t* result)
+{
+    q63_t sum = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        sum += ((q63_t)pSrcA[0] * pSrcB[0]) >> 14;
+        sum += ((q63_t)pSrcA[1] * pSrcB[1]) >> 14;
+        sum += ((q63_t)pSrcA[2] * pSrcB[2]) >> 14;
+        sum += ((q63_t)pSrcA[3] * pSrcB[3]) >> 14;
+        pSrcA += 4;
+        pSrcB += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        sum += ((q63_t)*pSrcA++ * *pSrcB++) >> 14;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        sum += ((q63_t)pSrcA[i] * pSrcB[i]) >> 14;
+    }
+#endif
+    *result = sum;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,148 @@
+/**********************************************************************
+ * @file		arm_common_tables.c
+ * @brief	Tables shared by the transforms of the DSP library
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_common_tables.h"
+
+/* Public Variables ----------------------------------------------------------- */
+
+/*
+ * Q15 twiddle factors of the 1024-point complex FFT, {cos(2 pi n / 1024), sin(2 pi n / 1024)} for n from 0 to 767:
+ * the radix-4 butterflies never need the last quarter of the circle. Shorter transforms step through the table by
+ * 1024 / fftLen. The values are rounded, 1.0 saturates to 0x7FFF.
+ */
+const q15_t twiddleCoefQ15[1536] = {
+    0x7FFF, 0x0000, 0x7FFF, 0x00C9, 0x7FFE, 0x0192, 0x7FFA, 0x025B, 0x7FF6, 0x0324, 0x7FF1, 0x03ED,
+    0x7FEA, 0x04B6, 0x7FE2, 0x057F, 0x7FD9, 0x0648, 0x7FCE, 0x0711, 0x7FC2, 0x07D9, 0x7FB5, 0x08A2,
+    0x7FA7, 0x096B, 0x7F98, 0x0A33, 0x7F87, 0x0AFB, 0x7F75, 0x0BC4, 0x7F62, 0x0C8C, 0x7F4E, 0x0D54,
+    0x7F38, 0x0E1C, 0x7F22, 0x0EE4, 0x7F0A, 0x0FAB, 0x7EF0, 0x1073, 0x7ED6, 0x113A, 0x7EBA, 0x1201,
+    0x7E9D, 0x12C8, 0x7E7F, 0x138F, 0x7E60, 0x1455, 0x7E3F, 0x151C, 0x7E1E, 0x15E2, 0x7DFB, 0x16A8,
+    0x7DD6, 0x176E, 0x7DB1, 0x1833, 0x7D8A, 0x18F9, 0x7D63, 0x19BE, 0x7D3A, 0x1A83, 0x7D0F, 0x1B47,
+    0x7CE4, 0x1C0C, 0x7CB7, 0x1CD0, 0x7C89, 0x1D93, 0x7C5A, 0x1E57, 0x7C2A, 0x1F1A, 0x7BF9, 0x1FDD,
+    0x7BC6, 0x209F, 0x7B92, 0x2162, 0x7B5D, 0x2224, 0x7B27, 0x22E5, 0x7AEF, 0x23A7, 0x7AB7, 0x2467,
+    0x7A7D, 0x2528, 0x7A42, 0x25E8, 0x7A06, 0x26A8, 0x79C9, 0x2768, 0x798A, 0x2827, 0x794A, 0x28E5,
+    0x790A, 0x29A4, 0x78C8, 0x2A62, 0x7885, 0x2B1F, 0x7840, 0x2BDC, 0x77FB, 0x2C99, 0x77B4, 0x2D55,
+    0x776C, 0x2E11, 0x7723, 0x2ECC, 0x76D9, 0x2F87, 0x768E, 0x3042, 0x7642, 0x30FC, 0x75F4, 0x31B5,
+    0x75A6, 0x326E, 0x7556, 0x3327, 0x7505, 0x33DF, 0x74B3, 0x3497, 0x7460, 0x354E, 0x740B, 0x3604,
+    0x73B6, 0x36BA, 0x735F, 0x3770, 0x7308, 0x3825, 0x72AF, 0x38D9, 0x7255, 0x398D, 0x71FA, 0x3A40,
+    0x719E, 0x3AF3, 0x7141, 0x3BA5, 0x70E3, 0x3C57, 0x7083, 0x3D08, 0x7023, 0x3DB8, 0x6FC2, 0x3E68,
+    0x6F5F, 0x3F17, 0x6EFB, 0x3FC6, 0x6E97, 0x4074, 0x6E31, 0x4121, 0x6DCA, 0x41CE, 0x6D62, 0x427A,
+    0x6CF9, 0x4326, 0x6C8F, 0x43D1, 0x6C24, 0x447B, 0x6BB8, 0x4524, 0x6B4B, 0x45CD, 0x6ADD, 0x4675,
+    0x6A6E, 0x471D, 0x69FD, 0x47C4, 0x698C, 0x486A, 0x691A, 0x490F, 0x68A7, 0x49B4, 0x6832, 0x4A58,
+    0x67BD, 0x4AFB, 0x6747, 0x4B9E, 0x66D0, 0x4C40, 0x6657, 0x4CE1, 0x65DE, 0x4D81, 0x6564, 0x4E21,
+    0x64E9, 0x4EC0, 0x646C, 0x4F5E, 0x63EF, 0x4FFB, 0x6371, 0x5098, 0x62F2, 0x5134, 0x6272, 0x51CF,
+    0x61F1, 0x5269, 0x616F, 0x5303, 0x60EC, 0x539B, 0x6068, 0x5433, 0x5FE4, 0x54CA, 0x5F5E, 0x5560,
+    0x5ED7, 0x55F6, 0x5E50, 0x568A, 0x5DC8, 0x571E, 0x5D3E, 0x57B1, 0x5CB4, 0x5843, 0x5C29, 0x58D4,
+    0x5B9D, 0x5964, 0x5B10, 0x59F4, 0x5A82, 0x5A82, 0x59F4, 0x5B10, 0x5964, 0x5B9D, 0x58D4, 0x5C29,
+    0x5843, 0x5CB4, 0x57B1, 0x5D3E, 0x571E, 0x5DC8, 0x568A, 0x5E50, 0x55F6, 0x5ED7, 0x5560, 0x5F5E,
+    0x54CA, 0x5FE4, 0x5433, 0x6068, 0x539B, 0x60EC, 0x5303, 0x616F, 0x5269, 0x61F1, 0x51CF, 0x6272,
+    0x5134, 0x62F2, 0x5098, 0x6371, 0x4FFB, 0x63EF, 0x4F5E, 0x646C, 0x4EC0, 0x64E9, 0x4E21, 0x6564,
+    0x4D81, 0x65DE, 0x4CE1, 0x6657, 0x4C40, 0x66D0, 0x4B9E, 0x6747, 0x4AFB, 0x67BD, 0x4A58, 0x6832,
+    0x49B4, 0x68A7, 0x490F, 0x691A, 0x486A, 0x698C, 0x47C4, 0x69FD, 0x471D, 0x6A6E, 0x4675, 0x6ADD,
+    0x45CD, 0x6B4B, 0x4524, 0x6BB8, 0x447B, 0x6C24, 0x43D1, 0x6C8F, 0x4326, 0x6CF9, 0x427A, 0x6D62,
+    0x41CE, 0x6DCA, 0x4121, 0x6E31, 0x4074, 0x6E97, 0x3FC6, 0x6EFB, 0x3F17, 0x6F5F, 0x3E68, 0x6FC2,
+    0x3DB8, 0x7023, 0x3D08, 0x7083, 0x3C57, 0x70E3, 0x3BA5, 0x7141, 0x3AF3, 0x719E, 0x3A40, 0x71FA,
+    0x398D, 0x7255, 0x38D9, 0x72AF, 0x3825, 0x7308, 0x3770, 0x735F, 0x36BA, 0x73B6, 0x3604, 0x740B,
+    0x354E, 0x7460, 0x3497, 0x74B3, 0x33DF, 0x7505, 0x3327, 0x7556, 0x326E, 0x75A6, 0x31B5, 0x75F4,
+    0x30FC, 0x7642, 0x3042, 0x768E, 0x2F87, 0x76D9, 0x2ECC, 0x7723, 0x2E11, 0x776C, 0x2D55, 0x77B4,
+    0x2C99, 0x77FB, 0x2BDC, 0x7840, 0x2B1F, 0x7885, 0x2A62, 0x78C8, 0x29A4, 0x790A, 0x28E5, 0x794A,
+    0x2827, 0x798A, 0x2768, 0x79C9, 0x26A8, 0x7A06, 0x25E8, 0x7A42, 0x2528, 0x7A7D, 0x2467, 0x7AB7,
+    0x23A7, 0x7AEF, 0x22E5, 0x7B27, 0x2224, 0x7B5D, 0x2162, 0x7B92, 0x209F, 0x7BC6, 0x1FDD, 0x7BF9,
+    0x1F1A, 0x7C2A, 0x1E57, 0x7C5A, 0x1D93, 0x7C89, 0x1CD0, 0x7CB7, 0x1C0C, 0x7CE4, 0x1B47, 0x7D0F,
+    0x1A83, 0x7D3A, 0x19BE, 0x7D63, 0x18F9, 0x7D8A, 0x1833, 0x7DB1, 0x176E, 0x7DD6, 0x16A8, 0x7DFB,
+    0x15E2, 0x7E1E, 0x151C, 0x7E3F, 0x1455, 0x7E60, 0x138F, 0x7E7F, 0x12C8, 0x7E9D, 0x1201, 0x7EBA,
+    0x113A, 0x7ED6, 0x1073, 0x7EF0, 0x0FAB, 0x7F0A, 0x0EE4, 0x7F22, 0x0E1C, 0x7F38, 0x0D54, 0x7F4E,
+    0x0C8C, 0x7F62, 0x0BC4, 0x7F75, 0x0AFB, 0x7F87, 0x0A33, 0x7F98, 0x096B, 0x7FA7, 0x08A2, 0x7FB5,
+    0x07D9, 0x7FC2, 0x0711, 0x7FCE, 0x0648, 0x7FD9, 0x057F, 0x7FE2, 0x04B6, 0x7FEA, 0x03ED, 0x7FF1,
+    0x0324, 0x7FF6, 0x025B, 0x7FFA, 0x0192, 0x7FFE, 0x00C9, 0x7FFF, 0x0000, 0x7FFF, -0x00C9, 0x7FFF,
+    -0x0192, 0x7FFE, -0x025B, 0x7FFA, -0x0324, 0x7FF6, -0x03ED, 0x7FF1, -0x04B6, 0x7FEA, -0x057F, 0x7FE2,
+    -0x0648, 0x7FD9, -0x0711, 0x7FCE, -0x07D9, 0x7FC2, -0x08A2, 0x7FB5, -0x096B, 0x7FA7, -0x0A33, 0x7F98,
+    -0x0AFB, 0x7F87, -0x0BC4, 0x7F75, -0x0C8C, 0x7F62, -0x0D54, 0x7F4E, -0x0E1C, 0x7F38, -0x0EE4, 0x7F22,
+    -0x0FAB, 0x7F0A, -0x1073, 0x7EF0, -0x113A, 0x7ED6, -0x1201, 0x7EBA, -0x12C8, 0x7E9D, -0x138F, 0x7E7F,
+    -0x1455, 0x7E60, -0x151C, 0x7E3F, -0x15E2, 0x7E1E, -0x16A8, 0x7DFB, -0x176E, 0x7DD6, -0x1833, 0x7DB1,
+    -0x18F9, 0x7D8A, -0x19BE, 0x7D63, -0x1A83, 0x7D3A, -0x1B47, 0x7D0F, -0x1C0C, 0x7CE4, -0x1CD0, 0x7CB7,
+    -0x1D93, 0x7C89, -0x1E57, 0x7C5A, -0x1F1A, 0x7C2A, -0x1FDD, 0x7BF9, -0x209F, 0x7BC6, -0x2162, 0x7B92,
+    -0x2224, 0x7B5D, -0x22E5, 0x7B27, -0x23A7, 0x7AEF, -0x2467, 0x7AB7, -0x2528, 0x7A7D, -0x25E8, 0x7A42,
+    -0x26A8, 0x7A06, -0x2768, 0x79C9, -0x2827, 0x798A, -0x28E5, 0x794A, -0x29A4, 0x790A, -0x2A62, 0x78C8,
+    -0x2B1F, 0x7885, -0x2BDC, 0x7840, -0x2C99, 0x77FB, -0x2D55, 0x77B4, -0x2E11, 0x776C, -0x2ECC, 0x7723,
+    -0x2F87, 0x76D9, -0x3042, 0x768E, -0x30FC, 0x7642, -0x31B5, 0x75F4, -0x326E, 0x75A6, -0x3327, 0x7556,
+    -0x33DF, 0x7505, -0x3497, 0x74B3, -0x354E, 0x7460, -0x3604, 0x740B, -0x36BA, 0x73B6, -0x3770, 0x735F,
+    -0x3825, 0x7308, -0x38D9, 0x72AF, -0x398D, 0x7255, -0x3A40, 0x71FA, -0x3AF3, 0x719E, -0x3BA5, 0x7141,
+    -0x3C57, 0x70E3, -0x3D08, 0x7083, -0x3DB8, 0x7023, -0x3E68, 0x6FC2, -0x3F17, 0x6F5F, -0x3FC6, 0x6EFB,
+    -0x4074, 0x6E97, -0x4121, 0x6E31, -0x41CE, 0x6DCA, -0x427A, 0x6D62, -0x4326, 0x6CF9, -0x43D1, 0x6C8F,
+    -0x447B, 0x6C24, -0x4524, 0x6BB8, -0x45CD, 0x6B4B, -0x4675, 0x6ADD, -0x471D, 0x6A6E, -0x47C4, 0x69FD,
+    -0x486A, 0x698C, -0x490F, 0x691A, -0x49B4, 0x68A7, -0x4A58, 0x6832, -0x4AFB, 0x67BD, -0x4B9E, 0x6747,
+    -0x4C40, 0x66D0, -0x4CE1, 0x6657, -0x4D81, 0x65DE, -0x4E21, 0x6564, -0x4EC0, 0x64E9, -0x4F5E, 0x646C,
+    -0x4FFB, 0x63EF, -0x5098, 0x6371, -0x5134, 0x62F2, -0x51CF, 0x6272, -0x5269, 0x61F1, -0x5303, 0x616F,
+    -0x539B, 0x60EC, -0x5433, 0x6068, -0x54CA, 0x5FE4, -0x5560, 0x5F5E, -0x55F6, 0x5ED7, -0x568A, 0x5E50,
+    -0x571E, 0x5DC8, -0x57B1, 0x5D3E, -0x5843, 0x5CB4, -0x58D4, 0x5C29, -0x5964, 0x5B9D, -0x59F4, 0x5B10,
+    -0x5A82, 0x5A82, -0x5B10, 0x59F4, -0x5B9D, 0x5964, -0x5C29, 0x58D4, -0x5CB4, 0x5843, -0x5D3E, 0x57B1,
+    -0x5DC8, 0x571E, -0x5E50, 0x568A, -0x5ED7, 0x55F6, -0x5F5E, 0x5560, -0x5FE4, 0x54CA, -0x6068, 0x5433,
+    -0x60EC, 0x539B, -0x616F, 0x5303, -0x61F1, 0x5269, -0x6272, 0x51CF, -0x62F2, 0x5134, -0x6371, 0x5098,
+    -0x63EF, 0x4FFB, -0x646C, 0x4F5E, -0x64E9, 0x4EC0, -0x6564, 0x4E21, -0x65DE, 0x4D81, -0x6657, 0x4CE1,
+    -0x66D0, 0x4C40, -0x6747, 0x4B9E, -0x67BD, 0x4AFB, -0x6832, 0x4A58, -0x68A7, 0x49B4, -0x691A, 0x490F,
+    -0x698C, 0x486A, -0x69FD, 0x47C4, -0x6A6E, 0x471D, -0x6ADD, 0x4675, -0x6B4B, 0x45CD, -0x6BB8, 0x4524,
+    -0x6C24, 0x447B, -0x6C8F, 0x43D1, -0x6CF9, 0x4326, -0x6D62, 0x427A, -0x6DCA, 0x41CE, -0x6E31, 0x4121,
+    -0x6E97, 0x4074, -0x6EFB, 0x3FC6, -0x6F5F, 0x3F17, -0x6FC2, 0x3E68, -0x7023, 0x3DB8, -0x7083, 0x3D08,
+    -0x70E3, 0x3C57, -0x7141, 0x3BA5, -0x719E, 0x3AF3, -0x71FA, 0x3A40, -0x7255, 0x398D, -0x72AF, 0x38D9,
+    -0x7308, 0x3825, -0x735F, 0x3770, -0x73B6, 0x36BA, -0x740B, 0x3604, -0x7460, 0x354E, -0x74B3, 0x3497,
+    -0x7505, 0x33DF, -0x7556, 0x3327, -0x75A6, 0x326E, -0x75F4, 0x31B5, -0x7642, 0x30FC, -0x768E, 0x3042,
+    -0x76D9, 0x2F87, -0x7723, 0x2ECC, -0x776C, 0x2E11, -0x77B4, 0x2D55, -0x77FB, 0x2C99, -0x7840, 0x2BDC,
+    -0x7885, 0x2B1F, -0x78C8, 0x2A62, -0x790A, 0x29A4, -0x794A, 0x28E5, -0x798A, 0x2827, -0x79C9, 0x2768,
+    -0x7A06, 0x26A8, -0x7A42, 0x25E8, -0x7A7D, 0x2528, -0x7AB7, 0x2467, -0x7AEF, 0x23A7, -0x7B27, 0x22E5,
+    -0x7B5D, 0x2224, -0x7B92, 0x2162, -0x7BC6, 0x209F, -0x7BF9, 0x1FDD, -0x7C2A, 0x1F1A, -0x7C5A, 0x1E57,
+    -0x7C89, 0x1D93, -0x7CB7, 0x1CD0, -0x7CE4, 0x1C0C, -0x7D0F, 0x1B47, -0x7D3A, 0x1A83, -0x7D63, 0x19BE,
+    -0x7D8A, 0x18F9, -0x7DB1, 0x1833, -0x7DD6, 0x176E, -0x7DFB, 0x16A8, -0x7E1E, 0x15E2, -0x7E3F, 0x151C,
+    -0x7E60, 0x1455, -0x7E7F, 0x138F, -0x7E9D, 0x12C8, -0x7EBA, 0x1201, -0x7ED6, 0x113A, -0x7EF0, 0x1073,
+    -0x7F0A, 0x0FAB, -0x7F22, 0x0EE4, -0x7F38, 0x0E1C, -0x7F4E, 0x0D54, -0x7F62, 0x0C8C, -0x7F75, 0x0BC4,
+    -0x7F87, 0x0AFB, -0x7F98, 0x0A33, -0x7FA7, 0x096B, -0x7FB5, 0x08A2, -0x7FC2, 0x07D9, -0x7FCE, 0x0711,
+    -0x7FD9, 0x0648, -0x7FE2, 0x057F, -0x7FEA, 0x04B6, -0x7FF1, 0x03ED, -0x7FF6, 0x0324, -0x7FFA, 0x025B,
+    -0x7FFE, 0x0192, -0x7FFF, 0x00C9, -0x8000, 0x0000, -0x7FFF, -0x00C9, -0x7FFE, -0x0192, -0x7FFA, -0x025B,
+    -0x7FF6, -0x0324, -0x7FF1, -0x03ED, -0x7FEA, -0x04B6, -0x7FE2, -0x057F, -0x7FD9, -0x0648, -0x7FCE, -0x0711,
+    -0x7FC2, -0x07D9, -0x7FB5, -0x08A2, -0x7FA7, -0x096B, -0x7F98, -0x0A33, -0x7F87, -0x0AFB, -0x7F75, -0x0BC4,
+    -0x7F62, -0x0C8C, -0x7F4E, -0x0D54, -0x7F38, -0x0E1C, -0x7F22, -0x0EE4, -0x7F0A, -0x0FAB, -0x7EF0, -0x1073,
+    -0x7ED6, -0x113A, -0x7EBA, -0x1201, -0x7E9D, -0x12C8, -0x7E7F, -0x138F, -0x7E60, -0x1455, -0x7E3F, -0x151C,
+    -0x7E1E, -0x15E2, -0x7DFB, -0x16A8, -0x7DD6, -0x176E, -0x7DB1, -0x1833, -0x7D8A, -0x18F9, -0x7D63, -0x19BE,
+    -0x7D3A, -0x1A83, -0x7D0F, -0x1B47, -0x7CE4, -0x1C0C, -0x7CB7, -0x1CD0, -0x7C89, -0x1D93, -0x7C5A, -0x1E57,
+    -0x7C2A, -0x1F1A, -0x7BF9, -0x1FDD, -0x7BC6, -0x209F, -0x7B92, -0x2162, -0x7B5D, -0x2224, -0x7B27, -0x22E5,
+    -0x7AEF, -0x23A7, -0x7AB7, -0x2467, -0x7A7D, -0x2528, -0x7A42, -0x25E8, -0x7A06, -0x26A8, -0x79C9, -0x2768,
+    -0x798A, -0x2827, -0x794A, -0x28E5, -0x790A, -0x29A4, -0x78C8, -0x2A62, -0x7885, -0x2B1F, -0x7840, -0x2BDC,
+    -0x77FB, -0x2C99, -0x77B4, -0x2D55, -0x776C, -0x2E11, -0x7723, -0x2ECC, -0x76D9, -0x2F87, -0x768E, -0x3042,
+    -0x7642, -0x30FC, -0x75F4, -0x31B5, -0x75A6, -0x326E, -0x7556, -0x3327, -0x7505, -0x33DF, -0x74B3, -0x3497,
+    -0x7460, -0x354E, -0x740B, -0x3604, -0x73B6, -0x36BA, -0x735F, -0x3770, -0x7308, -0x3825, -0x72AF, -0x38D9,
+    -0x7255, -0x398D, -0x71FA, -0x3A40, -0x719E, -0x3AF3, -0x7141, -0x3BA5, -0x70E3, -0x3C57, -0x7083, -0x3D08,
+    -0x7023, -0x3DB8, -0x6FC2, -0x3E68, -0x6F5F, -0x3F17, -0x6EFB, -0x3FC6, -0x6E97, -0x4074, -0x6E31, -0x4121,
+    -0x6DCA, -0x41CE, -0x6D62, -0x427A, -0x6CF9, -0x4326, -0x6C8F, -0x43D1, -0x6C24, -0x447B, -0x6BB8, -0x4524,
+    -0x6B4B, -0x45CD, -0x6ADD, -0x4675, -0x6A6E, -0x471D, -0x69FD, -0x47C4, -0x698C, -0x486A, -0x691A, -0x490F,
+    -0x68A7, -0x49B4, -0x6832, -0x4A58, -0x67BD, -0x4AFB, -0x6747, -0x4B9E, -0x66D0, -0x4C40, -0x6657, -0x4CE1,
+    -0x65DE, -0x4D81, -0x6564, -0x4E21, -0x64E9, -0x4EC0, -0x646C, -0x4F5E, -0x63EF, -0x4FFB, -0x6371, -0x5098,
+    -0x62F2, -0x5134, -0x6272, -0x51CF, -0x61F1, -0x5269, -0x616F, -0x5303, -0x60EC, -0x539B, -0x6068, -0x5433,
+    -0x5FE4, -0x54CA, -0x5F5E, -0x5560, -0x5ED7, -0x55F6, -0x5E50, -0x568A, -0x5DC8, -0x571E, -0x5D3E, -0x57B1,
+    -0x5CB4, -0x5843, -0x5C29, -0x58D4, -0x5B9D, -0x5964, -0x5B10, -0x59F4, -0x5A82, -0x5A82, -0x59F4, -0x5B10,
+    -0x5964, -0x5B9D, -0x58D4, -0x5C29, -0x5843, -0x5CB4, -0x57B1, -0x5D3E, -0x571E, -0x5DC8, -0x568A, -0x5E50,
+    -0x55F6, -0x5ED7, -0x5560, -0x5F5E, -0x54CA, -0x5FE4, -0x5433, -0x6068, -0x539B, -0x60EC, -0x5303, -0x616F,
+    -0x5269, -0x61F1, -0x51CF, -0x6272, -0x5134, -0x62F2, -0x5098, -0x6371, -0x4FFB, -0x63EF, -0x4F5E, -0x646C,
+    -0x4EC0, -0x64E9, -0x4E21, -0x6564, -0x4D81, -0x65DE, -0x4CE1, -0x6657, -0x4C40, -0x66D0, -0x4B9E, -0x6747,
+    -0x4AFB, -0x67BD, -0x4A58, -0x6832, -0x49B4, -0x68A7, -0x490F, -0x691A, -0x486A, -0x698C, -0x47C4, -0x69FD,
+    -0x471D, -0x6A6E, -0x4675, -0x6ADD, -0x45CD, -0x6B4B, -0x4524, -0x6BB8, -0x447B, -0x6C24, -0x43D1, -0x6C8F,
+    -0x4326, -0x6CF9, -0x427A, -0x6D62, -0x41CE, -0x6DCA, -0x4121, -0x6E31, -0x4074, -0x6E97, -0x3FC6, -0x6EFB,
+    -0x3F17, -0x6F5F, -0x3E68, -0x6FC2, -0x3DB8, -0x7023, -0x3D08, -0x7083, -0x3C57, -0x70E3, -0x3BA5, -0x7141,
+    -0x3AF3, -0x719E, -0x3A40, -0x71FA, -0x398D, -0x7255, -0x38D9, -0x72AF, -0x3825, -0x7308, -0x3770, -0x735F,
+    -0x36BA, -0x73B6, -0x3604, -0x740B, -0x354E, -0x7460, -0x3497, -0x74B3, -0x33DF, -0x7505, -0x3327, -0x7556,
+    -0x326E, -0x75A6, -0x31B5, -0x75F4, -0x30FC, -0x7642, -0x3042, -0x768E, -0x2F87, -0x76D9, -0x2ECC, -0x7723,
+    -0x2E11, -0x776C, -0x2D55, -0x77B4, -0x2C99, -0x77FB, -0x2BDC, -0x7840, -0x2B1F, -0x7885, -0x2A62, -0x78C8,
+    -0x29A4, -0x790A, -0x28E5, -0x794A, -0x2827, -0x798A, -0x2768, -0x79C9, -0x26A8, -0x7A06, -0x25E8, -0x7A42,
+    -0x2528, -0x7A7D, -0x2467, -0x7AB7, -0x23A7, -0x7AEF, -0x22E5, -0x7B27, -0x2224, -0x7B5D, -0x2162, -0x7B92,
+    -0x209F, -0x7BC6, -0x1FDD, -0x7BF9, -0x1F1A, -0x7C2A, -0x1E57, -0x7C5A, -0x1D93, -0x7C89, -0x1CD0, -0x7CB7,
+    -0x1C0C, -0x7CE4, -0x1B47, -0x7D0F, -0x1A83, -0x7D3A, -0x19BE, -0x7D63, -0x18F9, -0x7D8A, -0x1833, -0x7DB1,
+    -0x176E, -0x7DD6, -0x16A8, -0x7DFB, -0x15E2, -0x7E1E, -0x151C, -0x7E3F, -0x1455, -0x7E60, -0x138F, -0x7E7F,
+    -0x12C8, -0x7E9D, -0x1201, -0x7EBA, -0x113A, -0x7ED6, -0x1073, -0x7EF0, -0x0FAB, -0x7F0A, -0x0EE4, -0x7F22,
+    -0x0E1C, -0x7F38, -0x0D54, -0x7F4E, -0x0C8C, -0x7F62, -0x0BC4, -0x7F75, -0x0AFB, -0x7F87, -0x0A33, -0x7F98,
+    -0x096B, -0x7FA7, -0x08A2, -0x7FB5, -0x07D9, -0x7FC2, -0x0711, -0x7FCE, -0x0648, -0x7FD9, -0x057F, -0x7FE2,
+    -0x04B6, -0x7FEA, -0x03ED, -0x7FF1, -0x0324, -0x7FF6, -0x025B, -0x7FFA, -0x0192, -0x7FFE, -0x00C9, -0x7FFF
+};
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,74 @@
+/**********************************************************************
+ * @file		arm_controller_q.c
+ * @brief	Q15 and Q31 PID controller setup of the DSP library. The
+ * 			controllers themselves, arm_pid_q15() and arm_pid_q31(),
+ * 			are inline in arm_math.h.
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q15 PID controller from its Kp, Ki and Kd
+ * @param[in]	S				Controller, with Kp, Ki and Kd set
+ * @param[in]	resetStateFlag	1 to clear the state, 0 to keep it
+ * @return		None
+ *
+ * Note: A1 packs -(Kp + 2 Kd) in its low half and Kd in its high half, so
+ * that arm_pid_q15() applies both to x[n-1] and x[n-2] with one SMLALD.
+ * The derived gains saturate.
+ **********************************************************************/
+void arm_pid_init_q15(arm_pid_instance_q15* S, int32_t resetStateFlag)
+{
+    S->A0 = (q15_t)ARM_SAT_Q15((q31_t)S->Kp + S->Ki + S->Kd);
+    S->A1 = __PKHBT(ARM_SAT_Q15(-((q31_t)S->Kp + 2 * (q31_t)S->Kd)), S->Kd, 16);
+    if (resetStateFlag)
+    {
+        arm_pid_reset_q15(S);
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Clear the state of a Q15 PID controller
+ * @param[in]	S	Controller
+ * @return		None
+ **********************************************************************/
+void arm_pid_reset_q15(arm_pid_instance_q15* S)
+{
+    memset(S->state, 0, sizeof(S->state));
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q31 PID controller from its Kp, Ki and Kd
+ * @param[in]	S				Controller, with Kp, Ki and Kd set
+ * @param[in]	resetStateFlag	1 to clear the state, 0 to keep it
+ * @return		None
+ *
+ * Note: the derived gains A0 = Kp + Ki + Kd, A1 = -(Kp + 2 Kd) and A2 = Kd
+ * saturate.
+ **********************************************************************/
+void arm_pid_init_q31(arm_pid_instance_q31* S, int32_t resetStateFlag)
+{
+    S->A0 = clip_q63_to_q31((q63_t)S->Kp + S->Ki + S->Kd);
+    S->A1 = clip_q63_to_q31(-((q63_t)S->Kp + 2 * (q63_t)S->Kd));
+    S->A2 = S->Kd;
+    if (resetStateFlag)
+    {
+        arm_pid_reset_q31(S);
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Clear the state of a Q31 PID controller
+ * @param[in]	S	Controller
+ * @return		None
+ **********************************************************************/
+void arm_pid_reset_q31(arm_pid_instance_q31* S)
+{
+    memset(S->state, 0, sizeof(S->state));
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,92 @@
+/**********************************************************************
+ * @file		arm_dsp_private.h
+ * @brief	Helpers shared by the fixed-point functions of the DSP library
+ * @version	1.0
+ **********************************************************************/
+
+/*
+ * Every block function of the library has two implementations of the same arithmetic:
+ * 	- the Cortex-M3 one (default): loops unrolled by 4, two q15 values per 32-bit load or store, 64-bit accumulators
+ * 	  that compile to SMLAL, SSAT for the saturation. The M3 has no SIMD instructions, so the packed values are split
+ * 	  in registers, which is still cheaper than a second load.
+ * 	- the portable C reference (ARM_MATH_PORTABLE defined): one sample per iteration, plain array indexing and the
+ * 	  saturation written in C. It is built on the host to check that both give the same bits.
+ */
+
+#ifndef ARM_DSP_PRIVATE_H_
+#define ARM_DSP_PRIVATE_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_math.h"
+
+/* Private Macros ------------------------------------------------------------- */
+
+/** Two q15 values read or written with one 32-bit access, the first one in the low half (little-endian). The type
+ * may alias q15_t and be 2-byte aligned: the M3 does unaligned LDR and STR. */
+typedef int32_t arm_q15x2_t __attribute__((may_alias, aligned(2)));
+
+#define ARM_READ_Q15x2(p)     (*(const arm_q15x2_t*)(p))
+#define ARM_WRITE_Q15x2(p, v) (*(arm_q15x2_t*)(p) = (v))
+#define ARM_Q15_LO(x)         ((q31_t)(q15_t)(x))
+#define ARM_Q15_HI(x)         ((q31_t)(x) >> 16)
+
+/** Largest and smallest q15 and q31 values */
+#define ARM_Q15_MAX ((q31_t)0x7FFF)
+#define ARM_Q15_MIN ((q31_t)-0x8000)
+#define ARM_Q31_MAX ((q31_t)0x7FFFFFFF)
+#define ARM_Q31_MIN ((q31_t)0x80000000)
+
+/* Private Functions ---------------------------------------------------------- */
+
+#ifndef ARM_MATH_PORTABLE
+
+/** Saturate to q15 */
+#define ARM_SAT_Q15(x) ((q31_t)__SSAT((x), 16))
+
+/** Saturating q31 addition and subtraction, from the sign of the 32-bit result: no 64-bit arithmetic */
+static __INLINE q31_t arm_qadd_q31(q31_t a, q31_t b)
+{
+    q31_t sum = (q31_t)((uint32_t)a + (uint32_t)b);
+
+    return (((sum ^ a) & (sum ^ b)) < 0) ? ((a >> 31) ^ ARM_Q31_MAX) : sum;
+}
+
+static __INLINE q31_t arm_qsub_q31(q31_t a, q31_t b)
+{
+    q31_t diff = (q31_t)((uint32_t)a - (uint32_t)b);
+
+    return (((a ^ b) & (diff ^ a)) < 0) ? ((a >> 31) ^ ARM_Q31_MAX) : diff;
+}
+
+#else
+
+static __INLINE q31_t arm_sat_q15(q31_t x)
+{
+    if (x > ARM_Q15_MAX)
+    {
+        return ARM_Q15_MAX;
+    }
+    if (x < ARM_Q15_MIN)
+    {
+        return ARM_Q15_MIN;
+    }
+    return x;
+}
+
+#define ARM_SAT_Q15(x) arm_sat_q15(x)
+
+static __INLINE q31_t arm_qadd_q31(q31_t a, q31_t b)
+{
+    return clip_q63_to_q31((q63_t)a + b);
+}
+
+static __INLINE q31_t arm_qsub_q31(q31_t a, q31_t b)
+{
+    return clip_q63_to_q31((q63_t)a - b);
+}
+
+#endif /* ARM_MATH_PORTABLE */
+
+#endif /* ARM_DSP_PRIVATE_H_ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,105 @@
+/**********************************************************************
+ * @file		arm_fast_math_q.c
+ * @brief	Q15 and Q31 square roots of the DSP library
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+
+/* Private Functions ---------------------------------------------------------- */
+
+/*
+ * Integer square root, rounded down, one result bit per iteration. The result is exact, unlike the Newton-Raphson
+ * approximation of the CMSIS library, and takes no table. The q15 root of x is isqrt(x << 15) and the q31 root
+ * isqrt(x << 31): the first one fits a 32-bit radicand.
+ */
+static uint32_t arm_isqrt_u32(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0u)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static uint32_t arm_isqrt_u64(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0u)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Q15 square root
+ * @param[in]	in		Input value, from 0 to 0x7FFF
+ * @param[out]	pOut	Square root, rounded down, or 0 for a negative input
+ * @return		ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for a negative
+ * 				input
+ **********************************************************************/
+arm_status arm_sqrt_q15(q15_t in, q15_t* pOut)
+{
+    if (in < 0)
+    {
+        *pOut = 0;
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    *pOut = (q15_t)arm_isqrt_u32((uint32_t)in << 15);
+    return ARM_MATH_SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 square root
+ * @param[in]	in		Input value, from 0 to 0x7FFFFFFF
+ * @param[out]	pOut	Square root, rounded down, or 0 for a negative input
+ * @return		ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for a negative
+ * 				input
+ **********************************************************************/
+arm_status arm_sqrt_q31(q31_t in, q31_t* pOut)
+{
+    if (in < 0)
+    {
+        *pOut = 0;
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    *pOut = (q31_t)arm_isqrt_u64((uint64_t)in << 31);
+    return ARM_MATH_SUCCESS;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,556 @@
+/**********************************************************************
+ * @file		arm_filtering_q.c
+ * @brief	Q15 and Q31 filtering functions of the DSP library:
+ * 			FIR and direct form I biquad cascade
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q15 FIR filter
+ * @param[in]	S			Filter instance
+ * @param[in]	numTaps		Number of coefficients, at least 1
+ * @param[in]	pCoeffs		Coefficients in time-reversed order:
+ * 							{b[numTaps-1], ..., b[1], b[0]}
+ * @param[in]	pState		State buffer of numTaps + blockSize - 1 samples
+ * @param[in]	blockSize	Largest number of samples per arm_fir_q15() call
+ * @return		ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if numTaps is 0
+ *
+ * Note: unlike the CMSIS library, any number of taps is accepted, odd ones
+ * too.
+ **********************************************************************/
+arm_status arm_fir_init_q15(arm_fir_instance_q15* S, uint16_t numTaps, q15_t* pCoeffs, q15_t* pState,
+                            uint32_t blockSize)
+{
+    if (numTaps == 0u)
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    memset(pState, 0, (numTaps + blockSize - 1u) * sizeof(q15_t));
+    return ARM_MATH_SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Q15 FIR filter
+ * @param[in]	S			Filter instance, initialized by arm_fir_init_q15()
+ * @param[in]	pSrc		Input samples
+ * @param[out]	pDst		Output samples
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ *
+ * Note: the 2.30 products are accumulated in 64 bits (34.30), without any
+ * overflow for the 65535 taps at most. The sum is shifted right by 15 and
+ * saturated to 16 bits.
+ **********************************************************************/
+void arm_fir_q15(const arm_fir_instance_q15* S, q15_t* pSrc, q15_t* pDst, uint32_t blockSize)
+{
+    q15_t* pState = S->pState;
+    const q15_t* pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt;
+
+    /* The new samples follow the numTaps - 1 last ones of the previous block */
+    arm_copy_q15(pSrc, pState + numTaps - 1u, blockSize);
+
+    /* Four outputs at a time: each coefficient and each state sample is loaded once for the four of them, two per
+     * 32-bit load */
+    blkCnt = blockSize >> 2;
+    while (blkCnt > 0u)
+    {
+        const q15_t* px = pState;
+        const q15_t* pb = pCoeffs;
+        q63_t acc0 = 0;
+        q63_t acc1 = 0;
+        q63_t acc2 = 0;
+        q63_t acc3 = 0;
+        q31_t x0 = px[0];
+        q31_t x1 = px[1];
+        q31_t x2 = px[2];
+        q31_t x3;
+        q31_t x4;
+        q31_t c;
+        uint32_t tapCnt = numTaps >> 1;
+
+        px += 3;
+        while (tapCnt > 0u)
+        {
+            q31_t c01 = ARM_READ_Q15x2(pb);
+            q31_t x34 = ARM_READ_Q15x2(px);
+
+            c = ARM_Q15_LO(c01);
+            x3 = ARM_Q15_LO(x34);
+            acc0 += (q63_t)c * x0;
+            acc1 += (q63_t)c * x1;
+            acc2 += (q63_t)c * x2;
+            acc3 += (q63_t)c * x3;
+
+            c = ARM_Q15_HI(c01);
+            x4 = ARM_Q15_HI(x34);
+            acc0 += (q63_t)c * x1;
+            acc1 += (q63_t)c * x2;
+            acc2 += (q63_t)c * x3;
+            acc3 += (q63_t)c * x4;
+
+            x0 = x2;
+            x1 = x3;
+            x2 = x4;
+            pb += 2;
+            px += 2;
+            tapCnt--;
+        }
+        if (numTaps & 1u)
+        {
+            c = *pb;
+            x3 = *px;
+            acc0 += (q63_t)c * x0;
+            acc1 += (q63_t)c * x1;
+            acc2 += (q63_t)c * x2;
+            acc3 += (q63_t)c * x3;
+        }
+
+        ARM_WRITE_Q15x2(pDst, __PKHBT(ARM_SAT_Q15((q31_t)(acc0 >> 15)), ARM_SAT_Q15((q31_t)(acc1 >> 15)), 16));
+        ARM_WRITE_Q15x2(pDst + 2, __PKHBT(ARM_SAT_Q15((q31_t)(acc2 >> 15)), ARM_SAT_Q15((q31_t)(acc3 >> 15)), 16));
+        pDst += 4;
+        pState += 4;
+        blkCnt--;
+    }
+
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        const q15_t* px = pState;
+        const q15_t* pb = pCoeffs;
+        q63_t acc = 0;
+        uint32_t tapCnt = numTaps;
+
+        while (tapCnt > 0u)
+        {
+            acc += (q63_t)*pb++ * *px++;
+            tapCnt--;
+        }
+        *pDst++ = (q15_t)ARM_SAT_Q15((q31_t)(acc >> 15));
+        pState++;
+        blkCnt--;
+    }
+
+    /* Keep the numTaps - 1 last samples for the next block */
+    arm_copy_q15(pState, S->pState, numTaps - 1u);
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pState[numTaps - 1u + i] = pSrc[i];
+    }
+    for (uint32_t n = 0; n < blockSize; n++)
+    {
+        q63_t acc = 0;
+
+        for (uint32_t k = 0; k < numTaps; k++)
+        {
+            acc += (q63_t)pCoeffs[k] * pState[n + k];
+        }
+        pDst[n] = (q15_t)ARM_SAT_Q15((q31_t)(acc >> 15));
+    }
+    for (uint32_t i = 0; i + 1u < numTaps; i++)
+    {
+        pState[i] = pState[blockSize + i];
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q31 FIR filter
+ * @param[in]	S			Filter instance
+ * @param[in]	numTaps		Number of coefficients, at least 1
+ * @param[in]	pCoeffs		Coefficients in time-reversed order:
+ * 							{b[numTaps-1], ..., b[1], b[0]}
+ * @param[in]	pState		State buffer of numTaps + blockSize - 1 samples
+ * @param[in]	blockSize	Largest number of samples per arm_fir_q31() call
+ * @return		None
+ **********************************************************************/
+void arm_fir_init_q31(arm_fir_instance_q31* S, uint16_t numTaps, q31_t* pCoeffs, q31_t* pState, uint32_t blockSize)
+{
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    memset(pState, 0, (numTaps + blockSize - 1u) * sizeof(q31_t));
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 FIR filter
+ * @param[in]	S			Filter instance, initialized by arm_fir_init_q31()
+ * @param[in]	pSrc		Input samples
+ * @param[out]	pDst		Output samples
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ *
+ * Note: the 2.62 products are accumulated in 64 bits and the sum is
+ * shifted right by 31 and truncated to 32 bits. The sum of the absolute
+ * values of the coefficients must stay below 1 to avoid wrapping.
+ **********************************************************************/
+void arm_fir_q31(const arm_fir_instance_q31* S, q31_t* pSrc, q31_t* pDst, uint32_t blockSize)
+{
+    q31_t* pState = S->pState;
+    const q31_t* pCoeffs = S->pCoeffs;
+    uint32_t numTaps = S->numTaps;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt;
+
+    arm_copy_q31(pSrc, pState + numTaps - 1u, blockSize);
+
+    /* Three outputs at a time, the most 64-bit accumulators the 13 registers of the M3 hold with the operands. The
+     * taps are unrolled by 3 so that the state samples rotate through x0, x1, x2 without moves. */
+    blkCnt = blockSize / 3u;
+    while (blkCnt > 0u)
+    {
+        const q31_t* px = pState;
+        const q31_t* pb = pCoeffs;
+        q63_t acc0 = 0;
+        q63_t acc1 = 0;
+        q63_t acc2 = 0;
+        q31_t x0 = px[0];
+        q31_t x1 = px[1];
+        q31_t x2;
+        q31_t c;
+        uint32_t tapCnt = numTaps / 3u;
+
+        px += 2;
+        while (tapCnt > 0u)
+        {
+            c = pb[0];
+            x2 = px[0];
+            acc0 += (q63_t)c * x0;
+            acc1 += (q63_t)c * x1;
+            acc2 += (q63_t)c * x2;
+
+            c = pb[1];
+            x0 = px[1];
+            acc0 += (q63_t)c * x1;
+            acc1 += (q63_t)c * x2;
+            acc2 += (q63_t)c * x0;
+
+            c = pb[2];
+            x1 = px[2];
+            acc0 += (q63_t)c * x2;
+            acc1 += (q63_t)c * x0;
+            acc2 += (q63_t)c * x1;
+
+            pb += 3;
+            px += 3;
+            tapCnt--;
+        }
+        tapCnt = numTaps % 3u;
+        while (tapCnt > 0u)
+        {
+            c = *pb++;
+            x2 = *px++;
+            acc0 += (q63_t)c * x0;
+            acc1 += (q63_t)c * x1;
+            acc2 += (q63_t)c * x2;
+            x0 = x1;
+            x1 = x2;
+            tapCnt--;
+        }
+
+        pDst[0] = (q31_t)(acc0 >> 31);
+        pDst[1] = (q31_t)(acc1 >> 31);
+        pDst[2] = (q31_t)(acc2 >> 31);
+        pDst += 3;
+        pState += 3;
+        blkCnt--;
+    }
+
+    blkCnt = blockSize % 3u;
+    while (blkCnt > 0u)
+    {
+        const q31_t* px = pState;
+        const q31_t* pb = pCoeffs;
+        q63_t acc = 0;
+        uint32_t tapCnt = numTaps;
+
+        while (tapCnt > 0u)
+        {
+            acc += (q63_t)*pb++ * *px++;
+            tapCnt--;
+        }
+        *pDst++ = (q31_t)(acc >> 31);
+        pState++;
+        blkCnt--;
+    }
+
+    arm_copy_q31(pState, S->pState, numTaps - 1u);
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pState[numTaps - 1u + i] = pSrc[i];
+    }
+    for (uint32_t n = 0; n < blockSize; n++)
+    {
+        q63_t acc = 0;
+
+        for (uint32_t k = 0; k < numTaps; k++)
+        {
+            acc += (q63_t)pCoeffs[k] * pState[n + k];
+        }
+        pDst[n] = (q31_t)(acc >> 31);
+    }
+    for (uint32_t i = 0; i + 1u < numTaps; i++)
+    {
+        pState[i] = pState[blockSize + i];
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q15 biquad cascade, direct form I
+ * @param[in]	S			Filter instance
+ * @param[in]	numStages	Number of second order stages
+ * @param[in]	pCoeffs		6 coefficients per stage: {b0, 0, b1, b2, a1, a2},
+ * 							the 0 keeps the pairs 32-bit aligned. The a
+ * 							coefficients are negated: y[n] = b0 x[n] +
+ * 							b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2].
+ * @param[in]	pState		4 samples per stage: {x[n-1], x[n-2], y[n-1], y[n-2]}
+ * @param[in]	postShift	Left shift of the outputs, for coefficients
+ * 							scaled down by 2^postShift to fit in q15
+ * @return		None
+ **********************************************************************/
+void arm_biquad_cascade_df1_init_q15(arm_biquad_casd_df1_inst_q15* S, uint8_t numStages, q15_t* pCoeffs,
+                                     q15_t* pState, int8_t postShift)
+{
+    S->numStages = (int8_t)numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->postShift = postShift;
+    memset(pState, 0, 4u * numStages * sizeof(q15_t));
+}
+
+/*********************************************************************/ /**
+ * @brief		Q15 biquad cascade, direct form I
+ * @param[in]	S			Filter instance, initialized by
+ * 							arm_biquad_cascade_df1_init_q15()
+ * @param[in]	pSrc		Input samples
+ * @param[out]	pDst		Output samples, may be pSrc
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ *
+ * Note: each stage sums its five 2.30 products in 64 bits, shifts the sum
+ * right by 15 - postShift and saturates it to 16 bits.
+ **********************************************************************/
+void arm_biquad_cascade_df1_q15(const arm_biquad_casd_df1_inst_q15* S, q15_t* pSrc, q15_t* pDst, uint32_t blockSize)
+{
+    const q15_t* pCoeffs = S->pCoeffs;
+    q15_t* pState = S->pState;
+    uint32_t shift = 15u - S->postShift;
+    q15_t* pIn = pSrc;
+    uint32_t stage = (uint32_t)S->numStages;
+
+    while (stage > 0u)
+    {
+#ifndef ARM_MATH_PORTABLE
+        /* The coefficients and the state of the stage stay in registers for the whole block */
+        q31_t b0 = ARM_Q15_LO(ARM_READ_Q15x2(pCoeffs));
+        q31_t b12 = ARM_READ_Q15x2(pCoeffs + 2);
+        q31_t a12 = ARM_READ_Q15x2(pCoeffs + 4);
+        q31_t b1 = ARM_Q15_LO(b12);
+        q31_t b2 = ARM_Q15_HI(b12);
+        q31_t a1 = ARM_Q15_LO(a12);
+        q31_t a2 = ARM_Q15_HI(a12);
+        q31_t x1 = pState[0];
+        q31_t x2 = pState[1];
+        q31_t y1 = pState[2];
+        q31_t y2 = pState[3];
+        const q15_t* px = pIn;
+        q15_t* py = pDst;
+        uint32_t sample = blockSize >> 1;
+        q63_t acc;
+
+        /* Two samples per iteration, read and written as a pair: the delay line rotates without moves */
+        while (sample > 0u)
+        {
+            q31_t in = ARM_READ_Q15x2(px);
+            q31_t xa = ARM_Q15_LO(in);
+            q31_t xb = ARM_Q15_HI(in);
+            q31_t ya;
+            q31_t yb;
+
+            acc = (q63_t)b0 * xa + (q63_t)b1 * x1 + (q63_t)b2 * x2 + (q63_t)a1 * y1 + (q63_t)a2 * y2;
+            ya = ARM_SAT_Q15((q31_t)(acc >> shift));
+            acc = (q63_t)b0 * xb + (q63_t)b1 * xa + (q63_t)b2 * x1 + (q63_t)a1 * ya + (q63_t)a2 * y1;
+            yb = ARM_SAT_Q15((q31_t)(acc >> shift));
+            ARM_WRITE_Q15x2(py, __PKHBT(ya, yb, 16));
+
+            x2 = xa;
+            x1 = xb;
+            y2 = ya;
+            y1 = yb;
+            px += 2;
+            py += 2;
+            sample--;
+        }
+        if (blockSize & 1u)
+        {
+            q31_t x0 = *px;
+            q31_t y0;
+
+            acc = (q63_t)b0 * x0 + (q63_t)b1 * x1 + (q63_t)b2 * x2 + (q63_t)a1 * y1 + (q63_t)a2 * y2;
+            y0 = ARM_SAT_Q15((q31_t)(acc >> shift));
+            *py = (q15_t)y0;
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+        }
+        pState[0] = (q15_t)x1;
+        pState[1] = (q15_t)x2;
+        pState[2] = (q15_t)y1;
+        pState[3] = (q15_t)y2;
+#else
+        for (uint32_t n = 0; n < blockSize; n++)
+        {
+            q31_t x0 = pIn[n];
+            q63_t acc = (q63_t)pCoeffs[0] * x0 + (q63_t)pCoeffs[2] * pState[0] + (q63_t)pCoeffs[3] * pState[1] +
+                        (q63_t)pCoeffs[4] * pState[2] + (q63_t)pCoeffs[5] * pState[3];
+            q15_t y0 = (q15_t)ARM_SAT_Q15((q31_t)(acc >> shift));
+
+            pState[1] = pState[0];
+            pState[0] = (q15_t)x0;
+            pState[3] = pState[2];
+            pState[2] = y0;
+            pDst[n] = y0;
+        }
+#endif
+        /* The next stage filters the output of this one */
+        pIn = pDst;
+        pCoeffs += 6;
+        pState += 4;
+        stage--;
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q31 biquad cascade, direct form I
+ * @param[in]	S			Filter instance
+ * @param[in]	numStages	Number of second order stages
+ * @param[in]	pCoeffs		5 coefficients per stage: {b0, b1, b2, a1, a2}.
+ * 							The a coefficients are negated, as for Q15.
+ * @param[in]	pState		4 samples per stage: {x[n-1], x[n-2], y[n-1], y[n-2]}
+ * @param[in]	postShift	Left shift of the outputs, for coefficients
+ * 							scaled down by 2^postShift to fit in q31
+ * @return		None
+ **********************************************************************/
+void arm_biquad_cascade_df1_init_q31(arm_biquad_casd_df1_inst_q31* S, uint8_t numStages, q31_t* pCoeffs,
+                                     q31_t* pState, int8_t postShift)
+{
+    S->numStages = numStages;
+    S->pCoeffs = pCoeffs;
+    S->pState = pState;
+    S->postShift = (uint8_t)postShift;
+    memset(pState, 0, 4u * numStages * sizeof(q31_t));
+}
+
+/*********************************************************************/ /**
+ * @brief		Q31 biquad cascade, direct form I
+ * @param[in]	S			Filter instance, initialized by
+ * 							arm_biquad_cascade_df1_init_q31()
+ * @param[in]	pSrc		Input samples
+ * @param[out]	pDst		Output samples, may be pSrc
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ *
+ * Note: each stage sums its five 2.62 products in 64 bits and shifts the
+ * sum right by 31 - postShift, truncated to 32 bits.
+ **********************************************************************/
+void arm_biquad_cascade_df1_q31(const arm_biquad_casd_df1_inst_q31* S, q31_t* pSrc, q31_t* pDst, uint32_t blockSize)
+{
+    const q31_t* pCoeffs = S->pCoeffs;
+    q31_t* pState = S->pState;
+    uint32_t shift = 31u - S->postShift;
+    q31_t* pIn = pSrc;
+    uint32_t stage = S->numStages;
+
+    while (stage > 0u)
+    {
+#ifndef ARM_MATH_PORTABLE
+        q31_t b0 = pCoeffs[0];
+        q31_t b1 = pCoeffs[1];
+        q31_t b2 = pCoeffs[2];
+        q31_t a1 = pCoeffs[3];
+        q31_t a2 = pCoeffs[4];
+        q31_t x1 = pState[0];
+        q31_t x2 = pState[1];
+        q31_t y1 = pState[2];
+        q31_t y2 = pState[3];
+        const q31_t* px = pIn;
+        q31_t* py = pDst;
+        uint32_t sample = blockSize >> 1;
+        q63_t acc;
+
+        while (sample > 0u)
+        {
+            q31_t xa = px[0];
+            q31_t xb = px[1];
+            q31_t ya;
+            q31_t yb;
+
+            acc = (q63_t)b0 * xa + (q63_t)b1 * x1 + (q63_t)b2 * x2 + (q63_t)a1 * y1 + (q63_t)a2 * y2;
+            ya = (q31_t)(acc >> shift);
+            acc = (q63_t)b0 * xb + (q63_t)b1 * xa + (q63_t)b2 * x1 + (q63_t)a1 * ya + (q63_t)a2 * y1;
+            yb = (q31_t)(acc >> shift);
+            py[0] = ya;
+            py[1] = yb;
+
+            x2 = xa;
+            x1 = xb;
+            y2 = ya;
+            y1 = yb;
+            px += 2;
+            py += 2;
+            sample--;
+        }
+        if (blockSize & 1u)
+        {
+            q31_t x0 = *px;
+            q31_t y0;
+
+            acc = (q63_t)b0 * x0 + (q63_t)b1 * x1 + (q63_t)b2 * x2 + (q63_t)a1 * y1 + (q63_t)a2 * y2;
+            y0 = (q31_t)(acc >> shift);
+            *py = y0;
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+        }
+        pState[0] = x1;
+        pState[1] = x2;
+        pState[2] = y1;
+        pState[3] = y2;
+#else
+        for (uint32_t n = 0; n < blockSize; n++)
+        {
+            q31_t x0 = pIn[n];
+            q63_t acc = (q63_t)pCoeffs[0] * x0 + (q63_t)pCoeffs[1] * pState[0] + (q63_t)pCoeffs[2] * pState[1] +
+                        (q63_t)pCoeffs[3] * pState[2] + (q63_t)pCoeffs[4] * pState[3];
+            q31_t y0 = (q31_t)(acc >> shift);
+
+            pState[1] = pState[0];
+            pState[0] = x0;
+            pState[3] = pState[2];
+            pState[2] = y0;
+            pDst[n] = y0;
+        }
+#endif
+        pIn = pDst;
+        pCoeffs += 5;
+        pState += 4;
+        stage--;
+    }
+}
+
+/* --------------------------------- End Of File ------------------------------ */
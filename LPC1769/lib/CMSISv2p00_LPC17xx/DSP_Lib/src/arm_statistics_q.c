@@ -0,0 +1,408 @@
+/**********************************************************************
+ * @file		arm_statistics_q.c
+ * @brief	Q15 and Q31 statistics functions of the DSP library:
+ * 			mean, power, RMS, maximum and minimum
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+
+/* Private Functions ---------------------------------------------------------- */
+
+/* Sum of the Q15 samples and of their squares (34.30) */
+static void arm_sums_q15(const q15_t* pSrc, uint32_t blockSize, q31_t* pSum, q63_t* pSumSq)
+{
+    q31_t sum = 0;
+    q63_t sumSq = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in01 = ARM_READ_Q15x2(pSrc);
+        q31_t in23 = ARM_READ_Q15x2(pSrc + 2);
+        q31_t x0 = ARM_Q15_LO(in01);
+        q31_t x1 = ARM_Q15_HI(in01);
+        q31_t x2 = ARM_Q15_LO(in23);
+        q31_t x3 = ARM_Q15_HI(in23);
+
+        sum += x0 + x1 + x2 + x3;
+        sumSq += (q63_t)(x0 * x0);
+        sumSq += (q63_t)(x1 * x1);
+        sumSq += (q63_t)(x2 * x2);
+        sumSq += (q63_t)(x3 * x3);
+        pSrc += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        q31_t x = *pSrc++;
+
+        sum += x;
+        sumSq += (q63_t)(x * x);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        sum += pSrc[i];
+        sumSq += (q63_t)pSrc[i] * pSrc[i];
+    }
+#endif
+    if (pSum != NULL)
+    {
+        *pSum = sum;
+    }
+    if (pSumSq != NULL)
+    {
+        *pSumSq = sumSq;
+    }
+}
+
+/* Sum of the Q31 samples and of their 2.62 squares, the second one shifted right by shift */
+static void arm_sums_q31(const q31_t* pSrc, uint32_t blockSize, q63_t* pSum, q63_t* pSumSq, uint32_t shift)
+{
+    q63_t sum = 0;
+    q63_t sumSq = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t x0 = pSrc[0];
+        q31_t x1 = pSrc[1];
+        q31_t x2 = pSrc[2];
+        q31_t x3 = pSrc[3];
+
+        sum += (q63_t)x0 + x1 + x2 + x3;
+        sumSq += ((q63_t)x0 * x0) >> shift;
+        sumSq += ((q63_t)x1 * x1) >> shift;
+        sumSq += ((q63_t)x2 * x2) >> shift;
+        sumSq += ((q63_t)x3 * x3) >> shift;
+        pSrc += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        q31_t x = *pSrc++;
+
+        sum += x;
+        sumSq += ((q63_t)x * x) >> shift;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        sum += pSrc[i];
+        sumSq += ((q63_t)pSrc[i] * pSrc[i]) >> shift;
+    }
+#endif
+    if (pSum != NULL)
+    {
+        *pSum = sum;
+    }
+    if (pSumSq != NULL)
+    {
+        *pSumSq = sumSq;
+    }
+}
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Mean of a Q15 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, from 1 to 65536
+ * @param[out]	pResult		Mean, truncated toward 0
+ * @return		None
+ **********************************************************************/
+void arm_mean_q15(q15_t* pSrc, uint32_t blockSize, q15_t* pResult)
+{
+    q31_t sum;
+
+    arm_sums_q15(pSrc, blockSize, &sum, NULL);
+    *pResult = (q15_t)(sum / (q31_t)blockSize);
+}
+
+/*********************************************************************/ /**
+ * @brief		Mean of a Q31 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		Mean, truncated toward 0
+ * @return		None
+ **********************************************************************/
+void arm_mean_q31(q31_t* pSrc, uint32_t blockSize, q31_t* pResult)
+{
+    q63_t sum;
+
+    arm_sums_q31(pSrc, blockSize, &sum, NULL, 0);
+    *pResult = (q31_t)(sum / (q63_t)blockSize);
+}
+
+/*********************************************************************/ /**
+ * @brief		Sum of the squares of a Q15 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples
+ * @param[out]	pResult		Sum of the 2.30 squares, in 34.30 format
+ * @return		None
+ **********************************************************************/
+void arm_power_q15(q15_t* pSrc, uint32_t blockSize, q63_t* pResult)
+{
+    arm_sums_q15(pSrc, blockSize, NULL, pResult);
+}
+
+/*********************************************************************/ /**
+ * @brief		Sum of the squares of a Q31 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples
+ * @param[out]	pResult		Sum of the 2.62 squares shifted right by 14, in
+ * 							16.48 format
+ * @return		None
+ **********************************************************************/
+void arm_power_q31(q31_t* pSrc, uint32_t blockSize, q63_t* pResult)
+{
+    arm_sums_q31(pSrc, blockSize, NULL, pResult, 14);
+}
+
+/*********************************************************************/ /**
+ * @brief		Root mean square of a Q15 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		RMS value, rounded down
+ * @return		None
+ **********************************************************************/
+void arm_rms_q15(q15_t* pSrc, uint32_t blockSize, q15_t* pResult)
+{
+    q63_t sumSq;
+
+    arm_sums_q15(pSrc, blockSize, NULL, &sumSq);
+    (void)arm_sqrt_q15((q15_t)clip_q31_to_q15((q31_t)((sumSq / (q63_t)blockSize) >> 15)), pResult);
+}
+
+/*********************************************************************/ /**
+ * @brief		Root mean square of a Q31 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		RMS value, rounded down
+ * @return		None
+ **********************************************************************/
+void arm_rms_q31(q31_t* pSrc, uint32_t blockSize, q31_t* pResult)
+{
+    q63_t sumSq;
+
+    /* Squares summed in 16.48, as arm_power_q31(): 2^15 samples of -1 fit */
+    arm_sums_q31(pSrc, blockSize, NULL, &sumSq, 14);
+    (void)arm_sqrt_q31(clip_q63_to_q31((sumSq / (q63_t)blockSize) >> 17), pResult);
+}
+
+/*********************************************************************/ /**
+ * @brief		Maximum of a Q15 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		Maximum value
+ * @param[out]	pIndex		Index of its first occurrence
+ * @return		None
+ **********************************************************************/
+void arm_max_q15(q15_t* pSrc, uint32_t blockSize, q15_t* pResult, uint32_t* pIndex)
+{
+    q31_t best = pSrc[0];
+    uint32_t index = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t i = 1;
+
+    /* Pairs from the second sample, the last one alone if blockSize is even */
+    while (i + 1u < blockSize)
+    {
+        q31_t in = ARM_READ_Q15x2(pSrc + i);
+        q31_t x0 = ARM_Q15_LO(in);
+        q31_t x1 = ARM_Q15_HI(in);
+
+        if (x0 > best)
+        {
+            best = x0;
+            index = i;
+        }
+        if (x1 > best)
+        {
+            best = x1;
+            index = i + 1u;
+        }
+        i += 2u;
+    }
+    if ((i < blockSize) && (pSrc[i] > best))
+    {
+        best = pSrc[i];
+        index = i;
+    }
+#else
+    for (uint32_t i = 1; i < blockSize; i++)
+    {
+        if (pSrc[i] > best)
+        {
+            best = pSrc[i];
+            index = i;
+        }
+    }
+#endif
+    *pResult = (q15_t)best;
+    *pIndex = index;
+}
+
+/*********************************************************************/ /**
+ * @brief		Maximum of a Q31 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		Maximum value
+ * @param[out]	pIndex		Index of its first occurrence
+ * @return		None
+ **********************************************************************/
+void arm_max_q31(q31_t* pSrc, uint32_t blockSize, q31_t* pResult, uint32_t* pIndex)
+{
+    q31_t best = pSrc[0];
+    uint32_t index = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t i = 1;
+
+    while (i + 1u < blockSize)
+    {
+        q31_t x0 = pSrc[i];
+        q31_t x1 = pSrc[i + 1u];
+
+        if (x0 > best)
+        {
+            best = x0;
+            index = i;
+        }
+        if (x1 > best)
+        {
+            best = x1;
+            index = i + 1u;
+        }
+        i += 2u;
+    }
+    if ((i < blockSize) && (pSrc[i] > best))
+    {
+        best = pSrc[i];
+        index = i;
+    }
+#else
+    for (uint32_t i = 1; i < blockSize; i++)
+    {
+        if (pSrc[i] > best)
+        {
+            best = pSrc[i];
+            index = i;
+        }
+    }
+#endif
+    *pResult = best;
+    *pIndex = index;
+}
+
+/*********************************************************************/ /**
+ * @brief		Minimum of a Q15 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		Minimum value
+ * @param[out]	pIndex		Index of its first occurrence
+ * @return		None
+ **********************************************************************/
+void arm_min_q15(q15_t* pSrc, uint32_t blockSize, q15_t* pResult, uint32_t* pIndex)
+{
+    q31_t best = pSrc[0];
+    uint32_t index = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t i = 1;
+
+    while (i + 1u < blockSize)
+    {
+        q31_t in = ARM_READ_Q15x2(pSrc + i);
+        q31_t x0 = ARM_Q15_LO(in);
+        q31_t x1 = ARM_Q15_HI(in);
+
+        if (x0 < best)
+        {
+            best = x0;
+            index = i;
+        }
+        if (x1 < best)
+        {
+            best = x1;
+            index = i + 1u;
+        }
+        i += 2u;
+    }
+    if ((i < blockSize) && (pSrc[i] < best))
+    {
+        best = pSrc[i];
+        index = i;
+    }
+#else
+    for (uint32_t i = 1; i < blockSize; i++)
+    {
+        if (pSrc[i] < best)
+        {
+            best = pSrc[i];
+            index = i;
+        }
+    }
+#endif
+    *pResult = (q15_t)best;
+    *pIndex = index;
+}
+
+/*********************************************************************/ /**
+ * @brief		Minimum of a Q31 vector
+ * @param[in]	pSrc		Input vector
+ * @param[in]	blockSize	Number of samples, at least 1
+ * @param[out]	pResult		Minimum value
+ * @param[out]	pIndex		Index of its first occurrence
+ * @return		None
+ **********************************************************************/
+void arm_min_q31(q31_t* pSrc, uint32_t blockSize, q31_t* pResult, uint32_t* pIndex)
+{
+    q31_t best = pSrc[0];
+    uint32_t index = 0;
+#ifndef ARM_MATH_PORTABLE
+    uint32_t i = 1;
+
+    while (i + 1u < blockSize)
+    {
+        q31_t x0 = pSrc[i];
+        q31_t x1 = pSrc[i + 1u];
+
+        if (x0 < best)
+        {
+            best = x0;
+            index = i;
+        }
+        if (x1 < best)
+        {
+            best = x1;
+            index = i + 1u;
+        }
+        i += 2u;
+    }
+    if ((i < blockSize) && (pSrc[i] < best))
+    {
+        best = pSrc[i];
+        index = i;
+    }
+#else
+    for (uint32_t i = 1; i < blockSize; i++)
+    {
+        if (pSrc[i] < best)
+        {
+            best = pSrc[i];
+            index = i;
+        }
+    }
+#endif
+    *pResult = best;
+    *pIndex = index;
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,236 @@
+/**********************************************************************
+ * @file		arm_support_q.c
+ * @brief	Q15 and Q31 support functions of the DSP library:
+ * 			copy, fill and conversions between Q15 and Q31
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Copy a Q15 vector
+ * @param[in]	pSrc		Input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_copy_q15(q15_t* pSrc, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in01 = ARM_READ_Q15x2(pSrc);
+        q31_t in23 = ARM_READ_Q15x2(pSrc + 2);
+
+        ARM_WRITE_Q15x2(pDst, in01);
+        ARM_WRITE_Q15x2(pDst + 2, in23);
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = *pSrc++;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = pSrc[i];
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Copy a Q31 vector
+ * @param[in]	pSrc		Input vector
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_copy_q31(q31_t* pSrc, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in0 = pSrc[0];
+        q31_t in1 = pSrc[1];
+        q31_t in2 = pSrc[2];
+        q31_t in3 = pSrc[3];
+
+        pDst[0] = in0;
+        pDst[1] = in1;
+        pDst[2] = in2;
+        pDst[3] = in3;
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = *pSrc++;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = pSrc[i];
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Fill a Q15 vector with a constant
+ * @param[in]	value		Constant
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_fill_q15(q15_t value, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+    q31_t packed = __PKHBT(value, value, 16);
+
+    while (blkCnt > 0u)
+    {
+        ARM_WRITE_Q15x2(pDst, packed);
+        ARM_WRITE_Q15x2(pDst + 2, packed);
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = value;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = value;
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Fill a Q31 vector with a constant
+ * @param[in]	value		Constant
+ * @param[out]	pDst		Output vector
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_fill_q31(q31_t value, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        pDst[0] = value;
+        pDst[1] = value;
+        pDst[2] = value;
+        pDst[3] = value;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = value;
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = value;
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Convert a Q15 vector to Q31
+ * @param[in]	pSrc		Input vector
+ * @param[out]	pDst		Output vector, the inputs shifted left by 16
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_q15_to_q31(q15_t* pSrc, q31_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        q31_t in01 = ARM_READ_Q15x2(pSrc);
+        q31_t in23 = ARM_READ_Q15x2(pSrc + 2);
+
+        /* The high half is in place already, the low half moves up */
+        pDst[0] = (q31_t)((uint32_t)in01 << 16);
+        pDst[1] = (q31_t)((uint32_t)in01 & 0xFFFF0000u);
+        pDst[2] = (q31_t)((uint32_t)in23 << 16);
+        pDst[3] = (q31_t)((uint32_t)in23 & 0xFFFF0000u);
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q31_t)((uint32_t)(q31_t)*pSrc++ << 16);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q31_t)pSrc[i] * 65536;
+    }
+#endif
+}
+
+/*********************************************************************/ /**
+ * @brief		Convert a Q31 vector to Q15
+ * @param[in]	pSrc		Input vector
+ * @param[out]	pDst		Output vector, the inputs shifted right by 16
+ * 							(truncated)
+ * @param[in]	blockSize	Number of samples
+ * @return		None
+ **********************************************************************/
+void arm_q31_to_q15(q31_t* pSrc, q15_t* pDst, uint32_t blockSize)
+{
+#ifndef ARM_MATH_PORTABLE
+    uint32_t blkCnt = blockSize >> 2;
+
+    while (blkCnt > 0u)
+    {
+        /* Both high halves in one word: a shift for the first, a mask for the second */
+        ARM_WRITE_Q15x2(pDst, (q31_t)(((uint32_t)pSrc[0] >> 16) | ((uint32_t)pSrc[1] & 0xFFFF0000u)));
+        ARM_WRITE_Q15x2(pDst + 2, (q31_t)(((uint32_t)pSrc[2] >> 16) | ((uint32_t)pSrc[3] & 0xFFFF0000u)));
+        pSrc += 4;
+        pDst += 4;
+        blkCnt--;
+    }
+    blkCnt = blockSize & 3u;
+    while (blkCnt > 0u)
+    {
+        *pDst++ = (q15_t)(*pSrc++ >> 16);
+        blkCnt--;
+    }
+#else
+    for (uint32_t i = 0; i < blockSize; i++)
+    {
+        pDst[i] = (q15_t)(pSrc[i] >> 16);
+    }
+#endif
+}
+
+/* --------------------------------- End Of File ------------------------------ */
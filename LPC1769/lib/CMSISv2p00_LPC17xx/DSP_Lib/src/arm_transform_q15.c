@@ -0,0 +1,229 @@
+/**********************************************************************
+ * @file		arm_transform_q15.c
+ * @brief	Q15 radix-4 complex FFT of the DSP library
+ * @version	1.0
+ **********************************************************************/
+
+/* Includes ------------------------------------------------------------------- */
+#include "arm_dsp_private.h"
+#include "arm_common_tables.h"
+
+/* Private Macros ------------------------------------------------------------- */
+
+/** Length of the transform served by twiddleCoefQ15[] with a step of 1 */
+#define ARM_CFFT_Q15_MAX_LEN 1024u
+
+/* Private Functions ---------------------------------------------------------- */
+
+/*
+ * Multiplies (xr + j xi) by the twiddle factor w = {cos, sin}: (xr + j xi) (cos - j sin). The 2.30 products are summed
+ * in 32 bits, |xr| and |xi| below 2^15 keep the sums below 2^31.
+ */
+static __INLINE q31_t arm_twiddle_q15(q31_t xr, q31_t xi, q31_t w)
+{
+    q31_t c = ARM_Q15_LO(w);
+    q31_t s = ARM_Q15_HI(w);
+    q31_t yr = ARM_SAT_Q15((xr * c + xi * s) >> 15);
+    q31_t yi = ARM_SAT_Q15((xi * c - xr * s) >> 15);
+
+    return __PKHBT(yr, yi, 16);
+}
+
+/*
+ * Radix-4 decimation in frequency butterfly on the samples i0, i0 + q, i0 + 2q and i0 + 3q. The inputs are shifted
+ * right by 2 first, so that the sums of four samples fit in 16 bits: a transform of 4^k points is scaled by 1 / 4^k.
+ * Output k goes to i0 + k q multiplied by the twiddle factor w[k], k = 1 to 3, whose sin is already negated for the
+ * inverse transform. The outputs are packed {re, im} words.
+ */
+static __INLINE void arm_cfft_butterfly_q15(q15_t* p, uint32_t i0, uint32_t q, const q31_t* w, uint32_t inverse)
+{
+    uint32_t i1 = i0 + q;
+    uint32_t i2 = i1 + q;
+    uint32_t i3 = i2 + q;
+    q31_t xr0, xi0, xr1, xi1, xr2, xi2, xr3, xi3;
+    q31_t ar, ai, br, bi, cr, ci, dr, di;
+    q31_t y0, y1, y2, y3;
+
+#ifndef ARM_MATH_PORTABLE
+    /* One 32-bit load per complex sample */
+    q31_t in0 = ARM_READ_Q15x2(p + 2u * i0);
+    q31_t in1 = ARM_READ_Q15x2(p + 2u * i1);
+    q31_t in2 = ARM_READ_Q15x2(p + 2u * i2);
+    q31_t in3 = ARM_READ_Q15x2(p + 2u * i3);
+
+    xr0 = ARM_Q15_LO(in0) >> 2;
+    xi0 = ARM_Q15_HI(in0) >> 2;
+    xr1 = ARM_Q15_LO(in1) >> 2;
+    xi1 = ARM_Q15_HI(in1) >> 2;
+    xr2 = ARM_Q15_LO(in2) >> 2;
+    xi2 = ARM_Q15_HI(in2) >> 2;
+    xr3 = ARM_Q15_LO(in3) >> 2;
+    xi3 = ARM_Q15_HI(in3) >> 2;
+#else
+    xr0 = p[2u * i0] >> 2;
+    xi0 = p[2u * i0 + 1u] >> 2;
+    xr1 = p[2u * i1] >> 2;
+    xi1 = p[2u * i1 + 1u] >> 2;
+    xr2 = p[2u * i2] >> 2;
+    xi2 = p[2u * i2 + 1u] >> 2;
+    xr3 = p[2u * i3] >> 2;
+    xi3 = p[2u * i3 + 1u] >> 2;
+#endif
+
+    ar = xr0 + xr2;
+    ai = xi0 + xi2;
+    br = xr0 - xr2;
+    bi = xi0 - xi2;
+    cr = xr1 + xr3;
+    ci = xi1 + xi3;
+    dr = xr1 - xr3;
+    di = xi1 - xi3;
+
+    /* X0 = a + c, X2 = a - c, and b - jd, b + jd for X1 and X3 (swapped by the inverse transform) */
+    y0 = __PKHBT(ar + cr, ai + ci, 16);
+    y2 = arm_twiddle_q15(ar - cr, ai - ci, w[2]);
+    if (!inverse)
+    {
+        y1 = arm_twiddle_q15(br + di, bi - dr, w[1]);
+        y3 = arm_twiddle_q15(br - di, bi + dr, w[3]);
+    }
+    else
+    {
+        y1 = arm_twiddle_q15(br - di, bi + dr, w[1]);
+        y3 = arm_twiddle_q15(br + di, bi - dr, w[3]);
+    }
+
+#ifndef ARM_MATH_PORTABLE
+    ARM_WRITE_Q15x2(p + 2u * i0, y0);
+    ARM_WRITE_Q15x2(p + 2u * i1, y1);
+    ARM_WRITE_Q15x2(p + 2u * i2, y2);
+    ARM_WRITE_Q15x2(p + 2u * i3, y3);
+#else
+    p[2u * i0] = (q15_t)ARM_Q15_LO(y0);
+    p[2u * i0 + 1u] = (q15_t)ARM_Q15_HI(y0);
+    p[2u * i1] = (q15_t)ARM_Q15_LO(y1);
+    p[2u * i1 + 1u] = (q15_t)ARM_Q15_HI(y1);
+    p[2u * i2] = (q15_t)ARM_Q15_LO(y2);
+    p[2u * i2 + 1u] = (q15_t)ARM_Q15_HI(y2);
+    p[2u * i3] = (q15_t)ARM_Q15_LO(y3);
+    p[2u * i3 + 1u] = (q15_t)ARM_Q15_HI(y3);
+#endif
+}
+
+/* Index with its base 4 digits reversed, digits being log4 of the length */
+static __INLINE uint32_t arm_digit_reverse4(uint32_t index, uint32_t digits)
+{
+    uint32_t reversed = 0;
+
+    while (digits > 0u)
+    {
+        reversed = (reversed << 2) | (index & 3u);
+        index >>= 2;
+        digits--;
+    }
+    return reversed;
+}
+
+/* Public Functions ----------------------------------------------------------- */
+
+/*********************************************************************/ /**
+ * @brief		Initialize a Q15 radix-4 complex FFT
+ * @param[in]	S				FFT instance
+ * @param[in]	fftLen			Number of complex points: 16, 64, 256 or 1024
+ * @param[in]	ifftFlag		0 for the forward transform, 1 for the inverse
+ * @param[in]	bitReverseFlag	1 to return the output in natural order, 0 to
+ * 								leave it in digit-reversed order
+ * @return		ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR for another length
+ *
+ * Note: the output order is computed on the fly, pBitRevTable is not used
+ * and set to NULL.
+ **********************************************************************/
+arm_status arm_cfft_radix4_init_q15(arm_cfft_radix4_instance_q15* S, uint16_t fftLen, uint8_t ifftFlag,
+                                    uint8_t bitReverseFlag)
+{
+    if ((fftLen != 16u) && (fftLen != 64u) && (fftLen != 256u) && (fftLen != 1024u))
+    {
+        return ARM_MATH_ARGUMENT_ERROR;
+    }
+    S->fftLen = fftLen;
+    S->ifftFlag = ifftFlag;
+    S->bitReverseFlag = bitReverseFlag;
+    S->pTwiddle = (q15_t*)twiddleCoefQ15;
+    S->pBitRevTable = NULL;
+    S->twidCoefModifier = (uint16_t)(ARM_CFFT_Q15_MAX_LEN / fftLen);
+    S->bitRevFactor = (uint16_t)(ARM_CFFT_Q15_MAX_LEN / fftLen);
+    return ARM_MATH_SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Q15 radix-4 complex FFT, in place
+ * @param[in]	S		FFT instance, initialized by arm_cfft_radix4_init_q15()
+ * @param[in]	pSrc	fftLen complex samples {re, im}, replaced by the
+ * 						transform
+ * @return		None
+ *
+ * Note: every stage divides by 4 to avoid overflows, so the output is the
+ * transform divided by fftLen, for the inverse transform too. The twiddle
+ * products are truncated and saturated.
+ **********************************************************************/
+void arm_cfft_radix4_q15(const arm_cfft_radix4_instance_q15* S, q15_t* pSrc)
+{
+    uint32_t fftLen = S->fftLen;
+    uint32_t step = S->twidCoefModifier;
+    uint32_t inverse = (S->ifftFlag != 0u);
+    uint32_t digits = 0;
+    uint32_t n;
+
+    for (n = fftLen; n >= 4u; n >>= 2)
+    {
+        uint32_t q = n >> 2;
+
+        for (uint32_t j = 0; j < q; j++)
+        {
+            q31_t w[4];
+
+            /* The twiddle factors of the three outputs, shared by all the butterflies of this j */
+            for (uint32_t k = 1; k < 4u; k++)
+            {
+                const q15_t* pw = S->pTwiddle + 2u * k * j * step;
+                q31_t s = inverse ? -pw[1] : pw[1];
+
+                w[k] = __PKHBT(pw[0], s, 16);
+            }
+            for (uint32_t i0 = j; i0 < fftLen; i0 += n)
+            {
+                arm_cfft_butterfly_q15(pSrc, i0, q, w, inverse);
+            }
+        }
+        step <<= 2;
+        digits++;
+    }
+
+    if (S->bitReverseFlag)
+    {
+        for (uint32_t i = 1; i < fftLen - 1u; i++)
+        {
+            uint32_t r = arm_digit_reverse4(i, digits);
+
+            if (r > i)
+            {
+#ifndef ARM_MATH_PORTABLE
+                q31_t tmp = ARM_READ_Q15x2(pSrc + 2u * i);
+
+                ARM_WRITE_Q15x2(pSrc + 2u * i, ARM_READ_Q15x2(pSrc + 2u * r));
+                ARM_WRITE_Q15x2(pSrc + 2u * r, tmp);
+#else
+                q15_t re = pSrc[2u * i];
+                q15_t im = pSrc[2u * i + 1u];
+
+                pSrc[2u * i] = pSrc[2u * r];
+                pSrc[2u * i + 1u] = pSrc[2u * r + 1u];
+                pSrc[2u * r] = re;
+                pSrc[2u * r + 1u] = im;
+#endif
+            }
+        }
+    }
+}
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,110 @@
+/**********************************************************************
+ * @file		lpc17xx_adcscan.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the burst mode multi-channel ADC scanner on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup ADCSCAN ADCSCAN (Burst mode multi-channel ADC scanner)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Converts a set of ADC channels continuously in burst mode, at the maximum aggregate rate, without one interrupt per
+ * conversion:
+ * 	- the GPDMA moves every ADGDR word into two blocks of ADCSCAN_BLOCK_SIZE words, filled alternately through two
+ * 	  linked list items;
+ * 	- the terminal count interrupt of a block sorts its words by their CHN field into one ring per channel, and drops
+ * 	  the words with the OVERRUN flag set (a result the DMA read after the next one had overwritten it);
+ * 	- ADCSCAN_GetLatest() returns the last samples of a channel in place, oldest first, without copying them.
+ *
+ * The DMA terminal count interrupt is dispatched by GPDMA_IntHandler(), which the program calls from its
+ * DMA_IRQHandler():
+ * @code
+ * ADCSCAN_Init(ADCSCAN_CH(0) | ADCSCAN_CH(1) | ADCSCAN_CH(2) | ADCSCAN_CH(3), 200000);
+ * NVIC_EnableIRQ(DMA_IRQn);
+ * ADCSCAN_Start();
+ * ...
+ * const uint16_t* ldr0 = ADCSCAN_GetLatest(0, 16);  // ldr0[15] is the last result of AD0.0
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_ADCSCAN_H_
+#define LPC17XX_ADCSCAN_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup ADCSCAN_Public_Macros ADCSCAN Public Macros
+ * @{
+ */
+
+/** Number of ADC channels */
+#define ADCSCAN_CHANNELS 8
+
+/** Bit of channel n (0 to 7) in the channel mask of ADCSCAN_Init() */
+#define ADCSCAN_CH(n) ((uint8_t)(1 << (n)))
+
+/** ADGDR words per DMA block: one interrupt sorts this many conversions */
+#ifndef ADCSCAN_BLOCK_SIZE
+#define ADCSCAN_BLOCK_SIZE 64
+#endif
+
+/** Samples kept per channel, a power of 2. It is also the largest count of ADCSCAN_GetLatest(). */
+#ifndef ADCSCAN_RING_SIZE
+#define ADCSCAN_RING_SIZE 64
+#endif
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup ADCSCAN_Public_Types ADCSCAN Public Types
+ * @{
+ */
+
+/** @brief Counters of a channel, since ADCSCAN_Init() */
+typedef struct
+{
+    uint32_t Samples; /**< Results stored in the ring of the channel */
+    uint32_t Dropped; /**< Results of the channel dropped for an OVERRUN flag */
+} ADCSCAN_Stats_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup ADCSCAN_Public_Functions ADCSCAN Public Functions
+ * @{
+ */
+
+Status ADCSCAN_Init(uint8_t channelMask, uint32_t rate);
+Status ADCSCAN_Start(void);
+void ADCSCAN_Stop(void);
+const uint16_t* ADCSCAN_GetLatest(uint8_t channel, uint32_t count);
+uint32_t ADCSCAN_GetCount(uint8_t channel);
+void ADCSCAN_GetStats(uint8_t channel, ADCSCAN_Stats_Type* stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_ADCSCAN_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
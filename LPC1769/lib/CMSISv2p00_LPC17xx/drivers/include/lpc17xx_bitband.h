@@ -0,0 +1,139 @@
+/**********************************************************************
+ * @file		lpc17xx_bitband.h
+ * @brief	Contains the macros and inline functions of the Cortex-M3
+ * 			bit-band access on LPC17xx (header only)
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup BITBAND BITBAND (Cortex-M3 bit-band access)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Every bit of the two bit-band regions has its own word in an alias region: a store of 0 or 1 to the alias word
+ * clears or sets the bit, a load returns the bit. The update is a single instruction, atomic with respect to the
+ * interrupt handlers, so no critical section is needed around it.
+ *
+ * Bit-band regions on LPC17xx:
+ * 	- SRAM region 0x20000000-0x200FFFFF: the AHB SRAM banks (0x2007C000, 0x20080000) and the fast GPIO (0x2009C000).
+ * 	  The main SRAM at 0x10000000 is outside: flags shared between handlers and main must be placed in the AHB SRAM
+ * 	  with BITBAND_AHBRAM.
+ * 	- Peripheral region 0x40000000-0x400FFFFF: the APB0 and APB1 peripherals.
+ *
+ * With a constant register address and bit number, the alias address is computed at compile time:
+ * @code
+ * BITBAND(LPC_GPIO0->FIOPIN, 22) ^= 1;  // Toggle P0.22
+ * BITBAND_Set(&LPC_SC->PCONP, 12);       // Power up the ADC
+ *
+ * static BITBAND_AHBRAM volatile uint32_t events;
+ * BITBAND(events, 3) = 1;                // In a handler
+ * @endcode
+ *
+ * A store to an alias word is a read-modify-write of the whole target word on the bus. It must not be used on
+ * registers with write-1-to-clear bits (TIM IR, GPIO interrupt clear, ...) or with side effects on read: the other
+ * bits would be written back too.
+ * @{
+ */
+
+#ifndef LPC17XX_BITBAND_H_
+#define LPC17XX_BITBAND_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup BITBAND_Public_Macros BITBAND Public Macros
+ * @{
+ */
+
+/** Base of the SRAM bit-band region and of its alias */
+#define BITBAND_SRAM_BASE  (0x20000000UL)
+#define BITBAND_SRAM_ALIAS (0x22000000UL)
+/** Base of the peripheral bit-band region and of its alias */
+#define BITBAND_PERI_BASE  (0x40000000UL)
+#define BITBAND_PERI_ALIAS (0x42000000UL)
+
+/** Address of the alias word of bit (0 to 31) of the word at addr, in either bit-band region */
+#define BITBAND_ADDR(addr, bit)                                                                                        \
+    (((uint32_t)(uintptr_t)(addr) & 0xF0000000UL) + 0x02000000UL +                                                     \
+     (((uint32_t)(uintptr_t)(addr) & 0x000FFFFFUL) << 5) + ((uint32_t)(bit) << 2))
+
+/** Alias word of bit of the register or variable reg, read and written as 0 or 1 */
+#define BITBAND(reg, bit) (*(volatile uint32_t*)BITBAND_ADDR(&(reg), (bit)))
+
+/** Places a variable in the AHB SRAM bank 0, inside the SRAM bit-band region. It is not cleared at reset. */
+#define BITBAND_AHBRAM __attribute__((section(".ahbram")))
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup BITBAND_Public_Functions BITBAND Public Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Set a bit of a word in a bit-band region
+ * @param[in]	addr	Word aligned address of the register or variable
+ * @param[in]	bit		Bit number, in range from 0 to 31
+ * @return		None
+ **********************************************************************/
+static __INLINE void BITBAND_Set(volatile void* addr, uint32_t bit)
+{
+    *(volatile uint32_t*)BITBAND_ADDR(addr, bit) = 1;
+}
+
+/*********************************************************************/ /**
+ * @brief		Clear a bit of a word in a bit-band region
+ * @param[in]	addr	Word aligned address of the register or variable
+ * @param[in]	bit		Bit number, in range from 0 to 31
+ * @return		None
+ **********************************************************************/
+static __INLINE void BITBAND_Clear(volatile void* addr, uint32_t bit)
+{
+    *(volatile uint32_t*)BITBAND_ADDR(addr, bit) = 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		Write a bit of a word in a bit-band region
+ * @param[in]	addr	Word aligned address of the register or variable
+ * @param[in]	bit		Bit number, in range from 0 to 31
+ * @param[in]	value	New state of the bit, 0 or 1
+ * @return		None
+ **********************************************************************/
+static __INLINE void BITBAND_Write(volatile void* addr, uint32_t bit, uint32_t value)
+{
+    *(volatile uint32_t*)BITBAND_ADDR(addr, bit) = value;
+}
+
+/*********************************************************************/ /**
+ * @brief		Read a bit of a word in a bit-band region
+ * @param[in]	addr	Word aligned address of the register or variable
+ * @param[in]	bit		Bit number, in range from 0 to 31
+ * @return		State of the bit, 0 or 1
+ **********************************************************************/
+static __INLINE uint32_t BITBAND_Test(const volatile void* addr, uint32_t bit)
+{
+    return *(const volatile uint32_t*)BITBAND_ADDR(addr, bit);
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_BITBAND_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
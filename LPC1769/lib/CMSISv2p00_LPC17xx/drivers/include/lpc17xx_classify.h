@@ -0,0 +1,119 @@
+/**********************************************************************
+ * @file		lpc17xx_classify.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the threshold classifier of ADC readings on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup CLASSIFY CLASSIFY (Threshold classifier of ADC readings)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Sorts the readings of up to CLASSIFY_CHANNELS inputs into bands, such as the temperature ranges shown by a set of
+ * LEDs, and acts only when the band of an input changes:
+ * 	- each input has a table of ascending thresholds, which split the readings into bands;
+ * 	- a reading must pass a threshold by the hysteresis of the table to leave its band, and the new band must hold for
+ * 	  the debounce count of the table, in consecutive readings, before it is taken;
+ * 	- a change of band drives the pins of the new band with a single store (FGPIO_Write()) and calls the callback.
+ * 	  A reading in the current band costs two comparisons, and no bus access.
+ *
+ * The tables are const, and CLASSIFY_SetTable() replaces the table of an input at any time:
+ * @code
+ * static const uint16_t limits[] = {41, 71};
+ * static const uint32_t leds[] = {GREEN_LED, YELLOW_LED, RED_LED};
+ * static const CLASSIFY_Table_Type oven = {limits, leds, 3, PINSEL_PORT_0, 2, 1};
+ *
+ * CLASSIFY_Init(NULL, NULL);
+ * CLASSIFY_SetTable(0, &oven);
+ * ...
+ * CLASSIFY_Update(0, reading);  // in the DMA completion
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_CLASSIFY_H_
+#define LPC17XX_CLASSIFY_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup CLASSIFY_Public_Macros CLASSIFY Public Macros
+ * @{
+ */
+
+/** Number of inputs, one per ADC channel for CLASSIFY_UpdateBlock() */
+#define CLASSIFY_CHANNELS 8
+
+/** Largest number of bands of a table */
+#define CLASSIFY_MAX_BANDS 16
+
+/** Band of an input without a table, or whose first reading is still to come */
+#define CLASSIFY_BAND_NONE 0xFF
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup CLASSIFY_Public_Types CLASSIFY Public Types
+ * @{
+ */
+
+/** @brief Bands of an input: Count bands split by Count - 1 thresholds */
+typedef struct
+{
+    const uint16_t* Thresholds; /**< Count - 1 ascending values, band i holds the readings from Thresholds[i - 1]
+                                     up to Thresholds[i] excluded */
+    const uint32_t* Pins;       /**< Count masks of pins of Port, those set in each band, or NULL for no pins */
+    uint8_t Count;              /**< Bands, from 1 to CLASSIFY_MAX_BANDS */
+    uint8_t Port;               /**< GPIO port of the pins, 0 to 4 */
+    uint16_t Hysteresis;        /**< Margin a reading must pass a threshold by to leave its band */
+    uint8_t Debounce;           /**< Consecutive readings of a new band before it is taken, 0 or 1 for the first */
+} CLASSIFY_Table_Type;
+
+/**
+ * @brief Band change callback, called from CLASSIFY_Update() or CLASSIFY_UpdateBlock() after the pins are driven
+ * @param[in] channel Input, 0 to CLASSIFY_CHANNELS - 1
+ * @param[in] band New band
+ * @param[in] previous Previous band, CLASSIFY_BAND_NONE for the first reading of a table
+ * @param[in] arg Argument given to CLASSIFY_Init()
+ */
+typedef void (*CLASSIFY_Callback_Type)(uint8_t channel, uint8_t band, uint8_t previous, void* arg);
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup CLASSIFY_Public_Functions CLASSIFY Public Functions
+ * @{
+ */
+
+void CLASSIFY_Init(CLASSIFY_Callback_Type callback, void* arg);
+Status CLASSIFY_SetTable(uint8_t channel, const CLASSIFY_Table_Type* table);
+void CLASSIFY_Update(uint8_t channel, uint16_t reading);
+void CLASSIFY_UpdateBlock(const uint32_t* words, uint32_t count);
+uint8_t CLASSIFY_GetBand(uint8_t channel);
+uint32_t CLASSIFY_GetChanges(uint8_t channel);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_CLASSIFY_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -372,6 +372,22 @@ extern "C"
 /** Power Control for Peripherals bit mask */
 #define CLKPWR_PCONP_BITMASK 0xEFEFF7DE
 
+    /**
+     * @}
+     */
+
+    /* Public Types --------------------------------------------------------------- */
+    /** @defgroup CLKPWR_Public_Types CLKPWR Public Types
+     * @{
+     */
+
+    /** @brief Peripheral clock divider configuration structure */
+    typedef struct
+    {
+        uint32_t ClkType; /**< Peripheral Clock Selection, should be CLKPWR_PCLKSEL_x */
+        uint32_t DivVal;  /**< Value of divider, should be CLKPWR_PCLKSEL_CCLK_DIV_x */
+    } CLKPWR_PCLK_CFG_Type;
+
     /**
      * @}
      */
@@ -382,6 +398,7 @@ extern "C"
      */
 
     void CLKPWR_SetPCLKDiv(uint32_t ClkType, uint32_t DivVal);
+    void CLKPWR_ConfigPCLKs(const CLKPWR_PCLK_CFG_Type* PclkCfgTable, uint32_t count);
     uint32_t CLKPWR_GetPCLKSEL(uint32_t ClkType);
     uint32_t CLKPWR_GetPCLK(uint32_t ClkType);
     void CLKPWR_ConfigPPWR(uint32_t PPType, FunctionalState NewState);
@@ -0,0 +1,183 @@
+/**********************************************************************
+ * @file		lpc17xx_dacwave.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the DAC waveform player on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup DACWAVE DACWAVE (DAC waveform player)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Plays periodic waveforms stored in flash on the DAC, and switches between them without dropping or repeating a
+ * sample:
+ * 	- a waveform is a const table of DACR words, built at compile time by DACWAVE_TABLE() from one of the shapes
+ * 	  below, with its number of samples and its DAC update rate;
+ * 	- the GPDMA reads the table in a loop through two linked list items that point at each other;
+ * 	- DACWAVE_Select() rewrites the item the GPDMA loads next, so the new waveform starts exactly at the end of the
+ * 	  period being played. Its first sample is a one-word item, whose terminal count interrupt reloads the DAC
+ * 	  timeout before that sample is output when the rate differs, and sets the items back to a plain loop.
+ *
+ * The DAC counter reloads DACCNTVAL when it times out, so the interrupt must write the new timeout within one sample
+ * period of the waveform being left: 1 / Rate, 2.5 us at 400 kHz, minus the DMA latency. The DMA interrupt needs a
+ * priority that no other handler holds off for that long. A late write does not drop or repeat a sample: the first
+ * sample of the new waveform is held for the old period, and the new rate starts with the second one.
+ *
+ * @code
+ * static const uint32_t trapezoid[64] = DACWAVE_TABLE(DACWAVE_TRAPEZOID, 64, 0, 1023);
+ * static const DACWAVE_Type waves[] = {{trapezoid, 64, 60000}, {DACWAVE_Sine64, 64, 120000}};
+ *
+ * GPDMA_Init();
+ * DACWAVE_Init();
+ * NVIC_EnableIRQ(DMA_IRQn);
+ * DACWAVE_Start(&waves[0]);
+ * ...
+ * DACWAVE_Select(&waves[1]);  // from EINT0_IRQHandler(), for instance
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_DACWAVE_H_
+#define LPC17XX_DACWAVE_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DACWAVE_Public_Macros DACWAVE Public Macros
+ * @{
+ */
+
+/** DACR word of a 10-bit code, with the 700 uA bias (1 us settling time, up to 1 MHz) */
+#define DACWAVE_VALUE(code) ((uint32_t)(((uint32_t)(code) & 0x3FF) << 6))
+
+/** BIAS bit of DACR, or-ed into the words of a table for the 350 uA bias (2.5 us settling time, up to 400 kHz) */
+#define DACWAVE_BIAS ((uint32_t)(1 << 16))
+
+/** Highest rate of a waveform, with the 700 uA bias */
+#define DACWAVE_MAX_RATE 1000000
+
+/** Highest rate of a waveform whose first word has DACWAVE_BIAS */
+#define DACWAVE_MAX_RATE_BIAS 400000
+
+/** Fewest samples of a waveform: the first period must leave time to rewrite the linked list items */
+#define DACWAVE_MIN_COUNT 4
+
+/** Largest number of samples of a waveform, the transfer size of a linked list item */
+#define DACWAVE_MAX_COUNT 4095
+
+/*
+ * Shapes: the 10-bit code of sample i of a period of n samples, from lo to hi. They are integer constant expressions,
+ * so that DACWAVE_TABLE() builds the table at compile time.
+ */
+
+/** Sine starting at mid scale, Bhaskara approximation of each half period (error below 0.2 % of the span) */
+#define DACWAVE_SINE(i, n, lo, hi)                                                                                     \
+    ((2ULL * (i) < (n)) ? DACWAVE_MID(lo, hi) + DACWAVE_ARCH(2ULL * (i), n, lo, hi)                                    \
+                        : DACWAVE_MID(lo, hi) - DACWAVE_ARCH(2ULL * (i) - (n), n, lo, hi))
+
+/** Triangle, rising over the first half period */
+#define DACWAVE_TRIANGLE(i, n, lo, hi)                                                                                 \
+    ((2ULL * (i) < (n)) ? (lo) + ((hi) - (lo)) * 2ULL * (i) / (n) : (lo) + ((hi) - (lo)) * (2ULL * ((n) - (i))) / (n))
+
+/** Sawtooth, from lo at the first sample to hi at the last one */
+#define DACWAVE_SAWTOOTH(i, n, lo, hi) ((lo) + ((hi) - (lo)) * (unsigned long long)(i) / ((n) - 1))
+
+/** Square, hi over the first half period */
+#define DACWAVE_SQUARE(i, n, lo, hi) ((2ULL * (i) < (n)) ? (hi) : (lo))
+
+/** Trapezoid: rise, high, fall and low over a quarter of the period each */
+#define DACWAVE_TRAPEZOID(i, n, lo, hi)                                                                                \
+    ((4ULL * (i) < (n))       ? (lo) + ((hi) - (lo)) * 4ULL * (i) / (n)                                                \
+     : (4ULL * (i) < 2U * (n)) ? (hi)                                                                                  \
+     : (4ULL * (i) < 3U * (n)) ? (hi) - ((hi) - (lo)) * (4ULL * (i) - 2U * (n)) / (n)                                  \
+                               : (lo))
+
+/** Initializer of a table of n DACR words of a shape, n being 16, 32, 64, 128 or 256 */
+#define DACWAVE_TABLE(shape, n, lo, hi) {DACWAVE_REP##n(shape, 0, n, lo, hi)}
+
+/* Helpers of the shapes and of DACWAVE_TABLE() */
+#define DACWAVE_MID(lo, hi) (((lo) + (hi) + 1ULL) / 2)
+/* Positive half period of a sine at u / n of it, u from 0 to n, amplitude (hi - lo) / 2: 16x(1-x) / (5 - 4x(1-x)) */
+#define DACWAVE_ARCH(u, n, lo, hi)                                                                                     \
+    (((hi) - (lo)) * 8ULL * (u) * ((n) - (u)) / (5ULL * (n) * (n) - 4ULL * (u) * ((n) - (u))))
+#define DACWAVE_POINT(shape, i, n, lo, hi) DACWAVE_VALUE(shape(i, n, lo, hi))
+#define DACWAVE_REP1(s, b, n, lo, hi)      DACWAVE_POINT(s, b, n, lo, hi)
+#define DACWAVE_REP2(s, b, n, lo, hi)      DACWAVE_REP1(s, b, n, lo, hi), DACWAVE_REP1(s, (b) + 1, n, lo, hi)
+#define DACWAVE_REP4(s, b, n, lo, hi)      DACWAVE_REP2(s, b, n, lo, hi), DACWAVE_REP2(s, (b) + 2, n, lo, hi)
+#define DACWAVE_REP8(s, b, n, lo, hi)      DACWAVE_REP4(s, b, n, lo, hi), DACWAVE_REP4(s, (b) + 4, n, lo, hi)
+#define DACWAVE_REP16(s, b, n, lo, hi)     DACWAVE_REP8(s, b, n, lo, hi), DACWAVE_REP8(s, (b) + 8, n, lo, hi)
+#define DACWAVE_REP32(s, b, n, lo, hi)     DACWAVE_REP16(s, b, n, lo, hi), DACWAVE_REP16(s, (b) + 16, n, lo, hi)
+#define DACWAVE_REP64(s, b, n, lo, hi)     DACWAVE_REP32(s, b, n, lo, hi), DACWAVE_REP32(s, (b) + 32, n, lo, hi)
+#define DACWAVE_REP128(s, b, n, lo, hi)    DACWAVE_REP64(s, b, n, lo, hi), DACWAVE_REP64(s, (b) + 64, n, lo, hi)
+#define DACWAVE_REP256(s, b, n, lo, hi)    DACWAVE_REP128(s, b, n, lo, hi), DACWAVE_REP128(s, (b) + 128, n, lo, hi)
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup DACWAVE_Public_Types DACWAVE Public Types
+ * @{
+ */
+
+/** @brief A waveform: one period of DACR words and the rate they are played at */
+typedef struct
+{
+    const uint32_t* Samples; /**< DACR words, from DACWAVE_TABLE() or DACWAVE_VALUE(), in flash or RAM */
+    uint16_t Count;          /**< Samples per period, from DACWAVE_MIN_COUNT to DACWAVE_MAX_COUNT */
+    uint32_t Rate;           /**< DAC updates per second, from PCLK_DAC / 65535 to DACWAVE_MAX_RATE, or to
+                                  DACWAVE_MAX_RATE_BIAS with DACWAVE_BIAS */
+} DACWAVE_Type;
+
+/**
+ * @}
+ */
+
+/* Public Variables ----------------------------------------------------------- */
+/** @addtogroup DACWAVE_Public_Types
+ * @{
+ */
+
+/** Full scale waveforms of 64 samples, in flash */
+extern const uint32_t DACWAVE_Sine64[64];
+extern const uint32_t DACWAVE_Triangle64[64];
+extern const uint32_t DACWAVE_Sawtooth64[64];
+extern const uint32_t DACWAVE_Square64[64];
+extern const uint32_t DACWAVE_Trapezoid64[64];
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup DACWAVE_Public_Functions DACWAVE Public Functions
+ * @{
+ */
+
+Status DACWAVE_Init(void);
+Status DACWAVE_Start(const DACWAVE_Type* wave);
+Status DACWAVE_Select(const DACWAVE_Type* wave);
+void DACWAVE_Stop(void);
+const DACWAVE_Type* DACWAVE_GetWave(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DACWAVE_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,132 @@
+/**********************************************************************
+ * @file		lpc17xx_dds.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the direct digital synthesis engine of the DAC
+ * 			on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup DDS DDS (Direct digital synthesis on the DAC)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Generates a periodic waveform of any frequency on the DAC, at a fixed update rate:
+ * 	- a 32-bit phase accumulator advances by a tuning word at each DAC update, the frequency resolution is the update
+ * 	  rate divided by 2^32 (23 uHz at 100 kHz);
+ * 	- the top bits of the phase index a power of 2 table of Q15 samples in flash (a 1024 point sine by default),
+ * 	  scaled by a Q15 amplitude;
+ * 	- the GPDMA feeds the DAC from two blocks of DDS_BLOCK_SIZE words through two linked list items, the terminal
+ * 	  count interrupt of a block computes its next samples while the other block plays.
+ *
+ * Frequency, phase and amplitude changes are taken at a block boundary: the phase accumulator is never reset, so a
+ * change of frequency keeps the waveform continuous, and a phase offset or amplitude change ramps over one block.
+ * The DMA terminal count interrupt is dispatched by GPDMA_IntHandler(), which the program calls from its
+ * DMA_IRQHandler():
+ * @code
+ * GPDMA_Init();
+ * DDS_Init(100000);
+ * DDS_SetFrequency(60000);  // 60 Hz, in mHz
+ * NVIC_EnableIRQ(DMA_IRQn);
+ * DDS_Start();
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_DDS_H_
+#define LPC17XX_DDS_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup DDS_Public_Macros DDS Public Macros
+ * @{
+ */
+
+/** DACR words per DMA block: one interrupt computes this many samples */
+#ifndef DDS_BLOCK_SIZE
+#define DDS_BLOCK_SIZE 64
+#endif
+
+/** log2 of the number of points of DDS_SineTable */
+#define DDS_SINE_TABLE_LOG2 10
+
+/** Largest table, 2^DDS_TABLE_LOG2_MAX points */
+#define DDS_TABLE_LOG2_MAX 16
+
+/** Full scale amplitude, Q15 */
+#define DDS_AMPLITUDE_MAX 32767
+
+/** Highest DAC update rate, with the 700 uA bias (1 us settling time) */
+#define DDS_RATE_MAX 1000000
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup DDS_Public_Types DDS Public Types
+ * @{
+ */
+
+/** @brief Settings applied together at the next block boundary by DDS_Configure() */
+typedef struct
+{
+    uint32_t TuningWord; /**< Phase increment per DAC update, 2^32 is one period per update */
+    uint32_t Phase;      /**< Phase offset added to the accumulator, 2^32 is one period */
+    uint16_t Amplitude;  /**< Q15 scale of the table, from 0 to DDS_AMPLITUDE_MAX */
+} DDS_CFG_Type;
+
+/**
+ * @}
+ */
+
+/* Public Variables ----------------------------------------------------------- */
+/** @addtogroup DDS_Public_Types
+ * @{
+ */
+
+/** One period of a sine, 2^DDS_SINE_TABLE_LOG2 Q15 points */
+extern const int16_t DDS_SineTable[1 << DDS_SINE_TABLE_LOG2];
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup DDS_Public_Functions DDS Public Functions
+ * @{
+ */
+
+Status DDS_Init(uint32_t rate);
+Status DDS_Start(void);
+void DDS_Stop(void);
+uint32_t DDS_GetRate(void);
+Status DDS_SetTable(const int16_t* table, uint8_t log2Size);
+uint32_t DDS_FrequencyToTuningWord(uint32_t frequency);
+void DDS_SetFrequency(uint32_t frequency);
+void DDS_SetPhase(uint32_t phase);
+void DDS_SetAmplitude(uint16_t amplitude);
+Status DDS_Configure(const DDS_CFG_Type* cfg);
+void DDS_FillBlock(uint32_t* block, uint32_t count);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_DDS_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
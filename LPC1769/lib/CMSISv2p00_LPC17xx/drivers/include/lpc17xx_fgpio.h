@@ -0,0 +1,142 @@
+/**********************************************************************
+ * @file		lpc17xx_fgpio.h
+ * @brief	Contains the inline functions of the fast GPIO access
+ * 			path on LPC17xx (header only)
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup FGPIO FGPIO (Fast GPIO inline access)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Inline replacements of GPIO_SetValue(), GPIO_ClearValue() and GPIO_ReadValue() for the hot paths. The port address
+ * is computed from the port number instead of the switch of GPIO_GetPointer(): with a constant port number a call
+ * compiles to a single load or store. There is no check of the port number, which must be in range from 0 to 4.
+ *
+ * FGPIO_Write() changes several pins of a port with a single store, so that they never show an intermediate state:
+ * @code
+ * FGPIO_Write(PINSEL_PORT_0, RED_LED | YELLOW_LED | GREEN_LED, GREEN_LED);
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_FGPIO_H_
+#define LPC17XX_FGPIO_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup FGPIO_Public_Macros FGPIO Public Macros
+ * @{
+ */
+
+/** Registers of the GPIO port portNum (0 to 4), the ports are 0x20 bytes apart */
+#define FGPIO_PORT(portNum) ((LPC_GPIO_TypeDef*)(LPC_GPIO_BASE + ((uint32_t)(portNum) << 5)))
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup FGPIO_Public_Functions FGPIO Public Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Set the output pins of bitValue, the other pins are unchanged
+ * @param[in]	portNum		Port number, in range from 0 to 4
+ * @param[in]	bitValue	Pins to set, e.g. 0x5 sets pins 0 and 2
+ * @return		None
+ **********************************************************************/
+static __INLINE void FGPIO_Set(uint8_t portNum, uint32_t bitValue)
+{
+    FGPIO_PORT(portNum)->FIOSET = bitValue;
+}
+
+/*********************************************************************/ /**
+ * @brief		Clear the output pins of bitValue, the other pins are unchanged
+ * @param[in]	portNum		Port number, in range from 0 to 4
+ * @param[in]	bitValue	Pins to clear, e.g. 0x5 clears pins 0 and 2
+ * @return		None
+ **********************************************************************/
+static __INLINE void FGPIO_Clear(uint8_t portNum, uint32_t bitValue)
+{
+    FGPIO_PORT(portNum)->FIOCLR = bitValue;
+}
+
+/*********************************************************************/ /**
+ * @brief		Read the state of the pins of a port, inputs and outputs
+ * @param[in]	portNum		Port number, in range from 0 to 4
+ * @return		Pin states, the pins masked in FIOMASK read as 0
+ **********************************************************************/
+static __INLINE uint32_t FGPIO_Read(uint8_t portNum)
+{
+    return FGPIO_PORT(portNum)->FIOPIN;
+}
+
+/*********************************************************************/ /**
+ * @brief		Write the output pins of bitMask with the bits of value in a
+ * 				single store, the other pins are unchanged
+ * @param[in]	portNum		Port number, in range from 0 to 4
+ * @param[in]	bitMask		Pins to write
+ * @param[in]	value		New state of the pins of bitMask
+ * @return		None
+ *
+ * Note: FIOMASK restricts the store to FIOPIN to the pins of bitMask. FIOMASK also
+ * masks the FIOSET and FIOCLR writes of an interrupt handler, so the sequence runs
+ * with the interrupts disabled for a few cycles, and restores FIOMASK.
+ **********************************************************************/
+static __INLINE void FGPIO_Write(uint8_t portNum, uint32_t bitMask, uint32_t value)
+{
+    LPC_GPIO_TypeDef* pGPIO = FGPIO_PORT(portNum);
+    uint32_t primask = __get_PRIMASK();
+    uint32_t mask;
+
+    __disable_irq();
+    mask = pGPIO->FIOMASK;
+    pGPIO->FIOMASK = ~bitMask;
+    pGPIO->FIOPIN = value;
+    pGPIO->FIOMASK = mask;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Toggle the output pins of bitValue, the other pins are unchanged
+ * @param[in]	portNum		Port number, in range from 0 to 4
+ * @param[in]	bitValue	Pins to toggle
+ * @return		None
+ *
+ * Note: branch free, one read of FIOPIN then one store to FIOCLR and one to FIOSET.
+ * Pins outside bitValue are never written, so an interrupt handler can drive them
+ * at any time.
+ **********************************************************************/
+static __INLINE void FGPIO_Toggle(uint8_t portNum, uint32_t bitValue)
+{
+    LPC_GPIO_TypeDef* pGPIO = FGPIO_PORT(portNum);
+    uint32_t pins = pGPIO->FIOPIN;
+
+    pGPIO->FIOCLR = pins & bitValue;
+    pGPIO->FIOSET = ~pins & bitValue;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_FGPIO_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,198 @@
+/**********************************************************************
+ * @file		lpc17xx_filter.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the streaming ADC filter stages on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup FILTER FILTER (Streaming ADC filter stages)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Fixed-point filters that consume the samples once, as they arrive, with a constant cost per sample and no division:
+ * 	- Boxcar: moving average of the last 2^n samples, from a running sum updated with the newest and the oldest sample.
+ * 	- CIC: cascaded integrator-comb decimator of order 1 to FILTER_CIC_MAX_ORDER and any ratio. The integrators run
+ * 	  at the input rate, the combs once per output.
+ * 	- Decimate: oversample-and-decimate, the sum of 4^n samples shifted right by n gives a result with n more bits
+ * 	  than the 12-bit ADC (the input noise must span a few codes).
+ *
+ * The Push functions take one 12-bit sample. The Block functions take a DMA buffer of ADGDR (or ADDRn) words, extract
+ * the results and skip the words whose OVERRUN flag is set, counted in the Dropped field of the filter:
+ * @code
+ * static FILTER_Decimate_Type filter;
+ * static uint16_t readings[DMA_BUFFER_SIZE / 16 + 1];
+ *
+ * FILTER_DecimateInit(&filter, 2);                                       // 16 samples per 14-bit reading
+ * n = FILTER_DecimateBlock(&filter, dma_buffer, DMA_BUFFER_SIZE, readings); // in the DMA completion
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_FILTER_H_
+#define LPC17XX_FILTER_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup FILTER_Public_Macros FILTER Public Macros
+ * @{
+ */
+
+/** Highest order of a CIC decimator */
+#define FILTER_CIC_MAX_ORDER 4
+
+/** Most extra bits of an oversample-and-decimate stage: 256 samples of 12 bits per 16-bit result */
+#define FILTER_DECIMATE_MAX_BITS 4
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup FILTER_Public_Types FILTER Public Types
+ * @{
+ */
+
+/** @brief Moving average of the last 2^n samples */
+typedef struct
+{
+    uint16_t* history; /**< Last samples, 2^n entries owned by the caller */
+    uint32_t sum;      /**< Sum of the history */
+    uint16_t index;    /**< Entry of the oldest sample, replaced by the next one */
+    uint16_t mask;     /**< 2^n - 1 */
+    uint8_t shift;     /**< n */
+    uint32_t Dropped;  /**< Words skipped by FILTER_BoxcarBlock() for their OVERRUN flag */
+} FILTER_Boxcar_Type;
+
+/** @brief Cascaded integrator-comb decimator, differential delay of 1 */
+typedef struct
+{
+    uint32_t integ[FILTER_CIC_MAX_ORDER]; /**< Integrator outputs, modulo 2^32 */
+    uint32_t comb[FILTER_CIC_MAX_ORDER];  /**< Input of each comb at the previous output */
+    uint16_t ratio;                       /**< Input samples per output */
+    uint16_t phase;                       /**< Input samples since the last output */
+    uint8_t order;                        /**< Number of integrator and comb pairs */
+    uint8_t shift;                        /**< Right shift of the outputs */
+    uint32_t Dropped;                     /**< Words skipped by FILTER_CicBlock() for their OVERRUN flag */
+} FILTER_Cic_Type;
+
+/** @brief Oversample-and-decimate stage, 4^n samples per result of 12 + n bits */
+typedef struct
+{
+    uint32_t sum;     /**< Sum of the samples of the current result */
+    uint16_t count;   /**< Samples in the sum */
+    uint16_t length;  /**< 4^n */
+    uint8_t shift;    /**< n */
+    uint32_t Dropped; /**< Words skipped by FILTER_DecimateBlock() for their OVERRUN flag */
+} FILTER_Decimate_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup FILTER_Public_Functions FILTER Public Functions
+ * @{
+ */
+
+void FILTER_BoxcarInit(FILTER_Boxcar_Type* f, uint16_t* history, uint8_t lengthLog2);
+uint16_t FILTER_BoxcarBlock(FILTER_Boxcar_Type* f, const uint32_t* words, uint32_t count);
+Status FILTER_CicInit(FILTER_Cic_Type* f, uint8_t order, uint16_t ratio, uint8_t shift);
+uint32_t FILTER_CicBlock(FILTER_Cic_Type* f, const uint32_t* words, uint32_t count, uint32_t* out);
+Status FILTER_DecimateInit(FILTER_Decimate_Type* f, uint8_t extraBits);
+uint32_t FILTER_DecimateBlock(FILTER_Decimate_Type* f, const uint32_t* words, uint32_t count, uint16_t* out);
+
+/*********************************************************************/ /**
+ * @brief		Add a sample to a moving average
+ * @param[in]	f		Moving average, initialized by FILTER_BoxcarInit()
+ * @param[in]	sample	12-bit sample
+ * @return		Average of the last 2^n samples, the missing ones count as 0
+ * 				until 2^n samples have been added
+ **********************************************************************/
+static __INLINE uint16_t FILTER_BoxcarPush(FILTER_Boxcar_Type* f, uint16_t sample)
+{
+    uint32_t index = f->index;
+
+    f->sum += (uint32_t)sample - f->history[index];
+    f->history[index] = sample;
+    f->index = (uint16_t)((index + 1) & f->mask);
+    return (uint16_t)(f->sum >> f->shift);
+}
+
+/*********************************************************************/ /**
+ * @brief		Add a sample to a CIC decimator
+ * @param[in]	f		Decimator, initialized by FILTER_CicInit()
+ * @param[in]	sample	12-bit sample
+ * @param[out]	out		Output, written once every ratio samples
+ * @return		1 when an output was written, 0 otherwise
+ *
+ * Note: the integrators wrap modulo 2^32. The output is exact as long as
+ * its full value, 12 bits times ratio^order, fits in 32 bits, which
+ * FILTER_CicInit() checks.
+ **********************************************************************/
+static __INLINE uint32_t FILTER_CicPush(FILTER_Cic_Type* f, uint16_t sample, uint32_t* out)
+{
+    uint32_t acc = sample;
+    uint32_t stage;
+
+    for (stage = 0; stage < f->order; stage++)
+    {
+        acc += f->integ[stage];
+        f->integ[stage] = acc;
+    }
+    if (++f->phase < f->ratio)
+    {
+        return 0;
+    }
+    f->phase = 0;
+    for (stage = 0; stage < f->order; stage++)
+    {
+        uint32_t prev = f->comb[stage];
+        f->comb[stage] = acc;
+        acc -= prev;
+    }
+    *out = acc >> f->shift;
+    return 1;
+}
+
+/*********************************************************************/ /**
+ * @brief		Add a sample to an oversample-and-decimate stage
+ * @param[in]	f		Stage, initialized by FILTER_DecimateInit()
+ * @param[in]	sample	12-bit sample
+ * @param[out]	out		Result of 12 + n bits, written once every 4^n samples
+ * @return		1 when a result was written, 0 otherwise
+ **********************************************************************/
+static __INLINE uint32_t FILTER_DecimatePush(FILTER_Decimate_Type* f, uint16_t sample, uint16_t* out)
+{
+    f->sum += sample;
+    if (++f->count < f->length)
+    {
+        return 0;
+    }
+    *out = (uint16_t)(f->sum >> f->shift);
+    f->sum = 0;
+    f->count = 0;
+    return 1;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_FILTER_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
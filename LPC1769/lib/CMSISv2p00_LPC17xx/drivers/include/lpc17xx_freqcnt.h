@@ -0,0 +1,130 @@
+/**********************************************************************
+ * @file		lpc17xx_freqcnt.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the gated frequency counter on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup FREQCNT FREQCNT (Gated frequency counter)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Measures the frequency of a digital signal with two timers, without any interrupt per edge:
+ * 	- the counter timer runs in counter mode: its TC counts the rising edges of its CAPn.x input, up to PCLK / 2;
+ * 	- the gate timer runs freely on the CPU clock. One match register interrupts at the end of each window, and one
+ * 	  capture input, wired to the same signal, timestamps the last rising edge without interrupt;
+ * 	- at the end of a window, FREQCNT_IntHandler() reads the edge count and the timestamp of the last edge. With an
+ * 	  edge timestamp at both ends, the frequency is reciprocal: the edges of the window over the exact time between
+ * 	  the first and the last one, to one tick. When the edges come faster than the registers can be read together,
+ * 	  the edges are counted over the window instead, to one edge;
+ * 	- FREQCNT_Read() returns the frequency with the half width of its confidence window, in Q16 fixed point.
+ *
+ * A tachometer giving one pulse per revolution, on P0.4 (CAP2.0) and P1.26 (CAP0.0), measured every 100 ms:
+ * @code
+ * FREQCNT_CFG_Type cfg;
+ * FREQCNT_Result_Type tach;
+ *
+ * cfg.CounterTIM = LPC_TIM2;
+ * cfg.CounterInput = TIM_COUNTER_INCAP0;
+ * cfg.GateTIM = LPC_TIM0;
+ * cfg.GateCapture = 0;
+ * cfg.GateMatch = 0;
+ * cfg.WindowUs = 100000;
+ * FREQCNT_Init(&cfg);
+ *
+ * void TIMER0_IRQHandler(void)
+ * {
+ *     FREQCNT_IntHandler();
+ * }
+ *
+ * if (FREQCNT_Read(&tach) == SUCCESS)
+ * {
+ *     // rpm = tach.FrequencyHz * 60 / 65536, within +- tach.ErrorHz * 60 / 65536
+ * }
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_FREQCNT_H_
+#define LPC17XX_FREQCNT_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup FREQCNT_Public_Macros FREQCNT Public Macros
+ * @{
+ */
+
+/** Measurement methods */
+#define FREQCNT_RECIPROCAL 0 /**< Edges over the time between the first and the last edge of the window */
+#define FREQCNT_COUNTING   1 /**< Edges over the time of the window */
+#define FREQCNT_STOPPED    2 /**< No edge in the window: below the inverse of the time since the last edge */
+
+/** Value of the Q16 results: 1 Hz */
+#define FREQCNT_Q16_ONE ((uint64_t)1 << 16)
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup FREQCNT_Public_Types FREQCNT Public Types
+ * @{
+ */
+
+/** @brief Timers and window of the counter */
+typedef struct
+{
+    LPC_TIM_TypeDef* CounterTIM; /**< Timer counting the edges, LPC_TIM0 to LPC_TIM3 */
+    LPC_TIM_TypeDef* GateTIM;    /**< Timer ending the windows and timestamping the edges, another one */
+    uint8_t CounterInput;        /**< Input of the counter timer: TIM_COUNTER_INCAP0 or TIM_COUNTER_INCAP1 */
+    uint8_t GateCapture;         /**< Capture channel of the gate timer wired to the signal, 0 or 1 */
+    uint8_t GateMatch;           /**< Match register of the gate timer ending the windows, 0 to 3 */
+    uint8_t Reserved;            /**< Reserved */
+    uint32_t WindowUs;           /**< Length of a window in microseconds, 10 us to 21 s at 100 MHz */
+} FREQCNT_CFG_Type;
+
+/** @brief Frequency of the last window */
+typedef struct
+{
+    uint64_t FrequencyHz; /**< Frequency in Hz, Q16 */
+    uint64_t ErrorHz;     /**< Half width of the confidence window in Hz, Q16: FrequencyHz +- ErrorHz */
+    uint32_t Edges;       /**< Rising edges counted in the window */
+    uint32_t Method;      /**< FREQCNT_RECIPROCAL, FREQCNT_COUNTING or FREQCNT_STOPPED */
+} FREQCNT_Result_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup FREQCNT_Public_Functions FREQCNT Public Functions
+ * @{
+ */
+
+Status FREQCNT_Init(FREQCNT_CFG_Type* FREQCNT_ConfigStruct);
+void FREQCNT_IntHandler(void);
+uint32_t FREQCNT_GetWindowCount(void);
+Status FREQCNT_Read(FREQCNT_Result_Type* result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_FREQCNT_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -53,6 +53,12 @@ extern "C"
  * @{
  */
 
+/** GPDMA channel priority classes, for GPDMA_AllocChannel(). The value is the first channel of the class: the
+ * controller serves the lower channel numbers first. */
+#define GPDMA_PRIO_HIGH   ((0UL)) /**< Channels 0 to 7, lowest free channel first */
+#define GPDMA_PRIO_MEDIUM ((2UL)) /**< Channels 2 to 7 */
+#define GPDMA_PRIO_LOW    ((6UL)) /**< Channels 6 and 7 */
+
 /** DMA Connection number definitions */
 #define GPDMA_CONN_SSP0_Tx       ((0UL))  /**< SSP0 Tx */
 #define GPDMA_CONN_SSP0_Rx       ((1UL))  /**< SSP0 Rx */
@@ -406,6 +412,22 @@ extern "C"
         uint32_t Control; /**< GPDMA Control of this LLI */
     } GPDMA_LLI_Type;
 
+    /**
+     * @brief GPDMA channel callback type, called from GPDMA_IntHandler() with the
+     * channel number and the argument given to GPDMA_Submit()
+     */
+    typedef void (*GPDMA_Callback_Type)(uint32_t channelNum, void* arg);
+
+    /**
+     * @brief GPDMA channel statistics structure type definition
+     */
+    typedef struct
+    {
+        uint32_t Transfers; /**< Terminal count interrupts served */
+        uint32_t Bytes;     /**< Bytes moved, TransferSize of the submitted transfer per terminal count */
+        uint32_t Errors;    /**< Error interrupts served */
+    } GPDMA_Stats_Type;
+
     /**
      * @}
      */
@@ -421,7 +443,12 @@ extern "C"
     IntStatus GPDMA_IntGetStatus(GPDMA_Status_Type type, uint8_t channel);
     void GPDMA_ClearIntPending(GPDMA_StateClear_Type type, uint8_t channel);
     void GPDMA_ChannelCmd(uint8_t channelNum, FunctionalState NewState);
-    // void GPDMA_IntHandler(void);
+    int32_t GPDMA_AllocChannel(uint32_t prio);
+    void GPDMA_FreeChannel(uint8_t channelNum);
+    Status GPDMA_Submit(GPDMA_Channel_CFG_Type* GPDMAChannelConfig, GPDMA_Callback_Type pfnDone,
+                        GPDMA_Callback_Type pfnError, void* arg);
+    void GPDMA_GetStats(uint8_t channelNum, GPDMA_Stats_Type* stats);
+    void GPDMA_IntHandler(void);
 
     /**
      * @}
@@ -118,6 +118,16 @@ extern "C"
         __O uint16_t FIOCLRU;   /**< FIO clear register upper halfword part */
     } GPIO_HalfWord_TypeDef;
 
+    /**
+     * @brief GPIO direction configuration structure
+     */
+    typedef struct
+    {
+        uint8_t portNum;   /**< Port number, in range from 0 to 4 */
+        uint32_t bitValue; /**< Pins of the port to configure */
+        uint8_t dir;       /**< Direction of the pins: 0 input, 1 output */
+    } GPIO_DIR_CFG_Type;
+
     /**
      * @}
      */
@@ -129,6 +139,7 @@ extern "C"
 
     /* GPIO style ------------------------------- */
     void GPIO_SetDir(uint8_t portNum, uint32_t bitValue, uint8_t dir);
+    void GPIO_ConfigDirs(const GPIO_DIR_CFG_Type* DirCfgTable, uint32_t count);
     void GPIO_SetValue(uint8_t portNum, uint32_t bitValue);
     void GPIO_ClearValue(uint8_t portNum, uint32_t bitValue);
     uint32_t GPIO_ReadValue(uint8_t portNum);
@@ -103,6 +103,9 @@
 /* DAC ------------------------------- */
 #define _ADC
 
+/* ADCSCAN --------------------------- */
+#define _ADCSCAN
+
 /* PWM ------------------------------- */
 #define _PWM
 #define _PWM1
@@ -132,6 +135,42 @@
 /* EMAC ------------------------------ */
 #define _EMAC
 
+/* PROF ------------------------------ */
+#define _PROF
+
+/* FILTER ---------------------------- */
+#define _FILTER
+
+/* DDS ------------------------------- */
+#define _DDS
+
+/* DACWAVE --------------------------- */
+#define _DACWAVE
+
+/* RECPLAY --------------------------- */
+#define _RECPLAY
+
+/* CLASSIFY -------------------------- */
+#define _CLASSIFY
+
+/* TWHEEL ---------------------------- */
+#define _TWHEEL
+
+/* SYSTIME --------------------------- */
+#define _SYSTIME
+
+/* PULSE ----------------------------- */
+#define _PULSE
+
+/* FREQCNT --------------------------- */
+#define _FREQCNT
+
+/* MATSEQ ---------------------------- */
+#define _MATSEQ
+
+/* PWMSYNC --------------------------- */
+#define _PWMSYNC
+
 /************************** GLOBAL/PUBLIC MACRO DEFINITIONS *********************************/
 
 #ifdef DEBUG
@@ -0,0 +1,104 @@
+/**********************************************************************
+ * @file		lpc17xx_matseq.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the DMA driven match sequencer on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup MATSEQ MATSEQ (DMA driven match sequencer)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Plays a train of edges on the MATn.0 or MATn.1 output of a timer, with no interrupt per edge:
+ * 	- the match register toggles the output and resets the TC, so it holds the time to the next edge;
+ * 	- the same match requests a GPDMA transfer, which writes the time to the following edge from a table in memory
+ * 	  into the match register, long before the TC reaches it;
+ * 	- after the last edge of a train played once, one more transfer from a linked list item stops the timer. A train
+ * 	  played in a loop goes on from the first edge again.
+ *
+ * Each edge falls on the tick given by the table, whatever the interrupt load: a stepper step train, the marks and
+ * spaces of an IR remote code, or servo frames, e.g. a 1.5 ms pulse every 20 ms on MAT1.0 (P1.22):
+ * @code
+ * static uint32_t servo[2] = {MATSEQ_TICKS(1850000), MATSEQ_TICKS(150000)}; // 18.5 ms low, 1.5 ms high
+ * MATSEQ_Type frame = {servo, 2, ENABLE, 0};
+ *
+ * MATSEQ_Init(LPC_TIM1, 0, 1); // MR0, 10 ns ticks
+ * MATSEQ_Start(&frame);
+ * servo[1] = MATSEQ_TICKS(200000); // 2 ms pulses from the next frame on
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_MATSEQ_H_
+#define LPC17XX_MATSEQ_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup MATSEQ_Public_Macros MATSEQ Public Macros
+ * @{
+ */
+
+/** Most edges of a train: the transfers of one GPDMA descriptor, which plays the whole table of a loop */
+#define MATSEQ_MAX_EDGES 4095
+
+/** Shortest time between two edges in PCLK cycles: the GPDMA writes the next match value meanwhile */
+#define MATSEQ_MIN_CYCLES 50
+
+/** Entry of the table for an edge a number of ticks after the previous one: the TC counts from 0 to the entry */
+#define MATSEQ_TICKS(ticks) ((uint32_t)(ticks) - 1)
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup MATSEQ_Public_Types MATSEQ Public Types
+ * @{
+ */
+
+/** @brief Train of edges */
+typedef struct
+{
+    const volatile uint32_t* Intervals; /**< Time before each edge, MATSEQ_TICKS(), kept in place while played */
+    uint32_t Count;                     /**< Edges, 2 to MATSEQ_MAX_EDGES */
+    FunctionalState Repeat;             /**< ENABLE: the train starts again after its last edge, DISABLE: once */
+    uint8_t IdleLevel;                  /**< Output level before the first edge and after MATSEQ_Stop(), 0 or 1 */
+} MATSEQ_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup MATSEQ_Public_Functions MATSEQ Public Functions
+ * @{
+ */
+
+Status MATSEQ_Init(LPC_TIM_TypeDef* TIMx, uint8_t matchChannel, uint32_t prescale);
+Status MATSEQ_Start(const MATSEQ_Type* train);
+void MATSEQ_Stop(void);
+Bool MATSEQ_IsBusy(void);
+uint32_t MATSEQ_GetTickHz(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_MATSEQ_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -178,6 +178,7 @@ extern "C"
      */
 
     void PINSEL_ConfigPin(PINSEL_CFG_Type* PinCfg);
+    void PINSEL_ConfigPins(const PINSEL_CFG_Type* PinCfgTable, uint32_t count);
     void PINSEL_ConfigTraceFunc(FunctionalState NewState);
     void PINSEL_SetI2C0Pins(uint8_t i2cPinMode, FunctionalState filterSlewRateEnable);
 
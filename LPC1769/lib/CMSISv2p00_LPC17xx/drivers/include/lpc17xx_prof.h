@@ -0,0 +1,140 @@
+/**********************************************************************
+ * @file		lpc17xx_prof.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the DWT cycle counter profiler on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup PROF PROF (DWT cycle counter profiler)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Measures interrupt handlers with the DWT cycle counter (CYCCNT, one count per core clock):
+ * 	- duration of each handler, without the time spent in the handlers that preempt it
+ * 	- latency from an event time stamp to the entry in its handler
+ * 	- CPU load, from the time spent between PROF_IdleEnter() and the next interrupt
+ *
+ * A handler is bracketed with PROF_IsrEnter() and PROF_IsrExit(), called first and last:
+ * @code
+ * void TIMER0_IRQHandler(void)
+ * {
+ *     PROF_IsrEnter(TIMER0_IRQn);
+ *     ...
+ *     PROF_IsrExit(TIMER0_IRQn);
+ * }
+ * @endcode
+ * CYCCNT wraps after 2^32 cycles (about 43 s at 100 MHz): a single duration or latency must be shorter, and the
+ * CPU load must be read at least that often.
+ * @{
+ */
+
+#ifndef LPC17XX_PROF_H_
+#define LPC17XX_PROF_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup PROF_Public_Macros PROF Public Macros
+ * @{
+ */
+
+/** Number of handlers that can be profiled at the same time */
+#ifndef PROF_MAX_SLOTS
+#define PROF_MAX_SLOTS 8
+#endif
+
+/** Deepest handler preemption tracked */
+#ifndef PROF_MAX_NESTING
+#define PROF_MAX_NESTING 8
+#endif
+
+/** Number of log2 histogram bins: bin n counts the values v with 2^(n-1) <= v < 2^n, bin 0 counts v = 0 */
+#define PROF_HIST_BINS 33
+
+/** Vector index of an exception or interrupt number (SysTick_IRQn = -1 gives 15) */
+#define PROF_VECTORS 51
+#define PROF_VECTOR(irq) ((uint32_t)((int32_t)(irq) + 16))
+
+/** Current value of the cycle counter */
+#define PROF_CYCLES() (DWT->CYCCNT)
+
+/** Records the time stamp of the event served by the handler of irq, see PROF_SetTrigger() */
+#define PROF_MarkTrigger(irq) PROF_SetTrigger((irq), PROF_CYCLES())
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup PROF_Public_Types PROF Public Types
+ * @{
+ */
+
+/** @brief Statistics of a series of cycle counts */
+typedef struct
+{
+    uint32_t count;                /**< Number of samples */
+    uint32_t min;                  /**< Smallest sample, in cycles */
+    uint32_t max;                  /**< Largest sample, in cycles */
+    uint64_t sum;                  /**< Sum of the samples, for the mean */
+    uint32_t hist[PROF_HIST_BINS]; /**< log2 histogram */
+} PROF_SERIES_Type;
+
+/** @brief Profile of an interrupt handler */
+typedef struct
+{
+    int32_t irq;               /**< Profiled exception or interrupt number */
+    PROF_SERIES_Type duration; /**< Cycles spent in the handler, preemptions excluded */
+    PROF_SERIES_Type latency;  /**< Cycles from the trigger time stamp to the handler entry */
+} PROF_SLOT_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup PROF_Public_Functions PROF Public Functions
+ * @{
+ */
+
+/* Init functions */
+void PROF_Init(void);
+void PROF_Reset(void);
+Status PROF_Attach(IRQn_Type irq);
+
+/* Handler bracketing functions */
+void PROF_IsrEnter(IRQn_Type irq);
+void PROF_IsrExit(IRQn_Type irq);
+void PROF_SetTrigger(IRQn_Type irq, uint32_t cycles);
+
+/* CPU load functions */
+void PROF_IdleEnter(void);
+void PROF_IdleExit(void);
+uint32_t PROF_GetLoad(void);
+
+/* Result functions */
+const PROF_SLOT_Type* PROF_GetSlot(IRQn_Type irq);
+uint32_t PROF_GetMean(const PROF_SERIES_Type* series);
+void PROF_Dump(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_PROF_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,117 @@
+/**********************************************************************
+ * @file		lpc17xx_pulse.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the capture based pulse measurement on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup PULSE PULSE (Capture based pulse measurement)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Measures the period, frequency and duty cycle of a digital signal with the capture inputs of one timer:
+ * 	- CAPn.0 captures the rising edges and CAPn.1 the falling edges, both pins wired to the signal. The interrupt
+ * 	  handler stores the two kinds of edges in one ring, in time order, with no division and no floating point;
+ * 	- the TC runs freely and is extended to 64 bits: one match register interrupts every 2^30 ticks, so that a
+ * 	  timestamp never wraps around;
+ * 	- PULSE_Measure() reads the last edges of the ring when the application asks, and computes the means over a
+ * 	  number of periods in Q16 fixed point. The ring has no lock: the handler never waits for the reader, and the
+ * 	  reader checks that the edges it used were not overwritten meanwhile.
+ *
+ * The timer counts the CPU clock: PULSE_Init() sets the PCLKSEL divider of the timer to CCLK / 1, in place of the
+ * CCLK / 4 of TIM_Init(), and the prescaler divides it further.
+ *
+ * With 10 ns ticks, a signal of a few tens of kHz costs a few dozen cycles per edge:
+ * @code
+ * PULSE_Result_Type pwm;
+ *
+ * PULSE_Init(LPC_TIM1, 3, 1);  // CAP1.0 (P1.18) and CAP1.1 (P1.19), MR3, 10 ns ticks
+ *
+ * void TIMER1_IRQHandler(void)
+ * {
+ *     PULSE_IntHandler();
+ * }
+ *
+ * if (PULSE_Measure(10, &pwm) == SUCCESS)
+ * {
+ *     // pwm.Duty: mean duty cycle of the last 10 periods, 65536 is 100 %
+ * }
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_PULSE_H_
+#define LPC17XX_PULSE_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup PULSE_Public_Macros PULSE Public Macros
+ * @{
+ */
+
+/** Edges kept in the ring, a power of two */
+#define PULSE_RING_SIZE 64
+
+/** Most periods PULSE_Measure() can average: the ring holds one rising and one falling edge per period */
+#define PULSE_MAX_PERIODS ((PULSE_RING_SIZE - 2) / 2)
+
+/** Value of the Q16 results: 1.0 */
+#define PULSE_Q16_ONE ((uint32_t)1 << 16)
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup PULSE_Public_Types PULSE Public Types
+ * @{
+ */
+
+/** @brief Means over the last periods of the signal */
+typedef struct
+{
+    uint32_t Periods;     /**< Number of periods measured */
+    uint64_t PeriodUs;    /**< Mean period in microseconds, Q16: 32 integer bits, periods of hours */
+    uint32_t FrequencyHz; /**< Mean frequency in Hz, Q16, 0xFFFFFFFF from 65536 Hz */
+    uint32_t Duty;        /**< Mean duty cycle, Q16: PULSE_Q16_ONE is 100 % */
+    uint64_t LastEdge;    /**< Tick of the last rising edge measured, to compare with PULSE_Now() */
+} PULSE_Result_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup PULSE_Public_Functions PULSE Public Functions
+ * @{
+ */
+
+Status PULSE_Init(LPC_TIM_TypeDef* TIMx, uint8_t matchChannel, uint32_t prescale);
+void PULSE_IntHandler(void);
+uint64_t PULSE_Now(void);
+uint32_t PULSE_GetTickHz(void);
+uint32_t PULSE_GetEdgeCount(void);
+Status PULSE_Measure(uint32_t periods, PULSE_Result_Type* result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_PULSE_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -326,6 +326,7 @@ extern "C"
     void PWM_ConfigCapture(LPC_PWM_TypeDef* PWMx, PWM_CAPTURECFG_Type* PWM_CaptureConfigStruct);
     uint32_t PWM_GetCaptureValue(LPC_PWM_TypeDef* PWMx, uint8_t CaptureChannel);
     void PWM_MatchUpdate(LPC_PWM_TypeDef* PWMx, uint8_t MatchChannel, uint32_t MatchValue, uint8_t UpdateType);
+    void PWM_MultiMatchUpdate(LPC_PWM_TypeDef* PWMx, PWM_Match_T* MatchStruct, uint8_t UpdateType);
     void PWM_ChannelConfig(LPC_PWM_TypeDef* PWMx, uint8_t PWMChannel, uint8_t ModeOption);
     void PWM_ChannelCmd(LPC_PWM_TypeDef* PWMx, uint8_t PWMChannel, FunctionalState NewState);
 
@@ -0,0 +1,144 @@
+/**********************************************************************
+ * @file		lpc17xx_pwmsync.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the synchronized PWM1 service on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup PWMSYNC PWMSYNC (Synchronized PWM1 channels)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Drives the six outputs of PWM1 with one period, and changes all their duty cycles at the same period boundary:
+ * 	- a frame holds the high time of every channel, and the rising edge of the double edge channels, in ticks;
+ * 	- PWMSYNC_Commit() writes the shadow match registers of the frame, then LER once: the hardware copies them
+ * 	  together when the next period starts, so a period never mixes two frames. Nothing is read back;
+ * 	- LER is cleared before the shadow registers are written, so a frame committed in the same period as the previous
+ * 	  one replaces it whole, and the latch never finds half a frame.
+ *
+ * PWMSYNC_UsTicks() gives the ticks of a pulse for servos, PWMSYNC_LevelTicks() the ticks of a brightness level for
+ * LEDs, through a lookup table from sensor_lut.h such as PWMSYNC_Cie1931:
+ * @code
+ * PWMSYNC_CFG_Type cfg = {20000, PWMSYNC_CH(1) | PWMSYNC_CH(2), 0, 0}; // 50 Hz
+ * PWMSYNC_Frame_Type frame = {{0}, {0}};
+ *
+ * PWMSYNC_Init(&cfg);
+ * frame.High[0] = PWMSYNC_UsTicks(1500);                     // PWM1.1: servo centered
+ * frame.High[1] = PWMSYNC_LevelTicks(PWMSYNC_Cie1931, 2048); // PWM1.2: LED at half perceived brightness
+ * PWMSYNC_Commit(&frame);
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_PWMSYNC_H_
+#define LPC17XX_PWMSYNC_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+#include "sensor_lut.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup PWMSYNC_Public_Macros PWMSYNC Public Macros
+ * @{
+ */
+
+/** Outputs of PWM1, PWM1.1 to PWM1.6 */
+#define PWMSYNC_CHANNELS 6
+
+/** Bit of the output PWM1.n in the channel masks of PWMSYNC_CFG_Type */
+#define PWMSYNC_CH(n) ((uint8_t)(1 << ((n) - 1)))
+
+/** Shortest period in ticks */
+#define PWMSYNC_MIN_TICKS 100
+
+/** Duty cycle of 100 % in Q16 */
+#define PWMSYNC_Q16_ONE ((uint32_t)1 << 16)
+
+/** Duty cycle in Q16 of a 12-bit brightness level with the CIE 1931 lightness curve, for SENSOR_TABLE() */
+#define PWMSYNC_CIE1931(code)                                                                                          \
+    ((int32_t)((((code) * 100.0 / 4096.0) <= 8.0 ? ((code) * 100.0 / 4096.0) / 903.3                                   \
+                                                 : PWMSYNC_CUBE(((code) * 100.0 / 4096.0 + 16.0) / 116.0)) *           \
+                   65536.0 +                                                                                           \
+               0.5))
+
+/** Duty cycle in Q16 of a 12-bit brightness level with a gamma of 2, for SENSOR_TABLE() */
+#define PWMSYNC_GAMMA2(code) ((int32_t)((code) * (code) * 65536.0 / (4096.0 * 4096.0) + 0.5))
+
+/** Cube of a constant expression */
+#define PWMSYNC_CUBE(x) ((x) * (x) * (x))
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup PWMSYNC_Public_Types PWMSYNC Public Types
+ * @{
+ */
+
+/** @brief Configuration of the outputs */
+typedef struct
+{
+    uint32_t PeriodUs;  /**< Period of all the outputs in microseconds, e.g. 20000 for servos */
+    uint8_t Channels;   /**< Outputs driven, PWMSYNC_CH(n) for PWM1.n */
+    uint8_t DoubleEdge; /**< Double edge outputs among Channels, PWM1.2 to PWM1.6: PWM1.n-1 must not be driven */
+    uint16_t Reserved;  /**< Must be 0 */
+} PWMSYNC_CFG_Type;
+
+/** @brief Frame of duty cycles, index n - 1 for PWM1.n */
+typedef struct
+{
+    uint32_t High[PWMSYNC_CHANNELS]; /**< Ticks high per period: 0 keeps the output low, the period keeps it high */
+    uint32_t Rise[PWMSYNC_CHANNELS]; /**< Double edge outputs: ticks from the start of the period to the rising edge */
+} PWMSYNC_Frame_Type;
+
+/**
+ * @}
+ */
+
+/* Public Variables ----------------------------------------------------------- */
+/** @addtogroup PWMSYNC_Public_Types
+ * @{
+ */
+
+/** Duty cycles of the brightness levels, in flash: CIE 1931 lightness curve and gamma of 2 */
+extern const int32_t PWMSYNC_Cie1931[SENSOR_TABLE_POINTS];
+extern const int32_t PWMSYNC_Gamma2[SENSOR_TABLE_POINTS];
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup PWMSYNC_Public_Functions PWMSYNC Public Functions
+ * @{
+ */
+
+Status PWMSYNC_Init(PWMSYNC_CFG_Type* PWMSYNC_ConfigStruct);
+Status PWMSYNC_Commit(const PWMSYNC_Frame_Type* frame);
+Bool PWMSYNC_IsPending(void);
+uint32_t PWMSYNC_GetPeriodTicks(void);
+uint32_t PWMSYNC_DutyTicks(uint32_t duty);
+uint32_t PWMSYNC_UsTicks(uint32_t us);
+uint32_t PWMSYNC_LevelTicks(const int32_t* curve, uint32_t level);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_PWMSYNC_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
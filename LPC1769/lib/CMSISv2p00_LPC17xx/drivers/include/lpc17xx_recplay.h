@@ -0,0 +1,137 @@
+/**********************************************************************
+ * @file		lpc17xx_recplay.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the ADC record and DAC playback engine on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup RECPLAY RECPLAY (ADC record and DAC playback)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Records an ADC channel into a circular buffer and plays the buffer back on the DAC, both moved by the GPDMA:
+ * 	- in record mode, a GPDMA channel writes every ADGDR word of the burst mode conversions into the buffer, in a
+ * 	  loop of linked list items of RECPLAY_BLOCK_SIZE words. The terminal count interrupt of each item clears the
+ * 	  bits of its block outside the VALUE field of DACR: the DONE, OVERRUN and CHN fields of ADGDR, and bit 16, which
+ * 	  would select the BIAS of DACR;
+ * 	- in play mode, another GPDMA channel writes the same words to DACR at the DAC update rate, in the same loop. An
+ * 	  ADGDR word holds the result in bits 15:4, and DACR takes its VALUE from bits 15:6: the words are played in place,
+ * 	  the CPU does not copy or shift them;
+ * 	- RECPLAY_Record() and RECPLAY_Play() switch modes, and continue from the position the other mode reached: after
+ * 	  a recording of RECPLAY_CFG_Type::Count samples or more, the playback starts with the oldest one and plays them
+ * 	  in order. RECPLAY_Record() takes constant time. Leaving record mode masks the words recorded since the last
+ * 	  terminal count, RECPLAY_BLOCK_SIZE words at most, or twice as many when its interrupt is pending.
+ *
+ * The buffer is meant for the AHB SRAM, so that the GPDMA does not compete with the CPU for the local SRAM:
+ * @code
+ * static RECPLAY_AHBRAM1 uint32_t samples[4096];  // the whole 16 kB bank, 20 ms at 200 kHz
+ * static const RECPLAY_CFG_Type cfg = {samples, 4096, 0, 200000, 200000};
+ *
+ * GPDMA_Init();
+ * NVIC_EnableIRQ(DMA_IRQn);  // DMA_IRQHandler() calls GPDMA_IntHandler()
+ * RECPLAY_Init(&cfg);
+ * RECPLAY_Record();
+ * ...
+ * RECPLAY_Play();  // from EINT0_IRQHandler(), for instance
+ * @endcode
+ * The DMA interrupt runs once per block while recording, and not at all while playing.
+ * @{
+ */
+
+#ifndef LPC17XX_RECPLAY_H_
+#define LPC17XX_RECPLAY_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup RECPLAY_Public_Macros RECPLAY Public Macros
+ * @{
+ */
+
+/** Places a buffer in the first bank of the AHB SRAM (AHBRAM0, 16 kB, shared with BITBAND_AHBRAM variables) */
+#define RECPLAY_AHBRAM0 __attribute__((section(".ahbram")))
+
+/** Places a buffer in the second bank of the AHB SRAM (AHBRAM1, 16 kB) */
+#define RECPLAY_AHBRAM1 __attribute__((section(".ahbram1")))
+
+/** Words per linked list item, at most 4095 */
+#ifndef RECPLAY_BLOCK_SIZE
+#define RECPLAY_BLOCK_SIZE 1024
+#endif
+
+/** Linked list items per mode: the buffer holds up to RECPLAY_MAX_BLOCKS * RECPLAY_BLOCK_SIZE words */
+#ifndef RECPLAY_MAX_BLOCKS
+#define RECPLAY_MAX_BLOCKS 8
+#endif
+
+/** Highest ADC conversion rate */
+#define RECPLAY_RECORD_RATE_MAX 200000
+
+/** Highest DAC update rate: the words played have bit 16 clear, the 700 uA bias of DACR */
+#define RECPLAY_PLAY_RATE_MAX 1000000
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup RECPLAY_Public_Types RECPLAY Public Types
+ * @{
+ */
+
+/** @brief Buffer, ADC channel and rates of the engine */
+typedef struct
+{
+    uint32_t* Buffer;    /**< ADGDR words, masked to DACR words. Global or static, best in the AHB SRAM. */
+    uint16_t Count;      /**< Words of the buffer, from 2 to RECPLAY_MAX_BLOCKS * RECPLAY_BLOCK_SIZE */
+    uint8_t Channel;     /**< ADC channel, 0 to 7 but 3 (AD0.3 is P0.26, the DAC output) */
+    uint32_t RecordRate; /**< Conversions per second, up to RECPLAY_RECORD_RATE_MAX, rounded to PCLK_ADC / (65 * n) */
+    uint32_t PlayRate;   /**< DAC updates per second, up to RECPLAY_PLAY_RATE_MAX */
+} RECPLAY_CFG_Type;
+
+/** @brief Mode of the engine */
+typedef enum
+{
+    RECPLAY_IDLE = 0, /**< Stopped, the DAC holds its last value */
+    RECPLAY_RECORD,   /**< The ADC writes the buffer */
+    RECPLAY_PLAY      /**< The DAC reads the buffer */
+} RECPLAY_MODE_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup RECPLAY_Public_Functions RECPLAY Public Functions
+ * @{
+ */
+
+Status RECPLAY_Init(const RECPLAY_CFG_Type* cfg);
+Status RECPLAY_Record(void);
+Status RECPLAY_Play(void);
+void RECPLAY_Stop(void);
+Status RECPLAY_SetPlayRate(uint32_t rate);
+RECPLAY_MODE_Type RECPLAY_GetMode(void);
+uint32_t RECPLAY_GetPosition(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_RECPLAY_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
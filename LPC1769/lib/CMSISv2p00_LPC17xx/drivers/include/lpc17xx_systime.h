@@ -0,0 +1,93 @@
+/**********************************************************************
+ * @file		lpc17xx_systime.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the tickless SysTick time base on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup SYSTIME SYSTIME (Tickless SysTick time base)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Keeps a 64-bit count of core clock cycles on the SysTick timer, and sleeps instead of spinning in delays:
+ * 	- without a pending deadline the SysTick counts its full 2^24 cycles: one interrupt every 168 ms at 100 MHz, where
+ * 	  a periodic tick takes one every millisecond;
+ * 	- a delay writes the reload value with the cycles left to its deadline, and waits in __WFI(). The core wakes up
+ * 	  at the deadline, and on the interrupts of the application;
+ * 	- the delays count cycles, so they do not depend on the optimization level. Each reprogramming of the SysTick
+ * 	  loses the few cycles between the read and the write of its current value.
+ *
+ * The delays are for the main loop. A caller that disabled the interrupts sleeps as long, but its interrupts, the
+ * SysTick one included, wait for the end of the delay:
+ * @code
+ * SYSTIME_Init();
+ *
+ * void SysTick_Handler(void)
+ * {
+ *     SYSTIME_IntHandler();
+ * }
+ *
+ * uint64_t next = SYSTIME_Now();
+ * while (TRUE)
+ * {
+ *     next += SYSTIME_MS(100);
+ *     SYSTIME_SleepUntil(next); // every 100 ms, without drift
+ *     toggle_led();
+ * }
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_SYSTIME_H_
+#define LPC17XX_SYSTIME_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup SYSTIME_Public_Macros SYSTIME Public Macros
+ * @{
+ */
+
+/** Cycles of SystemCoreClock in us microseconds */
+#define SYSTIME_US(us) ((uint64_t)(us) * (SystemCoreClock / 1000000))
+
+/** Cycles of SystemCoreClock in ms milliseconds */
+#define SYSTIME_MS(ms) ((uint64_t)(ms) * (SystemCoreClock / 1000))
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup SYSTIME_Public_Functions SYSTIME Public Functions
+ * @{
+ */
+
+void SYSTIME_Init(void);
+uint64_t SYSTIME_Now(void);
+void SYSTIME_SleepUntil(uint64_t deadline);
+void SYSTIME_DelayUs(uint32_t us);
+void SYSTIME_DelayMs(uint32_t ms);
+void SYSTIME_IntHandler(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_SYSTIME_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
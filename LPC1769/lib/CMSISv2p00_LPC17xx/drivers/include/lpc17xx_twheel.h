@@ -0,0 +1,140 @@
+/**********************************************************************
+ * @file		lpc17xx_twheel.h
+ * @brief	Contains all macro definitions and function prototypes
+ * 			support for the tickless software timer wheel on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @defgroup TWHEEL TWHEEL (Tickless software timer wheel)
+ * @ingroup LPC1700CMSIS_FwLib_Drivers
+ * Runs any number of software timers, one-shot or periodic, on a single match register of one hardware timer:
+ * 	- the timer counts ticks freely, and the match register is written with the next deadline only: there is no
+ * 	  periodic tick. Without a running timer the interrupt is disabled;
+ * 	- the timers are kept in a hierarchical wheel of TWHEEL_LEVELS levels of TWHEEL_SLOTS slots, a slot of level L
+ * 	  spanning TWHEEL_SLOTS^L ticks. TWHEEL_Start() and TWHEEL_Stop() take constant time, and the next deadline is
+ * 	  found with one CLZ per level. A slot of a higher level is moved down, in one pass over its timers, when the
+ * 	  ticks reach its start;
+ * 	- each timer runs its callback in the interrupt handler (TWHEEL_ISR), or is queued for TWHEEL_RunDeferred() in
+ * 	  the main loop (TWHEEL_DEFERRED).
+ *
+ * The other match registers and the capture registers of the timer stay free, the TC is never reset:
+ * @code
+ * static TWHEEL_Timer_Type blink;
+ *
+ * TWHEEL_Init(LPC_TIM0, 0, 100);  // MR0, 100 us ticks
+ * TWHEEL_TimerInit(&blink, toggle_led, (void*)LED0, TWHEEL_ISR);
+ * TWHEEL_Start(&blink, 2500, 2500);  // every 250 ms
+ *
+ * void TIMER0_IRQHandler(void)
+ * {
+ *     TWHEEL_IntHandler();
+ * }
+ * @endcode
+ * @{
+ */
+
+#ifndef LPC17XX_TWHEEL_H_
+#define LPC17XX_TWHEEL_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include "LPC17xx.h"
+#include "lpc_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup TWHEEL_Public_Macros TWHEEL Public Macros
+ * @{
+ */
+
+/** Slots per level, one bit each in a 32-bit word */
+#define TWHEEL_SLOTS 32
+
+/** Levels: TWHEEL_SLOTS^TWHEEL_LEVELS = 2^30 ticks, a divisor of the 2^32 ticks of the TC */
+#define TWHEEL_LEVELS 6
+
+/** Longest delay or period, in ticks: 14.9 hours with 100 us ticks */
+#define TWHEEL_MAX_TICKS ((uint32_t)1 << 29)
+
+/**
+ * Longest time between two interrupts while a timer runs, in ticks: the wheel is brought up to date this often, so
+ * that a delay from the TC stays within the 2^30 ticks of the wheel
+ */
+#define TWHEEL_HORIZON ((uint32_t)1 << 28)
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup TWHEEL_Public_Types TWHEEL Public Types
+ * @{
+ */
+
+/** @brief Context of a callback */
+typedef enum
+{
+    TWHEEL_ISR = 0,  /**< Called from TWHEEL_IntHandler(), at the priority of the timer interrupt */
+    TWHEEL_DEFERRED  /**< Queued when it expires, called from TWHEEL_RunDeferred() */
+} TWHEEL_MODE_Type;
+
+/**
+ * @brief Expiry callback
+ * @param[in] arg Argument given to TWHEEL_TimerInit()
+ */
+typedef void (*TWHEEL_Callback_Type)(void* arg);
+
+/** @brief Software timer, global or static, its fields are private */
+typedef struct TWHEEL_Timer
+{
+    struct TWHEEL_Timer* Next;     /**< Next timer of the same slot */
+    struct TWHEEL_Timer* Prev;     /**< Previous timer of the same slot, NULL for the first one */
+    struct TWHEEL_Timer* QNext;    /**< Next timer of the deferred queue */
+    struct TWHEEL_Timer* QPrev;    /**< Previous timer of the deferred queue, NULL for the first one */
+    uint32_t Expiry;               /**< Tick of the next expiry */
+    uint32_t Period;               /**< Ticks between two expiries, 0 for a one-shot timer */
+    TWHEEL_Callback_Type Callback; /**< Expiry callback */
+    void* Arg;                     /**< Argument of the callback */
+    uint8_t Mode;                  /**< TWHEEL_MODE_Type of the callback */
+    uint8_t Slot;                  /**< Slot of the wheel holding the timer, 0xFF when it is not in the wheel */
+    uint8_t Queued;                /**< In the deferred queue */
+} TWHEEL_Timer_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup TWHEEL_Public_Functions TWHEEL Public Functions
+ * @{
+ */
+
+Status TWHEEL_Init(LPC_TIM_TypeDef* TIMx, uint8_t matchChannel, uint32_t tickUs);
+void TWHEEL_TimerInit(TWHEEL_Timer_Type* timer, TWHEEL_Callback_Type callback, void* arg, TWHEEL_MODE_Type mode);
+Status TWHEEL_Start(TWHEEL_Timer_Type* timer, uint32_t delay, uint32_t period);
+void TWHEEL_Stop(TWHEEL_Timer_Type* timer);
+Bool TWHEEL_IsActive(const TWHEEL_Timer_Type* timer);
+uint32_t TWHEEL_Now(void);
+void TWHEEL_IntHandler(void);
+uint32_t TWHEEL_RunDeferred(void);
+Bool TWHEEL_IsDeferredPending(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_TWHEEL_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
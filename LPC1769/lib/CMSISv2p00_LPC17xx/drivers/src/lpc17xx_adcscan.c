@@ -0,0 +1,322 @@
+/**********************************************************************
+ * @file		lpc17xx_adcscan.c
+ * @brief	Contains all functions support for the burst mode
+ * 			multi-channel ADC scanner on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup ADCSCAN
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_adcscan.h"
+#include "lpc17xx_adc.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_pinsel.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _ADCSCAN
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup ADCSCAN_Private_Macros ADCSCAN Private Macros
+ * @{
+ */
+
+#if (ADCSCAN_RING_SIZE & (ADCSCAN_RING_SIZE - 1)) != 0
+#error "ADCSCAN_RING_SIZE must be a power of 2"
+#endif
+
+/** Registers of the GPDMA channel n, the channels are 0x20 bytes apart */
+#define ADCSCAN_DMACH(n) ((LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ((uint32_t)(n) << 5)))
+
+/** Control word of the linked list items: ADGDR words to memory, terminal count interrupt at the end of the block */
+#define ADCSCAN_DMA_CONTROL                                                                                            \
+    (GPDMA_DMACCxControl_TransferSize(ADCSCAN_BLOCK_SIZE) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |             \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_DI | GPDMA_DMACCxControl_I)
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup ADCSCAN_Private_Variables ADCSCAN Private Variables
+ * @{
+ */
+
+/** Pin of each channel AD0.0 to AD0.7, without pull-up or pull-down */
+static const PINSEL_CFG_Type scan_pins[ADCSCAN_CHANNELS] = {
+    {PINSEL_PORT_0, PINSEL_PIN_23, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_24, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_25, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_26, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_1, PINSEL_PIN_30, PINSEL_FUNC_3, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_1, PINSEL_PIN_31, PINSEL_FUNC_3, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_3, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_2, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+};
+
+/** ADGDR words, written alternately by the two linked list items */
+static uint32_t scan_block[2][ADCSCAN_BLOCK_SIZE];
+/** Each item reloads the channel for the other block */
+static GPDMA_LLI_Type scan_lli[2];
+
+/** Ring of each channel, stored twice in a row so that the last samples are always contiguous */
+static uint16_t scan_ring[ADCSCAN_CHANNELS][2 * ADCSCAN_RING_SIZE];
+/** Samples stored in each ring since ADCSCAN_Init(), the next one goes at this index modulo ADCSCAN_RING_SIZE */
+static volatile uint32_t scan_head[ADCSCAN_CHANNELS];
+static uint32_t scan_dropped[ADCSCAN_CHANNELS];
+
+static uint8_t scan_mask;
+/** GPDMA channel of the scanner, -1 until ADCSCAN_Init() gets one */
+static int32_t scan_dma = -1;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup ADCSCAN_Private_Functions ADCSCAN Private Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		GPDMA terminal count callback, sorts the words of the block
+ * 				completed into the rings of their channels
+ * @param[in]	channel	GPDMA channel of the scanner
+ * @param[in]	arg		Not used
+ * @return		None
+ *
+ * Note: the completed block is the one the channel is not writing now. It is
+ * found from the destination address rather than by alternation, so it stays
+ * right when the interrupt is served late.
+ **********************************************************************/
+static void scan_block_done(uint32_t channel, void* arg)
+{
+    uint32_t dst = ADCSCAN_DMACH(channel)->DMACCDestAddr;
+    const uint32_t* words = scan_block[(dst - (uint32_t)scan_block[1] < sizeof(scan_block[1])) ? 0 : 1];
+
+    (void)arg;
+
+    for (uint32_t i = 0; i < ADCSCAN_BLOCK_SIZE; i++)
+    {
+        uint32_t word = words[i];
+        uint32_t chn = ADC_GDR_CH(word);
+        uint32_t head;
+        uint16_t result;
+
+        // A set OVERRUN flag means a result of the scan was lost before this one, a clear DONE flag that the word
+        // holds no new result
+        if ((word & (ADC_GDR_DONE_FLAG | ADC_GDR_OVERRUN_FLAG)) != ADC_GDR_DONE_FLAG)
+        {
+            scan_dropped[chn]++;
+            continue;
+        }
+
+        head = scan_head[chn];
+        result = (uint16_t)ADC_GDR_RESULT(word);
+        scan_ring[chn][head & (ADCSCAN_RING_SIZE - 1)] = result;
+        scan_ring[chn][(head & (ADCSCAN_RING_SIZE - 1)) + ADCSCAN_RING_SIZE] = result;
+        scan_head[chn] = head + 1;
+    }
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup ADCSCAN_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Configure the ADC, its pins and a GPDMA channel to scan a set
+ * 				of channels, and clear the rings and the counters
+ * @param[in]	channelMask	Channels to scan, ADCSCAN_CH(n) of each channel n
+ * @param[in]	rate		Conversion rate of the ADC in Hz, at most 200 kHz.
+ * 							Each channel is sampled at rate divided by the
+ * 							number of channels of the mask.
+ * @return		SUCCESS, or ERROR if the mask is empty or no GPDMA channel
+ * 				is free
+ *
+ * Note: GPDMA_Init() must have been called. The GPDMA channel is kept by the
+ * scanner: a second call keeps it and only changes the channels and the rate.
+ * The scan is stopped.
+ **********************************************************************/
+Status ADCSCAN_Init(uint8_t channelMask, uint32_t rate)
+{
+    PINSEL_CFG_Type pins[ADCSCAN_CHANNELS];
+    uint32_t count = 0;
+
+    if (channelMask == 0)
+    {
+        return ERROR;
+    }
+    if (scan_dma < 0)
+    {
+        scan_dma = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+        if (scan_dma < 0)
+        {
+            return ERROR;
+        }
+    }
+    ADCSCAN_Stop();
+
+    ADC_Init(LPC_ADC, rate);
+    for (uint32_t channel = 0; channel < ADCSCAN_CHANNELS; channel++)
+    {
+        if (channelMask & ADCSCAN_CH(channel))
+        {
+            pins[count++] = scan_pins[channel];
+            ADC_ChannelCmd(LPC_ADC, (uint8_t)channel, ENABLE);
+        }
+        scan_head[channel] = 0;
+        scan_dropped[channel] = 0;
+    }
+    PINSEL_ConfigPins(pins, count);
+
+    // The DMA request of the ADC is the interrupt flag of the channels: every conversion of the scan requests a
+    // transfer. The global DONE interrupt is not allowed in burst mode.
+    LPC_ADC->ADINTEN = channelMask;
+
+    scan_mask = channelMask;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Start the scan: burst mode conversions moved by the GPDMA
+ * @param[in]	None
+ * @return		SUCCESS, or ERROR if ADCSCAN_Init() did not succeed
+ *
+ * Note: the DMA interrupt must be enabled in the NVIC, and DMA_IRQHandler()
+ * must call GPDMA_IntHandler(). The rings keep their samples.
+ **********************************************************************/
+Status ADCSCAN_Start(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+
+    if ((scan_dma < 0) || (scan_mask == 0))
+    {
+        return ERROR;
+    }
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        scan_lli[i].SrcAddr = (uint32_t)&LPC_ADC->ADGDR;
+        scan_lli[i].DstAddr = (uint32_t)scan_block[i];
+        scan_lli[i].NextLLI = (uint32_t)&scan_lli[i ^ 1];
+        scan_lli[i].Control = ADCSCAN_DMA_CONTROL;
+    }
+
+    // Block 0 first, then item 1 fills block 1 and links to item 0, which fills block 0 again
+    cfg.ChannelNum = (uint32_t)scan_dma;
+    cfg.SrcMemAddr = 0;
+    cfg.DstMemAddr = (uint32_t)scan_block[0];
+    cfg.TransferSize = ADCSCAN_BLOCK_SIZE;
+    cfg.TransferWidth = 0;
+    cfg.TransferType = GPDMA_TRANSFERTYPE_P2M;
+    cfg.SrcConn = GPDMA_CONN_ADC;
+    cfg.DstConn = 0;
+    cfg.DMALLI = (uint32_t)&scan_lli[1];
+
+    if (GPDMA_Submit(&cfg, scan_block_done, NULL, NULL) != SUCCESS)
+    {
+        return ERROR;
+    }
+    ADC_BurstCmd(LPC_ADC, ENABLE);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop the scan, the rings keep their samples
+ * @param[in]	None
+ * @return		None
+ *
+ * Note: the results of the block being filled are not sorted.
+ **********************************************************************/
+void ADCSCAN_Stop(void)
+{
+    ADC_BurstCmd(LPC_ADC, DISABLE);
+    if (scan_dma >= 0)
+    {
+        GPDMA_ChannelCmd((uint8_t)scan_dma, DISABLE);
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the last samples of a channel, in place
+ * @param[in]	channel	ADC channel, in range from 0 to 7
+ * @param[in]	count	Number of samples, at most ADCSCAN_RING_SIZE
+ * @return		Pointer to count contiguous 12-bit results, oldest first,
+ * 				or NULL if the channel has fewer samples or count is too large
+ *
+ * Note: the samples are not copied. They stay valid until the DMA interrupt
+ * stores ADCSCAN_RING_SIZE - count new samples of the channel: a reader that
+ * can be late compares ADCSCAN_GetCount() before and after reading them.
+ **********************************************************************/
+const uint16_t* ADCSCAN_GetLatest(uint8_t channel, uint32_t count)
+{
+    uint32_t head;
+
+    if ((channel >= ADCSCAN_CHANNELS) || (count > ADCSCAN_RING_SIZE))
+    {
+        return NULL;
+    }
+    head = scan_head[channel];
+    if (head < count)
+    {
+        return NULL;
+    }
+    return &scan_ring[channel][(head - count) & (ADCSCAN_RING_SIZE - 1)];
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the number of samples stored for a channel
+ * @param[in]	channel	ADC channel, in range from 0 to 7
+ * @return		Samples stored since ADCSCAN_Init(), wraps after 2^32
+ **********************************************************************/
+uint32_t ADCSCAN_GetCount(uint8_t channel)
+{
+    return (channel < ADCSCAN_CHANNELS) ? scan_head[channel] : 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the counters of a channel
+ * @param[in]	channel	ADC channel, in range from 0 to 7
+ * @param[out]	stats	Counters of the channel since ADCSCAN_Init()
+ * @return		None
+ **********************************************************************/
+void ADCSCAN_GetStats(uint8_t channel, ADCSCAN_Stats_Type* stats)
+{
+    if (channel >= ADCSCAN_CHANNELS)
+    {
+        stats->Samples = 0;
+        stats->Dropped = 0;
+        return;
+    }
+    stats->Samples = scan_head[channel];
+    stats->Dropped = scan_dropped[channel];
+}
+
+/**
+ * @}
+ */
+
+#endif /* _ADCSCAN */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,258 @@
+/**********************************************************************
+ * @file		lpc17xx_classify.c
+ * @brief	Contains all functions support for the threshold classifier
+ * 			of ADC readings on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup CLASSIFY
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_classify.h"
+#include "band_classify.h"
+#include "lpc17xx_adc.h"
+#include "lpc17xx_fgpio.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _CLASSIFY
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup CLASSIFY_Private_Macros CLASSIFY Private Macros
+ * @{
+ */
+
+#if CLASSIFY_BAND_NONE != BAND_NONE
+#error "CLASSIFY_BAND_NONE must be the BAND_NONE of band_classify.h"
+#endif
+
+/**
+ * @}
+ */
+
+/* Private Types -------------------------------------------------------------- */
+/** @defgroup CLASSIFY_Private_Types CLASSIFY Private Types
+ * @{
+ */
+
+/** @brief State of an input */
+typedef struct
+{
+    const CLASSIFY_Table_Type* Table; /**< NULL when the input is not classified */
+    uint32_t Changes;                 /**< Bands taken since CLASSIFY_SetTable() */
+    BAND_State_Type Bands;            /**< Band, CLASSIFY_BAND_NONE before the first reading, and its debounce */
+} CLASSIFY_State_Type;
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup CLASSIFY_Private_Variables CLASSIFY Private Variables
+ * @{
+ */
+
+static CLASSIFY_State_Type classify_state[CLASSIFY_CHANNELS];
+static CLASSIFY_Callback_Type classify_callback;
+static void* classify_arg;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup CLASSIFY_Private_Functions CLASSIFY Private Functions
+ * @{
+ */
+
+/* The band changed: drive the pins of the new one, then tell the callback */
+static void classify_take(uint8_t channel, CLASSIFY_State_Type* state, uint8_t previous)
+{
+    const CLASSIFY_Table_Type* table = state->Table;
+    uint8_t band = state->Bands.Band;
+
+    if (table->Pins != NULL)
+    {
+        uint32_t all = 0;
+
+        for (uint8_t i = 0; i < table->Count; i++)
+        {
+            all |= table->Pins[i];
+        }
+        FGPIO_Write(table->Port, all, table->Pins[band]);
+    }
+    state->Changes++;
+
+    if (classify_callback != NULL)
+    {
+        classify_callback(channel, band, previous, classify_arg);
+    }
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup CLASSIFY_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Remove the tables of all the inputs, and set the band
+ * 				change callback
+ * @param[in]	callback	Called on each band change, or NULL
+ * @param[in]	arg			Argument of the callback
+ * @return		None
+ **********************************************************************/
+void CLASSIFY_Init(CLASSIFY_Callback_Type callback, void* arg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    for (uint32_t channel = 0; channel < CLASSIFY_CHANNELS; channel++)
+    {
+        classify_state[channel].Table = NULL;
+        classify_state[channel].Changes = 0;
+        BAND_Reset(&classify_state[channel].Bands);
+    }
+    classify_callback = callback;
+    classify_arg = arg;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Set or replace the table of an input
+ * @param[in]	channel	Input, 0 to CLASSIFY_CHANNELS - 1
+ * @param[in]	table	Table, kept in place while it is used, or NULL to
+ * 						stop classifying the input
+ * @return		SUCCESS, or ERROR if the input or the number of bands is
+ * 				out of range
+ *
+ * Note: the next reading is classified without hysteresis or debounce, and
+ * drives the pins of its band. The pins of the previous table that the new
+ * one does not use are left as they are. It may be called while the
+ * readings arrive.
+ **********************************************************************/
+Status CLASSIFY_SetTable(uint8_t channel, const CLASSIFY_Table_Type* table)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    if ((channel >= CLASSIFY_CHANNELS) ||
+        ((table != NULL) && ((table->Count == 0) || (table->Count > CLASSIFY_MAX_BANDS))))
+    {
+        return ERROR;
+    }
+
+    __disable_irq();
+    classify_state[channel].Table = table;
+    classify_state[channel].Changes = 0;
+    BAND_Reset(&classify_state[channel].Bands);
+    __set_PRIMASK(primask);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Classify a reading of an input
+ * @param[in]	channel	Input, 0 to CLASSIFY_CHANNELS - 1
+ * @param[in]	reading	Reading, in the unit of the thresholds
+ * @return		None
+ *
+ * Note: the band changes when the reading passes the threshold beyond the
+ * current band by the hysteresis, for Debounce readings in a row. A reading
+ * may skip bands. Readings of an input must not be classified from two
+ * interrupt priorities. A reading of an input out of range is ignored.
+ **********************************************************************/
+void CLASSIFY_Update(uint8_t channel, uint16_t reading)
+{
+    CLASSIFY_State_Type* state;
+    const CLASSIFY_Table_Type* table;
+    uint8_t previous;
+
+    CHECK_PARAM(channel < CLASSIFY_CHANNELS);
+
+    if (channel >= CLASSIFY_CHANNELS)
+    {
+        return;
+    }
+    state = &classify_state[channel];
+    table = state->Table;
+    if (table == NULL)
+    {
+        return;
+    }
+    // The state machine is shared with the STM32 examples (lib/band_classify)
+    previous = state->Bands.Band;
+    if (BAND_Update(&state->Bands, table->Thresholds, table->Count, table->Hysteresis, table->Debounce, reading))
+    {
+        classify_take(channel, state, previous);
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Classify a DMA buffer of ADC words, each word as a reading
+ * 				of the input of its channel
+ * @param[in]	words	ADGDR (or ADDRn) words
+ * @param[in]	count	Number of words
+ * @return		None
+ *
+ * Note: the readings are the 12-bit results. The words without the DONE
+ * flag, or with the OVERRUN flag, are skipped.
+ **********************************************************************/
+void CLASSIFY_UpdateBlock(const uint32_t* words, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t word = words[i];
+
+        if ((word & (ADC_GDR_DONE_FLAG | ADC_GDR_OVERRUN_FLAG)) == ADC_GDR_DONE_FLAG)
+        {
+            CLASSIFY_Update((uint8_t)ADC_GDR_CH(word), (uint16_t)ADC_GDR_RESULT(word));
+        }
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the current band of an input
+ * @param[in]	channel	Input, 0 to CLASSIFY_CHANNELS - 1
+ * @return		Band, or CLASSIFY_BAND_NONE without a table or before the
+ * 				first reading
+ **********************************************************************/
+uint8_t CLASSIFY_GetBand(uint8_t channel)
+{
+    return (channel < CLASSIFY_CHANNELS) ? classify_state[channel].Bands.Band : CLASSIFY_BAND_NONE;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the number of band changes of an input
+ * @param[in]	channel	Input, 0 to CLASSIFY_CHANNELS - 1
+ * @return		Bands taken since CLASSIFY_SetTable(), the first one
+ * 				included: the number of writes to the pins
+ **********************************************************************/
+uint32_t CLASSIFY_GetChanges(uint8_t channel)
+{
+    return (channel < CLASSIFY_CHANNELS) ? classify_state[channel].Changes : 0;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _CLASSIFY */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -108,6 +108,43 @@ void CLKPWR_SetPCLKDiv(uint32_t ClkType, uint32_t DivVal)
     }
 }
 
+/*********************************************************************/ /**
+ * @brief		Set the dividers of a table of peripheral clocks with one
+ * 				read-modify-write of PCLKSEL0 and of PCLKSEL1 at most
+ * @param[in]	PclkCfgTable	Table of CLKPWR_PCLK_CFG_Type, one entry per
+ * 								peripheral clock (see CLKPWR_SetPCLKDiv())
+ * @param[in]	count			Number of entries of PclkCfgTable
+ * @return		None
+ *
+ * Note: the peripherals of a same register change their clock together. The
+ * power of several peripherals is switched the same way by a single call of
+ * CLKPWR_ConfigPPWR() with the CLKPWR_PCONP_x bits OR'ed together.
+ **********************************************************************/
+void CLKPWR_ConfigPCLKs(const CLKPWR_PCLK_CFG_Type* PclkCfgTable, uint32_t count)
+{
+    uint32_t mask[2] = {0}, value[2] = {0};
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint32_t reg = (PclkCfgTable[i].ClkType < 32) ? 0 : 1;
+        uint32_t bitpos = PclkCfgTable[i].ClkType - 32 * reg;
+
+        mask[reg] |= CLKPWR_PCLKSEL_BITMASK(bitpos);
+        value[reg] &= ~CLKPWR_PCLKSEL_BITMASK(bitpos);
+        value[reg] |= CLKPWR_PCLKSEL_SET(bitpos, PclkCfgTable[i].DivVal);
+    }
+
+    if (mask[0])
+    {
+        LPC_SC->PCLKSEL0 = (LPC_SC->PCLKSEL0 & ~mask[0]) | value[0];
+    }
+    if (mask[1])
+    {
+        LPC_SC->PCLKSEL1 = (LPC_SC->PCLKSEL1 & ~mask[1]) | value[1];
+    }
+}
+
 /*********************************************************************/ /**
   * @brief		Get current value of each Peripheral Clock Selection
   * @param[in]	ClkType	Peripheral Clock Selection of each type,
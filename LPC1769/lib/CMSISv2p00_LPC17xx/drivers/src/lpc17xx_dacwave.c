@@ -0,0 +1,377 @@
+/**********************************************************************
+ * @file		lpc17xx_dacwave.c
+ * @brief	Contains all functions support for the DAC waveform player
+ * 			on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup DACWAVE
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_dacwave.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_pinsel.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _DACWAVE
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DACWAVE_Private_Macros DACWAVE Private Macros
+ * @{
+ */
+
+/** Registers of the GPDMA channel n, the channels are 0x20 bytes apart */
+#define DACWAVE_DMACH(n) ((LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ((uint32_t)(n) << 5)))
+
+/** Control word of the linked list items, n words to DACR */
+#define DACWAVE_DMA_CONTROL(n)                                                                                         \
+    (GPDMA_DMACCxControl_TransferSize((uint32_t)(n)) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |                  \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_SI)
+
+/** Transfers left in the period below which the GPDMA may be loading the next item */
+#define DACWAVE_GUARD 2
+
+/**
+ * @}
+ */
+
+/* Public Variables ----------------------------------------------------------- */
+/** @addtogroup DACWAVE_Public_Types
+ * @{
+ */
+
+const uint32_t DACWAVE_Sine64[64] = DACWAVE_TABLE(DACWAVE_SINE, 64, 0, 1023);
+const uint32_t DACWAVE_Triangle64[64] = DACWAVE_TABLE(DACWAVE_TRIANGLE, 64, 0, 1023);
+const uint32_t DACWAVE_Sawtooth64[64] = DACWAVE_TABLE(DACWAVE_SAWTOOTH, 64, 0, 1023);
+const uint32_t DACWAVE_Square64[64] = DACWAVE_TABLE(DACWAVE_SQUARE, 64, 0, 1023);
+const uint32_t DACWAVE_Trapezoid64[64] = DACWAVE_TABLE(DACWAVE_TRAPEZOID, 64, 0, 1023);
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup DACWAVE_Private_Variables DACWAVE Private Variables
+ * @{
+ */
+
+/**
+ * The item the GPDMA loads at the end of each period. It loops on itself with a whole period, or holds the first
+ * sample of the next waveform, with its terminal count interrupt, and links to wave_rest.
+ */
+static GPDMA_LLI_Type wave_loop;
+/** The other samples of the first period of a new waveform, links back to wave_loop */
+static GPDMA_LLI_Type wave_rest;
+
+/** Waveform of the periods being played */
+static const DACWAVE_Type* wave_playing;
+/** Waveform written to the items, whose first sample has not been moved yet, NULL if none */
+static const DACWAVE_Type* wave_pending;
+/** Waveform selected while another one was pending, NULL if none */
+static const DACWAVE_Type* wave_queued;
+/** wave_loop holds a first sample rather than a whole period */
+static uint32_t wave_split;
+
+static uint32_t wave_pclk;
+/** GPDMA channel of the player, -1 until DACWAVE_Init() gets one */
+static int32_t wave_dma = -1;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup DACWAVE_Private_Functions DACWAVE Private Functions
+ * @{
+ */
+
+/*
+ * DACCNTVAL of the rate of a waveform, rounded to the nearest PCLK_DAC period, 0 if out of range. The bias of the first
+ * word sets the settling time, hence the highest rate.
+ */
+static uint32_t wave_timeout(const DACWAVE_Type* wave)
+{
+    uint32_t rate = wave->Rate;
+    uint32_t max = (wave->Samples[0] & DACWAVE_BIAS) ? DACWAVE_MAX_RATE_BIAS : DACWAVE_MAX_RATE;
+    uint32_t timeout = ((rate != 0) && (rate <= max)) ? (wave_pclk + rate / 2) / rate : 0;
+
+    return (timeout <= 0xFFFF) ? timeout : 0;
+}
+
+/* Transfers left in the period being played, when it is a whole period of wave_playing */
+static uint32_t wave_left(void)
+{
+    uint32_t end = (uint32_t)(wave_playing->Samples + wave_playing->Count);
+
+    return (end - DACWAVE_DMACH(wave_dma)->DMACCSrcAddr) / sizeof(uint32_t);
+}
+
+/*
+ * Rewrite the items so that the next period starts with the first sample of wave, alone in an item with the terminal
+ * count interrupt. Called with the interrupts disabled, at least DACWAVE_GUARD transfers before the end of the period.
+ */
+static void wave_write_first(const DACWAVE_Type* wave)
+{
+    wave_rest.SrcAddr = (uint32_t)(wave->Samples + 1);
+    wave_rest.DstAddr = (uint32_t)&LPC_DAC->DACR;
+    wave_rest.NextLLI = (uint32_t)&wave_loop;
+    wave_rest.Control = DACWAVE_DMA_CONTROL(wave->Count - 1);
+
+    wave_loop.SrcAddr = (uint32_t)wave->Samples;
+    wave_loop.NextLLI = (uint32_t)&wave_rest;
+    wave_loop.Control = DACWAVE_DMA_CONTROL(1) | GPDMA_DMACCxControl_I;
+    wave_split = 1;
+    wave_pending = wave;
+}
+
+/* Rewrite wave_loop to play whole periods of wave, same conditions */
+static void wave_write_loop(const DACWAVE_Type* wave)
+{
+    wave_loop.SrcAddr = (uint32_t)wave->Samples;
+    wave_loop.DstAddr = (uint32_t)&LPC_DAC->DACR;
+    wave_loop.NextLLI = (uint32_t)&wave_loop;
+    wave_loop.Control = DACWAVE_DMA_CONTROL(wave->Count);
+    wave_split = 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		GPDMA terminal count callback, the first sample of a new
+ * 				waveform has been moved to DACR
+ * @param[in]	channel	GPDMA channel of the player
+ * @param[in]	arg		Not used
+ * @return		None
+ *
+ * Note: the previous waveform's last sample is being output, and the new
+ * first sample is output at the next DAC timeout: the new timeout is written
+ * first, so that it applies from that sample on. It must be written before
+ * the counter reloads, one sample period of the previous waveform after the
+ * request, or that sample is held for the previous period (see the group
+ * description). Then wave_loop, which the GPDMA loads at the end of this
+ * period, plays whole periods again, or the first sample of a waveform
+ * queued meanwhile.
+ **********************************************************************/
+static void wave_first_done(uint32_t channel, void* arg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    (void)arg;
+
+    // The register pass of DACWAVE_Start() ends with a terminal count too: the GPDMA then runs wave_loop, not wave_rest
+    if (DACWAVE_DMACH(channel)->DMACCLLI != (uint32_t)&wave_loop)
+    {
+        return;
+    }
+
+    if (wave_pending != NULL)
+    {
+        if (wave_pending->Rate != wave_playing->Rate)
+        {
+            LPC_DAC->DACCNTVAL = wave_timeout(wave_pending);
+        }
+        wave_playing = wave_pending;
+        wave_pending = NULL;
+    }
+
+    __disable_irq();
+    // The GPDMA plays the rest of the first period of wave_playing: wave_left() holds, and is Count - 1 at most
+    if (wave_split && (wave_left() >= DACWAVE_GUARD))
+    {
+        if (wave_queued != NULL)
+        {
+            wave_write_first(wave_queued);
+            wave_queued = NULL;
+        }
+        else
+        {
+            wave_write_loop(wave_playing);
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup DACWAVE_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Configure the DAC, its pin and a GPDMA channel for the
+ * 				player
+ * @param[in]	None
+ * @return		SUCCESS, or ERROR if no GPDMA channel is free
+ *
+ * Note: GPDMA_Init() must have been called. The player is stopped.
+ **********************************************************************/
+Status DACWAVE_Init(void)
+{
+    static const PINSEL_CFG_Type aout = {PINSEL_PORT_0, PINSEL_PIN_26, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE,
+                                         PINSEL_PINMODE_NORMAL};
+
+    if (wave_dma < 0)
+    {
+        wave_dma = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+        if (wave_dma < 0)
+        {
+            return ERROR;
+        }
+    }
+    DACWAVE_Stop();
+
+    PINSEL_ConfigPins(&aout, 1);
+    DAC_Init(LPC_DAC);
+    wave_pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Start playing a waveform in a loop
+ * @param[in]	wave	Waveform, kept in place while it is played
+ * @return		SUCCESS, or ERROR if DACWAVE_Init() did not succeed or the
+ * 				waveform is out of range
+ *
+ * Note: the DMA interrupt must be enabled in the NVIC, and DMA_IRQHandler()
+ * must call GPDMA_IntHandler(). A waveform being played is stopped first.
+ **********************************************************************/
+Status DACWAVE_Start(const DACWAVE_Type* wave)
+{
+    DAC_CONVERTER_CFG_Type dac;
+    GPDMA_Channel_CFG_Type cfg;
+    uint32_t timeout;
+
+    if ((wave_dma < 0) || (wave->Count < DACWAVE_MIN_COUNT) || (wave->Count > DACWAVE_MAX_COUNT))
+    {
+        return ERROR;
+    }
+    timeout = wave_timeout(wave);
+    if (timeout == 0)
+    {
+        return ERROR;
+    }
+    DACWAVE_Stop();
+
+    wave_playing = wave;
+    wave_pending = NULL;
+    wave_queued = NULL;
+    wave_write_loop(wave);
+
+    // The double buffer loads DACR into the output on the timeout, so the DMA latency does not move the updates
+    DAC_SetDMATimeOut(LPC_DAC, timeout);
+    dac.DBLBUF_ENA = SET;
+    dac.CNT_ENA = SET;
+    dac.DMA_ENA = SET;
+    DAC_ConfigDAConverterControl(LPC_DAC, &dac);
+
+    // The first period from the channel registers, then wave_loop. Its terminal count only finds nothing to do.
+    cfg.ChannelNum = (uint32_t)wave_dma;
+    cfg.SrcMemAddr = (uint32_t)wave->Samples;
+    cfg.DstMemAddr = 0;
+    cfg.TransferSize = wave->Count;
+    cfg.TransferWidth = 0;
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    cfg.SrcConn = 0;
+    cfg.DstConn = GPDMA_CONN_DAC;
+    cfg.DMALLI = (uint32_t)&wave_loop;
+
+    return GPDMA_Submit(&cfg, wave_first_done, NULL, NULL);
+}
+
+/*********************************************************************/ /**
+ * @brief		Switch to another waveform at the end of the period being
+ * 				played
+ * @param[in]	wave	Waveform, kept in place while it is played
+ * @return		SUCCESS, or ERROR if the player is stopped or the waveform
+ * 				is out of range
+ *
+ * Note: the samples of the two waveforms follow each other without a gap or
+ * a repeat, and the DAC rate changes with the first new sample. When the
+ * period is about to end, the call waits for the next one (at most
+ * DACWAVE_GUARD samples). A waveform selected before the previous one has
+ * started is queued, and replaces any waveform queued before. It may be
+ * called from an interrupt handler.
+ **********************************************************************/
+Status DACWAVE_Select(const DACWAVE_Type* wave)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    if ((wave_dma < 0) || (wave_playing == NULL) || (wave->Count < DACWAVE_MIN_COUNT) ||
+        (wave->Count > DACWAVE_MAX_COUNT) || (wave_timeout(wave) == 0))
+    {
+        return ERROR;
+    }
+
+    for (;;)
+    {
+        __disable_irq();
+        if ((wave_pending != NULL) || wave_split)
+        {
+            // The terminal count callback rewrites wave_loop next, it takes this one
+            wave_queued = wave;
+            break;
+        }
+        if (wave_left() >= DACWAVE_GUARD)
+        {
+            wave_write_first(wave);
+            break;
+        }
+        // The GPDMA may be loading wave_loop: wait for the next period
+        __set_PRIMASK(primask);
+    }
+    __set_PRIMASK(primask);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop the player, the DAC holds its last value
+ * @param[in]	None
+ * @return		None
+ **********************************************************************/
+void DACWAVE_Stop(void)
+{
+    if (wave_dma >= 0)
+    {
+        GPDMA_ChannelCmd((uint8_t)wave_dma, DISABLE);
+    }
+    wave_playing = NULL;
+    wave_pending = NULL;
+    wave_queued = NULL;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the waveform being played
+ * @param[in]	None
+ * @return		Waveform of the current period, NULL when stopped
+ **********************************************************************/
+const DACWAVE_Type* DACWAVE_GetWave(void)
+{
+    return wave_playing;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _DACWAVE */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
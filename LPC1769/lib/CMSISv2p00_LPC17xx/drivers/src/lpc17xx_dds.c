@@ -0,0 +1,548 @@
+/**********************************************************************
+ * @file		lpc17xx_dds.c
+ * @brief	Contains all functions support for the direct digital
+ * 			synthesis engine of the DAC on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup DDS
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_dds.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_pinsel.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _DDS
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup DDS_Private_Macros DDS Private Macros
+ * @{
+ */
+
+/** Registers of the GPDMA channel n, the channels are 0x20 bytes apart */
+#define DDS_DMACH(n) ((LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ((uint32_t)(n) << 5)))
+
+/** Control word of the linked list items: words to DACR, terminal count interrupt at the end of the block */
+#define DDS_DMA_CONTROL                                                                                                \
+    (GPDMA_DMACCxControl_TransferSize(DDS_BLOCK_SIZE) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |                 \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_SI | GPDMA_DMACCxControl_I)
+
+/** VALUE field of DACR, BIAS left clear (700 uA, as set by DAC_Init()) */
+#define DDS_DACR_VALUE_MASK ((uint32_t)0xFFC0)
+
+/** Offset of a signed Q15 sample to the unsigned range of DACR */
+#define DDS_DACR_OFFSET 32768
+
+/**
+ * @}
+ */
+
+/* Private Types -------------------------------------------------------------- */
+/** @defgroup DDS_Private_Types DDS Private Types
+ * @{
+ */
+
+/** Settings of the synthesis, read once per block */
+typedef struct
+{
+    const int16_t* table;
+    uint32_t shift; /* 32 - log2 of the table size: the table index is the phase shifted right by this */
+    uint32_t tuning;
+    uint32_t phase;
+    int32_t amplitude;
+} dds_settings_t;
+
+/**
+ * @}
+ */
+
+/* Public Variables ----------------------------------------------------------- */
+/** @addtogroup DDS_Public_Types
+ * @{
+ */
+
+const int16_t DDS_SineTable[1 << DDS_SINE_TABLE_LOG2] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2410, 2611,
+    2811, 3012, 3212, 3412, 3612, 3811, 4011, 4210, 4410, 4609, 4808, 5007, 5205, 5404,
+    5602, 5800, 5998, 6195, 6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767, 7962, 8157,
+    8351, 8545, 8739, 8933, 9126, 9319, 9512, 9704, 9896, 10087, 10278, 10469, 10659, 10849,
+    11039, 11228, 11417, 11605, 11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462,
+    13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623, 15800, 15976,
+    16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037, 18204, 18371,
+    18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+    20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856, 22005, 22154, 22301, 22448, 22594, 22739,
+    22884, 23027, 23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680,
+    24811, 24942, 25072, 25201, 25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438,
+    26556, 26674, 26790, 26905, 27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+    28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177, 29268, 29358,
+    29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195, 30273, 30349, 30424, 30498,
+    30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297, 31356, 31414,
+    31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098,
+    32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545,
+    32567, 32589, 32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+    32757, 32761, 32765, 32766, 32767, 32766, 32765, 32761, 32757, 32752, 32745, 32737, 32728, 32717,
+    32705, 32692, 32678, 32663, 32646, 32628, 32609, 32589, 32567, 32545, 32521, 32495, 32469, 32441,
+    32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176, 32137, 32098, 32057, 32014, 31971, 31926,
+    31880, 31833, 31785, 31736, 31685, 31633, 31580, 31526, 31470, 31414, 31356, 31297, 31237, 31176,
+    31113, 31050, 30985, 30919, 30852, 30783, 30714, 30643, 30571, 30498, 30424, 30349, 30273, 30195,
+    30117, 30037, 29956, 29874, 29791, 29706, 29621, 29534, 29447, 29358, 29268, 29177, 29085, 28992,
+    28898, 28803, 28706, 28609, 28510, 28411, 28310, 28208, 28105, 28001, 27896, 27790, 27683, 27575,
+    27466, 27356, 27245, 27133, 27019, 26905, 26790, 26674, 26556, 26438, 26319, 26198, 26077, 25955,
+    25832, 25708, 25582, 25456, 25329, 25201, 25072, 24942, 24811, 24680, 24547, 24413, 24279, 24143,
+    24007, 23870, 23731, 23592, 23452, 23311, 23170, 23027, 22884, 22739, 22594, 22448, 22301, 22154,
+    22005, 21856, 21705, 21554, 21403, 21250, 21096, 20942, 20787, 20631, 20475, 20317, 20159, 20000,
+    19841, 19680, 19519, 19357, 19195, 19032, 18868, 18703, 18537, 18371, 18204, 18037, 17869, 17700,
+    17530, 17360, 17189, 17018, 16846, 16673, 16499, 16325, 16151, 15976, 15800, 15623, 15446, 15269,
+    15090, 14912, 14732, 14553, 14372, 14191, 14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725,
+    12539, 12353, 12167, 11980, 11793, 11605, 11417, 11228, 11039, 10849, 10659, 10469, 10278, 10087,
+    9896, 9704, 9512, 9319, 9126, 8933, 8739, 8545, 8351, 8157, 7962, 7767, 7571, 7375,
+    7179, 6983, 6786, 6590, 6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007, 4808, 4609,
+    4410, 4210, 4011, 3811, 3612, 3412, 3212, 3012, 2811, 2611, 2410, 2210, 2009, 1809,
+    1608, 1407, 1206, 1005, 804, 603, 402, 201, 0, -201, -402, -603, -804, -1005,
+    -1206, -1407, -1608, -1809, -2009, -2210, -2410, -2611, -2811, -3012, -3212, -3412, -3612, -3811,
+    -4011, -4210, -4410, -4609, -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195, -6393, -6590,
+    -6786, -6983, -7179, -7375, -7571, -7767, -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319,
+    -9512, -9704, -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980,
+    -12167, -12353, -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553,
+    -14732, -14912, -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673, -16846, -17018,
+    -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371, -18537, -18703, -18868, -19032, -19195, -19357,
+    -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631, -20787, -20942, -21096, -21250, -21403, -21554,
+    -21705, -21856, -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027, -23170, -23311, -23452, -23592,
+    -23731, -23870, -24007, -24143, -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456,
+    -25582, -25708, -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+    -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411, -28510, -28609,
+    -28706, -28803, -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874,
+    -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498, -30571, -30643, -30714, -30783, -30852, -30919,
+    -30985, -31050, -31113, -31176, -31237, -31297, -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736,
+    -31785, -31833, -31880, -31926, -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250, -32285, -32318,
+    -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589, -32609, -32628, -32646, -32663,
+    -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766, -32767, -32766,
+    -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692, -32678, -32663, -32646, -32628,
+    -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441, -32412, -32382, -32351, -32318, -32285, -32250,
+    -32213, -32176, -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633,
+    -31580, -31526, -31470, -31414, -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783,
+    -30714, -30643, -30571, -30498, -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+    -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803, -28706, -28609, -28510, -28411,
+    -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356, -27245, -27133, -27019, -26905,
+    -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456, -25329, -25201,
+    -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311,
+    -23170, -23027, -22884, -22739, -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250,
+    -21096, -20942, -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032,
+    -18868, -18703, -18537, -18371, -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018, -16846, -16673,
+    -16499, -16325, -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912, -14732, -14553, -14372, -14191,
+    -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725, -12539, -12353, -12167, -11980, -11793, -11605,
+    -11417, -11228, -11039, -10849, -10659, -10469, -10278, -10087, -9896, -9704, -9512, -9319, -9126, -8933,
+    -8739, -8545, -8351, -8157, -7962, -7767, -7571, -7375, -7179, -6983, -6786, -6590, -6393, -6195,
+    -5998, -5800, -5602, -5404, -5205, -5007, -4808, -4609, -4410, -4210, -4011, -3811, -3612, -3412,
+    -3212, -3012, -2811, -2611, -2410, -2210, -2009, -1809, -1608, -1407, -1206, -1005, -804, -603,
+    -402, -201,
+};
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup DDS_Private_Variables DDS Private Variables
+ * @{
+ */
+
+/** DACR words, read alternately by the two linked list items */
+static uint32_t dds_block[2][DDS_BLOCK_SIZE];
+/** Each item reloads the channel for the other block */
+static GPDMA_LLI_Type dds_lli[2];
+
+/** Settings of the blocks being computed, and the ones waiting for the next block boundary */
+static dds_settings_t dds_active = {DDS_SineTable, 32 - DDS_SINE_TABLE_LOG2, 0, 0, DDS_AMPLITUDE_MAX};
+static dds_settings_t dds_pending = {DDS_SineTable, 32 - DDS_SINE_TABLE_LOG2, 0, 0, DDS_AMPLITUDE_MAX};
+static volatile uint32_t dds_pending_set;
+
+/** Phase accumulator, without the phase offset, at the first sample of the next block */
+static uint32_t dds_accumulator;
+
+/** DAC update rate in Hz, 0 until DDS_Init() succeeds */
+static uint32_t dds_rate;
+/** GPDMA channel of the engine, -1 until DDS_Init() gets one */
+static int32_t dds_dma = -1;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup DDS_Private_Functions DDS Private Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		GPDMA terminal count callback, computes the block the DMA
+ * 				has just played
+ * @param[in]	channel	GPDMA channel of the engine
+ * @param[in]	arg		Not used
+ * @return		None
+ *
+ * Note: the completed block is the one the channel is not reading now. It is
+ * found from the source address rather than by alternation, so it stays
+ * right when the interrupt is served late.
+ **********************************************************************/
+static void dds_block_done(uint32_t channel, void* arg)
+{
+    uint32_t src = DDS_DMACH(channel)->DMACCSrcAddr;
+
+    (void)arg;
+    DDS_FillBlock(dds_block[(src - (uint32_t)dds_block[1] < sizeof(dds_block[1])) ? 0 : 1], DDS_BLOCK_SIZE);
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup DDS_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Configure the DAC, its pin and a GPDMA channel for the
+ * 				synthesis at a fixed update rate
+ * @param[in]	rate	DAC updates per second, from PCLK_DAC / 65535 to
+ * 						DDS_RATE_MAX
+ * @return		SUCCESS, or ERROR if the rate is out of range or no GPDMA
+ * 				channel is free
+ *
+ * Note: GPDMA_Init() must have been called. The rate is rounded to a whole
+ * number of PCLK_DAC periods, DDS_GetRate() returns the rate obtained. The
+ * engine is stopped, the output frequency is 0 until DDS_SetFrequency() and
+ * the table is DDS_SineTable at full scale.
+ **********************************************************************/
+Status DDS_Init(uint32_t rate)
+{
+    static const PINSEL_CFG_Type aout = {PINSEL_PORT_0, PINSEL_PIN_26, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE,
+                                         PINSEL_PINMODE_NORMAL};
+    DAC_CONVERTER_CFG_Type dac;
+    uint32_t pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+    uint32_t timeout;
+
+    if ((rate == 0) || (rate > DDS_RATE_MAX))
+    {
+        return ERROR;
+    }
+    timeout = (pclk + rate / 2) / rate;
+    if ((timeout == 0) || (timeout > 0xFFFF))
+    {
+        return ERROR;
+    }
+    if (dds_dma < 0)
+    {
+        dds_dma = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+        if (dds_dma < 0)
+        {
+            return ERROR;
+        }
+    }
+    DDS_Stop();
+
+    PINSEL_ConfigPins(&aout, 1);
+    DAC_Init(LPC_DAC);
+    DAC_SetDMATimeOut(LPC_DAC, timeout);
+
+    // The double buffer loads DACR into the output on the timeout, so the DMA latency does not move the updates
+    dac.DBLBUF_ENA = SET;
+    dac.CNT_ENA = SET;
+    dac.DMA_ENA = SET;
+    DAC_ConfigDAConverterControl(LPC_DAC, &dac);
+
+    dds_rate = pclk / timeout;
+    dds_active.table = DDS_SineTable;
+    dds_active.shift = 32 - DDS_SINE_TABLE_LOG2;
+    dds_active.tuning = 0;
+    dds_active.phase = 0;
+    dds_active.amplitude = DDS_AMPLITUDE_MAX;
+    dds_pending = dds_active;
+    dds_pending_set = 0;
+    dds_accumulator = 0;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Start the output: both blocks are computed, then played by
+ * 				the GPDMA
+ * @param[in]	None
+ * @return		SUCCESS, or ERROR if DDS_Init() did not succeed
+ *
+ * Note: the DMA interrupt must be enabled in the NVIC, and DMA_IRQHandler()
+ * must call GPDMA_IntHandler(). The phase goes on from where DDS_Stop() left
+ * it.
+ **********************************************************************/
+Status DDS_Start(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+
+    if ((dds_dma < 0) || (dds_rate == 0))
+    {
+        return ERROR;
+    }
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        DDS_FillBlock(dds_block[i], DDS_BLOCK_SIZE);
+        dds_lli[i].SrcAddr = (uint32_t)dds_block[i];
+        dds_lli[i].DstAddr = (uint32_t)&LPC_DAC->DACR;
+        dds_lli[i].NextLLI = (uint32_t)&dds_lli[i ^ 1];
+        dds_lli[i].Control = DDS_DMA_CONTROL;
+    }
+
+    // Block 0 first, then item 1 plays block 1 and links to item 0, which plays block 0 again
+    cfg.ChannelNum = (uint32_t)dds_dma;
+    cfg.SrcMemAddr = (uint32_t)dds_block[0];
+    cfg.DstMemAddr = 0;
+    cfg.TransferSize = DDS_BLOCK_SIZE;
+    cfg.TransferWidth = 0;
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    cfg.SrcConn = 0;
+    cfg.DstConn = GPDMA_CONN_DAC;
+    cfg.DMALLI = (uint32_t)&dds_lli[1];
+
+    return GPDMA_Submit(&cfg, dds_block_done, NULL, NULL);
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop the output, the DAC holds its last value
+ * @param[in]	None
+ * @return		None
+ *
+ * Note: the samples computed and not played yet are skipped.
+ **********************************************************************/
+void DDS_Stop(void)
+{
+    if (dds_dma >= 0)
+    {
+        GPDMA_ChannelCmd((uint8_t)dds_dma, DISABLE);
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the DAC update rate
+ * @param[in]	None
+ * @return		Updates per second obtained by DDS_Init(), 0 before
+ **********************************************************************/
+uint32_t DDS_GetRate(void)
+{
+    return dds_rate;
+}
+
+/*********************************************************************/ /**
+ * @brief		Select the waveform, one period of Q15 samples
+ * @param[in]	table		2^log2Size samples, kept in place (flash or RAM)
+ * 							while the engine uses them
+ * @param[in]	log2Size	log2 of the number of samples, from 1 to
+ * 							DDS_TABLE_LOG2_MAX
+ * @return		SUCCESS, or ERROR if the size is out of range
+ *
+ * Note: the table is switched at the next block boundary, at the same phase.
+ **********************************************************************/
+Status DDS_SetTable(const int16_t* table, uint8_t log2Size)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    if ((table == NULL) || (log2Size == 0) || (log2Size > DDS_TABLE_LOG2_MAX))
+    {
+        return ERROR;
+    }
+    __disable_irq();
+    dds_pending.table = table;
+    dds_pending.shift = 32u - log2Size;
+    dds_pending_set = 1;
+    __set_PRIMASK(primask);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Convert a frequency to a tuning word at the current rate
+ * @param[in]	frequency	Output frequency in mHz
+ * @return		Phase increment per DAC update, rounded to the nearest,
+ * 				or 0 before DDS_Init()
+ *
+ * Note: frequencies above half the update rate alias.
+ **********************************************************************/
+uint32_t DDS_FrequencyToTuningWord(uint32_t frequency)
+{
+    uint64_t updates = (uint64_t)dds_rate * 1000u;
+
+    if (updates == 0)
+    {
+        return 0;
+    }
+    return (uint32_t)((((uint64_t)frequency << 32) + updates / 2) / updates);
+}
+
+/*********************************************************************/ /**
+ * @brief		Set the output frequency
+ * @param[in]	frequency	Output frequency in mHz
+ * @return		None
+ *
+ * Note: the new frequency starts at the next block boundary, from the phase
+ * reached: the waveform stays continuous.
+ **********************************************************************/
+void DDS_SetFrequency(uint32_t frequency)
+{
+    uint32_t tuning = DDS_FrequencyToTuningWord(frequency);
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    dds_pending.tuning = tuning;
+    dds_pending_set = 1;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Set the phase offset of the output
+ * @param[in]	phase	Offset added to the phase accumulator, 2^32 is
+ * 						one period (0x40000000 for 90 degrees)
+ * @return		None
+ *
+ * Note: the offset moves to the new value over the next block, the shorter
+ * way round: the phase advances faster or slower during that block, so the
+ * waveform stays continuous. A step of half a period plays as a frequency
+ * shift of half the update rate divided by the block size.
+ **********************************************************************/
+void DDS_SetPhase(uint32_t phase)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    dds_pending.phase = phase;
+    dds_pending_set = 1;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Set the amplitude of the output
+ * @param[in]	amplitude	Q15 scale of the table, from 0 to
+ * 							DDS_AMPLITUDE_MAX, larger values are clamped
+ * @return		None
+ *
+ * Note: the amplitude ramps linearly to the new value over the next block.
+ **********************************************************************/
+void DDS_SetAmplitude(uint16_t amplitude)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    dds_pending.amplitude = (amplitude > DDS_AMPLITUDE_MAX) ? DDS_AMPLITUDE_MAX : amplitude;
+    dds_pending_set = 1;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Set the frequency, the phase and the amplitude together
+ * @param[in]	cfg		Pointer to a DDS_CFG_Type structure, the tuning
+ * 						word from DDS_FrequencyToTuningWord()
+ * @return		SUCCESS, or ERROR if cfg is NULL
+ *
+ * Note: the three settings start at the same block boundary, the phase
+ * offset and the amplitude ramp over that block.
+ **********************************************************************/
+Status DDS_Configure(const DDS_CFG_Type* cfg)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    if (cfg == NULL)
+    {
+        return ERROR;
+    }
+    __disable_irq();
+    dds_pending.tuning = cfg->TuningWord;
+    dds_pending.phase = cfg->Phase;
+    dds_pending.amplitude = (cfg->Amplitude > DDS_AMPLITUDE_MAX) ? DDS_AMPLITUDE_MAX : cfg->Amplitude;
+    dds_pending_set = 1;
+    __set_PRIMASK(primask);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Compute the next DACR words of the synthesis
+ * @param[out]	block	DACR words, VALUE field set and BIAS clear
+ * @param[in]	count	Number of words
+ * @return		None
+ *
+ * Note: the terminal count interrupt calls it for each block played; it is
+ * public for the programs that feed the DAC by other means. The pending
+ * settings are taken at the start of the call. The cost per sample is one
+ * table read, one multiply and no division.
+ **********************************************************************/
+void DDS_FillBlock(uint32_t* block, uint32_t count)
+{
+    int32_t from = dds_active.amplitude;
+    uint32_t offset = dds_active.phase;
+    const int16_t* table;
+    uint32_t shift, tuning, phase;
+    int32_t amplitude;
+
+    if (dds_pending_set)
+    {
+        uint32_t primask = __get_PRIMASK();
+
+        __disable_irq();
+        dds_active = dds_pending;
+        dds_pending_set = 0;
+        __set_PRIMASK(primask);
+    }
+    table = dds_active.table;
+    shift = dds_active.shift;
+    tuning = dds_active.tuning;
+    amplitude = dds_active.amplitude;
+    phase = dds_accumulator + offset;
+    dds_accumulator += tuning * count;
+
+    if (((amplitude != from) || (dds_active.phase != offset)) && (count != 0))
+    {
+        // Amplitude in Q15.16 from the previous value to the new one over the block, and the phase offset from the
+        // previous value to the new one: the next block starts exactly on the new offset
+        int32_t scale = from * 65536;
+        int32_t step = ((amplitude - from) * 65536) / (int32_t)count;
+        uint32_t increment = tuning + (uint32_t)((int32_t)(dds_active.phase - offset) / (int32_t)count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            scale += step;
+            block[i] =
+                ((uint32_t)((table[phase >> shift] * (scale >> 16)) >> 15) + DDS_DACR_OFFSET) & DDS_DACR_VALUE_MASK;
+            phase += increment;
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        block[i] = ((uint32_t)((table[phase >> shift] * amplitude) >> 15) + DDS_DACR_OFFSET) & DDS_DACR_VALUE_MASK;
+        phase += tuning;
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* _DDS */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,221 @@
+/**********************************************************************
+ * @file		lpc17xx_filter.c
+ * @brief	Contains all functions support for the streaming ADC
+ * 			filter stages on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup FILTER
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_filter.h"
+#include "lpc17xx_adc.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _FILTER
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup FILTER_Private_Macros FILTER Private Macros
+ * @{
+ */
+
+/** Bits of an ADC result */
+#define FILTER_SAMPLE_BITS 12
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup FILTER_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Initialize a moving average of 2^n samples
+ * @param[in]	f			Moving average to initialize
+ * @param[in]	history		Buffer of 2^n samples, kept by the filter
+ * @param[in]	lengthLog2	n, in range from 0 to 16
+ * @return		None
+ *
+ * Note: the history is cleared, so the first 2^n averages are low.
+ **********************************************************************/
+void FILTER_BoxcarInit(FILTER_Boxcar_Type* f, uint16_t* history, uint8_t lengthLog2)
+{
+    uint32_t length = 1UL << lengthLog2;
+
+    for (uint32_t i = 0; i < length; i++)
+    {
+        history[i] = 0;
+    }
+    f->history = history;
+    f->sum = 0;
+    f->index = 0;
+    f->mask = (uint16_t)(length - 1);
+    f->shift = lengthLog2;
+    f->Dropped = 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		Add the results of a DMA buffer to a moving average
+ * @param[in]	f		Moving average, initialized by FILTER_BoxcarInit()
+ * @param[in]	words	ADGDR or ADDRn words
+ * @param[in]	count	Number of words
+ * @return		Average of the last 2^n results
+ **********************************************************************/
+uint16_t FILTER_BoxcarBlock(FILTER_Boxcar_Type* f, const uint32_t* words, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t word = words[i];
+
+        if (word & ADC_GDR_OVERRUN_FLAG)
+        {
+            f->Dropped++;
+            continue;
+        }
+        (void)FILTER_BoxcarPush(f, (uint16_t)ADC_GDR_RESULT(word));
+    }
+    return (uint16_t)(f->sum >> f->shift);
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize a CIC decimator
+ * @param[in]	f		Decimator to initialize
+ * @param[in]	order	Number of integrator and comb pairs, in range from
+ * 						1 to FILTER_CIC_MAX_ORDER
+ * @param[in]	ratio	Input samples per output, at least 1
+ * @param[in]	shift	Right shift of the outputs. The gain of the filter is
+ * 						ratio^order: with ratio = 2^r, shift = order * r gives
+ * 						12-bit outputs, a smaller shift keeps the extra bits.
+ * @return		SUCCESS, or ERROR if order is out of range or the outputs
+ * 				do not fit in 32 bits
+ **********************************************************************/
+Status FILTER_CicInit(FILTER_Cic_Type* f, uint8_t order, uint16_t ratio, uint8_t shift)
+{
+    uint32_t ratioBits = 0;
+
+    if ((order < 1) || (order > FILTER_CIC_MAX_ORDER) || (ratio < 1) || (shift > 31))
+    {
+        return ERROR;
+    }
+    while ((1UL << ratioBits) < ratio)
+    {
+        ratioBits++;
+    }
+    if (FILTER_SAMPLE_BITS + order * ratioBits > 32)
+    {
+        return ERROR;
+    }
+
+    for (uint32_t stage = 0; stage < FILTER_CIC_MAX_ORDER; stage++)
+    {
+        f->integ[stage] = 0;
+        f->comb[stage] = 0;
+    }
+    f->ratio = ratio;
+    f->phase = 0;
+    f->order = order;
+    f->shift = shift;
+    f->Dropped = 0;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Add the results of a DMA buffer to a CIC decimator
+ * @param[in]	f		Decimator, initialized by FILTER_CicInit()
+ * @param[in]	words	ADGDR or ADDRn words
+ * @param[in]	count	Number of words
+ * @param[out]	out		Outputs, room for count / ratio + 1 values
+ * @return		Number of outputs written
+ **********************************************************************/
+uint32_t FILTER_CicBlock(FILTER_Cic_Type* f, const uint32_t* words, uint32_t count, uint32_t* out)
+{
+    uint32_t written = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t word = words[i];
+
+        if (word & ADC_GDR_OVERRUN_FLAG)
+        {
+            f->Dropped++;
+            continue;
+        }
+        written += FILTER_CicPush(f, (uint16_t)ADC_GDR_RESULT(word), &out[written]);
+    }
+    return written;
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize an oversample-and-decimate stage
+ * @param[in]	f			Stage to initialize
+ * @param[in]	extraBits	n, bits gained above the 12 of the ADC, in range
+ * 							from 1 to FILTER_DECIMATE_MAX_BITS. Each result
+ * 							takes 4^n samples.
+ * @return		SUCCESS, or ERROR if extraBits is out of range
+ **********************************************************************/
+Status FILTER_DecimateInit(FILTER_Decimate_Type* f, uint8_t extraBits)
+{
+    if ((extraBits < 1) || (extraBits > FILTER_DECIMATE_MAX_BITS))
+    {
+        return ERROR;
+    }
+    f->sum = 0;
+    f->count = 0;
+    f->length = (uint16_t)(1UL << (2 * extraBits));
+    f->shift = extraBits;
+    f->Dropped = 0;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Add the results of a DMA buffer to an oversample-and-decimate
+ * 				stage
+ * @param[in]	f		Stage, initialized by FILTER_DecimateInit()
+ * @param[in]	words	ADGDR or ADDRn words
+ * @param[in]	count	Number of words
+ * @param[out]	out		Results of 12 + n bits, room for count / 4^n + 1 values
+ * @return		Number of results written
+ **********************************************************************/
+uint32_t FILTER_DecimateBlock(FILTER_Decimate_Type* f, const uint32_t* words, uint32_t count, uint16_t* out)
+{
+    uint32_t written = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t word = words[i];
+
+        if (word & ADC_GDR_OVERRUN_FLAG)
+        {
+            f->Dropped++;
+            continue;
+        }
+        written += FILTER_DecimatePush(f, (uint16_t)ADC_GDR_RESULT(word), &out[written]);
+    }
+    return written;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _FILTER */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,396 @@
+/**********************************************************************
+ * @file		lpc17xx_freqcnt.c
+ * @brief	Contains all functions support for the gated frequency
+ * 			counter on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup FREQCNT
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_freqcnt.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_timer.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _FREQCNT
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup FREQCNT_Private_Macros FREQCNT Private Macros
+ * @{
+ */
+
+/** Shortest and longest windows in ticks: below 2^31 ticks, a new edge timestamp is told from an old one */
+#define FREQCNT_MIN_WINDOW 1000
+#define FREQCNT_MAX_WINDOW ((uint32_t)1 << 31)
+
+/** Age in ticks of a captured edge before it is counted for sure: both inputs are synchronized to PCLK */
+#define FREQCNT_SETTLE_TICKS 4
+
+/** Readings of the two timers by the handler before it counts the edges over the window */
+#define FREQCNT_READ_ATTEMPTS 3
+
+/** Oldest edge timestamp kept as a reference, in ticks: the divisions of FREQCNT_Read() do not overflow below 2^47 */
+#define FREQCNT_MAX_AGE ((uint64_t)1 << 46)
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup FREQCNT_Private_Variables FREQCNT Private Variables
+ * @{
+ */
+
+static LPC_TIM_TypeDef* freqcnt_counter;
+static LPC_TIM_TypeDef* freqcnt_gate;
+static volatile uint32_t* freqcnt_mr;
+static volatile uint32_t* freqcnt_cr;
+static uint32_t freqcnt_ir;
+static uint32_t freqcnt_window;
+static uint32_t freqcnt_tick_hz;
+
+/** State of the handler: end of the current window, and the readings at the end of the previous one */
+static uint64_t freqcnt_end;
+static uint32_t freqcnt_count;
+static uint64_t freqcnt_read_time;
+static uint32_t freqcnt_read_jitter;
+static Bool freqcnt_started;
+/** Last edge seen, when its timestamp is known: the count of the counter timer has not changed since */
+static uint64_t freqcnt_edge;
+static Bool freqcnt_edge_valid;
+
+/** Raw result of the last window, converted by FREQCNT_Read() */
+static volatile uint32_t freqcnt_method;
+static volatile uint32_t freqcnt_edges;
+static volatile uint64_t freqcnt_ticks;
+static volatile uint32_t freqcnt_jitter;
+/** Windows measured since FREQCNT_Init() */
+static volatile uint32_t freqcnt_windows;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup FREQCNT_Private_Functions FREQCNT Private Functions
+ * @{
+ */
+
+/* Interrupt and peripheral clock selection of a timer */
+static Status freqcnt_timer(LPC_TIM_TypeDef* TIMx, IRQn_Type* irq, uint32_t* pclksel)
+{
+    if (TIMx == LPC_TIM0)
+    {
+        *irq = TIMER0_IRQn;
+        *pclksel = CLKPWR_PCLKSEL_TIMER0;
+    }
+    else if (TIMx == LPC_TIM1)
+    {
+        *irq = TIMER1_IRQn;
+        *pclksel = CLKPWR_PCLKSEL_TIMER1;
+    }
+    else if (TIMx == LPC_TIM2)
+    {
+        *irq = TIMER2_IRQn;
+        *pclksel = CLKPWR_PCLKSEL_TIMER2;
+    }
+    else if (TIMx == LPC_TIM3)
+    {
+        *irq = TIMER3_IRQn;
+        *pclksel = CLKPWR_PCLKSEL_TIMER3;
+    }
+    else
+    {
+        return ERROR;
+    }
+    return SUCCESS;
+}
+
+/* value / ticks in Q16, without overflow for ticks below 2^47 */
+static uint64_t freqcnt_ratio(uint64_t value, uint64_t ticks)
+{
+    uint64_t quotient = value / ticks;
+    uint64_t remainder = value % ticks;
+
+    return (quotient << 16) + (remainder << 16) / ticks;
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup FREQCNT_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Start the counter timer in counter mode on rising edges,
+ * 				and the gate timer on the CPU clock, with its capture
+ * 				channel and its match interrupt every window
+ * @param[in]	FREQCNT_ConfigStruct	Pointer to a FREQCNT_CFG_Type
+ * 										structure with the timers and the
+ * 										window
+ * @return		SUCCESS, or ERROR on a bad parameter, with both timers
+ * 				left as they were
+ *
+ * Note: both timers run on PCLK = CCLK. The CAP input of the counter
+ * timer and the CAP input of the gate timer must be selected in PINSEL
+ * and wired to the signal. The handler of the gate timer must call
+ * FREQCNT_IntHandler(). The first result comes at the end of the second
+ * window.
+ **********************************************************************/
+Status FREQCNT_Init(FREQCNT_CFG_Type* FREQCNT_ConfigStruct)
+{
+    TIM_COUNTERCFG_Type counter_cfg;
+    TIM_TIMERCFG_Type timer_cfg;
+    TIM_CAPTURECFG_Type capture_cfg;
+    LPC_TIM_TypeDef* counter = FREQCNT_ConfigStruct->CounterTIM;
+    LPC_TIM_TypeDef* gate = FREQCNT_ConfigStruct->GateTIM;
+    IRQn_Type counter_irq;
+    IRQn_Type gate_irq;
+    uint32_t counter_pclksel;
+    uint32_t gate_pclksel;
+    uint64_t window;
+
+    if ((counter == gate) || (freqcnt_timer(counter, &counter_irq, &counter_pclksel) == ERROR) ||
+        (freqcnt_timer(gate, &gate_irq, &gate_pclksel) == ERROR) || (FREQCNT_ConfigStruct->CounterInput > 1) ||
+        (FREQCNT_ConfigStruct->GateCapture > 1) || (FREQCNT_ConfigStruct->GateMatch > 3))
+    {
+        return ERROR;
+    }
+
+    // The gate timer will count CCLK: the window is checked before either timer changes
+    window = (uint64_t)FREQCNT_ConfigStruct->WindowUs * SystemCoreClock / 1000000;
+    if ((window < FREQCNT_MIN_WINDOW) || (window > FREQCNT_MAX_WINDOW))
+    {
+        return ERROR;
+    }
+
+    NVIC_DisableIRQ(gate_irq);
+    NVIC_DisableIRQ(counter_irq);
+
+    counter_cfg.CountInputSelect = FREQCNT_ConfigStruct->CounterInput;
+    TIM_Init(counter, TIM_COUNTER_RISING_MODE, &counter_cfg);
+    CLKPWR_SetPCLKDiv(counter_pclksel, CLKPWR_PCLKSEL_CCLK_DIV_1); // Inputs up to PCLK / 2
+
+    timer_cfg.PrescaleOption = TIM_PRESCALE_TICKVAL;
+    timer_cfg.PrescaleValue = 1;
+    TIM_Init(gate, TIM_TIMER_MODE, &timer_cfg);
+    CLKPWR_SetPCLKDiv(gate_pclksel, CLKPWR_PCLKSEL_CCLK_DIV_1); // TIM_Init() selects CCLK / 4
+    freqcnt_tick_hz = CLKPWR_GetPCLK(gate_pclksel);
+
+    capture_cfg.CaptureChannel = FREQCNT_ConfigStruct->GateCapture;
+    capture_cfg.RisingEdge = ENABLE;
+    capture_cfg.FallingEdge = DISABLE;
+    capture_cfg.IntOnCaption = DISABLE; // Read at the end of the window only
+    TIM_ConfigCapture(gate, &capture_cfg);
+
+    // Interrupt only, the TC runs freely and the match register moves by one window
+    gate->MCR = (gate->MCR & ~TIM_MCR_CHANNEL_MASKBIT(FREQCNT_ConfigStruct->GateMatch)) |
+                TIM_INT_ON_MATCH(FREQCNT_ConfigStruct->GateMatch);
+    freqcnt_counter = counter;
+    freqcnt_gate = gate;
+    freqcnt_mr = &gate->MR0 + FREQCNT_ConfigStruct->GateMatch;
+    freqcnt_cr = (volatile uint32_t*)&gate->CR0 + FREQCNT_ConfigStruct->GateCapture;
+    freqcnt_ir = TIM_IR_CLR(FREQCNT_ConfigStruct->GateMatch);
+    freqcnt_window = (uint32_t)window;
+    *freqcnt_mr = freqcnt_window;
+
+    freqcnt_end = 0;
+    freqcnt_count = 0;
+    freqcnt_started = FALSE;
+    freqcnt_edge_valid = FALSE;
+    freqcnt_windows = 0;
+
+    TIM_Cmd(counter, ENABLE);
+    TIM_Cmd(gate, ENABLE);
+    NVIC_EnableIRQ(gate_irq);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Match interrupt of the gate timer: read the edge count and
+ * 				the last edge, and store the result of the window
+ * @return		None
+ *
+ * Note: to be called from TIMERx_IRQHandler() of the gate timer. The edge
+ * timestamp is used only when it did not change while the count was read,
+ * and was older than the synchronization of the inputs. The other
+ * interrupt flags of the timer are left for the caller.
+ **********************************************************************/
+void FREQCNT_IntHandler(void)
+{
+    LPC_TIM_TypeDef* gate = freqcnt_gate;
+    uint32_t end = *freqcnt_mr;
+    uint32_t primask = __get_PRIMASK();
+    uint32_t before = 0;
+    uint32_t after = 0;
+    uint32_t edge = 0;
+    uint32_t count = 0;
+    uint32_t edges;
+    uint32_t jitter;
+    uint64_t now;
+    uint64_t read_time;
+    Bool consistent = FALSE;
+
+    if (!(gate->IR & freqcnt_ir))
+    {
+        return;
+    }
+    gate->IR = freqcnt_ir;
+    *freqcnt_mr = end + freqcnt_window;
+
+    for (uint32_t attempt = 0; (attempt < FREQCNT_READ_ATTEMPTS) && !consistent; attempt++)
+    {
+        // No other interrupt between the reads: they bracket the count as closely as possible
+        __disable_irq();
+        before = gate->TC;
+        edge = *freqcnt_cr;
+        count = freqcnt_counter->TC;
+        consistent = ((*freqcnt_cr == edge) && (before - edge >= FREQCNT_SETTLE_TICKS)) ? TRUE : FALSE;
+        after = gate->TC;
+        __set_PRIMASK(primask);
+    }
+
+    // The window ended at end, a little before the reads
+    freqcnt_end += freqcnt_window;
+    now = freqcnt_end + (after - end);
+    jitter = (after - before + 1) / 2;
+    read_time = now - (after - before) / 2;
+    edges = count - freqcnt_count;
+
+    if (freqcnt_started)
+    {
+        if ((edges == 0) && freqcnt_edge_valid && (now - freqcnt_edge < FREQCNT_MAX_AGE))
+        {
+            freqcnt_method = FREQCNT_STOPPED;
+            freqcnt_ticks = now - freqcnt_edge;
+        }
+        else if ((edges != 0) && consistent && freqcnt_edge_valid)
+        {
+            // The edges of the window end periods begun on the last edge of the previous windows
+            freqcnt_method = FREQCNT_RECIPROCAL;
+            freqcnt_ticks = (now - (after - edge)) - freqcnt_edge;
+        }
+        else
+        {
+            freqcnt_method = FREQCNT_COUNTING;
+            freqcnt_ticks = read_time - freqcnt_read_time;
+            freqcnt_jitter = jitter + freqcnt_read_jitter;
+        }
+        freqcnt_edges = edges;
+        freqcnt_windows++;
+    }
+
+    if (edges != 0)
+    {
+        // A new edge is less than a window old: its 32-bit timestamp is not ambiguous
+        freqcnt_edge = now - (after - edge);
+        freqcnt_edge_valid = consistent;
+    }
+    else if (freqcnt_edge_valid && (now - freqcnt_edge >= FREQCNT_MAX_AGE))
+    {
+        freqcnt_edge_valid = FALSE;
+    }
+    freqcnt_count = count;
+    freqcnt_read_time = read_time;
+    freqcnt_read_jitter = jitter;
+    freqcnt_started = TRUE;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the number of windows measured
+ * @return		Windows since FREQCNT_Init(), modulo 2^32
+ *
+ * Note: a change of the count tells that FREQCNT_Read() has a new result.
+ **********************************************************************/
+uint32_t FREQCNT_GetWindowCount(void)
+{
+    return freqcnt_windows;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the frequency measured over the last window
+ * @param[out]	result	Frequency and confidence window, written on
+ * 						SUCCESS only
+ * @return		SUCCESS, or ERROR before the end of the second window
+ *
+ * Note: from the main loop. The divisions are done here, not in the
+ * handler. Reciprocal: each edge timestamp is exact to one tick.
+ * Counting: the count is exact to one edge, and its read time to the
+ * half of the time taken by the reads. Stopped: no edge for the time
+ * since the last one, so the period is longer.
+ **********************************************************************/
+Status FREQCNT_Read(FREQCNT_Result_Type* result)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t method;
+    uint32_t edges;
+    uint32_t jitter;
+    uint32_t windows;
+    uint64_t ticks;
+    uint64_t frequency;
+
+    // Copied together: the handler may end a window meanwhile
+    __disable_irq();
+    method = freqcnt_method;
+    edges = freqcnt_edges;
+    ticks = freqcnt_ticks;
+    jitter = freqcnt_jitter;
+    windows = freqcnt_windows;
+    __set_PRIMASK(primask);
+
+    if (windows == 0)
+    {
+        return ERROR;
+    }
+
+    frequency = freqcnt_ratio((uint64_t)edges * freqcnt_tick_hz, ticks);
+    result->Method = method;
+    result->Edges = edges;
+    if (method == FREQCNT_RECIPROCAL)
+    {
+        // The time between the edges is within 2 ticks
+        result->FrequencyHz = frequency;
+        result->ErrorHz = (ticks > 2) ? (frequency * 2 + ticks - 3) / (ticks - 2) : frequency;
+    }
+    else if (method == FREQCNT_COUNTING)
+    {
+        // One edge more or less, over a time within the jitter of the two readings
+        ticks -= jitter;
+        result->FrequencyHz = frequency;
+        result->ErrorHz = freqcnt_ratio(freqcnt_tick_hz, ticks) + 1 + (frequency * jitter + ticks - 1) / ticks;
+    }
+    else
+    {
+        result->FrequencyHz = 0;
+        result->ErrorHz = freqcnt_ratio(freqcnt_tick_hz, ticks) + 1;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _FREQCNT */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -169,7 +169,7 @@ const uint8_t GPDMA_LUTPerWid[] = {
     GPDMA_WIDTH_WORD, // ADC
     GPDMA_WIDTH_WORD, // I2S channel 0
     GPDMA_WIDTH_WORD, // I2S channel 1
-    GPDMA_WIDTH_BYTE, // DAC
+    GPDMA_WIDTH_WORD, // DAC, VALUE is bits 15:6 of DACR
     GPDMA_WIDTH_BYTE, // UART0 Tx
     GPDMA_WIDTH_BYTE, // UART0 Rx
     GPDMA_WIDTH_BYTE, // UART1 Tx
@@ -188,6 +188,21 @@ const uint8_t GPDMA_LUTPerWid[] = {
     GPDMA_WIDTH_WORD  // MAT3.1
 };
 
+/** @brief State of a channel of the allocator */
+typedef struct
+{
+    GPDMA_Callback_Type pfnDone;  /**< Called on terminal count, or NULL */
+    GPDMA_Callback_Type pfnError; /**< Called on error, or NULL */
+    void* arg;                    /**< Argument of the callbacks */
+    uint32_t bytes;               /**< Bytes of the submitted transfer */
+    GPDMA_Stats_Type stats;       /**< Counters since the allocation */
+} GPDMA_ChannelState_Type;
+
+/** @brief Channels handed out by GPDMA_AllocChannel(), one bit per channel */
+static volatile uint32_t GPDMA_AllocMask;
+/** @brief Callbacks and counters of each channel */
+static GPDMA_ChannelState_Type GPDMA_ChState[8];
+
 /**
  * @}
  */
@@ -469,6 +484,184 @@ void GPDMA_ClearIntPending(GPDMA_StateClear_Type type, uint8_t channel)
         LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(channel);
 }
 
+/*********************************************************************/ /**
+ * @brief		Allocate a free GPDMA channel of a priority class
+ * @param[in]	prio	Priority class, should be:
+ * 					- GPDMA_PRIO_HIGH: 		any channel, lowest free first
+ * 					- GPDMA_PRIO_MEDIUM: 	channels 2 to 7
+ * 					- GPDMA_PRIO_LOW: 		channels 6 and 7
+ * @return		Channel number, in range from 0 to 7, or -1 if every channel
+ * 				of the class is in use
+ *
+ * Note: a class never gets a channel of higher priority than its first one,
+ * so a low priority stream cannot delay a high priority one. The counters of
+ * the channel are cleared. Safe to call from an interrupt handler.
+ **********************************************************************/
+int32_t GPDMA_AllocChannel(uint32_t prio)
+{
+    uint32_t primask = __get_PRIMASK();
+    int32_t channel;
+
+    __disable_irq();
+    for (channel = (int32_t)prio; channel < 8; channel++)
+    {
+        if (!(GPDMA_AllocMask & (1UL << channel)))
+        {
+            GPDMA_AllocMask |= (1UL << channel);
+            break;
+        }
+    }
+    __set_PRIMASK(primask);
+
+    if (channel == 8)
+    {
+        return -1;
+    }
+
+    GPDMA_ChState[channel].pfnDone = NULL;
+    GPDMA_ChState[channel].pfnError = NULL;
+    GPDMA_ChState[channel].bytes = 0;
+    GPDMA_ChState[channel].stats.Transfers = 0;
+    GPDMA_ChState[channel].stats.Bytes = 0;
+    GPDMA_ChState[channel].stats.Errors = 0;
+    return channel;
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop a channel and give it back to the allocator
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @return		None
+ *
+ * Note: a transfer in progress is aborted, its callbacks are not called.
+ **********************************************************************/
+void GPDMA_FreeChannel(uint8_t channelNum)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channelNum));
+
+    GPDMA_ChannelCmd(channelNum, DISABLE);
+
+    __disable_irq();
+    GPDMA_ChState[channelNum].pfnDone = NULL;
+    GPDMA_ChState[channelNum].pfnError = NULL;
+    LPC_GPDMA->DMACIntTCClear = GPDMA_DMACIntTCClear_Ch(channelNum);
+    LPC_GPDMA->DMACIntErrClr = GPDMA_DMACIntErrClr_Ch(channelNum);
+    GPDMA_AllocMask &= ~(1UL << channelNum);
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Setup and start a transfer on an allocated channel, without
+ * 				waiting for its end
+ * @param[in]	GPDMAChannelConfig	Pointer to a GPDMA_Channel_CFG_Type structure,
+ * 									ChannelNum must come from GPDMA_AllocChannel()
+ * @param[in]	pfnDone		Called from GPDMA_IntHandler() on each terminal count
+ * 							of the channel, or NULL
+ * @param[in]	pfnError	Called from GPDMA_IntHandler() on an error of the
+ * 							channel, or NULL
+ * @param[in]	arg			Argument passed to the callbacks
+ * @return		ERROR if the channel is out of range, not allocated or still
+ * 				busy, SUCCESS if the transfer is started
+ *
+ * Note: the application enables DMA_IRQn and calls GPDMA_IntHandler() from
+ * DMA_IRQHandler(). A callback can submit the next transfer of its channel.
+ **********************************************************************/
+Status GPDMA_Submit(GPDMA_Channel_CFG_Type* GPDMAChannelConfig, GPDMA_Callback_Type pfnDone,
+                    GPDMA_Callback_Type pfnError, void* arg)
+{
+    uint32_t channel = GPDMAChannelConfig->ChannelNum;
+    GPDMA_ChannelState_Type* pState;
+    uint32_t width;
+
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channel));
+
+    // Checked even without CHECK_PARAM: the channel indexes the state table
+    if (channel >= 8)
+    {
+        return ERROR;
+    }
+    pState = &GPDMA_ChState[channel];
+
+    if (!(GPDMA_AllocMask & (1UL << channel)) || (GPDMA_Setup(GPDMAChannelConfig) != SUCCESS))
+    {
+        return ERROR;
+    }
+
+    // Width of the source side, in which TransferSize is counted
+    switch (GPDMAChannelConfig->TransferType)
+    {
+        case GPDMA_TRANSFERTYPE_M2M: width = GPDMAChannelConfig->TransferWidth; break;
+        case GPDMA_TRANSFERTYPE_M2P: width = GPDMA_LUTPerWid[GPDMAChannelConfig->DstConn]; break;
+        default: width = GPDMA_LUTPerWid[GPDMAChannelConfig->SrcConn]; break;
+    }
+
+    // The channel is stopped after GPDMA_Setup(), no interrupt of it can be pending
+    pState->pfnDone = pfnDone;
+    pState->pfnError = pfnError;
+    pState->arg = arg;
+    pState->bytes = GPDMAChannelConfig->TransferSize << width;
+
+    GPDMA_ChannelCmd(channel, ENABLE);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Read the counters of a channel since its allocation
+ * @param[in]	channelNum	GPDMA channel, should be in range from 0 to 7
+ * @param[out]	stats		Pointer to a GPDMA_Stats_Type structure to fill
+ * @return		None
+ **********************************************************************/
+void GPDMA_GetStats(uint8_t channelNum, GPDMA_Stats_Type* stats)
+{
+    CHECK_PARAM(PARAM_GPDMA_CHANNEL(channelNum));
+
+    *stats = GPDMA_ChState[channelNum].stats;
+}
+
+/*********************************************************************/ /**
+ * @brief		Serve the terminal count and error interrupts of all the
+ * 				channels, to be called from DMA_IRQHandler()
+ * @return		None
+ *
+ * Note: the flags are read and cleared once, then the callbacks run in
+ * channel order, the highest priority channel first. Errors of a channel are
+ * served before its terminal count.
+ **********************************************************************/
+void GPDMA_IntHandler(void)
+{
+    uint32_t tc = LPC_GPDMA->DMACIntTCStat;
+    uint32_t err = LPC_GPDMA->DMACIntErrStat;
+    uint32_t pending = tc | err;
+    uint32_t channel;
+
+    LPC_GPDMA->DMACIntTCClear = tc;
+    LPC_GPDMA->DMACIntErrClr = err;
+
+    for (channel = 0; pending; channel++, pending >>= 1, tc >>= 1, err >>= 1)
+    {
+        GPDMA_ChannelState_Type* pState = &GPDMA_ChState[channel];
+
+        if (err & 0x01)
+        {
+            pState->stats.Errors++;
+            if (pState->pfnError != NULL)
+            {
+                pState->pfnError(channel, pState->arg);
+            }
+        }
+        if (tc & 0x01)
+        {
+            pState->stats.Transfers++;
+            pState->stats.Bytes += pState->bytes;
+            if (pState->pfnDone != NULL)
+            {
+                pState->pfnDone(channel, pState->arg);
+            }
+        }
+    }
+}
+
 /**
  * @}
  */
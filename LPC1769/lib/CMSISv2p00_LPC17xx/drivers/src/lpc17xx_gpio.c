@@ -174,6 +174,47 @@ void GPIO_SetDir(uint8_t portNum, uint32_t bitValue, uint8_t dir)
     }
 }
 
+/*********************************************************************/ /**
+ * @brief		Set the direction of a table of pin groups with one
+ * 				read-modify-write of FIODIR per port
+ * @param[in]	DirCfgTable	Table of GPIO_DIR_CFG_Type (see GPIO_SetDir())
+ * @param[in]	count		Number of entries of DirCfgTable
+ * @return		None
+ *
+ * Note: entries with an invalid port number are ignored. When a pin appears
+ * twice, the last entry wins.
+ **********************************************************************/
+void GPIO_ConfigDirs(const GPIO_DIR_CFG_Type* DirCfgTable, uint32_t count)
+{
+    uint32_t mask[5] = {0}, value[5] = {0};
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint8_t port = DirCfgTable[i].portNum;
+
+        if (port < 5)
+        {
+            mask[port] |= DirCfgTable[i].bitValue;
+            value[port] &= ~DirCfgTable[i].bitValue;
+            if (DirCfgTable[i].dir)
+            {
+                value[port] |= DirCfgTable[i].bitValue;
+            }
+        }
+    }
+
+    for (i = 0; i < 5; i++)
+    {
+        if (mask[i])
+        {
+            LPC_GPIO_TypeDef* pGPIO = GPIO_GetPointer(i);
+
+            pGPIO->FIODIR = (pGPIO->FIODIR & ~mask[i]) | value[i];
+        }
+    }
+}
+
 /*********************************************************************/ /**
                                                                          * @brief		Set Value for bits that have output
                                                                          *direction on GPIO port.
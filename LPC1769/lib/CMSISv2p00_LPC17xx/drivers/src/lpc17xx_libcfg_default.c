@@ -52,8 +52,10 @@
  * @param[in]	file Pointer to the source file name
  * @param[in]    line assert_param error line source number
  * @return		None
+ *
+ * Note: weak, an application or a test replaces it with its own report.
  *******************************************************************************/
-void check_failed(uint8_t* file, uint32_t line)
+__weak void check_failed(uint8_t* file, uint32_t line)
 {
     /* User can add his own implementation to report the file name and line number,
      ex: printf("Wrong parameters value: file %s on line %d\r\n", file, line) */
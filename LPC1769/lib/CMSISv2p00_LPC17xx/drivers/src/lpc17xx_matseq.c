@@ -0,0 +1,291 @@
+/**********************************************************************
+ * @file		lpc17xx_matseq.c
+ * @brief	Contains all functions support for the DMA driven match
+ * 			sequencer on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup MATSEQ
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_matseq.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_timer.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _MATSEQ
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup MATSEQ_Private_Macros MATSEQ Private Macros
+ * @{
+ */
+
+/** Control word of the linked list items, n words from memory to a timer register */
+#define MATSEQ_DMA_CONTROL(n)                                                                                          \
+    (GPDMA_DMACCxControl_TransferSize((uint32_t)(n)) | GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_1) |                     \
+     GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_1) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |                        \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_SI)
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup MATSEQ_Private_Variables MATSEQ Private Variables
+ * @{
+ */
+
+/** Item the GPDMA loads after the table of a train played in a loop: the whole table, linked to itself */
+static GPDMA_LLI_Type seq_loop;
+/** Item the GPDMA loads after the table of a train played once: seq_stop to TCR */
+static GPDMA_LLI_Type seq_end;
+/** Word written to TCR on the match of the last edge: stops the timer */
+static const uint32_t seq_stop = 0;
+
+static LPC_TIM_TypeDef* seq_timer;
+static volatile uint32_t* seq_mr;
+static uint32_t seq_channel;
+static uint32_t seq_conn;
+static uint32_t seq_prescale;
+/** Idle level of the last train started, low before the first one */
+static uint32_t seq_idle;
+static uint32_t seq_tick_hz;
+/** GPDMA channel of the sequencer, -1 until MATSEQ_Init() gets one */
+static int32_t seq_dma = -1;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup MATSEQ_Private_Functions MATSEQ Private Functions
+ * @{
+ */
+
+/* Peripheral clock selection and number of a timer */
+static Status seq_timer_unit(LPC_TIM_TypeDef* TIMx, uint32_t* pclksel, uint32_t* unit)
+{
+    if (TIMx == LPC_TIM0)
+    {
+        *pclksel = CLKPWR_PCLKSEL_TIMER0;
+        *unit = 0;
+    }
+    else if (TIMx == LPC_TIM1)
+    {
+        *pclksel = CLKPWR_PCLKSEL_TIMER1;
+        *unit = 1;
+    }
+    else if (TIMx == LPC_TIM2)
+    {
+        *pclksel = CLKPWR_PCLKSEL_TIMER2;
+        *unit = 2;
+    }
+    else if (TIMx == LPC_TIM3)
+    {
+        *pclksel = CLKPWR_PCLKSEL_TIMER3;
+        *unit = 3;
+    }
+    else
+    {
+        return ERROR;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup MATSEQ_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Configure a timer and a GPDMA channel for the sequencer
+ * @param[in]	TIMx			Timer of the train, LPC_TIM0 to LPC_TIM3
+ * @param[in]	matchChannel	Match register and output of the train,
+ * 								0 (MATn.0) or 1 (MATn.1)
+ * @param[in]	prescale		CPU clock cycles per tick, at least 1
+ * @return		SUCCESS, or ERROR on a bad parameter or if no GPDMA channel
+ * 				is free
+ *
+ * Note: GPDMA_Init() must have been called. The timer runs on PCLK = CCLK
+ * and is dedicated to the sequencer, its interrupt is not used. The MAT
+ * pin must be selected in PINSEL. The sequencer is stopped.
+ **********************************************************************/
+Status MATSEQ_Init(LPC_TIM_TypeDef* TIMx, uint8_t matchChannel, uint32_t prescale)
+{
+    TIM_TIMERCFG_Type timer_cfg;
+    uint32_t pclksel;
+    uint32_t unit;
+
+    if ((seq_timer_unit(TIMx, &pclksel, &unit) == ERROR) || (matchChannel > 1) || (prescale == 0))
+    {
+        return ERROR;
+    }
+    if (seq_dma < 0)
+    {
+        seq_dma = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+        if (seq_dma < 0)
+        {
+            return ERROR;
+        }
+    }
+    seq_timer = NULL;
+    GPDMA_ChannelCmd((uint8_t)seq_dma, DISABLE);
+
+    timer_cfg.PrescaleOption = TIM_PRESCALE_TICKVAL;
+    timer_cfg.PrescaleValue = prescale;
+    TIM_Init(TIMx, TIM_TIMER_MODE, &timer_cfg);
+    CLKPWR_SetPCLKDiv(pclksel, CLKPWR_PCLKSEL_CCLK_DIV_1); // TIM_Init() selects CCLK / 4
+    seq_tick_hz = CLKPWR_GetPCLK(pclksel) / prescale;
+
+    // Each match ends an interval: the TC counts the next one from 0, without interrupt
+    TIMx->MCR = TIM_RESET_ON_MATCH(matchChannel);
+    seq_timer = TIMx;
+    seq_mr = &TIMx->MR0 + matchChannel;
+    seq_channel = matchChannel;
+    seq_conn = GPDMA_CONN_MAT0_0 + unit * 2 + matchChannel;
+    seq_prescale = prescale;
+    seq_idle = 0;
+
+    MATSEQ_Stop();
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Start playing a train of edges
+ * @param[in]	train	Train of edges, its table kept in place while it is
+ * 						played
+ * @return		SUCCESS, or ERROR if MATSEQ_Init() did not succeed or the
+ * 				train is out of range
+ *
+ * Note: a train being played is stopped first. The first edge comes
+ * Intervals[0] + 1 ticks after the call, each following one
+ * Intervals[k] + 1 ticks after the previous one, and each interval must
+ * last MATSEQ_MIN_CYCLES CPU cycles at least. The GPDMA reads the entry
+ * of an edge when the previous edge falls: an entry may be changed up to
+ * then, and takes effect on the next pass of a train played in a loop.
+ * A train played once leaves the output at the level of its last edge,
+ * the idle level after an even Count. An odd Count played in a loop
+ * inverts the train on every other pass.
+ **********************************************************************/
+Status MATSEQ_Start(const MATSEQ_Type* train)
+{
+    GPDMA_Channel_CFG_Type cfg;
+    LPC_TIM_TypeDef* TIMx = seq_timer;
+
+    if ((TIMx == NULL) || (train->Count < 2) || (train->Count > MATSEQ_MAX_EDGES) || (train->IdleLevel > 1))
+    {
+        return ERROR;
+    }
+    for (uint32_t k = 0; k < train->Count; k++)
+    {
+        if (((uint64_t)train->Intervals[k] + 1) * seq_prescale < MATSEQ_MIN_CYCLES)
+        {
+            return ERROR;
+        }
+    }
+    seq_idle = train->IdleLevel;
+    MATSEQ_Stop();
+
+    seq_loop.SrcAddr = (uint32_t)train->Intervals;
+    seq_loop.DstAddr = (uint32_t)seq_mr;
+    seq_loop.NextLLI = (uint32_t)&seq_loop;
+    seq_loop.Control = MATSEQ_DMA_CONTROL(train->Count);
+
+    seq_end.SrcAddr = (uint32_t)&seq_stop;
+    seq_end.DstAddr = (uint32_t)&TIMx->TCR;
+    seq_end.NextLLI = 0;
+    seq_end.Control = MATSEQ_DMA_CONTROL(1);
+
+    // The first interval from the match register, the DMA request of each edge loads the next one
+    *seq_mr = train->Intervals[0];
+    TIMx->IR = TIM_IR_CLR(seq_channel); // No request left from a previous match
+    TIMx->EMR = (seq_idle << seq_channel) | TIM_EM_SET(seq_channel, TIM_EM_TOGGLE);
+
+    cfg.ChannelNum = (uint32_t)seq_dma;
+    cfg.SrcMemAddr = (uint32_t)(train->Intervals + 1);
+    cfg.DstMemAddr = 0;
+    cfg.TransferSize = train->Count - 1;
+    cfg.TransferWidth = 0;
+    cfg.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    cfg.SrcConn = 0;
+    cfg.DstConn = seq_conn;
+    cfg.DMALLI = (train->Repeat == ENABLE) ? (uint32_t)&seq_loop : (uint32_t)&seq_end;
+
+    // The terminal count of the table finds no callback
+    if (GPDMA_Submit(&cfg, NULL, NULL, NULL) != SUCCESS)
+    {
+        return ERROR;
+    }
+    TIM_Cmd(TIMx, ENABLE);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop the train being played, the output goes back to its
+ * 				idle level
+ * @param[in]	None
+ * @return		None
+ **********************************************************************/
+void MATSEQ_Stop(void)
+{
+    LPC_TIM_TypeDef* TIMx = seq_timer;
+
+    if ((TIMx == NULL) || (seq_dma < 0))
+    {
+        return;
+    }
+    TIM_Cmd(TIMx, DISABLE);
+    GPDMA_ChannelCmd((uint8_t)seq_dma, DISABLE);
+    TIM_ResetCounter(TIMx);
+    TIMx->EMR = seq_idle << seq_channel; // No more toggles
+}
+
+/*********************************************************************/ /**
+ * @brief		Tell whether a train is being played
+ * @param[in]	None
+ * @return		TRUE until a train played once has ended or MATSEQ_Stop()
+ * 				is called
+ **********************************************************************/
+Bool MATSEQ_IsBusy(void)
+{
+    return ((seq_timer != NULL) && (seq_timer->TCR & TIM_ENABLE)) ? TRUE : FALSE;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the tick rate of the intervals
+ * @param[in]	None
+ * @return		Ticks per second, 0 before MATSEQ_Init()
+ **********************************************************************/
+uint32_t MATSEQ_GetTickHz(void)
+{
+    return seq_tick_hz;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _MATSEQ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
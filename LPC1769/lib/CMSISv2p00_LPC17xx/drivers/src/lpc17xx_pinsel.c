@@ -36,13 +36,35 @@
  */
 
 /* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_bitband.h"
 #include "lpc17xx_pinsel.h"
 
+/* Private Macros ------------------------------------------------------------- */
+/** Number of ports, and of PINSEL/PINMODE registers for the pins of these ports */
+#define PINSEL_PORT_COUNT 5
+#define PINSEL_REG_COUNT  (2 * PINSEL_PORT_COUNT)
+
 /* Public Functions ----------------------------------------------------------- */
 
 static void set_PinFunc(uint8_t portnum, uint8_t pinnum, uint8_t funcnum);
 static void set_ResistorMode(uint8_t portnum, uint8_t pinnum, uint8_t modenum);
 static void set_OpenDrainMode(uint8_t portnum, uint8_t pinnum, uint8_t modenum);
+static void set_PinField(volatile uint32_t* reg, uint32_t shift, uint32_t value);
+
+/*********************************************************************/ /**
+ * @brief 		Write a 2-bit field of a PINSEL or PINMODE register
+ * @param[in]	reg		PINSEL or PINMODE register
+ * @param[in]	shift	Position of the field
+ * @param[in]	value	New value of the field, 0 to 3
+ * @return 		None
+ *
+ * Note: one read and one write of the register, the field goes straight
+ * from its old value to the new one.
+ **********************************************************************/
+static void set_PinField(volatile uint32_t* reg, uint32_t shift, uint32_t value)
+{
+    *reg = (*reg & ~(0x03UL << shift)) | ((value & 0x03UL) << shift);
+}
 
 /*********************************************************************/ /**
   * @brief 		Setup the pin selection function
@@ -101,15 +123,14 @@ static void set_PinFunc(uint8_t portnum, uint8_t pinnum, uint8_t funcnum)
 {
     uint32_t pinnum_t = pinnum;
     uint32_t pinselreg_idx = 2 * portnum;
-    uint32_t* pPinCon = (uint32_t*)&LPC_PINCON->PINSEL0;
+    volatile uint32_t* pPinCon = &LPC_PINCON->PINSEL0;
 
     if (pinnum_t >= 16)
     {
         pinnum_t -= 16;
         pinselreg_idx++;
     }
-    *(uint32_t*)(pPinCon + pinselreg_idx) &= ~(0x03UL << (pinnum_t * 2));
-    *(uint32_t*)(pPinCon + pinselreg_idx) |= ((uint32_t)funcnum) << (pinnum_t * 2);
+    set_PinField(pPinCon + pinselreg_idx, pinnum_t * 2, funcnum);
 }
 
 /*********************************************************************/ /**
@@ -167,7 +188,7 @@ void set_ResistorMode(uint8_t portnum, uint8_t pinnum, uint8_t modenum)
 {
     uint32_t pinnum_t = pinnum;
     uint32_t pinmodereg_idx = 2 * portnum;
-    uint32_t* pPinCon = (uint32_t*)&LPC_PINCON->PINMODE0;
+    volatile uint32_t* pPinCon = &LPC_PINCON->PINMODE0;
 
     if (pinnum_t >= 16)
     {
@@ -175,8 +196,7 @@ void set_ResistorMode(uint8_t portnum, uint8_t pinnum, uint8_t modenum)
         pinmodereg_idx++;
     }
 
-    *(uint32_t*)(pPinCon + pinmodereg_idx) &= ~(0x03UL << (pinnum_t * 2));
-    *(uint32_t*)(pPinCon + pinmodereg_idx) |= ((uint32_t)modenum) << (pinnum_t * 2);
+    set_PinField(pPinCon + pinmodereg_idx, pinnum_t * 2, modenum);
 }
 
 /*********************************************************************/ /**
@@ -232,16 +252,9 @@ void set_ResistorMode(uint8_t portnum, uint8_t pinnum, uint8_t modenum)
   **********************************************************************/
 void set_OpenDrainMode(uint8_t portnum, uint8_t pinnum, uint8_t modenum)
 {
-    uint32_t* pPinCon = (uint32_t*)&LPC_PINCON->PINMODE_OD0;
+    volatile uint32_t* pPinCon = &LPC_PINCON->PINMODE_OD0;
 
-    if (modenum == PINSEL_PINMODE_OPENDRAIN)
-    {
-        *(uint32_t*)(pPinCon + portnum) |= (0x01UL << pinnum);
-    }
-    else
-    {
-        *(uint32_t*)(pPinCon + portnum) &= ~(0x01UL << pinnum);
-    }
+    BITBAND_Write(pPinCon + portnum, pinnum, modenum == PINSEL_PINMODE_OPENDRAIN);
 }
 
 /* End of Public Functions ---------------------------------------------------- */
@@ -322,6 +335,74 @@ void PINSEL_ConfigPin(PINSEL_CFG_Type* PinCfg)
     set_OpenDrainMode(PinCfg->Portnum, PinCfg->Pinnum, PinCfg->OpenDrain);
 }
 
+/*********************************************************************/ /**
+ * @brief 		Configure a table of pins with one read-modify-write of each
+ * 				PINSEL, PINMODE and PINMODE_OD register they use
+ * @param[in]	PinCfgTable	Table of PINSEL_CFG_Type, one entry per pin
+ * @param[in]	count		Number of entries of PinCfgTable
+ * @return 		None
+ *
+ * Note: the fields of all the entries are merged first, then every register
+ * holding at least one of the pins is written once, with its final value.
+ * Pins that share a register switch together. Entries with an invalid port
+ * or pin number are ignored. When a pin appears twice, the last entry wins.
+ **********************************************************************/
+void PINSEL_ConfigPins(const PINSEL_CFG_Type* PinCfgTable, uint32_t count)
+{
+    uint32_t func_mask[PINSEL_REG_COUNT] = {0}, func_value[PINSEL_REG_COUNT] = {0};
+    uint32_t mode_mask[PINSEL_REG_COUNT] = {0}, mode_value[PINSEL_REG_COUNT] = {0};
+    uint32_t od_mask[PINSEL_PORT_COUNT] = {0}, od_value[PINSEL_PORT_COUNT] = {0};
+    volatile uint32_t* pinsel = &LPC_PINCON->PINSEL0;
+    volatile uint32_t* pinmode = &LPC_PINCON->PINMODE0;
+    volatile uint32_t* pinmode_od = &LPC_PINCON->PINMODE_OD0;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        const PINSEL_CFG_Type* pin = &PinCfgTable[i];
+        uint32_t idx;
+        uint32_t shift;
+        uint32_t field;
+        uint32_t bit;
+
+        if ((pin->Portnum >= PINSEL_PORT_COUNT) || (pin->Pinnum > PINSEL_PIN_31))
+        {
+            continue;
+        }
+        idx = 2 * pin->Portnum + (pin->Pinnum >> 4);
+        shift = (pin->Pinnum & 0x0F) * 2;
+        field = 0x03UL << shift;
+        bit = 0x01UL << pin->Pinnum;
+
+        func_mask[idx] |= field;
+        func_value[idx] = (func_value[idx] & ~field) | ((uint32_t)pin->Funcnum << shift);
+        mode_mask[idx] |= field;
+        mode_value[idx] = (mode_value[idx] & ~field) | ((uint32_t)pin->Pinmode << shift);
+        od_mask[pin->Portnum] |= bit;
+        od_value[pin->Portnum] &= ~bit;
+        if (pin->OpenDrain == PINSEL_PINMODE_OPENDRAIN)
+        {
+            od_value[pin->Portnum] |= bit;
+        }
+    }
+
+    for (i = 0; i < PINSEL_REG_COUNT; i++)
+    {
+        if (func_mask[i])
+        {
+            pinsel[i] = (pinsel[i] & ~func_mask[i]) | func_value[i];
+            pinmode[i] = (pinmode[i] & ~mode_mask[i]) | mode_value[i];
+        }
+    }
+    for (i = 0; i < PINSEL_PORT_COUNT; i++)
+    {
+        if (od_mask[i])
+        {
+            pinmode_od[i] = (pinmode_od[i] & ~od_mask[i]) | od_value[i];
+        }
+    }
+}
+
 /**
  * @}
  */
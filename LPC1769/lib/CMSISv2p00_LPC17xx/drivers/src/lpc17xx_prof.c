@@ -0,0 +1,479 @@
+/**********************************************************************
+ * @file		lpc17xx_prof.c
+ * @brief	Contains all functions support for the DWT cycle counter
+ * 			profiler on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup PROF
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_prof.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _PROF
+
+#ifdef _DBGFWK
+#include "debug_frmwrk.h"
+#endif /* _DBGFWK */
+
+/* Private Types -------------------------------------------------------------- */
+/** @defgroup PROF_Private_Types PROF Private Types
+ * @{
+ */
+
+/** @brief Handler being executed */
+typedef struct
+{
+    uint32_t start;  /**< CYCCNT at the entry */
+    uint32_t nested; /**< Cycles spent in the handlers that preempted it */
+    uint32_t slot;   /**< Profile slot, PROF_MAX_SLOTS when the handler is not attached */
+} PROF_FRAME_Type;
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup PROF_Private_Variables PROF Private Variables
+ * @{
+ */
+
+static const PROF_SLOT_Type empty_slot;
+static PROF_SLOT_Type slots[PROF_MAX_SLOTS];
+static uint32_t slot_count;
+/** Slot of each vector plus one, 0 when the vector is not attached */
+static uint8_t slot_of[PROF_VECTORS];
+static uint32_t trigger[PROF_MAX_SLOTS];
+static uint8_t trigger_set[PROF_MAX_SLOTS];
+
+static PROF_FRAME_Type frames[PROF_MAX_NESTING];
+static uint32_t depth;
+
+/** Cycles counted between two back to back CYCCNT reads, removed from every measure */
+static uint32_t overhead;
+
+static uint32_t window_start;
+static uint32_t idle_since;
+static uint32_t idle_open;
+static uint32_t idle_cycles;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup PROF_Private_Functions PROF Private Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief 		Add a sample to a series
+ * @param[in]	series Series to update
+ * @param[in]	cycles Sample value, in cycles
+ * @return 		None
+ **********************************************************************/
+static void add_sample(PROF_SERIES_Type* series, uint32_t cycles)
+{
+    uint32_t bin = (cycles == 0) ? 0 : 32 - (uint32_t)__builtin_clz(cycles);
+
+    if (series->count == 0 || cycles < series->min)
+    {
+        series->min = cycles;
+    }
+    if (cycles > series->max)
+    {
+        series->max = cycles;
+    }
+    series->count++;
+    series->sum += cycles;
+    series->hist[bin]++;
+}
+
+/*********************************************************************/ /**
+ * @brief 		Remove the measure overhead from a cycle count
+ * @param[in]	cycles Measured cycles
+ * @return 		Corrected cycles
+ **********************************************************************/
+static uint32_t corrected(uint32_t cycles)
+{
+    return (cycles > overhead) ? cycles - overhead : 0;
+}
+
+/*********************************************************************/ /**
+ * @brief 		Close the idle period in progress, if any
+ * @param[in]	now Current CYCCNT
+ * @return 		None
+ **********************************************************************/
+static void close_idle(uint32_t now)
+{
+    if (idle_open)
+    {
+        idle_cycles += now - idle_since;
+        idle_open = 0;
+    }
+}
+
+#ifdef _DBGFWK
+/*********************************************************************/ /**
+ * @brief 		Print a series on the debug UART
+ * @param[in]	name Name of the series
+ * @param[in]	series Series to print
+ * @return 		None
+ **********************************************************************/
+static void dump_series(const char* name, const PROF_SERIES_Type* series)
+{
+    _DBG("  ");
+    _DBG(name);
+    _DBG(" n=");
+    _DBD32(series->count);
+    _DBG(" min=");
+    _DBD32(series->min);
+    _DBG(" max=");
+    _DBD32(series->max);
+    _DBG(" mean=");
+    _DBD32(PROF_GetMean(series));
+    _DBG_("");
+
+    for (uint32_t bin = 0; bin < PROF_HIST_BINS; bin++)
+    {
+        if (series->hist[bin] != 0)
+        {
+            _DBG("    <2^");
+            _DBD(bin);
+            _DBG(": ");
+            _DBD32(series->hist[bin]);
+            _DBG_("");
+        }
+    }
+}
+#endif /* _DBGFWK */
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup PROF_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief 		Start the DWT cycle counter and clear every profile.
+ * 				The attached handlers are detached.
+ * @param[in]	None
+ * @return 		None
+ **********************************************************************/
+void PROF_Init(void)
+{
+    uint32_t first;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    first = PROF_CYCLES();
+    overhead = PROF_CYCLES() - first;
+
+    slot_count = 0;
+    for (uint32_t vector = 0; vector < PROF_VECTORS; vector++)
+    {
+        slot_of[vector] = 0;
+    }
+    depth = 0;
+    PROF_Reset();
+}
+
+/*********************************************************************/ /**
+ * @brief 		Clear the statistics of the attached handlers and
+ * 				start a new CPU load window
+ * @param[in]	None
+ * @return 		None
+ **********************************************************************/
+void PROF_Reset(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    for (uint32_t slot = 0; slot < slot_count; slot++)
+    {
+        int32_t irq = slots[slot].irq;
+
+        slots[slot] = empty_slot;
+        slots[slot].irq = irq;
+        trigger_set[slot] = 0;
+    }
+    window_start = PROF_CYCLES();
+    idle_cycles = 0;
+    idle_open = 0;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief 		Attach a profile slot to a handler
+ * @param[in]	irq Exception or interrupt number of the handler
+ * @return 		SUCCESS, or ERROR when every slot is in use
+ **********************************************************************/
+Status PROF_Attach(IRQn_Type irq)
+{
+    uint32_t vector = PROF_VECTOR(irq);
+
+    if (vector >= PROF_VECTORS)
+    {
+        return ERROR;
+    }
+    if (slot_of[vector] != 0)
+    {
+        return SUCCESS;
+    }
+    if (slot_count == PROF_MAX_SLOTS)
+    {
+        return ERROR;
+    }
+
+    slots[slot_count].irq = irq;
+    slot_of[vector] = (uint8_t)(slot_count + 1);
+    slot_count++;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief 		Mark the entry in a handler, to be called first
+ * @param[in]	irq Exception or interrupt number of the handler
+ * @return 		None
+ **********************************************************************/
+void PROF_IsrEnter(IRQn_Type irq)
+{
+    uint32_t now = PROF_CYCLES();
+    uint32_t vector = PROF_VECTOR(irq);
+    uint32_t slot = (vector < PROF_VECTORS && slot_of[vector]) ? slot_of[vector] - 1U : PROF_MAX_SLOTS;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    close_idle(now);
+
+    if (slot < PROF_MAX_SLOTS && trigger_set[slot])
+    {
+        add_sample(&slots[slot].latency, corrected(now - trigger[slot]));
+        trigger_set[slot] = 0;
+    }
+
+    if (depth < PROF_MAX_NESTING)
+    {
+        frames[depth].start = now;
+        frames[depth].nested = 0;
+        frames[depth].slot = slot;
+    }
+    depth++;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief 		Mark the exit of a handler, to be called last
+ * @param[in]	irq Exception or interrupt number of the handler
+ * @return 		None
+ **********************************************************************/
+void PROF_IsrExit(IRQn_Type irq)
+{
+    uint32_t now = PROF_CYCLES();
+    uint32_t primask = __get_PRIMASK();
+
+    (void)irq;
+
+    __disable_irq();
+    if (depth == 0)
+    {
+        __set_PRIMASK(primask);
+        return;
+    }
+    depth--;
+
+    if (depth < PROF_MAX_NESTING)
+    {
+        PROF_FRAME_Type* frame = &frames[depth];
+        uint32_t total = now - frame->start;
+
+        if (frame->slot < PROF_MAX_SLOTS)
+        {
+            add_sample(&slots[frame->slot].duration, corrected(total - frame->nested));
+        }
+        if (depth > 0 && depth - 1 < PROF_MAX_NESTING)
+        {
+            frames[depth - 1].nested += total;
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief 		Record the time stamp of the event served by a handler.
+ * 				The next PROF_IsrEnter() of this handler adds the
+ * 				time elapsed since then to its latency series.
+ * @param[in]	irq Exception or interrupt number of the handler
+ * @param[in]	cycles CYCCNT value when the event happened. It can be
+ * 				in the past, e.g. derived from a timer capture.
+ * @return 		None
+ **********************************************************************/
+void PROF_SetTrigger(IRQn_Type irq, uint32_t cycles)
+{
+    uint32_t vector = PROF_VECTOR(irq);
+
+    if (vector < PROF_VECTORS && slot_of[vector] != 0)
+    {
+        trigger[slot_of[vector] - 1U] = cycles;
+        trigger_set[slot_of[vector] - 1U] = 1;
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief 		Mark the start of an idle period, typically right
+ * 				before __WFI(). The period ends at the next handler
+ * 				entry or at PROF_IdleExit().
+ * @param[in]	None
+ * @return 		None
+ **********************************************************************/
+void PROF_IdleEnter(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    idle_since = PROF_CYCLES();
+    idle_open = 1;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief 		Mark the end of an idle period
+ * @param[in]	None
+ * @return 		None
+ **********************************************************************/
+void PROF_IdleExit(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    close_idle(PROF_CYCLES());
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief 		Get the CPU load since the previous call (or since
+ * 				PROF_Reset()) and start a new window
+ * @param[in]	None
+ * @return 		Load in per mille: 1000 minus the idle share of the window
+ **********************************************************************/
+uint32_t PROF_GetLoad(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t now;
+    uint32_t elapsed;
+    uint32_t idle;
+
+    __disable_irq();
+    now = PROF_CYCLES();
+    if (idle_open)
+    {
+        close_idle(now);
+        idle_since = now;
+        idle_open = 1;
+    }
+    elapsed = now - window_start;
+    idle = idle_cycles;
+    window_start = now;
+    idle_cycles = 0;
+    __set_PRIMASK(primask);
+
+    if (elapsed == 0)
+    {
+        return 0;
+    }
+    return 1000U - (uint32_t)(((uint64_t)idle * 1000U) / elapsed);
+}
+
+/*********************************************************************/ /**
+ * @brief 		Get the profile of a handler
+ * @param[in]	irq Exception or interrupt number of the handler
+ * @return 		Profile, NULL when the handler is not attached
+ **********************************************************************/
+const PROF_SLOT_Type* PROF_GetSlot(IRQn_Type irq)
+{
+    uint32_t vector = PROF_VECTOR(irq);
+
+    if (vector >= PROF_VECTORS || slot_of[vector] == 0)
+    {
+        return NULL;
+    }
+    return &slots[slot_of[vector] - 1U];
+}
+
+/*********************************************************************/ /**
+ * @brief 		Get the mean of a series
+ * @param[in]	series Series of cycle counts
+ * @return 		Mean, in cycles (0 for an empty series)
+ **********************************************************************/
+uint32_t PROF_GetMean(const PROF_SERIES_Type* series)
+{
+    return series->count ? (uint32_t)(series->sum / series->count) : 0;
+}
+
+/*********************************************************************/ /**
+ * @brief 		Print the CPU load and the profile of every attached
+ * 				handler on the debug UART (debug_frmwrk_init() must
+ * 				have been called). Starts a new CPU load window.
+ * @param[in]	None
+ * @return 		None
+ **********************************************************************/
+void PROF_Dump(void)
+{
+#ifdef _DBGFWK
+    PROF_SLOT_Type copy;
+
+    _DBG("PROF load=");
+    _DBD32(PROF_GetLoad());
+    _DBG("/1000 overhead=");
+    _DBD32(overhead);
+    _DBG_(" cycles");
+
+    for (uint32_t slot = 0; slot < slot_count; slot++)
+    {
+        /* Snapshot, so that the handlers can keep running while the UART is busy */
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        copy = slots[slot];
+        __set_PRIMASK(primask);
+
+        _DBG("vector ");
+        _DBD32(PROF_VECTOR(copy.irq));
+        _DBG_("");
+        dump_series("duration", &copy.duration);
+        if (copy.latency.count != 0)
+        {
+            dump_series("latency", &copy.latency);
+        }
+    }
+#endif /* _DBGFWK */
+}
+
+/**
+ * @}
+ */
+
+#endif /* _PROF */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,386 @@
+/**********************************************************************
+ * @file		lpc17xx_pulse.c
+ * @brief	Contains all functions support for the capture based pulse
+ * 			measurement on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup PULSE
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_pulse.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_timer.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _PULSE
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup PULSE_Private_Macros PULSE Private Macros
+ * @{
+ */
+
+/** Flag of a falling edge in a timestamp of the ring, above the 2^63 ticks (2900 years at 100 MHz) of the counter */
+#define PULSE_FALLING ((uint64_t)1 << 63)
+
+/** Ticks between two interrupts of the match register: a timestamp is less than 2^31 ticks after the last one */
+#define PULSE_MARK_TICKS ((uint32_t)1 << 30)
+
+/** Interrupt flags of the capture channels: CR0 rising edges, CR1 falling edges */
+#define PULSE_IR_RISE TIM_IR_CLR(TIM_CR0_INT)
+#define PULSE_IR_FALL TIM_IR_CLR(TIM_CR1_INT)
+
+/** Readings of the ring by PULSE_Measure() before it gives up, when the handler overwrites the edges it reads */
+#define PULSE_READ_ATTEMPTS 4
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup PULSE_Private_Variables PULSE Private Variables
+ * @{
+ */
+
+static LPC_TIM_TypeDef* pulse_tim;
+static volatile uint32_t* pulse_mr;
+static uint32_t pulse_ir;
+static uint32_t pulse_ir_mark;
+static uint32_t pulse_tick_hz;
+
+/** Timestamps of the edges, PULSE_FALLING set for the falling ones, written by the handler only */
+static volatile uint64_t pulse_ring[PULSE_RING_SIZE];
+/** Edges stored since PULSE_Init(): the next one goes to pulse_ring[pulse_head % PULSE_RING_SIZE] */
+static volatile uint32_t pulse_head;
+/** Tick of the last event handled, edge or match: the low 32 bits of a capture are counted from it */
+static volatile uint64_t pulse_last;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup PULSE_Private_Functions PULSE Private Functions
+ * @{
+ */
+
+/* Store an edge: the timestamp first, then the new head, so that the reader never sees an entry being written */
+static void pulse_push(uint64_t stamp)
+{
+    uint32_t head = pulse_head;
+
+    pulse_ring[head & (PULSE_RING_SIZE - 1)] = stamp;
+    pulse_head = head + 1;
+}
+
+/* Clamp a result to the 32 bits of the Q16 fields */
+static uint32_t pulse_saturate(uint64_t value)
+{
+    return (value > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (uint32_t)value;
+}
+
+/*
+ * Compute the means from the edges of complete periods, both ends on a rising edge. Divisions on 64 bits, without
+ * overflow up to 2^47 ticks (16 days with 10 ns ticks) per measurement: the period is below 2^63 ticks in Q16, and
+ * below 2^64 microseconds in Q16 with ticks of 1 us or less.
+ */
+static void pulse_compute(uint32_t periods, uint64_t first, uint64_t last, uint64_t high, PULSE_Result_Type* result)
+{
+    uint64_t total = last - first;
+    uint64_t period = (total << 16) / periods; // Ticks, Q16
+    uint64_t seconds = period / pulse_tick_hz; // Q16, the remainder is converted to microseconds on its own
+
+    result->Periods = periods;
+    result->PeriodUs = seconds * 1000000 + (period % pulse_tick_hz) * 1000000 / pulse_tick_hz;
+    result->FrequencyHz = pulse_saturate((((uint64_t)periods * pulse_tick_hz) << 16) / total);
+    result->Duty = (uint32_t)((high << 16) / total);
+    result->LastEdge = last;
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup PULSE_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Start the timer on the CPU clock, capture the rising edges
+ * 				on CR0 and the falling edges on CR1, and empty the ring
+ * @param[in]	TIMx			Timer, LPC_TIM0 to LPC_TIM3
+ * @param[in]	matchChannel	Match register extending the TC, 0 to 3
+ * @param[in]	prescale		CPU clock cycles per tick, 1 for 10 ns
+ * 								ticks at 100 MHz
+ * @return		SUCCESS, or ERROR on a bad parameter
+ *
+ * Note: the CAPn.0 and CAPn.1 pins must be selected in PINSEL and wired
+ * to the signal. The handler of the timer must call PULSE_IntHandler().
+ * The PCLKSEL divider of the timer is set to CCLK / 1, whatever it was:
+ * the ticks last prescale CPU clock cycles.
+ **********************************************************************/
+Status PULSE_Init(LPC_TIM_TypeDef* TIMx, uint8_t matchChannel, uint32_t prescale)
+{
+    TIM_TIMERCFG_Type timer_cfg;
+    TIM_CAPTURECFG_Type capture_cfg;
+    IRQn_Type irq;
+    uint32_t pclksel;
+
+    if ((matchChannel > 3) || (prescale == 0))
+    {
+        return ERROR;
+    }
+    if (TIMx == LPC_TIM0)
+    {
+        irq = TIMER0_IRQn;
+        pclksel = CLKPWR_PCLKSEL_TIMER0;
+    }
+    else if (TIMx == LPC_TIM1)
+    {
+        irq = TIMER1_IRQn;
+        pclksel = CLKPWR_PCLKSEL_TIMER1;
+    }
+    else if (TIMx == LPC_TIM2)
+    {
+        irq = TIMER2_IRQn;
+        pclksel = CLKPWR_PCLKSEL_TIMER2;
+    }
+    else if (TIMx == LPC_TIM3)
+    {
+        irq = TIMER3_IRQn;
+        pclksel = CLKPWR_PCLKSEL_TIMER3;
+    }
+    else
+    {
+        return ERROR;
+    }
+
+    NVIC_DisableIRQ(irq);
+    pulse_head = 0;
+    pulse_last = 0;
+
+    timer_cfg.PrescaleOption = TIM_PRESCALE_TICKVAL;
+    timer_cfg.PrescaleValue = prescale;
+    TIM_Init(TIMx, TIM_TIMER_MODE, &timer_cfg);
+    CLKPWR_SetPCLKDiv(pclksel, CLKPWR_PCLKSEL_CCLK_DIV_1); // TIM_Init() selects CCLK / 4
+    pulse_tick_hz = CLKPWR_GetPCLK(pclksel) / prescale;
+
+    capture_cfg.CaptureChannel = 0;
+    capture_cfg.RisingEdge = ENABLE;
+    capture_cfg.FallingEdge = DISABLE;
+    capture_cfg.IntOnCaption = ENABLE;
+    TIM_ConfigCapture(TIMx, &capture_cfg);
+    capture_cfg.CaptureChannel = 1;
+    capture_cfg.RisingEdge = DISABLE;
+    capture_cfg.FallingEdge = ENABLE;
+    TIM_ConfigCapture(TIMx, &capture_cfg);
+
+    // Interrupt only, the TC runs freely
+    TIMx->MCR = (TIMx->MCR & ~TIM_MCR_CHANNEL_MASKBIT(matchChannel)) | TIM_INT_ON_MATCH(matchChannel);
+    pulse_tim = TIMx;
+    pulse_mr = &TIMx->MR0 + matchChannel;
+    *pulse_mr = PULSE_MARK_TICKS;
+    pulse_ir_mark = TIM_IR_CLR(matchChannel);
+    pulse_ir = PULSE_IR_RISE | PULSE_IR_FALL | pulse_ir_mark;
+
+    TIM_Cmd(TIMx, ENABLE);
+    NVIC_EnableIRQ(irq);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Capture and match interrupt: store the new edges in the
+ * 				ring, in time order
+ * @return		None
+ *
+ * Note: to be called from TIMERx_IRQHandler(). A capture register read
+ * again after a new edge is recognized by its timestamp, not stored
+ * twice. The other interrupt flags of the timer are left for the caller.
+ **********************************************************************/
+void PULSE_IntHandler(void)
+{
+    LPC_TIM_TypeDef* tim = pulse_tim;
+    uint32_t ir = tim->IR & pulse_ir;
+    uint64_t last = pulse_last;
+    uint32_t base = (uint32_t)last;
+    uint32_t rise = 0; // Ticks after the last event, 0 for none
+    uint32_t fall = 0;
+    uint32_t latest = 0;
+
+    // Cleared before the capture registers are read: an edge captured from now on interrupts again
+    tim->IR = ir;
+    if (ir & PULSE_IR_RISE)
+    {
+        rise = tim->CR0 - base;
+        rise = ((int32_t)rise > 0) ? rise : 0;
+    }
+    if (ir & PULSE_IR_FALL)
+    {
+        fall = tim->CR1 - base;
+        fall = ((int32_t)fall > 0) ? fall : 0;
+    }
+    if (ir & pulse_ir_mark)
+    {
+        latest = *pulse_mr - base;
+        *pulse_mr += PULSE_MARK_TICKS;
+    }
+
+    if ((fall != 0) && (fall < rise))
+    {
+        pulse_push((last + fall) | PULSE_FALLING);
+        pulse_push(last + rise);
+    }
+    else
+    {
+        if (rise != 0)
+        {
+            pulse_push(last + rise);
+        }
+        if (fall != 0)
+        {
+            pulse_push((last + fall) | PULSE_FALLING);
+        }
+    }
+
+    latest = (rise > latest) ? rise : latest;
+    latest = (fall > latest) ? fall : latest;
+    pulse_last = last + latest;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the 64-bit count of the timer
+ * @return		Ticks since PULSE_Init()
+ *
+ * Note: from any context, as long as the timer interrupt is not masked
+ * for more than 2^31 ticks.
+ **********************************************************************/
+uint64_t PULSE_Now(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint64_t last;
+    uint64_t now;
+
+    __disable_irq();
+    last = pulse_last;
+    now = last + (uint32_t)(pulse_tim->TC - (uint32_t)last);
+    __set_PRIMASK(primask);
+    return now;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the rate of the ticks
+ * @return		Ticks per second
+ **********************************************************************/
+uint32_t PULSE_GetTickHz(void)
+{
+    return pulse_tick_hz;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the number of edges captured
+ * @return		Rising and falling edges stored since PULSE_Init(),
+ * 				modulo 2^32
+ *
+ * Note: a change of the count tells that PULSE_Measure() has new edges.
+ **********************************************************************/
+uint32_t PULSE_GetEdgeCount(void)
+{
+    return pulse_head;
+}
+
+/*********************************************************************/ /**
+ * @brief		Compute the mean period, frequency and duty cycle over the
+ * 				last periods of the signal
+ * @param[in]	periods	Number of periods, 1 to PULSE_MAX_PERIODS
+ * @param[out]	result	Means, written on SUCCESS only
+ * @return		SUCCESS, or ERROR when the ring does not hold the periods
+ * 				yet, or when an edge of them was missed
+ *
+ * Note: from the main loop. The periods end on the last rising edge. The
+ * interrupts stay enabled: the edges are read again when the handler
+ * overwrites them meanwhile.
+ **********************************************************************/
+Status PULSE_Measure(uint32_t periods, PULSE_Result_Type* result)
+{
+    if ((periods == 0) || (periods > PULSE_MAX_PERIODS))
+    {
+        return ERROR;
+    }
+
+    for (uint32_t attempt = 0; attempt < PULSE_READ_ATTEMPTS; attempt++)
+    {
+        uint32_t head = pulse_head;
+        uint32_t index = head - 1;
+        uint32_t used = 2 * periods + 1; // Edges read, from the oldest rising edge to the newest one
+        uint64_t last;
+        uint64_t first;
+        uint64_t high = 0;
+        Bool alternate;
+
+        if (head < used)
+        {
+            return ERROR;
+        }
+        if (pulse_ring[index & (PULSE_RING_SIZE - 1)] & PULSE_FALLING)
+        {
+            // The last period ends on the rising edge before
+            index--;
+            used++;
+            if (head < used)
+            {
+                return ERROR;
+            }
+        }
+
+        last = pulse_ring[index & (PULSE_RING_SIZE - 1)];
+        first = last;
+        alternate = (last & PULSE_FALLING) ? FALSE : TRUE;
+        for (uint32_t period = 0; period < periods; period++)
+        {
+            uint64_t fall = pulse_ring[(index - 1) & (PULSE_RING_SIZE - 1)];
+
+            first = pulse_ring[(index - 2) & (PULSE_RING_SIZE - 1)];
+            alternate = ((fall & PULSE_FALLING) && !(first & PULSE_FALLING)) ? alternate : FALSE;
+            high += (fall & ~PULSE_FALLING) - first;
+            index -= 2;
+        }
+
+        // The handler wrote pulse_head - head edges meanwhile, over the oldest entries of the ring
+        if (pulse_head - head > PULSE_RING_SIZE - used)
+        {
+            continue;
+        }
+        if (!alternate)
+        {
+            return ERROR;
+        }
+        pulse_compute(periods, first, last, high, result);
+        return SUCCESS;
+    }
+    return ERROR;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _PULSE */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,269 @@
+/**********************************************************************
+ * @file		lpc17xx_pwmsync.c
+ * @brief	Contains all functions support for the synchronized PWM1
+ * 			service on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup PWMSYNC
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_pwmsync.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_pwm.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _PWMSYNC
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup PWMSYNC_Private_Variables PWMSYNC Private Variables
+ * @{
+ */
+
+/** Shadow match registers, MR0 to MR6: MRn ends the pulse of PWM1.n, MRn-1 starts it in double edge mode */
+static volatile uint32_t* const sync_mr[PWMSYNC_CHANNELS + 1] = {&LPC_PWM1->MR0, &LPC_PWM1->MR1, &LPC_PWM1->MR2,
+                                                                  &LPC_PWM1->MR3, &LPC_PWM1->MR4, &LPC_PWM1->MR5,
+                                                                  &LPC_PWM1->MR6};
+
+static uint8_t sync_channels;
+static uint8_t sync_double;
+/** LER word of a frame: the match registers of the outputs driven */
+static uint32_t sync_latch;
+/** Ticks per period, 0 until PWMSYNC_Init() succeeds */
+static uint32_t sync_period;
+/** Ticks per microsecond in Q16 */
+static uint64_t sync_us_q16;
+
+/**
+ * @}
+ */
+
+/* Public Variables ----------------------------------------------------------- */
+/** @addtogroup PWMSYNC_Public_Types
+ * @{
+ */
+
+const int32_t PWMSYNC_Cie1931[SENSOR_TABLE_POINTS] = SENSOR_TABLE(PWMSYNC_CIE1931);
+const int32_t PWMSYNC_Gamma2[SENSOR_TABLE_POINTS] = SENSOR_TABLE(PWMSYNC_GAMMA2);
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup PWMSYNC_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Start PWM1 on the CPU clock with all the outputs low
+ * @param[in]	PWMSYNC_ConfigStruct	Pointer to a PWMSYNC_CFG_Type
+ * 										structure with the period and the
+ * 										outputs
+ * @return		SUCCESS, or ERROR on a bad parameter, with PWM1 and the
+ * 				frames of a previous PWMSYNC_Init() left as they were
+ *
+ * Note: PWM1 runs on PCLK = CCLK, without prescaler, and its interrupt is
+ * not used. The PWM1.n pins must be selected in PINSEL. A double edge
+ * output PWM1.n takes MRn-1, so PWM1.n-1 cannot be driven at the same time.
+ **********************************************************************/
+Status PWMSYNC_Init(PWMSYNC_CFG_Type* PWMSYNC_ConfigStruct)
+{
+    PWM_TIMERCFG_Type timer_cfg;
+    uint8_t channels = PWMSYNC_ConfigStruct->Channels;
+    uint8_t dual = PWMSYNC_ConfigStruct->DoubleEdge;
+    uint64_t period;
+    uint32_t pclk;
+
+    if ((channels == 0) || (channels >> PWMSYNC_CHANNELS) || (dual & ~channels) || (dual & PWMSYNC_CH(1)) ||
+        ((dual >> 1) & channels))
+    {
+        return ERROR;
+    }
+
+    // PWM1 will count CCLK: the period is checked before PWM1 and its clock change
+    pclk = SystemCoreClock;
+    period = (uint64_t)PWMSYNC_ConfigStruct->PeriodUs * pclk / 1000000;
+    if ((period < PWMSYNC_MIN_TICKS) || (period > 0xFFFFFFFFULL))
+    {
+        return ERROR;
+    }
+
+    sync_period = 0;
+    timer_cfg.PrescaleOption = PWM_TIMER_PRESCALE_TICKVAL;
+    timer_cfg.PrescaleValue = 1;
+    PWM_Init(LPC_PWM1, PWM_MODE_TIMER, &timer_cfg);
+    CLKPWR_SetPCLKDiv(CLKPWR_PCLKSEL_PWM1, CLKPWR_PCLKSEL_CCLK_DIV_1); // PWM_Init() selects CCLK / 4
+
+    // MR0 ends the period, the other match registers start at 0: single edge outputs low, double edge ones too
+    *sync_mr[0] = (uint32_t)period - 1;
+    sync_latch = PWM_LER_EN_MATCHn_LATCH(0);
+    for (uint32_t n = 1; n <= PWMSYNC_CHANNELS; n++)
+    {
+        *sync_mr[n] = 0;
+        sync_latch |= PWM_LER_EN_MATCHn_LATCH(n);
+    }
+    LPC_PWM1->LER = sync_latch;
+    LPC_PWM1->MCR = PWM_MCR_RESET_ON_MATCH(0);
+
+    LPC_PWM1->PCR = 0;
+    sync_latch = 0;
+    for (uint32_t n = 1; n <= PWMSYNC_CHANNELS; n++)
+    {
+        if (channels & PWMSYNC_CH(n))
+        {
+            LPC_PWM1->PCR |= PWM_PCR_PWMENAn(n);
+            sync_latch |= PWM_LER_EN_MATCHn_LATCH(n);
+        }
+        if (dual & PWMSYNC_CH(n))
+        {
+            // The rising edge on MRn-1
+            LPC_PWM1->PCR |= PWM_PCR_PWMSELn(n);
+            sync_latch |= PWM_LER_EN_MATCHn_LATCH(n) >> 1;
+        }
+    }
+    sync_channels = channels;
+    sync_double = dual;
+    sync_us_q16 = ((uint64_t)pclk << 16) / 1000000;
+    sync_period = (uint32_t)period;
+
+    PWM_ResetCounter(LPC_PWM1);
+    LPC_PWM1->TCR = PWM_TCR_COUNTER_ENABLE | PWM_TCR_PWM_ENABLE;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Commit a frame of duty cycles to all the outputs at once
+ * @param[in]	frame	Duty cycles of the outputs, in ticks
+ * @return		SUCCESS, or ERROR if PWMSYNC_Init() did not succeed
+ *
+ * Note: the frame takes effect when the next period starts, all the
+ * outputs together. A frame committed before that replaces the previous
+ * one, which is never output. High times are clamped to the period. A
+ * double edge output rises Rise ticks after the start of the period and
+ * falls High ticks later, at the end of the period at the latest: it
+ * cannot stay high from one period to the next. The registers are only
+ * written, one write per match register and one to LER.
+ **********************************************************************/
+Status PWMSYNC_Commit(const PWMSYNC_Frame_Type* frame)
+{
+    const uint32_t period = sync_period;
+    const uint32_t last = period - 1;
+
+    if (period == 0)
+    {
+        return ERROR;
+    }
+
+    // Drop a frame not latched yet, so the period boundary cannot come in the middle of the writes below
+    LPC_PWM1->LER = 0;
+    for (uint32_t i = 0; i < PWMSYNC_CHANNELS; i++)
+    {
+        uint32_t high = frame->High[i];
+
+        if (!(sync_channels & PWMSYNC_CH(i + 1)))
+        {
+            continue;
+        }
+        if (sync_double & PWMSYNC_CH(i + 1))
+        {
+            uint32_t rise = (frame->Rise[i] > last) ? last : frame->Rise[i];
+
+            high = (high > last - rise) ? last - rise : high;
+            *sync_mr[i] = rise;
+            *sync_mr[i + 1] = rise + high;
+        }
+        else
+        {
+            *sync_mr[i + 1] = (high > period) ? period : high;
+        }
+    }
+    LPC_PWM1->LER = sync_latch;
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Tell whether the last frame committed waits for the start of
+ * 				the next period
+ * @param[in]	None
+ * @return		TRUE until the hardware latches the frame
+ **********************************************************************/
+Bool PWMSYNC_IsPending(void)
+{
+    return (LPC_PWM1->LER & sync_latch) ? TRUE : FALSE;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the length of the period
+ * @param[in]	None
+ * @return		Ticks per period, 0 before PWMSYNC_Init()
+ **********************************************************************/
+uint32_t PWMSYNC_GetPeriodTicks(void)
+{
+    return sync_period;
+}
+
+/*********************************************************************/ /**
+ * @brief		Convert a duty cycle to a high time
+ * @param[in]	duty	Duty cycle in Q16, PWMSYNC_Q16_ONE is 100 %
+ * @return		Ticks high per period, rounded and clamped to the period
+ **********************************************************************/
+uint32_t PWMSYNC_DutyTicks(uint32_t duty)
+{
+    if (duty >= PWMSYNC_Q16_ONE)
+    {
+        return sync_period;
+    }
+    return (uint32_t)(((uint64_t)duty * sync_period + PWMSYNC_Q16_ONE / 2) >> 16);
+}
+
+/*********************************************************************/ /**
+ * @brief		Convert a pulse width to a high time, for servos
+ * @param[in]	us		Pulse width in microseconds
+ * @return		Ticks high per period, rounded and clamped to the period
+ **********************************************************************/
+uint32_t PWMSYNC_UsTicks(uint32_t us)
+{
+    uint64_t ticks = ((uint64_t)us * sync_us_q16 + PWMSYNC_Q16_ONE / 2) >> 16;
+
+    return (ticks > sync_period) ? sync_period : (uint32_t)ticks;
+}
+
+/*********************************************************************/ /**
+ * @brief		Convert a brightness level to a high time, for LEDs
+ * @param[in]	curve	Duty cycles of the levels from SENSOR_TABLE(), such
+ * 						as PWMSYNC_Cie1931 or PWMSYNC_Gamma2
+ * @param[in]	level	Brightness level, 0 to 4095
+ * @return		Ticks high per period, interpolated in the curve
+ **********************************************************************/
+uint32_t PWMSYNC_LevelTicks(const int32_t* curve, uint32_t level)
+{
+    const SENSOR_Type lut = {curve, 0, 0, 0};
+    int32_t duty = SENSOR_Convert(&lut, level);
+
+    return PWMSYNC_DutyTicks((duty > 0) ? (uint32_t)duty : 0);
+}
+
+/**
+ * @}
+ */
+
+#endif /* _PWMSYNC */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
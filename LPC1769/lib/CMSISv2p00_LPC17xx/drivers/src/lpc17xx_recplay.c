@@ -0,0 +1,497 @@
+/**********************************************************************
+ * @file		lpc17xx_recplay.c
+ * @brief	Contains all functions support for the ADC record and DAC
+ * 			playback engine on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup RECPLAY
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_recplay.h"
+#include "lpc17xx_adc.h"
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_dac.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_pinsel.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _RECPLAY
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup RECPLAY_Private_Macros RECPLAY Private Macros
+ * @{
+ */
+
+#if (RECPLAY_BLOCK_SIZE < 1) || (RECPLAY_BLOCK_SIZE > 4095)
+#error "RECPLAY_BLOCK_SIZE must be from 1 to 4095"
+#endif
+
+/** Registers of the GPDMA channel n, the channels are 0x20 bytes apart */
+#define RECPLAY_DMACH(n) ((LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + ((uint32_t)(n) << 5)))
+
+/** Control word of a record item: n ADGDR words to the buffer, terminal count interrupt */
+#define RECPLAY_RECORD_CONTROL(n)                                                                                      \
+    (GPDMA_DMACCxControl_TransferSize((uint32_t)(n)) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |                  \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_DI | GPDMA_DMACCxControl_I)
+
+/** Control word of a play item: n words of the buffer to DACR, no interrupt */
+#define RECPLAY_PLAY_CONTROL(n)                                                                                        \
+    (GPDMA_DMACCxControl_TransferSize((uint32_t)(n)) | GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) |                  \
+     GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_SI)
+
+/** Bits of a recorded word kept for DACR: the VALUE field, the 10 upper bits of the ADC result */
+#define RECPLAY_VALUE_MASK DAC_VALUE(0x3FF)
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup RECPLAY_Private_Variables RECPLAY Private Variables
+ * @{
+ */
+
+/** Pin of each channel AD0.0 to AD0.7, without pull-up or pull-down. AD0.3 shares P0.26 with AOUT. */
+static const PINSEL_CFG_Type recplay_adc_pins[8] = {
+    {PINSEL_PORT_0, PINSEL_PIN_23, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_24, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_25, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_26, PINSEL_FUNC_1, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_1, PINSEL_PIN_30, PINSEL_FUNC_3, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_1, PINSEL_PIN_31, PINSEL_FUNC_3, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_3, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+    {PINSEL_PORT_0, PINSEL_PIN_2, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE, PINSEL_PINMODE_NORMAL},
+};
+
+/** Record items, each writes its block of the buffer and links to the next one, the last one to the first one */
+static GPDMA_LLI_Type recplay_record_lli[RECPLAY_MAX_BLOCKS];
+/** Play items, over the same blocks */
+static GPDMA_LLI_Type recplay_play_lli[RECPLAY_MAX_BLOCKS];
+
+static uint32_t* recplay_buffer;
+static uint32_t recplay_count;
+static uint32_t recplay_blocks;
+/** Index of the word the next mode starts at, while idle */
+static uint32_t recplay_position;
+static RECPLAY_MODE_Type recplay_mode = RECPLAY_IDLE;
+
+/** GPDMA channels of the two modes, -1 until RECPLAY_Init() gets them */
+static int32_t recplay_record_dma = -1;
+static int32_t recplay_play_dma = -1;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup RECPLAY_Private_Functions RECPLAY Private Functions
+ * @{
+ */
+
+/* DACCNTVAL of a rate, rounded to the nearest PCLK_DAC period, 0 if out of range */
+static uint32_t recplay_timeout(uint32_t rate)
+{
+    uint32_t pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+    uint32_t timeout = ((rate != 0) && (rate <= RECPLAY_PLAY_RATE_MAX)) ? (pclk + rate / 2) / rate : 0;
+
+    return (timeout <= 0xFFFF) ? timeout : 0;
+}
+
+/* Words of block k of the buffer, the last block holds the remainder */
+static uint32_t recplay_block_size(uint32_t k)
+{
+    return (k + 1 < recplay_blocks) ? RECPLAY_BLOCK_SIZE : recplay_count - k * RECPLAY_BLOCK_SIZE;
+}
+
+/* Clear the bits of count words of the buffer from first on that DACR must not get */
+static void recplay_mask(uint32_t first, uint32_t count)
+{
+    uint32_t* word = &recplay_buffer[first];
+
+    while (count-- > 0)
+    {
+        *word++ &= RECPLAY_VALUE_MASK;
+    }
+}
+
+/* Index of the block of the word the record channel writes next, the first one past the end of the buffer */
+static uint32_t recplay_record_block(void)
+{
+    uint32_t position = (RECPLAY_DMACH(recplay_record_dma)->DMACCDestAddr - (uint32_t)recplay_buffer) /
+                        sizeof(uint32_t);
+
+    return (position < recplay_count) ? position / RECPLAY_BLOCK_SIZE : 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		GPDMA terminal count callback, a record item has filled its
+ * 				block
+ * @param[in]	channel	GPDMA channel of the record mode
+ * @param[in]	arg		Not used
+ * @return		None
+ *
+ * Note: the channel has loaded the item of the next block, the block before
+ * it is complete. The interrupt must come before the recording wraps around
+ * to that block, one buffer later.
+ **********************************************************************/
+static void recplay_record_done(uint32_t channel, void* arg)
+{
+    uint32_t k = recplay_record_block();
+
+    (void)channel;
+    (void)arg;
+
+    k = (k != 0) ? k - 1 : recplay_blocks - 1;
+    recplay_mask(k * RECPLAY_BLOCK_SIZE, recplay_block_size(k));
+}
+
+/*
+ * Stop the running mode and keep the position it reached. The address register of a disabled channel points at the
+ * next word it would have moved, or just past the buffer when the last item has completed but not reloaded. A recording
+ * leaves its words masked: those since the last terminal count, and the block before when its interrupt is pending,
+ * since the next GPDMA_Submit() of the channel clears it.
+ */
+static void recplay_halt(void)
+{
+    RECPLAY_MODE_Type mode = recplay_mode;
+    uint32_t address;
+    uint32_t k;
+
+    if (recplay_mode == RECPLAY_RECORD)
+    {
+        ADC_BurstCmd(LPC_ADC, DISABLE);
+        GPDMA_ChannelCmd((uint8_t)recplay_record_dma, DISABLE);
+        address = RECPLAY_DMACH(recplay_record_dma)->DMACCDestAddr;
+    }
+    else if (recplay_mode == RECPLAY_PLAY)
+    {
+        GPDMA_ChannelCmd((uint8_t)recplay_play_dma, DISABLE);
+        address = RECPLAY_DMACH(recplay_play_dma)->DMACCSrcAddr;
+    }
+    else
+    {
+        return;
+    }
+
+    recplay_position = (address - (uint32_t)recplay_buffer) / sizeof(uint32_t);
+    if (recplay_position >= recplay_count)
+    {
+        recplay_position = 0;
+    }
+    recplay_mode = RECPLAY_IDLE;
+
+    if (mode == RECPLAY_RECORD)
+    {
+        k = recplay_position / RECPLAY_BLOCK_SIZE;
+        recplay_mask(k * RECPLAY_BLOCK_SIZE, recplay_position - k * RECPLAY_BLOCK_SIZE);
+        if (GPDMA_IntGetStatus(GPDMA_STAT_RAWINTTC, (uint8_t)recplay_record_dma) == SET)
+        {
+            k = (k != 0) ? k - 1 : recplay_blocks - 1;
+            recplay_mask(k * RECPLAY_BLOCK_SIZE, recplay_block_size(k));
+        }
+    }
+}
+
+/*
+ * Load a channel with the rest of the block holding the word at recplay_position, linked to the item of the next
+ * block, and enable it. Constant time: the blocks all have RECPLAY_BLOCK_SIZE words but the last one.
+ */
+static void recplay_resume(int32_t dma, const GPDMA_LLI_Type* lli)
+{
+    LPC_GPDMACH_TypeDef* ch = RECPLAY_DMACH(dma);
+    uint32_t k = recplay_position / RECPLAY_BLOCK_SIZE;
+    uint32_t skip = (recplay_position - k * RECPLAY_BLOCK_SIZE) * sizeof(uint32_t);
+
+    // The buffer side of the item is the incremented one
+    ch->DMACCSrcAddr = lli[k].SrcAddr + ((lli[k].Control & GPDMA_DMACCxControl_SI) ? skip : 0);
+    ch->DMACCDestAddr = lli[k].DstAddr + ((lli[k].Control & GPDMA_DMACCxControl_DI) ? skip : 0);
+    ch->DMACCLLI = lli[k].NextLLI;
+    ch->DMACCControl = lli[k].Control - GPDMA_DMACCxControl_TransferSize(skip / sizeof(uint32_t));
+    GPDMA_ChannelCmd((uint8_t)dma, ENABLE);
+}
+
+/*
+ * Start the record channel with the rest of the block holding the word at recplay_position, through GPDMA_Submit() so
+ * that its terminal counts call recplay_record_done(). Constant time, like recplay_resume().
+ */
+static Status recplay_record_start(void)
+{
+    GPDMA_Channel_CFG_Type dma;
+    uint32_t k = recplay_position / RECPLAY_BLOCK_SIZE;
+
+    dma.ChannelNum = (uint32_t)recplay_record_dma;
+    dma.SrcMemAddr = 0;
+    dma.DstMemAddr = (uint32_t)&recplay_buffer[recplay_position];
+    dma.TransferSize = recplay_block_size(k) - (recplay_position - k * RECPLAY_BLOCK_SIZE);
+    dma.TransferWidth = 0;
+    dma.TransferType = GPDMA_TRANSFERTYPE_P2M;
+    dma.SrcConn = GPDMA_CONN_ADC;
+    dma.DstConn = 0;
+    dma.DMALLI = recplay_record_lli[k].NextLLI;
+    return GPDMA_Submit(&dma, recplay_record_done, NULL, NULL);
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup RECPLAY_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Configure the ADC, the DAC, their pins and two GPDMA
+ * 				channels for a buffer
+ * @param[in]	cfg		Buffer, ADC channel and rates, see RECPLAY_CFG_Type
+ * @return		SUCCESS, or ERROR if a setting is out of range or no two
+ * 				GPDMA channels are free
+ *
+ * Note: GPDMA_Init() must have been called, and DMA_IRQHandler() must call
+ * GPDMA_IntHandler() with the DMA interrupt enabled. The buffer is masked to
+ * DACR words. The engine is idle, the next mode starts at the beginning of
+ * the buffer.
+ **********************************************************************/
+Status RECPLAY_Init(const RECPLAY_CFG_Type* cfg)
+{
+    static const PINSEL_CFG_Type aout = {PINSEL_PORT_0, PINSEL_PIN_26, PINSEL_FUNC_2, PINSEL_PINMODE_TRISTATE,
+                                         PINSEL_PINMODE_NORMAL};
+    DAC_CONVERTER_CFG_Type dac;
+    GPDMA_Channel_CFG_Type dma;
+    uint32_t timeout = recplay_timeout(cfg->PlayRate);
+
+    if ((cfg->Buffer == NULL) || (cfg->Count < 2) || (cfg->Count > RECPLAY_MAX_BLOCKS * RECPLAY_BLOCK_SIZE) ||
+        (cfg->Channel > ADC_CHANNEL_7) || (cfg->Channel == ADC_CHANNEL_3) || (cfg->RecordRate == 0) ||
+        (cfg->RecordRate > RECPLAY_RECORD_RATE_MAX) || (timeout == 0))
+    {
+        return ERROR;
+    }
+    if (recplay_record_dma < 0)
+    {
+        recplay_record_dma = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    }
+    if (recplay_play_dma < 0)
+    {
+        recplay_play_dma = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    }
+    if ((recplay_record_dma < 0) || (recplay_play_dma < 0))
+    {
+        return ERROR;
+    }
+    RECPLAY_Stop();
+
+    recplay_buffer = cfg->Buffer;
+    recplay_count = cfg->Count;
+    recplay_blocks = (cfg->Count + RECPLAY_BLOCK_SIZE - 1) / RECPLAY_BLOCK_SIZE;
+    recplay_position = 0;
+    recplay_mask(0, recplay_count);
+    for (uint32_t k = 0; k < recplay_blocks; k++)
+    {
+        uint32_t next = (k + 1 < recplay_blocks) ? k + 1 : 0;
+
+        recplay_record_lli[k].SrcAddr = (uint32_t)&LPC_ADC->ADGDR;
+        recplay_record_lli[k].DstAddr = (uint32_t)&recplay_buffer[k * RECPLAY_BLOCK_SIZE];
+        recplay_record_lli[k].NextLLI = (uint32_t)&recplay_record_lli[next];
+        recplay_record_lli[k].Control = RECPLAY_RECORD_CONTROL(recplay_block_size(k));
+
+        recplay_play_lli[k].SrcAddr = (uint32_t)&recplay_buffer[k * RECPLAY_BLOCK_SIZE];
+        recplay_play_lli[k].DstAddr = (uint32_t)&LPC_DAC->DACR;
+        recplay_play_lli[k].NextLLI = (uint32_t)&recplay_play_lli[next];
+        recplay_play_lli[k].Control = RECPLAY_PLAY_CONTROL(recplay_block_size(k));
+    }
+
+    // Burst mode conversions of one channel, whose flag requests a transfer. The ADC interrupt stays disabled.
+    PINSEL_ConfigPins(&recplay_adc_pins[cfg->Channel], 1);
+    ADC_Init(LPC_ADC, cfg->RecordRate);
+    ADC_ChannelCmd(LPC_ADC, cfg->Channel, ENABLE);
+    LPC_ADC->ADINTEN = 1UL << cfg->Channel;
+
+    // The DAC counter runs in both modes, its requests are only served in play mode. The double buffer loads DACR into
+    // the output on the timeout, so the DMA latency does not move the updates.
+    PINSEL_ConfigPins(&aout, 1);
+    DAC_Init(LPC_DAC);
+    DAC_SetDMATimeOut(LPC_DAC, timeout);
+    dac.DBLBUF_ENA = SET;
+    dac.CNT_ENA = SET;
+    dac.DMA_ENA = SET;
+    DAC_ConfigDAConverterControl(LPC_DAC, &dac);
+
+    // The request line and widths of the play channel, left disabled: the mode loads the addresses itself. The record
+    // channel is submitted by each RECPLAY_Record(), for its terminal count callback.
+    dma.ChannelNum = (uint32_t)recplay_play_dma;
+    dma.SrcMemAddr = (uint32_t)recplay_buffer;
+    dma.DstMemAddr = 0;
+    dma.TransferSize = recplay_block_size(0);
+    dma.TransferWidth = 0;
+    dma.TransferType = GPDMA_TRANSFERTYPE_M2P;
+    dma.SrcConn = 0;
+    dma.DstConn = GPDMA_CONN_DAC;
+    dma.DMALLI = (uint32_t)&recplay_play_lli[0];
+    return GPDMA_Setup(&dma);
+}
+
+/*********************************************************************/ /**
+ * @brief		Record the ADC channel into the buffer, from the position
+ * 				reached
+ * @param[in]	None
+ * @return		SUCCESS, or ERROR if RECPLAY_Init() did not succeed
+ *
+ * Note: constant time, it may be called from an interrupt handler. Playback
+ * stops first.
+ **********************************************************************/
+Status RECPLAY_Record(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    Status status = SUCCESS;
+
+    if (recplay_buffer == NULL)
+    {
+        return ERROR;
+    }
+
+    __disable_irq();
+    if (recplay_mode != RECPLAY_RECORD)
+    {
+        recplay_halt();
+        // Reading ADGDR clears a DONE flag left by the last conversion, which would request a stale word
+        (void)LPC_ADC->ADGDR;
+        status = recplay_record_start();
+        if (status == SUCCESS)
+        {
+            ADC_BurstCmd(LPC_ADC, ENABLE);
+            recplay_mode = RECPLAY_RECORD;
+        }
+    }
+    __set_PRIMASK(primask);
+    return status;
+}
+
+/*********************************************************************/ /**
+ * @brief		Play the buffer on the DAC in a loop, from the position
+ * 				reached
+ * @param[in]	None
+ * @return		SUCCESS, or ERROR if RECPLAY_Init() did not succeed
+ *
+ * Note: it may be called from an interrupt handler. Recording stops first,
+ * and the playback starts with the oldest sample recorded. The words
+ * recorded since the last terminal count are masked before, at most two
+ * blocks when the interrupt of the last one has not run yet.
+ **********************************************************************/
+Status RECPLAY_Play(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    if (recplay_buffer == NULL)
+    {
+        return ERROR;
+    }
+
+    __disable_irq();
+    if (recplay_mode != RECPLAY_PLAY)
+    {
+        recplay_halt();
+        recplay_resume(recplay_play_dma, recplay_play_lli);
+        recplay_mode = RECPLAY_PLAY;
+    }
+    __set_PRIMASK(primask);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop recording or playing, the DAC holds its last value
+ * @param[in]	None
+ * @return		None
+ *
+ * Note: a recording is masked as by RECPLAY_Play().
+ **********************************************************************/
+void RECPLAY_Stop(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    recplay_halt();
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Change the DAC update rate, also while playing
+ * @param[in]	rate	DAC updates per second, up to RECPLAY_PLAY_RATE_MAX
+ * @return		SUCCESS, or ERROR if the rate is out of range
+ *
+ * Note: the DAC counter takes the new timeout when it reloads, after the
+ * sample being output.
+ **********************************************************************/
+Status RECPLAY_SetPlayRate(uint32_t rate)
+{
+    uint32_t timeout = recplay_timeout(rate);
+
+    if (timeout == 0)
+    {
+        return ERROR;
+    }
+    DAC_SetDMATimeOut(LPC_DAC, timeout);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the mode of the engine
+ * @param[in]	None
+ * @return		RECPLAY_IDLE, RECPLAY_RECORD or RECPLAY_PLAY
+ **********************************************************************/
+RECPLAY_MODE_Type RECPLAY_GetMode(void)
+{
+    return recplay_mode;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the position in the buffer
+ * @param[in]	None
+ * @return		Index of the next word recorded or played: while recording,
+ * 				the oldest sample of the buffer
+ **********************************************************************/
+uint32_t RECPLAY_GetPosition(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t address;
+    uint32_t position;
+
+    __disable_irq();
+    if (recplay_mode == RECPLAY_IDLE)
+    {
+        position = recplay_position;
+    }
+    else
+    {
+        address = (recplay_mode == RECPLAY_RECORD) ? RECPLAY_DMACH(recplay_record_dma)->DMACCDestAddr
+                                                   : RECPLAY_DMACH(recplay_play_dma)->DMACCSrcAddr;
+        position = (address - (uint32_t)recplay_buffer) / sizeof(uint32_t);
+        position = (position < recplay_count) ? position : 0;
+    }
+    __set_PRIMASK(primask);
+    return position;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _RECPLAY */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,263 @@
+/**********************************************************************
+ * @file		lpc17xx_systime.c
+ * @brief	Contains all functions support for the tickless SysTick
+ * 			time base on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup SYSTIME
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_systime.h"
+#include "lpc17xx_systick.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _SYSTIME
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup SYSTIME_Private_Macros SYSTIME Private Macros
+ * @{
+ */
+
+/** Cycles of a full SysTick period, without deadline */
+#define SYSTIME_FULL_PERIOD (SysTick_LOAD_RELOAD_Msk + 1)
+
+/** Deadline value when no delay is running */
+#define SYSTIME_NO_DEADLINE UINT64_MAX
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup SYSTIME_Private_Variables SYSTIME Private Variables
+ * @{
+ */
+
+/** Cycles at the last time the counter reached 0, or was cleared */
+static volatile uint64_t systime_base;
+/** Cycles between two zeros of the counter: RELOAD + 1 */
+static volatile uint32_t systime_period;
+/** End of the running delay */
+static volatile uint64_t systime_deadline = SYSTIME_NO_DEADLINE;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup SYSTIME_Private_Functions SYSTIME Private Functions
+ * @{
+ */
+
+/*
+ * Cycles since SYSTIME_Init(). The counter goes from RELOAD down to 0, where the interrupt becomes pending, and takes
+ * RELOAD on the next cycle. A zero not yet seen by the interrupt handler is counted. Called with the interrupts
+ * disabled.
+ */
+static uint64_t systime_read(void)
+{
+    uint64_t base = systime_base;
+    uint32_t value = SysTick->VAL;
+
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+    {
+        // The counter reached 0 before or after the first read: read it again after the zero
+        base += systime_period;
+        value = SysTick->VAL;
+    }
+    return base + ((value == 0) ? 0 : systime_period - value);
+}
+
+/*
+ * Restart the counter for a period of cycles, from now on. The time is read right before the counter is cleared: the
+ * cycles of the write of RELOAD in between are lost. Called with the interrupts disabled.
+ */
+static void systime_reload(uint32_t cycles)
+{
+    uint64_t now = systime_read();
+
+    SysTick->LOAD = cycles - 1;
+    SysTick->VAL = 0;                   // Cleared now, RELOAD on the next cycle
+    SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk; // A pending zero is already counted in now
+    systime_base = now;
+    systime_period = cycles;
+}
+
+/*
+ * Set the period of the counter to end at the deadline, or to the full period without a deadline in reach. The full
+ * period is left as it is, so that the time base does not lose cycles while no delay runs. Interrupts disabled.
+ */
+static void systime_program(void)
+{
+    uint64_t now = systime_read();
+    uint64_t deadline = systime_deadline;
+    uint32_t cycles = SYSTIME_FULL_PERIOD;
+
+    if ((deadline != SYSTIME_NO_DEADLINE) && (deadline > now) && (deadline - now < SYSTIME_FULL_PERIOD))
+    {
+        // Two cycles at least: a RELOAD of 0 stops the interrupt
+        cycles = (deadline - now < 2) ? 2 : (uint32_t)(deadline - now);
+    }
+    if ((cycles != SYSTIME_FULL_PERIOD) || (systime_period != SYSTIME_FULL_PERIOD))
+    {
+        systime_reload(cycles);
+    }
+}
+
+/* Count the period that ended at a zero of the counter, and set the next one. Called with the interrupts disabled. */
+static void systime_next_period(void)
+{
+    systime_base += systime_period;
+    systime_program();
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup SYSTIME_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Start the SysTick on the CPU clock, for a full period, and
+ * 				reset the time base to 0
+ * @return		None
+ *
+ * Note: SysTick_Handler() must call SYSTIME_IntHandler().
+ **********************************************************************/
+void SYSTIME_Init(void)
+{
+    SYSTICK_Cmd(DISABLE);
+    SYSTICK_InternalInit(1); // CPU clock source, the reload value is written below
+    systime_deadline = SYSTIME_NO_DEADLINE;
+    systime_base = 0;
+    systime_period = SYSTIME_FULL_PERIOD;
+    SysTick->LOAD = SYSTIME_FULL_PERIOD - 1;
+    SysTick->VAL = 0;
+    SYSTICK_IntCmd(ENABLE);
+    SYSTICK_Cmd(ENABLE);
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the time base
+ * @return		Cycles of SystemCoreClock since SYSTIME_Init()
+ *
+ * Note: from any context. The count is monotonic, and does not wrap
+ * around for 5800 years at 100 MHz.
+ **********************************************************************/
+uint64_t SYSTIME_Now(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint64_t now;
+
+    __disable_irq();
+    now = systime_read();
+    __set_PRIMASK(primask);
+    return now;
+}
+
+/*********************************************************************/ /**
+ * @brief		Sleep until the time base reaches a deadline
+ * @param[in]	deadline	Cycles since SYSTIME_Init(), e.g. the previous
+ * 							deadline plus a period, for a periodic task
+ * 							without drift
+ * @return		None
+ *
+ * Note: to be called from the main loop. The interrupts of the
+ * application run meanwhile, unless the caller disabled them: the zeros
+ * of the counter are then counted here, in place of SYSTIME_IntHandler().
+ * A deadline in the past returns at once.
+ **********************************************************************/
+void SYSTIME_SleepUntil(uint64_t deadline)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    systime_deadline = deadline;
+    systime_program();
+    // __WFI() wakes up on a pending interrupt with PRIMASK set: no interrupt is lost between the test and the sleep
+    while (systime_read() < deadline)
+    {
+        __WFI();
+        if (primask == 0)
+        {
+            __set_PRIMASK(primask); // Run the handlers
+            __disable_irq();
+        }
+        else if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+        {
+            // The caller masked the interrupts: systime_read() counts one pending zero only
+            SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+            systime_next_period();
+        }
+    }
+    systime_deadline = SYSTIME_NO_DEADLINE;
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Sleep for a number of microseconds
+ * @param[in]	us	Microseconds
+ * @return		None
+ *
+ * Note: see SYSTIME_SleepUntil().
+ **********************************************************************/
+void SYSTIME_DelayUs(uint32_t us)
+{
+    SYSTIME_SleepUntil(SYSTIME_Now() + SYSTIME_US(us));
+}
+
+/*********************************************************************/ /**
+ * @brief		Sleep for a number of milliseconds
+ * @param[in]	ms	Milliseconds
+ * @return		None
+ *
+ * Note: see SYSTIME_SleepUntil().
+ **********************************************************************/
+void SYSTIME_DelayMs(uint32_t ms)
+{
+    SYSTIME_SleepUntil(SYSTIME_Now() + SYSTIME_MS(ms));
+}
+
+/*********************************************************************/ /**
+ * @brief		SysTick interrupt: count the period that ended, and set
+ * 				the next one
+ * @return		None
+ *
+ * Note: to be called from SysTick_Handler().
+ **********************************************************************/
+void SYSTIME_IntHandler(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    systime_next_period();
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @}
+ */
+
+#endif /* _SYSTIME */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
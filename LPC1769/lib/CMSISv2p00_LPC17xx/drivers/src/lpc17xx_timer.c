@@ -365,8 +365,8 @@ void TIM_Init(LPC_TIM_TypeDef* TIMx, TIM_MODE_OPT TimerCounterMode, void* TIM_Co
         CLKPWR_SetPCLKDiv(CLKPWR_PCLKSEL_TIMER3, CLKPWR_PCLKSEL_CCLK_DIV_4);
     }
 
-    TIMx->CCR &= ~TIM_CTCR_MODE_MASK;
-    TIMx->CCR |= TIM_TIMER_MODE;
+    // Timer mode while configuring, the counter mode is set below
+    TIMx->CTCR &= ~TIM_CTCR_MASKBIT;
 
     TIMx->TC = 0;
     TIMx->PC = 0;
@@ -389,9 +389,9 @@ void TIM_Init(LPC_TIM_TypeDef* TIMx, TIM_MODE_OPT TimerCounterMode, void* TIM_Co
     {
 
         pCounterCfg = (TIM_COUNTERCFG_Type*)TIM_ConfigStruct;
-        TIMx->CCR &= ~TIM_CTCR_INPUT_MASK;
-        if (pCounterCfg->CountInputSelect == TIM_COUNTER_INCAP1)
-            TIMx->CCR |= _BIT(2);
+        // TC counts the edges of CAPn.0 or CAPn.1 selected in CTCR
+        TIMx->CTCR = (TimerCounterMode & TIM_CTCR_MODE_MASK) |
+                     (_SBF(2, pCounterCfg->CountInputSelect) & TIM_CTCR_INPUT_MASK);
     }
 
     // Clear interrupt pending
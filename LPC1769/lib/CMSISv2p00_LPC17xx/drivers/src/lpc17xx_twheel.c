@@ -0,0 +1,559 @@
+/**********************************************************************
+ * @file		lpc17xx_twheel.c
+ * @brief	Contains all functions support for the tickless software
+ * 			timer wheel on LPC17xx
+ * @version	1.0
+ **********************************************************************/
+
+/* Peripheral group ----------------------------------------------------------- */
+/** @addtogroup TWHEEL
+ * @{
+ */
+
+/* Includes ------------------------------------------------------------------- */
+#include "lpc17xx_twheel.h"
+#include "lpc17xx_timer.h"
+
+/* If this source file built with example, the LPC17xx FW library configuration
+ * file in each example directory ("lpc17xx_libcfg.h") must be included,
+ * otherwise the default FW library configuration file must be included instead
+ */
+#ifdef __BUILD_WITH_EXAMPLE__
+#include "lpc17xx_libcfg.h"
+#else
+#include "lpc17xx_libcfg_default.h"
+#endif /* __BUILD_WITH_EXAMPLE__ */
+
+#ifdef _TWHEEL
+
+/* Private Macros ------------------------------------------------------------- */
+/** @defgroup TWHEEL_Private_Macros TWHEEL Private Macros
+ * @{
+ */
+
+/** Bits of the tick per level */
+#define TWHEEL_LEVEL_BITS 5
+
+/** Slot value of a timer out of the wheel */
+#define TWHEEL_NO_SLOT 0xFF
+
+/**
+ * @}
+ */
+
+/* Private Variables ---------------------------------------------------------- */
+/** @defgroup TWHEEL_Private_Variables TWHEEL Private Variables
+ * @{
+ */
+
+static LPC_TIM_TypeDef* wheel_tim;
+static volatile uint32_t* wheel_mr;
+static uint32_t wheel_mcr_int;
+static uint32_t wheel_ir;
+static IRQn_Type wheel_irq;
+
+/** Tick the wheel is up to date with, at most TWHEEL_HORIZON ticks behind the TC while a timer runs */
+static uint32_t wheel_time;
+/** Timers in the wheel */
+static uint32_t wheel_count;
+/** Occupied slots of each level, bit i for slot i */
+static uint32_t wheel_map[TWHEEL_LEVELS];
+/** First timer of each slot, level by level */
+static TWHEEL_Timer_Type* wheel_slot[TWHEEL_LEVELS * TWHEEL_SLOTS];
+
+/** Expired TWHEEL_DEFERRED timers, oldest first */
+static TWHEEL_Timer_Type* wheel_queue_head;
+static TWHEEL_Timer_Type* wheel_queue_tail;
+
+/**
+ * @}
+ */
+
+/* Private Functions ---------------------------------------------------------- */
+/** @defgroup TWHEEL_Private_Functions TWHEEL Private Functions
+ * @{
+ */
+
+/* Put a timer in the slot of its expiry, relative to wheel_time. Called with the interrupts disabled. */
+static void wheel_insert(TWHEEL_Timer_Type* timer)
+{
+    uint32_t delta = timer->Expiry - wheel_time;
+    uint32_t level = (delta < TWHEEL_SLOTS) ? 0 : (31 - __CLZ(delta)) / TWHEEL_LEVEL_BITS;
+    uint32_t index = (timer->Expiry >> (level * TWHEEL_LEVEL_BITS)) & (TWHEEL_SLOTS - 1);
+    uint32_t slot = level * TWHEEL_SLOTS + index;
+    TWHEEL_Timer_Type* first = wheel_slot[slot];
+
+    timer->Prev = NULL;
+    timer->Next = first;
+    if (first != NULL)
+    {
+        first->Prev = timer;
+    }
+    wheel_slot[slot] = timer;
+    wheel_map[level] |= 1UL << index;
+    timer->Slot = (uint8_t)slot;
+    wheel_count++;
+}
+
+/* Take a timer out of its slot. Called with the interrupts disabled. */
+static void wheel_remove(TWHEEL_Timer_Type* timer)
+{
+    uint32_t slot = timer->Slot;
+
+    if (timer->Prev != NULL)
+    {
+        timer->Prev->Next = timer->Next;
+    }
+    else
+    {
+        wheel_slot[slot] = timer->Next;
+        if (timer->Next == NULL)
+        {
+            wheel_map[slot / TWHEEL_SLOTS] &= ~(1UL << (slot % TWHEEL_SLOTS));
+        }
+    }
+    if (timer->Next != NULL)
+    {
+        timer->Next->Prev = timer->Prev;
+    }
+    timer->Slot = TWHEEL_NO_SLOT;
+    wheel_count--;
+}
+
+/* Take a timer out of the deferred queue. Called with the interrupts disabled. */
+static void wheel_unqueue(TWHEEL_Timer_Type* timer)
+{
+    if (timer->QPrev != NULL)
+    {
+        timer->QPrev->QNext = timer->QNext;
+    }
+    else
+    {
+        wheel_queue_head = timer->QNext;
+    }
+    if (timer->QNext != NULL)
+    {
+        timer->QNext->QPrev = timer->QPrev;
+    }
+    else
+    {
+        wheel_queue_tail = timer->QPrev;
+    }
+    timer->Queued = 0;
+}
+
+/*
+ * Ticks from wheel_time to the next event: the expiry of a level 0 slot, or the start of a higher level slot, whose
+ * timers are then moved down. TWHEEL_HORIZON if there is none before. Called with the interrupts disabled.
+ */
+static uint32_t wheel_next(void)
+{
+    uint32_t next = TWHEEL_HORIZON;
+
+    for (uint32_t level = 0; level < TWHEEL_LEVELS; level++)
+    {
+        uint32_t map = wheel_map[level];
+        uint32_t shift = level * TWHEEL_LEVEL_BITS;
+        uint32_t current = (wheel_time >> shift) & (TWHEEL_SLOTS - 1);
+        uint32_t ahead;
+        uint32_t distance;
+
+        if (map == 0)
+        {
+            continue;
+        }
+        // Occupied slots from the current one on
+        ahead = (current == 0) ? map : ((map >> current) | (map << (TWHEEL_SLOTS - current)));
+
+        if (level == 0)
+        {
+            // A level 0 slot is a single tick, the current slot is due now
+            distance = 31 - __CLZ(ahead & (0 - ahead));
+            next = (distance < next) ? distance : next;
+        }
+        else
+        {
+            // The current slot of a higher level was moved down when its start was reached: it is a turn ahead
+            uint32_t start;
+
+            ahead &= ~1UL;
+            distance = (ahead == 0) ? TWHEEL_SLOTS : 31 - __CLZ(ahead & (0 - ahead));
+            start = ((wheel_time >> shift) + distance) << shift;
+            next = (start - wheel_time < next) ? start - wheel_time : next;
+        }
+    }
+    return next;
+}
+
+/* Move down the timers of the higher level slots starting at wheel_time. Called with the interrupts disabled. */
+static void wheel_cascade(void)
+{
+    for (uint32_t level = TWHEEL_LEVELS - 1; level > 0; level--)
+    {
+        uint32_t shift = level * TWHEEL_LEVEL_BITS;
+        uint32_t index = (wheel_time >> shift) & (TWHEEL_SLOTS - 1);
+        TWHEEL_Timer_Type* timer;
+
+        if (((wheel_time & ((1UL << shift) - 1)) != 0) || ((wheel_map[level] & (1UL << index)) == 0))
+        {
+            continue;
+        }
+
+        timer = wheel_slot[level * TWHEEL_SLOTS + index];
+        wheel_slot[level * TWHEEL_SLOTS + index] = NULL;
+        wheel_map[level] &= ~(1UL << index);
+        while (timer != NULL)
+        {
+            TWHEEL_Timer_Type* next = timer->Next;
+
+            wheel_count--;
+            wheel_insert(timer);
+            timer = next;
+        }
+    }
+}
+
+/* Write the match register with the next event, or disable the interrupt without timers. Interrupts disabled. */
+static void wheel_program(void)
+{
+    uint32_t next;
+
+    if (wheel_count == 0)
+    {
+        wheel_tim->MCR &= ~wheel_mcr_int;
+        return;
+    }
+
+    next = wheel_next();
+    *wheel_mr = wheel_time + next;
+    wheel_tim->MCR |= wheel_mcr_int;
+    if (wheel_tim->TC - wheel_time >= next)
+    {
+        // The TC is at or past the event, the match will not occur before the TC wraps
+        NVIC_SetPendingIRQ(wheel_irq);
+    }
+}
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @addtogroup TWHEEL_Public_Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Start the timer of the wheel and empty the wheel
+ * @param[in]	TIMx			Timer, LPC_TIM0 to LPC_TIM3
+ * @param[in]	matchChannel	Match register of the deadlines, 0 to 3
+ * @param[in]	tickUs			Tick, in microseconds
+ * @return		SUCCESS, or ERROR if a parameter is out of range
+ *
+ * Note: the timer is initialized with TIM_Init(), and its interrupt is
+ * enabled in the NVIC. TIMERx_IRQHandler() must call TWHEEL_IntHandler().
+ **********************************************************************/
+Status TWHEEL_Init(LPC_TIM_TypeDef* TIMx, uint8_t matchChannel, uint32_t tickUs)
+{
+    TIM_TIMERCFG_Type cfg;
+
+    if ((matchChannel > 3) || (tickUs == 0))
+    {
+        return ERROR;
+    }
+    if (TIMx == LPC_TIM0)
+    {
+        wheel_irq = TIMER0_IRQn;
+    }
+    else if (TIMx == LPC_TIM1)
+    {
+        wheel_irq = TIMER1_IRQn;
+    }
+    else if (TIMx == LPC_TIM2)
+    {
+        wheel_irq = TIMER2_IRQn;
+    }
+    else if (TIMx == LPC_TIM3)
+    {
+        wheel_irq = TIMER3_IRQn;
+    }
+    else
+    {
+        return ERROR;
+    }
+
+    NVIC_DisableIRQ(wheel_irq);
+    for (uint32_t slot = 0; slot < TWHEEL_LEVELS * TWHEEL_SLOTS; slot++)
+    {
+        wheel_slot[slot] = NULL;
+    }
+    for (uint32_t level = 0; level < TWHEEL_LEVELS; level++)
+    {
+        wheel_map[level] = 0;
+    }
+    wheel_count = 0;
+    wheel_time = 0;
+    wheel_queue_head = NULL;
+    wheel_queue_tail = NULL;
+
+    cfg.PrescaleOption = TIM_PRESCALE_USVAL;
+    cfg.PrescaleValue = tickUs;
+    TIM_Init(TIMx, TIM_TIMER_MODE, &cfg);
+    TIMx->MCR &= ~TIM_MCR_CHANNEL_MASKBIT(matchChannel); // No reset or stop, the TC runs freely
+
+    wheel_tim = TIMx;
+    wheel_mr = &TIMx->MR0 + matchChannel;
+    wheel_mcr_int = TIM_INT_ON_MATCH(matchChannel);
+    wheel_ir = TIM_IR_CLR(matchChannel);
+
+    TIM_Cmd(TIMx, ENABLE);
+    NVIC_EnableIRQ(wheel_irq);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Initialize a software timer, stopped
+ * @param[in]	timer		Timer
+ * @param[in]	callback	Expiry callback
+ * @param[in]	arg			Argument of the callback
+ * @param[in]	mode		TWHEEL_ISR or TWHEEL_DEFERRED
+ * @return		None
+ **********************************************************************/
+void TWHEEL_TimerInit(TWHEEL_Timer_Type* timer, TWHEEL_Callback_Type callback, void* arg, TWHEEL_MODE_Type mode)
+{
+    timer->Next = NULL;
+    timer->Prev = NULL;
+    timer->QNext = NULL;
+    timer->QPrev = NULL;
+    timer->Expiry = 0;
+    timer->Period = 0;
+    timer->Callback = callback;
+    timer->Arg = arg;
+    timer->Mode = (uint8_t)mode;
+    timer->Slot = TWHEEL_NO_SLOT;
+    timer->Queued = 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		Start or restart a software timer
+ * @param[in]	timer	Timer, initialized by TWHEEL_TimerInit()
+ * @param[in]	delay	Ticks to the first expiry, up to TWHEEL_MAX_TICKS
+ * @param[in]	period	Ticks between the next expiries, up to
+ * 						TWHEEL_MAX_TICKS, or 0 for a one-shot timer
+ * @return		SUCCESS, or ERROR if delay or period is out of range
+ *
+ * Note: constant time, from any context. A periodic timer keeps its phase:
+ * each expiry is period ticks after the previous one, whatever the
+ * interrupt latency. A pending deferred call of the timer is cancelled.
+ **********************************************************************/
+Status TWHEEL_Start(TWHEEL_Timer_Type* timer, uint32_t delay, uint32_t period)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    if ((delay > TWHEEL_MAX_TICKS) || (period > TWHEEL_MAX_TICKS))
+    {
+        return ERROR;
+    }
+
+    __disable_irq();
+    if (timer->Slot != TWHEEL_NO_SLOT)
+    {
+        wheel_remove(timer);
+    }
+    if (timer->Queued)
+    {
+        wheel_unqueue(timer);
+    }
+    if (wheel_count == 0)
+    {
+        wheel_time = wheel_tim->TC; // Nothing to bring up to date
+    }
+    timer->Expiry = wheel_tim->TC + delay;
+    timer->Period = period;
+    wheel_insert(timer);
+    wheel_program();
+    __set_PRIMASK(primask);
+    return SUCCESS;
+}
+
+/*********************************************************************/ /**
+ * @brief		Stop a software timer, and cancel its pending deferred call
+ * @param[in]	timer	Timer, initialized by TWHEEL_TimerInit()
+ * @return		None
+ *
+ * Note: constant time, from any context. Stopping a stopped timer has no
+ * effect.
+ **********************************************************************/
+void TWHEEL_Stop(TWHEEL_Timer_Type* timer)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (timer->Slot != TWHEEL_NO_SLOT)
+    {
+        wheel_remove(timer);
+        if (wheel_count == 0)
+        {
+            wheel_program();
+        }
+    }
+    if (timer->Queued)
+    {
+        wheel_unqueue(timer);
+    }
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Tell whether a software timer runs or has a pending
+ * 				deferred call
+ * @param[in]	timer	Timer, initialized by TWHEEL_TimerInit()
+ * @return		TRUE or FALSE
+ **********************************************************************/
+Bool TWHEEL_IsActive(const TWHEEL_Timer_Type* timer)
+{
+    return ((timer->Slot != TWHEEL_NO_SLOT) || timer->Queued) ? TRUE : FALSE;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the current tick
+ * @return		TC of the timer of the wheel, wraps around after 2^32 ticks
+ **********************************************************************/
+uint32_t TWHEEL_Now(void)
+{
+    return wheel_tim->TC;
+}
+
+/*********************************************************************/ /**
+ * @brief		Match interrupt of the wheel: expire the due timers and
+ * 				write the next deadline
+ * @return		None
+ *
+ * Note: to be called from TIMERx_IRQHandler(). The TWHEEL_ISR callbacks run
+ * with the interrupts enabled, and may start or stop any timer. The other
+ * interrupt flags of the timer are left for the caller.
+ **********************************************************************/
+void TWHEEL_IntHandler(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    wheel_tim->IR = wheel_ir;
+
+    __disable_irq();
+    while (wheel_count != 0)
+    {
+        uint32_t next = wheel_next();
+        TWHEEL_Timer_Type* timer;
+
+        if (wheel_tim->TC - wheel_time < next)
+        {
+            break;
+        }
+
+        wheel_time += next;
+        wheel_cascade();
+
+        // The timers of the level 0 slot of wheel_time are due, one at a time as the callbacks may change the slot
+        while ((wheel_map[0] & (1UL << (wheel_time & (TWHEEL_SLOTS - 1)))) != 0)
+        {
+            timer = wheel_slot[wheel_time & (TWHEEL_SLOTS - 1)];
+            wheel_remove(timer);
+            if (timer->Period != 0)
+            {
+                timer->Expiry += timer->Period;
+                wheel_insert(timer);
+            }
+
+            if (timer->Mode == TWHEEL_DEFERRED)
+            {
+                if (!timer->Queued)
+                {
+                    timer->QNext = NULL;
+                    timer->QPrev = wheel_queue_tail;
+                    if (wheel_queue_tail != NULL)
+                    {
+                        wheel_queue_tail->QNext = timer;
+                    }
+                    else
+                    {
+                        wheel_queue_head = timer;
+                    }
+                    wheel_queue_tail = timer;
+                    timer->Queued = 1;
+                }
+            }
+            else
+            {
+                __set_PRIMASK(primask);
+                timer->Callback(timer->Arg);
+                __disable_irq();
+            }
+        }
+    }
+    wheel_program();
+    __set_PRIMASK(primask);
+}
+
+/*********************************************************************/ /**
+ * @brief		Call the expired TWHEEL_DEFERRED timers, in expiry order
+ * @return		Number of callbacks called
+ *
+ * Note: to be called from the main loop, e.g. after each __WFI(), see
+ * TWHEEL_IsDeferredPending(). A timer that expired several times since
+ * the previous call is called once.
+ **********************************************************************/
+uint32_t TWHEEL_RunDeferred(void)
+{
+    uint32_t calls = 0;
+
+    for (;;)
+    {
+        uint32_t primask = __get_PRIMASK();
+        TWHEEL_Timer_Type* timer;
+
+        __disable_irq();
+        timer = wheel_queue_head;
+        if (timer != NULL)
+        {
+            wheel_unqueue(timer);
+        }
+        __set_PRIMASK(primask);
+
+        if (timer == NULL)
+        {
+            return calls;
+        }
+        timer->Callback(timer->Arg);
+        calls++;
+    }
+}
+
+/*********************************************************************/ /**
+ * @brief		Tell whether expired TWHEEL_DEFERRED timers wait for
+ * 				TWHEEL_RunDeferred()
+ * @return		TRUE or FALSE
+ *
+ * Note: the main loop tests it with the interrupts disabled, then sleeps:
+ * 		__disable_irq();
+ * 		if (!TWHEEL_IsDeferredPending()) __WFI();
+ * 		__enable_irq();
+ * 		TWHEEL_RunDeferred();
+ * so that a timer queued between TWHEEL_RunDeferred() and __WFI() wakes
+ * the loop instead of waiting for the next interrupt.
+ **********************************************************************/
+Bool TWHEEL_IsDeferredPending(void)
+{
+    return (wheel_queue_head != NULL) ? TRUE : FALSE;
+}
+
+/**
+ * @}
+ */
+
+#endif /* _TWHEEL */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -31,5 +31,6 @@ extern q15_t armRecipTableQ15[64];
 extern q31_t armRecipTableQ31[64]; 
 extern const q31_t realCoefAQ31[1024];
 extern const q31_t realCoefBQ31[1024];
+extern const q15_t twiddleCoefQ15[1536];
  
 #endif /*  ARM_COMMON_TABLES_H */ 
@@ -0,0 +1,22 @@
+# Build profiles shared by the driver library, the examples and the benchmarks.
+# Include this file and select a profile with PROFILE=<name> on the make command line:
+#   speed: -O2 with link-time optimization (default). Small driver functions such as GPIO_SetValue() are inlined into
+#          the callers, interrupt handlers included, and switches on constant arguments fold away.
+#   size:  -Os with link-time optimization, for the smallest flash footprint.
+#   debug: -O0 without link-time optimization, for single stepping in the debugger.
+# The library and the program that links it must use the same profile.
+
+PROFILE ?= speed
+
+ifeq ($(PROFILE),speed)
+PROFILE_CFLAGS = -O2 -flto -ffat-lto-objects
+else ifeq ($(PROFILE),size)
+PROFILE_CFLAGS = -Os -flto -ffat-lto-objects
+else ifeq ($(PROFILE),debug)
+PROFILE_CFLAGS = -O0
+else
+$(error Unknown PROFILE '$(PROFILE)', expected speed, size or debug)
+endif
+
+# With LTO the code is generated at link time: the link command needs the optimization flags too
+PROFILE_LDFLAGS = $(PROFILE_CFLAGS) -Wl,--gc-sections
@@ -0,0 +1,49 @@
+/*
+ * @file LPC17xx.h
+ * @brief Host build wrapper around the CMSIS device header
+ *
+ * This directory comes first in the include path of host builds, so every "LPC17xx.h" include lands here. The real
+ * header is pulled in unchanged; only the core intrinsics that would emit Cortex-M3 instructions are redirected to
+ * the simulator. Register accesses need no redirection, the simulator serves them at the real addresses.
+ */
+
+#ifndef LPC17XX_SIM_WRAPPER_H
+#define LPC17XX_SIM_WRAPPER_H
+
+#include_next "LPC17xx.h"
+
+#include "lpc17xx_sim.h"
+
+#define __enable_irq()   lpc_sim_enable_irq()
+#define __disable_irq()  lpc_sim_disable_irq()
+#define __get_PRIMASK()  lpc_sim_get_primask()
+#define __set_PRIMASK(x) lpc_sim_set_primask(x)
+#define __WFI()          lpc_sim_wfi()
+#define __WFE()          lpc_sim_wfi()
+#define __NOP()          __asm volatile("nop")
+#define __ISB()          __sync_synchronize()
+#define __DSB()          __sync_synchronize()
+#define __DMB()          __sync_synchronize()
+
+/* Saturation and leading zero count, used by the DSP library: the CMSIS versions are Cortex-M3 inline assembly */
+static inline int32_t lpc_sim_ssat(int32_t value, uint32_t bits)
+{
+    int32_t max = (int32_t)((1UL << (bits - 1)) - 1);
+
+    return (value > max) ? max : ((value < -max - 1) ? -max - 1 : value);
+}
+
+static inline uint32_t lpc_sim_usat(int32_t value, uint32_t bits)
+{
+    uint32_t max = (uint32_t)((1ULL << bits) - 1);
+
+    return (value < 0) ? 0 : (((uint32_t)value > max) ? max : (uint32_t)value);
+}
+
+#undef __SSAT
+#undef __USAT
+#define __SSAT(x, n) lpc_sim_ssat((x), (n))
+#define __USAT(x, n) lpc_sim_usat((x), (n))
+#define __CLZ(x)     ((uint8_t)(((x) == 0) ? 32 : __builtin_clz(x)))
+
+#endif /* LPC17XX_SIM_WRAPPER_H */
@@ -0,0 +1,17 @@
+/*
+ * @file arm_math.h
+ * @brief Host build wrapper around the CMSIS DSP header
+ *
+ * The inline functions of arm_math.h (arm_pid_q15(), the SIMD emulation) expand __SSAT() where they are defined.
+ * Including LPC17xx.h first gets them the C intrinsics of the simulator instead of the Cortex-M3 assembly. The angle
+ * brackets look it up in the include path, where the #include_next of its wrapper finds the vendored header.
+ */
+
+#ifndef ARM_MATH_SIM_WRAPPER_H
+#define ARM_MATH_SIM_WRAPPER_H
+
+#include <LPC17xx.h>
+
+#include_next "arm_math.h"
+
+#endif /* ARM_MATH_SIM_WRAPPER_H */
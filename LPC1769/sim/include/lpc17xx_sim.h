@@ -0,0 +1,278 @@
+/*
+ * @file lpc17xx_sim.h
+ * @brief Host-side simulated register backend for the LPC17xx driver library
+ *
+ * The simulator maps the LPC1769 peripheral address ranges (GPIO, APB0, APB1, AHB and the Cortex-M3 private
+ * peripheral bus) at their real addresses inside an x86-64 Linux process. Every page of those ranges is kept
+ * inaccessible, so each load or store from the drivers traps, is single-stepped and is then handed to a small
+ * behavioral model of the peripheral (FIFOs, status bits, write-one-to-clear flags, interrupt lines).
+ *
+ * Because the addresses are the real ones, the CMSIS headers and the driver sources compile unchanged. Programs must
+ * be linked with -no-pie so that RAM buffers handed to the GPDMA fit in 32-bit registers.
+ */
+
+#ifndef LPC17XX_SIM_H
+#define LPC17XX_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of bytes kept in each simulated UART transmit capture buffer and receive FIFO */
+#define LPC_SIM_UART_BUFFER_SIZE 4096
+
+/* Kinds of trace records */
+typedef enum
+{
+    LPC_SIM_TRACE_ISR_ENTER = 0, /* id: exception number (IRQn + 16) */
+    LPC_SIM_TRACE_ISR_EXIT,      /* id: exception number (IRQn + 16) */
+    LPC_SIM_TRACE_GPIO,          /* id: port * 32 + pin, value: new level */
+    LPC_SIM_TRACE_DAC,           /* value: new DAC output code */
+} lpc_sim_trace_kind_t;
+
+/* One trace record */
+typedef struct
+{
+    uint64_t cycles; /* Virtual time of the record, in core clock cycles */
+    uint32_t kind;   /* lpc_sim_trace_kind_t */
+    uint32_t id;
+    uint32_t value;
+} lpc_sim_trace_event_t;
+
+/* Bus access counters, useful to compare how many register accesses a driver path costs */
+typedef struct
+{
+    uint64_t reads;  /* CPU loads from peripheral registers */
+    uint64_t writes; /* CPU stores to peripheral registers */
+} lpc_sim_bus_stats_t;
+
+/**
+ * @brief Map the peripheral regions, install the trap handlers and reset every model.
+ * @note Called automatically before main(); calling it again is harmless.
+ */
+void lpc_sim_init(void);
+
+/**
+ * @brief Restore every simulated peripheral to its reset state.
+ */
+void lpc_sim_reset(void);
+
+/**
+ * @brief Get the register access counters accumulated since the last reset of the counters.
+ * @param stats Destination of the counters.
+ */
+void lpc_sim_bus_stats(lpc_sim_bus_stats_t* stats);
+
+/**
+ * @brief Clear the register access counters.
+ */
+void lpc_sim_bus_stats_clear(void);
+
+/**
+ * @brief Start counting the host instructions executed by the program, by single-stepping it.
+ * @note Interrupt handlers run by the simulator are not counted. The program runs thousands of times slower.
+ */
+void lpc_sim_insn_start(void);
+
+/**
+ * @brief Stop counting the host instructions.
+ * @return Instructions executed since lpc_sim_insn_start(), with a constant overhead of a few instructions.
+ */
+uint64_t lpc_sim_insn_stop(void);
+
+/* ----------------- Core and interrupts ----------------- */
+
+/**
+ * @brief Replacement for __enable_irq(): clear PRIMASK and run any interrupt that became pending meanwhile.
+ */
+void lpc_sim_enable_irq(void);
+
+/**
+ * @brief Replacement for __disable_irq(): set PRIMASK.
+ */
+void lpc_sim_disable_irq(void);
+
+/**
+ * @brief Replacement for __get_PRIMASK().
+ */
+uint32_t lpc_sim_get_primask(void);
+
+/**
+ * @brief Replacement for __set_PRIMASK(): a cleared PRIMASK runs any interrupt that became pending meanwhile.
+ */
+void lpc_sim_set_primask(uint32_t value);
+
+/**
+ * @brief Replacement for __WFI()/__WFE(): run pending interrupts, or jump to the next timed event when none is pending.
+ * @note With PRIMASK set, returns as soon as an interrupt is pending, without running it. When no event is scheduled
+ *       the idle hook is called. Without an idle hook the simulation has nothing left to do, so the process exits
+ *       with status 0.
+ */
+void lpc_sim_wfi(void);
+
+/**
+ * @brief Run every pending, enabled interrupt whose priority can preempt the current execution priority.
+ * @return Number of handlers executed.
+ */
+uint32_t lpc_sim_service_irqs(void);
+
+/**
+ * @brief Install the function called by lpc_sim_wfi() when no interrupt is pending and no event is scheduled.
+ * @param hook Idle hook, returns 0 when the simulation should stop. NULL restores the default behavior.
+ */
+void lpc_sim_set_idle_hook(int (*hook)(void));
+
+/**
+ * @brief Drive an interrupt line as a peripheral would.
+ * @param irq Interrupt number (only device interrupts, IRQn >= 0).
+ * @param level 1 while the peripheral requests service, 0 otherwise.
+ */
+void lpc_sim_irq_line(int32_t irq, uint32_t level);
+
+/* ----------------- Virtual time ----------------- */
+
+/*
+ * Time only advances in the simulator: every peripheral register access costs a few core cycles, __WFI() jumps to the
+ * next timed event (timer match, SysTick wrap, end of an ADC conversion, DAC counter timeout, end of a memory to
+ * memory DMA transfer) and a program that spins without touching any peripheral is considered idle, as in __WFI().
+ * An hour of firmware time that mostly waits for interrupts runs in milliseconds.
+ *
+ * The environment configures a run without recompiling: LPC_SIM_TIME_LIMIT (seconds of virtual time before the
+ * process exits with status 0), LPC_SIM_TRACE (trace file), LPC_SIM_ACCESS_CYCLES and LPC_SIM_SPIN_US.
+ */
+
+/**
+ * @brief Get the virtual time elapsed since the last reset.
+ * @return Time in core clock cycles.
+ */
+uint64_t lpc_sim_cycles(void);
+
+/**
+ * @brief Get the virtual time elapsed since the last reset.
+ * @return Time in nanoseconds, converted with the current SystemCoreClock.
+ */
+uint64_t lpc_sim_time_ns(void);
+
+/**
+ * @brief Let virtual time pass, running the events and the interrupts that fall in the interval.
+ * @param cycles Number of core clock cycles.
+ */
+void lpc_sim_advance(uint64_t cycles);
+
+/**
+ * @brief Set the cost of one CPU access to a peripheral register (4 cycles by default).
+ * @param cycles Core clock cycles charged per access.
+ */
+void lpc_sim_set_access_cycles(uint32_t cycles);
+
+/**
+ * @brief Stop the run when the virtual time reaches a limit: the trace is flushed and the process exits with status 0.
+ * @param ns Limit in nanoseconds, 0 for no limit.
+ */
+void lpc_sim_set_time_limit(uint64_t ns);
+
+/**
+ * @brief Set how long the program may spin without touching a peripheral before the simulator treats it as idle.
+ * @param host_us Host CPU time in microseconds (1000 by default), 0 disables the detection.
+ */
+void lpc_sim_set_spin_timeout(uint32_t host_us);
+
+/* ----------------- Trace ----------------- */
+
+/**
+ * @brief Record ISR entries/exits, GPIO edges and DAC output changes to a text file, one record per line:
+ *        "<time_ns> <isr_enter|isr_exit|gpio|dac> <source> <value>".
+ * @param path File to create, NULL stops the file trace.
+ * @return 0 on success, -1 if the file cannot be created.
+ */
+int lpc_sim_trace_open(const char* path);
+
+/**
+ * @brief Install a function receiving every trace record, to assert on timing in-process.
+ * @param hook Trace callback, NULL removes it.
+ */
+void lpc_sim_set_trace_hook(void (*hook)(const lpc_sim_trace_event_t* event));
+
+/* ----------------- Stimulus and observation ----------------- */
+
+/**
+ * @brief Install a function driving the inputs at chosen virtual times, such as a PWM signal on a capture pin.
+ * @param callback Called at cycle first, then at the cycle it returns, in time order with the peripheral events. It
+ *        drives the inputs with the functions below, the interrupts they raise are taken after it returns. Returning
+ *        UINT64_MAX ends the calls. NULL removes it.
+ * @param first Cycle of the first call.
+ */
+void lpc_sim_set_stimulus(uint64_t (*callback)(uint64_t cycle), uint64_t first);
+
+/**
+ * @brief Drive the level of input pins of a GPIO port.
+ * @param port Port number (0 to 4).
+ * @param mask Pins to drive.
+ * @param level New level of the pins in mask.
+ */
+void lpc_sim_gpio_drive(uint8_t port, uint32_t mask, uint32_t level);
+
+/**
+ * @brief Get the value of the output latch of a GPIO port, only for the pins configured as outputs.
+ * @param port Port number (0 to 4).
+ * @return Level of the output pins.
+ */
+uint32_t lpc_sim_gpio_output(uint8_t port);
+
+/**
+ * @brief Set the 12-bit code returned by the next conversions of an ADC channel.
+ * @param channel ADC channel (0 to 7).
+ * @param code Conversion result (0 to 4095).
+ */
+void lpc_sim_adc_set_input(uint8_t channel, uint16_t code);
+
+/**
+ * @brief Install a function that produces the conversion result of a channel, replacing the fixed inputs.
+ * @param source Callback receiving the channel number. NULL restores the fixed inputs.
+ */
+void lpc_sim_adc_set_source(uint16_t (*source)(uint8_t channel));
+
+/**
+ * @brief Push received bytes into the receive FIFO of a UART.
+ * @param uart UART number (0 to 3).
+ * @param data Bytes to receive.
+ * @param len Number of bytes.
+ * @return Number of bytes accepted.
+ */
+uint32_t lpc_sim_uart_rx_push(uint8_t uart, const uint8_t* data, uint32_t len);
+
+/**
+ * @brief Take the bytes transmitted by a UART since the last call.
+ * @param uart UART number (0 to 3).
+ * @param data Destination buffer.
+ * @param max Size of the destination buffer.
+ * @return Number of bytes copied.
+ */
+uint32_t lpc_sim_uart_tx_pop(uint8_t uart, uint8_t* data, uint32_t max);
+
+/**
+ * @brief Install the device answering on the MISO line of an SSP port. Without responder the port loops back.
+ * @param ssp SSP number (0 or 1).
+ * @param responder Callback receiving each transmitted frame and returning the received frame.
+ */
+void lpc_sim_ssp_set_responder(uint8_t ssp, uint16_t (*responder)(uint16_t mosi));
+
+/**
+ * @brief Get the 10-bit value currently presented on the DAC output.
+ * @return DAC output code (0 to 1023).
+ */
+uint16_t lpc_sim_dac_output(void);
+
+/**
+ * @brief Assert a GPDMA peripheral request line, as the peripheral would when it needs service.
+ * @param request Request number (0 to 15), see GPDMA_CONN_* in lpc17xx_gpdma.h.
+ */
+void lpc_sim_dma_request(uint8_t request);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LPC17XX_SIM_H */
@@ -0,0 +1,226 @@
+/*
+ * @file sim_adc.c
+ * @brief 12-bit ADC model in virtual time
+ *
+ * A conversion takes 65 ADC clocks (PCLK_ADC / (CLKDIV + 1)). It is started by software (START = 001), by an edge of
+ * EINT0 or of a timer match output (START = 010 to 111, EDGE selects the edge), or runs continuously over the selected
+ * channels in BURST mode. Results, DONE and OVERRUN flags, ADSTAT, the ADINTEN interrupt and the GPDMA request
+ * (line 4) follow the user manual, including the read-to-clear behavior of ADGDR and ADDRn.
+ */
+
+#include <stddef.h>
+
+#include "lpc17xx_clkpwr.h"
+#include "sim_internal.h"
+
+#define ADC_OFS(reg)        offsetof(LPC_ADC_TypeDef, reg)
+#define ADC_CHANNELS        8U
+#define ADC_DMA_REQUEST     4U
+#define ADC_CLOCKS_PER_CONV 65U
+
+#define CR_SEL_MASK    0xFFUL
+#define CR_CLKDIV(cr)  (((cr) >> 8) & 0xFFU)
+#define CR_BURST       (1UL << 16)
+#define CR_PDN         (1UL << 21)
+#define CR_START_SHIFT 24
+#define CR_START_MASK  (7UL << CR_START_SHIFT)
+#define CR_START_NOW   (1UL << CR_START_SHIFT)
+#define CR_EDGE        (1UL << 27)
+#define DR_RESULT(c)   (((uint32_t)(c) & 0xFFFU) << 4)
+#define DR_CHN(ch)     ((uint32_t)(ch) << 24)
+#define DR_OVERRUN     (1UL << 30)
+#define DR_DONE        (1UL << 31)
+#define INTEN_GLOBAL   (1UL << 8)
+#define STAT_ADINT     (1UL << 16)
+
+static uint16_t inputs[ADC_CHANNELS];
+static uint16_t (*source)(uint8_t channel);
+static uint32_t converting = 0;
+static uint32_t converting_channel = 0;
+static uint64_t conversion_end = SIM_NEVER;
+
+static LPC_ADC_TypeDef* adc(void)
+{
+    return SIM_REGS(LPC_ADC_TypeDef, LPC_ADC_BASE);
+}
+
+static volatile uint32_t* data_register(uint32_t channel)
+{
+    return (volatile uint32_t*)&adc()->ADDR0 + channel;
+}
+
+static void update(void)
+{
+    LPC_ADC_TypeDef* regs = adc();
+    uint32_t stat = 0;
+    uint32_t interrupt;
+
+    for (uint32_t channel = 0; channel < ADC_CHANNELS; channel++)
+    {
+        uint32_t dr = *data_register(channel);
+        stat |= ((dr & DR_DONE) ? 1UL << channel : 0) | ((dr & DR_OVERRUN) ? 1UL << (channel + 8) : 0);
+    }
+
+    interrupt = (stat & regs->ADINTEN & CR_SEL_MASK) || ((regs->ADINTEN & INTEN_GLOBAL) && (regs->ADGDR & DR_DONE));
+    *(volatile uint32_t*)&regs->ADSTAT = stat | (interrupt ? STAT_ADINT : 0);
+    lpc_sim_irq_line(ADC_IRQn, interrupt);
+}
+
+static void store_result(uint32_t channel)
+{
+    LPC_ADC_TypeDef* regs = adc();
+    uint16_t code = (source != NULL) ? source((uint8_t)channel) : inputs[channel];
+    volatile uint32_t* dr = data_register(channel);
+    uint32_t overrun = (*dr & DR_DONE) ? DR_OVERRUN : 0;
+
+    *dr = DR_DONE | overrun | DR_RESULT(code);
+    regs->ADGDR = DR_DONE | ((regs->ADGDR & DR_DONE) ? DR_OVERRUN : 0) | DR_CHN(channel) | DR_RESULT(code);
+    update();
+
+    if (regs->ADINTEN & (1UL << channel))
+    {
+        sim_gpdma_request(ADC_DMA_REQUEST);
+    }
+}
+
+static uint64_t conversion_cycles(void)
+{
+    uint64_t adc_clock_div = (CR_CLKDIV(adc()->ADCR) + 1ULL) * sim_pclk_divider(CLKPWR_PCLKSEL_ADC);
+    return ADC_CLOCKS_PER_CONV * adc_clock_div;
+}
+
+/* Next selected channel after the given one, in the ascending order of the burst scan */
+static uint32_t next_channel(uint32_t after)
+{
+    uint32_t select = adc()->ADCR & CR_SEL_MASK;
+
+    for (uint32_t step = 1; step <= ADC_CHANNELS; step++)
+    {
+        uint32_t channel = (after + step) % ADC_CHANNELS;
+        if (select & (1UL << channel))
+        {
+            return channel;
+        }
+    }
+    return ADC_CHANNELS;
+}
+
+static void start_conversion(uint32_t channel)
+{
+    if (channel >= ADC_CHANNELS)
+    {
+        return;
+    }
+    converting = 1;
+    converting_channel = channel;
+    conversion_end = sim_now() + conversion_cycles();
+}
+
+void sim_adc_start_edge(uint32_t start, uint32_t level)
+{
+    uint32_t cr = adc()->ADCR;
+    uint32_t wanted = (cr & CR_EDGE) ? 0 : 1;
+
+    if ((cr & CR_PDN) && !(cr & CR_BURST) && ((cr & CR_START_MASK) >> CR_START_SHIFT) == start && level == wanted)
+    {
+        start_conversion(next_channel(ADC_CHANNELS - 1));
+    }
+}
+
+static uint64_t adc_next(uint64_t now)
+{
+    (void)now;
+    return converting ? conversion_end : SIM_NEVER;
+}
+
+static void adc_fire(uint64_t now)
+{
+    uint32_t cr = adc()->ADCR;
+
+    (void)now;
+    converting = 0;
+    store_result(converting_channel);
+
+    if ((cr & CR_BURST) && (cr & CR_PDN))
+    {
+        start_conversion(next_channel(converting_channel));
+    }
+}
+
+static void adc_read_done(const sim_model_t* model, uint32_t offset)
+{
+    LPC_ADC_TypeDef* regs = adc();
+
+    (void)model;
+
+    if (offset == ADC_OFS(ADGDR))
+    {
+        regs->ADGDR &= ~(DR_DONE | DR_OVERRUN);
+    }
+    else if (offset >= ADC_OFS(ADDR0) && offset <= ADC_OFS(ADDR7))
+    {
+        *data_register((offset - ADC_OFS(ADDR0)) / 4) &= ~(DR_DONE | DR_OVERRUN);
+    }
+    else
+    {
+        return;
+    }
+    update();
+}
+
+static void adc_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)model;
+
+    if (offset == ADC_OFS(ADCR))
+    {
+        if (!(value & CR_PDN))
+        {
+            converting = 0; /* Power down aborts the conversion in progress */
+        }
+        else if ((value & CR_START_MASK) == CR_START_NOW && (old & CR_START_MASK) != CR_START_NOW)
+        {
+            start_conversion(next_channel(ADC_CHANNELS - 1));
+        }
+        else if ((value & CR_BURST) && !(old & CR_BURST) && !converting)
+        {
+            start_conversion(next_channel(ADC_CHANNELS - 1));
+        }
+    }
+    else if (offset == ADC_OFS(ADINTEN))
+    {
+        update();
+    }
+    else if (offset != ADC_OFS(ADTRM))
+    {
+        /* Result and status registers are read-only */
+        *(volatile uint32_t*)sim_shadow(LPC_ADC_BASE + offset) = old;
+    }
+}
+
+static void adc_reset(const sim_model_t* model)
+{
+    (void)model;
+
+    converting = 0;
+    conversion_end = SIM_NEVER;
+    adc()->ADINTEN = INTEN_GLOBAL;
+    update();
+}
+
+void lpc_sim_adc_set_input(uint8_t channel, uint16_t code)
+{
+    if (channel < ADC_CHANNELS)
+    {
+        inputs[channel] = code & 0xFFFU;
+    }
+}
+
+void lpc_sim_adc_set_source(uint16_t (*callback)(uint8_t channel))
+{
+    source = callback;
+}
+
+const sim_model_t sim_adc_model = {"ADC", LPC_ADC_BASE, SIM_PAGE_SIZE, 0, adc_reset, NULL, adc_read_done, adc_write};
+
+const sim_event_source_t sim_adc_events = {adc_next, adc_fire};
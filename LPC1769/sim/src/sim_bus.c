@@ -0,0 +1,503 @@
+/*
+ * @file sim_bus.c
+ * @brief Simulated peripheral bus: address space mapping and trap-and-emulate engine
+ *
+ * Each peripheral region is backed by a memfd mapped twice: once at the real LPC1769 address with no access rights
+ * (the view the drivers use) and once anywhere with read/write rights (the shadow view the models use).
+ *
+ * A driver access to the real address raises SIGSEGV. The handler lets the model prepare the word, grants access to
+ * the page and returns with the x86 trap flag set, so the faulting instruction executes exactly once and SIGTRAP
+ * follows. The SIGTRAP handler revokes the access again and reports the completed load or store to the model.
+ * Each access also charges its cost to the virtual clock, which runs the timed events that fall due meanwhile.
+ *
+ * The two bit-band alias windows of the Cortex-M3 (SRAM and peripherals) are reserved the same way. A load from an
+ * alias word reads the target word through the bus and returns the bit; a store does the read-modify-write of the
+ * target word on the bus, as the core does.
+ *
+ * lpc_sim_insn_start() sets the trap flag in the program itself: every host instruction then raises SIGTRAP, which the
+ * step handler counts until lpc_sim_insn_stop(). A register access met meanwhile keeps the flag set when it completes.
+ */
+
+#define _GNU_SOURCE
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "sim_internal.h"
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "The LPC17xx simulator relies on x86-64 Linux signal frames"
+#endif
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+#define X86_EFLAGS_TF     0x100UL /* Trap flag, single-step after the next instruction */
+#define X86_PF_WRITE      0x2UL   /* Page fault error code: the access was a write */
+#define CM3_PPB_BASE      LPC_CM3_BASE
+#define SIM_REGION_COUNT  (sizeof(regions) / sizeof(regions[0]))
+#define SIM_MAX_PAGES     128U
+#define BITBAND_SIZE      0x02000000U /* 1 MiB bit-band region, 32 alias bytes per byte */
+#define BITBAND_COUNT     (sizeof(bitband_aliases) / sizeof(bitband_aliases[0]))
+
+typedef struct
+{
+    uint32_t base;
+    uint32_t size;
+    uint8_t* shadow;
+    const sim_model_t* pages[SIM_MAX_PAGES];
+} sim_region_t;
+
+typedef struct
+{
+    uint32_t active;
+    uint32_t addr; /* Word aligned address of the access */
+    uint32_t write;
+    uint32_t old;
+    uint32_t traced; /* The program was counting instructions: the access keeps the trap flag */
+    uint32_t alias;  /* Bit-band alias access: target word and bit */
+    uint32_t target;
+    uint32_t bit;
+    const sim_model_t* model;
+    sim_region_t* region;
+} sim_access_t;
+
+/* Plain memory for every page without a dedicated model: no side effects, accesses are still counted */
+static const sim_model_t sim_plain_model = {"plain", 0, 0, 0, NULL, NULL, NULL, NULL};
+
+static sim_region_t regions[] = {
+    {LPC_GPIO_BASE, 0x00004000, NULL, {NULL}}, /* Fast GPIO on the AHB */
+    {LPC_APB0_BASE, 0x00080000, NULL, {NULL}}, /* APB0 peripherals */
+    {LPC_APB1_BASE, 0x00080000, NULL, {NULL}}, /* APB1 peripherals */
+    {LPC_AHB_BASE, 0x00010000, NULL, {NULL}},  /* Ethernet, GPDMA and USB */
+    {CM3_PPB_BASE, 0x00010000, NULL, {NULL}},  /* ITM, DWT, FPB and the System Control Space */
+};
+
+static const sim_model_t* const models[] = {
+    &sim_core_model,
+    &sim_dwt_model,
+    &sim_sc_model,
+    &sim_gpio_model,
+    &sim_gpioint_model,
+    &sim_timer_models[0],
+    &sim_timer_models[1],
+    &sim_timer_models[2],
+    &sim_timer_models[3],
+    &sim_pwm_model,
+    &sim_uart_models[0],
+    &sim_uart_models[1],
+    &sim_uart_models[2],
+    &sim_uart_models[3],
+    &sim_ssp_models[0],
+    &sim_ssp_models[1],
+    &sim_adc_model,
+    &sim_dac_model,
+    &sim_gpdma_model,
+};
+
+/* Alias windows of the SRAM (0x20000000) and peripheral (0x40000000) bit-band regions */
+static const uint32_t bitband_aliases[] = {0x22000000U, 0x42000000U};
+
+static sim_access_t pending;
+static lpc_sim_bus_stats_t stats;
+static volatile uint32_t insn_counting;
+static volatile uint64_t insn_count;
+static uint32_t initialized = 0;
+
+static sim_region_t* find_region(uint32_t addr)
+{
+    for (uint32_t i = 0; i < SIM_REGION_COUNT; i++)
+    {
+        if (addr - regions[i].base < regions[i].size)
+        {
+            return &regions[i];
+        }
+    }
+    return NULL;
+}
+
+static const sim_model_t* find_model(const sim_region_t* region, uint32_t addr)
+{
+    return region->pages[(addr - region->base) / SIM_PAGE_SIZE];
+}
+
+static void* page_of(uint32_t addr)
+{
+    return (void*)(uintptr_t)(addr & ~(SIM_PAGE_SIZE - 1));
+}
+
+static void fatal(const char* message)
+{
+    fprintf(stderr, "lpc_sim: %s\n", message);
+    abort();
+}
+
+void* sim_shadow(uint32_t addr)
+{
+    sim_region_t* region = find_region(addr);
+
+    if (region == NULL)
+    {
+        fatal("shadow access outside the simulated peripherals");
+    }
+    return region->shadow + (addr - region->base);
+}
+
+static uint32_t is_bitband_alias(uintptr_t addr)
+{
+    for (uint32_t i = 0; i < BITBAND_COUNT; i++)
+    {
+        if (addr - bitband_aliases[i] < BITBAND_SIZE)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Alias word: the target bit is published before a load, a store is applied to the target in on_step() */
+static void on_bitband_fault(ucontext_t* uc, uint32_t alias)
+{
+    uint32_t offset = alias & (BITBAND_SIZE - 1);
+
+    SIM_ENTER();
+    sim_time_access();
+
+    pending.active = 1;
+    pending.traced = (uc->uc_mcontext.gregs[REG_EFL] & X86_EFLAGS_TF) != 0;
+    pending.alias = 1;
+    pending.addr = alias & ~3U;
+    pending.target = (alias & 0xF0000000U) + ((offset >> 7) << 2);
+    pending.bit = (offset >> 2) & 31U;
+    pending.write = (uc->uc_mcontext.gregs[REG_ERR] & X86_PF_WRITE) != 0;
+
+    mprotect(page_of(pending.addr), SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    if (pending.write)
+    {
+        stats.writes++;
+        *(uint32_t*)(uintptr_t)pending.addr = 0;
+    }
+    else
+    {
+        stats.reads++;
+        *(uint32_t*)(uintptr_t)pending.addr = (sim_bus_read(pending.target, 4) >> pending.bit) & 1U;
+    }
+    uc->uc_mcontext.gregs[REG_EFL] |= X86_EFLAGS_TF;
+}
+
+static void on_bitband_step(const sim_access_t* access)
+{
+    uint32_t value = *(uint32_t*)(uintptr_t)access->addr;
+
+    mprotect(page_of(access->addr), SIM_PAGE_SIZE, PROT_NONE);
+    if (access->write)
+    {
+        uint32_t word = sim_bus_read(access->target, 4) & ~(1UL << access->bit);
+        sim_bus_write(access->target, 4, word | ((value & 1U) << access->bit));
+    }
+}
+
+static void on_fault(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    uintptr_t fault = (uintptr_t)info->si_addr;
+    sim_region_t* region = (fault >> 32) ? NULL : find_region((uint32_t)fault);
+
+    (void)sig;
+
+    if (region == NULL && !pending.active && is_bitband_alias(fault))
+    {
+        on_bitband_fault(uc, (uint32_t)fault);
+        return;
+    }
+    if (region == NULL || pending.active)
+    {
+        /* A genuine crash: let it happen with the default disposition */
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    SIM_ENTER();
+    sim_time_access();
+
+    pending.active = 1;
+    pending.traced = (uc->uc_mcontext.gregs[REG_EFL] & X86_EFLAGS_TF) != 0;
+    pending.alias = 0;
+    pending.addr = (uint32_t)fault & ~3U;
+    pending.write = (uc->uc_mcontext.gregs[REG_ERR] & X86_PF_WRITE) != 0;
+    pending.model = find_model(region, pending.addr);
+    pending.region = region;
+    pending.old = *(uint32_t*)(region->shadow + (pending.addr - region->base));
+
+    if (pending.write)
+    {
+        stats.writes++;
+    }
+    else
+    {
+        stats.reads++;
+        if (pending.model->read != NULL)
+        {
+            pending.model->read(pending.model, pending.addr - pending.model->base);
+        }
+    }
+
+    mprotect(page_of(pending.addr), SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    uc->uc_mcontext.gregs[REG_EFL] |= X86_EFLAGS_TF;
+}
+
+static void on_step(int sig, siginfo_t* info, void* context)
+{
+    ucontext_t* uc = (ucontext_t*)context;
+    sim_access_t access = pending;
+
+    (void)info;
+
+    if (!access.active && insn_counting)
+    {
+        /* One more instruction of the program, the trap flag stays set */
+        insn_count++;
+        return;
+    }
+    if (!access.active)
+    {
+        /* Not a simulator single-step (breakpoint, debugger): default disposition */
+        signal(sig, SIG_DFL);
+        raise(sig);
+        return;
+    }
+
+    pending.active = 0;
+    if (access.traced)
+    {
+        insn_count++;
+    }
+    else
+    {
+        uc->uc_mcontext.gregs[REG_EFL] &= ~X86_EFLAGS_TF;
+    }
+    if (access.alias)
+    {
+        on_bitband_step(&access);
+        SIM_LEAVE();
+        sim_irq_check();
+        return;
+    }
+    mprotect(page_of(access.addr), SIM_PAGE_SIZE, PROT_NONE);
+
+    uint32_t offset = access.addr - access.model->base;
+    if (access.write)
+    {
+        if (access.model->write != NULL)
+        {
+            uint32_t value = *(uint32_t*)(access.region->shadow + (access.addr - access.region->base));
+            access.model->write(access.model, offset, access.old, value);
+        }
+    }
+    else if (access.model->read_done != NULL)
+    {
+        access.model->read_done(access.model, offset);
+    }
+    SIM_LEAVE();
+
+    /* The access may have raised or unmasked an interrupt: take it now, as the core would */
+    sim_irq_check();
+}
+
+uint32_t sim_bus_read(uint32_t addr, uint32_t width)
+{
+    sim_region_t* region = find_region(addr);
+    uint32_t shift = (addr & 3U) * 8;
+    uint32_t value;
+
+    if (region == NULL)
+    {
+        const void* ram = (const void*)(uintptr_t)addr;
+        return (width == 1) ? *(const uint8_t*)ram : (width == 2) ? *(const uint16_t*)ram : *(const uint32_t*)ram;
+    }
+
+    const sim_model_t* model = find_model(region, addr & ~3U);
+    uint32_t offset = (addr & ~3U) - model->base;
+    if (model->read != NULL)
+    {
+        model->read(model, offset);
+    }
+    value = *(uint32_t*)(region->shadow + ((addr & ~3U) - region->base)) >> shift;
+    if (model->read_done != NULL)
+    {
+        model->read_done(model, offset);
+    }
+
+    return (width == 1) ? (value & 0xFFU) : (width == 2) ? (value & 0xFFFFU) : value;
+}
+
+void sim_bus_write(uint32_t addr, uint32_t width, uint32_t value)
+{
+    sim_region_t* region = find_region(addr);
+
+    if (region == NULL)
+    {
+        void* ram = (void*)(uintptr_t)addr;
+        if (width == 1)
+        {
+            *(uint8_t*)ram = (uint8_t)value;
+        }
+        else if (width == 2)
+        {
+            *(uint16_t*)ram = (uint16_t)value;
+        }
+        else
+        {
+            *(uint32_t*)ram = value;
+        }
+        return;
+    }
+
+    uint32_t* word = (uint32_t*)(region->shadow + ((addr & ~3U) - region->base));
+    uint32_t shift = (addr & 3U) * 8;
+    uint32_t mask = (width == 1) ? 0xFFU : (width == 2) ? 0xFFFFU : 0xFFFFFFFFU;
+    uint32_t old = *word;
+    const sim_model_t* model = find_model(region, addr & ~3U);
+
+    *word = (old & ~(mask << shift)) | ((value & mask) << shift);
+    if (model->write != NULL)
+    {
+        model->write(model, (addr & ~3U) - model->base, old, *word);
+    }
+}
+
+static void map_region(sim_region_t* region)
+{
+    int fd = memfd_create("lpc_sim", MFD_CLOEXEC);
+
+    if (fd < 0 || ftruncate(fd, region->size) != 0)
+    {
+        fatal("cannot allocate the register file");
+    }
+
+    void* bus = mmap((void*)(uintptr_t)region->base,
+                     region->size,
+                     PROT_NONE,
+                     MAP_SHARED | MAP_FIXED_NOREPLACE,
+                     fd,
+                     0);
+    if (bus != (void*)(uintptr_t)region->base)
+    {
+        fatal("cannot map a peripheral region at its LPC1769 address (is the program linked with -no-pie?)");
+    }
+
+    region->shadow = mmap(NULL, region->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (region->shadow == MAP_FAILED)
+    {
+        fatal("cannot map the shadow register file");
+    }
+    close(fd);
+
+    for (uint32_t page = 0; page < region->size / SIM_PAGE_SIZE; page++)
+    {
+        region->pages[page] = &sim_plain_model;
+    }
+}
+
+void lpc_sim_reset(void)
+{
+    for (uint32_t i = 0; i < SIM_REGION_COUNT; i++)
+    {
+        memset(regions[i].shadow, 0, regions[i].size);
+    }
+
+    sim_time_reset();
+    sim_nvic_reset();
+    for (uint32_t i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+    {
+        if (models[i]->reset != NULL)
+        {
+            models[i]->reset(models[i]);
+        }
+    }
+    lpc_sim_bus_stats_clear();
+}
+
+__attribute__((constructor)) void lpc_sim_init(void)
+{
+    struct sigaction action;
+
+    if (initialized)
+    {
+        return;
+    }
+    if (sysconf(_SC_PAGESIZE) != SIM_PAGE_SIZE)
+    {
+        fatal("unsupported host page size");
+    }
+
+    for (uint32_t i = 0; i < SIM_REGION_COUNT; i++)
+    {
+        map_region(&regions[i]);
+    }
+    for (uint32_t i = 0; i < BITBAND_COUNT; i++)
+    {
+        void* alias = mmap((void*)(uintptr_t)bitband_aliases[i],
+                           BITBAND_SIZE,
+                           PROT_NONE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED_NOREPLACE,
+                           -1,
+                           0);
+        if (alias != (void*)(uintptr_t)bitband_aliases[i])
+        {
+            fatal("cannot reserve a bit-band alias window");
+        }
+    }
+
+    for (uint32_t i = 0; i < sizeof(models) / sizeof(models[0]); i++)
+    {
+        sim_region_t* region = find_region(models[i]->base);
+        for (uint32_t addr = models[i]->base; addr - models[i]->base < models[i]->size; addr += SIM_PAGE_SIZE)
+        {
+            region->pages[(addr - region->base) / SIM_PAGE_SIZE] = models[i];
+        }
+    }
+
+    /* Handlers must nest: interrupt handlers run from on_step() and access peripherals themselves */
+    memset(&action, 0, sizeof(action));
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    action.sa_sigaction = on_fault;
+    sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = on_step;
+    sigaction(SIGTRAP, &action, NULL);
+
+    initialized = 1;
+    lpc_sim_reset();
+    sim_time_init();
+}
+
+void lpc_sim_bus_stats(lpc_sim_bus_stats_t* out)
+{
+    *out = stats;
+}
+
+void lpc_sim_bus_stats_clear(void)
+{
+    stats.reads = 0;
+    stats.writes = 0;
+}
+
+void lpc_sim_insn_start(void)
+{
+    insn_count = 0;
+    insn_counting = 1;
+    __asm__ volatile("pushfq\n\torq %0, (%%rsp)\n\tpopfq" : : "i"(X86_EFLAGS_TF) : "memory", "cc");
+}
+
+uint64_t lpc_sim_insn_stop(void)
+{
+    __asm__ volatile("pushfq\n\tandq %0, (%%rsp)\n\tpopfq" : : "i"(~X86_EFLAGS_TF) : "memory", "cc");
+    insn_counting = 0;
+    return insn_count;
+}
@@ -0,0 +1,116 @@
+/*
+ * @file sim_dac.c
+ * @brief 10-bit DAC model in virtual time
+ *
+ * The output follows the VALUE field of DACR. When the DMA counter runs (CNT_ENA), it times out every DACCNTVAL
+ * PCLK_DAC periods: the timeout sets INT_DMA_REQ, loads the double buffer into the output (DBLBUF_ENA) and asserts
+ * the GPDMA request (DMA_ENA, line 7).
+ */
+
+#include <stddef.h>
+
+#include "lpc17xx_clkpwr.h"
+#include "sim_internal.h"
+
+#define DAC_OFS(reg)     offsetof(LPC_DAC_TypeDef, reg)
+#define DAC_DMA_REQUEST  7U
+#define DACR_VALUE(reg)  (((reg) >> 6) & 0x3FFU)
+#define CTRL_INT_DMA_REQ (1UL << 0)
+#define CTRL_DBLBUF_ENA  (1UL << 1)
+#define CTRL_CNT_ENA     (1UL << 2)
+#define CTRL_DMA_ENA     (1UL << 3)
+
+static uint16_t output;
+static uint16_t buffered;
+static uint64_t timeout = SIM_NEVER;
+
+static LPC_DAC_TypeDef* dac(void)
+{
+    return SIM_REGS(LPC_DAC_TypeDef, LPC_DAC_BASE);
+}
+
+static void set_output(uint16_t value)
+{
+    if (value != output)
+    {
+        output = value;
+        sim_trace(LPC_SIM_TRACE_DAC, 0, value);
+    }
+}
+
+static uint64_t timeout_cycles(void)
+{
+    uint64_t count = dac()->DACCNTVAL;
+    return ((count != 0) ? count : 1U) * sim_pclk_divider(CLKPWR_PCLKSEL_DAC);
+}
+
+static uint64_t dac_next(uint64_t now)
+{
+    (void)now;
+    return timeout;
+}
+
+static void dac_fire(uint64_t now)
+{
+    LPC_DAC_TypeDef* regs = dac();
+
+    regs->DACCTRL |= CTRL_INT_DMA_REQ;
+    if (regs->DACCTRL & CTRL_DBLBUF_ENA)
+    {
+        set_output(buffered);
+    }
+    timeout = now + timeout_cycles();
+    if (regs->DACCTRL & CTRL_DMA_ENA)
+    {
+        sim_gpdma_request(DAC_DMA_REQUEST);
+    }
+}
+
+static void dac_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    LPC_DAC_TypeDef* regs = dac();
+
+    (void)model;
+
+    if (offset == DAC_OFS(DACR))
+    {
+        regs->DACCTRL &= ~CTRL_INT_DMA_REQ;
+        if ((regs->DACCTRL & (CTRL_DBLBUF_ENA | CTRL_CNT_ENA)) == (CTRL_DBLBUF_ENA | CTRL_CNT_ENA))
+        {
+            buffered = (uint16_t)DACR_VALUE(value);
+        }
+        else
+        {
+            set_output((uint16_t)DACR_VALUE(value));
+        }
+    }
+    else if (offset == DAC_OFS(DACCTRL))
+    {
+        if ((value & CTRL_CNT_ENA) && !(old & CTRL_CNT_ENA))
+        {
+            timeout = sim_now() + timeout_cycles();
+        }
+        else if (!(value & CTRL_CNT_ENA))
+        {
+            timeout = SIM_NEVER;
+        }
+    }
+}
+
+static void dac_reset(const sim_model_t* model)
+{
+    (void)model;
+
+    output = 0;
+    buffered = 0;
+    timeout = SIM_NEVER;
+}
+
+uint16_t lpc_sim_dac_output(void)
+{
+    return output;
+}
+
+const sim_model_t sim_dac_model = {"DAC", LPC_DAC_BASE, SIM_PAGE_SIZE, 0, dac_reset, NULL, NULL, dac_write};
+
+const sim_event_source_t sim_dac_events = {dac_next, dac_fire};
@@ -0,0 +1,87 @@
+/*
+ * @file sim_dwt.c
+ * @brief DWT cycle counter model
+ *
+ * CYCCNT counts core cycles of the virtual time while CYCCNTENA and the TRCENA bit of DEMCR are both set, and wraps at
+ * 32 bits as on the device. The other counters and the comparators are plain registers.
+ */
+
+#include <stddef.h>
+
+#include "sim_internal.h"
+
+#define DWT_OFS(reg)   offsetof(DWT_Type, reg)
+#define DWT_CTRL_RESET (4UL << DWT_CTRL_NUMCOMP_Pos) /* Four comparators, every counter implemented */
+
+static uint32_t counting = 0;
+static uint32_t count = 0;  /* CYCCNT at cycle sync */
+static uint64_t sync = 0;
+
+static DWT_Type* dwt(void)
+{
+    return SIM_REGS(DWT_Type, DWT_BASE);
+}
+
+static uint32_t enabled(void)
+{
+    return (dwt()->CTRL & DWT_CTRL_CYCCNTENA_Msk) &&
+           (SIM_REGS(CoreDebug_Type, CoreDebug_BASE)->DEMCR & CoreDebug_DEMCR_TRCENA_Msk);
+}
+
+static uint32_t cycle_count(void)
+{
+    return counting ? count + (uint32_t)(sim_now() - sync) : count;
+}
+
+static void dwt_read(const sim_model_t* model, uint32_t offset)
+{
+    (void)model;
+
+    if (offset == DWT_OFS(CYCCNT))
+    {
+        dwt()->CYCCNT = cycle_count();
+    }
+}
+
+static void dwt_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)model;
+    (void)old;
+
+    if (offset == DWT_OFS(CYCCNT))
+    {
+        count = value;
+    }
+    else if (offset == DWT_OFS(CTRL))
+    {
+        count = cycle_count();
+        /* NUMCOMP and the NOxxx feature bits are read-only */
+        dwt()->CTRL = (value & ~(0x1FUL << DWT_CTRL_NOPRFCNT_Pos)) | DWT_CTRL_RESET;
+    }
+    else
+    {
+        return;
+    }
+    sync = sim_now();
+    counting = enabled();
+}
+
+/* DEMCR belongs to the SCS page: the core model reports TRCENA changes here */
+void sim_dwt_trace_enable(void)
+{
+    count = cycle_count();
+    sync = sim_now();
+    counting = enabled();
+}
+
+static void dwt_reset(const sim_model_t* model)
+{
+    (void)model;
+
+    counting = 0;
+    count = 0;
+    sync = 0;
+    dwt()->CTRL = DWT_CTRL_RESET;
+}
+
+const sim_model_t sim_dwt_model = {"DWT", DWT_BASE, SIM_PAGE_SIZE, 0, dwt_reset, dwt_read, NULL, dwt_write};
@@ -0,0 +1,295 @@
+/*
+ * @file sim_gpdma.c
+ * @brief GPDMA model: 8 channels, memory/peripheral flow control, linked lists and terminal count interrupts
+ *
+ * Memory-to-memory channels move each linked list item in one go, at the virtual time the AHB master would need for
+ * it (GPDMA_ITEM_CYCLES per item). Peripheral channels move one burst each time their request line is asserted; a request stays pending until a channel serves it, like the level requests of
+ * the device. Source and destination are read and written through the simulated bus, so DMA accesses to peripheral
+ * registers have the same side effects as CPU accesses. Each item is read with the source width and written with the
+ * destination width, without the packing of the real AHB master.
+ */
+
+#include <stddef.h>
+
+#include "sim_internal.h"
+
+#define GPDMA_OFS(reg)    offsetof(LPC_GPDMA_TypeDef, reg)
+#define GPDMA_CHANNELS    8U
+#define GPDMA_LINES       16U
+#define GPDMA_ITEM_CYCLES 2U
+#define CH_FIRST_OFFSET   (LPC_GPDMACH0_BASE - LPC_GPDMA_BASE)
+#define CH_SIZE           0x20U
+#define CH_OFS(reg)       offsetof(LPC_GPDMACH_TypeDef, reg)
+
+#define CONFIG_E          (1UL << 0)
+#define CTRL_SIZE_MASK    0xFFFUL
+#define CTRL_SBSIZE(c)    (((c) >> 12) & 7U)
+#define CTRL_DBSIZE(c)    (((c) >> 15) & 7U)
+#define CTRL_SWIDTH(c)    (((c) >> 18) & 7U)
+#define CTRL_DWIDTH(c)    (((c) >> 21) & 7U)
+#define CTRL_SI           (1UL << 26)
+#define CTRL_DI           (1UL << 27)
+#define CTRL_I            (1UL << 31)
+#define CCFG_E            (1UL << 0)
+#define CCFG_SRC_PER(c)   (((c) >> 1) & 0x1FU)
+#define CCFG_DST_PER(c)   (((c) >> 6) & 0x1FU)
+#define CCFG_TYPE(c)      (((c) >> 11) & 7U)
+#define CCFG_IE           (1UL << 14)
+#define CCFG_ITC          (1UL << 15)
+#define CCFG_H            (1UL << 18)
+
+enum
+{
+    FLOW_M2M = 0,
+    FLOW_M2P = 1,
+    FLOW_P2M = 2,
+    FLOW_P2P = 3,
+};
+
+static uint32_t requests; /* Pending request lines */
+static uint32_t raw_tc;
+static uint32_t raw_err;
+static uint32_t servicing;
+static uint64_t m2m_end[GPDMA_CHANNELS]; /* End of the memory-to-memory item in progress */
+
+static LPC_GPDMA_TypeDef* gpdma(void)
+{
+    return SIM_REGS(LPC_GPDMA_TypeDef, LPC_GPDMA_BASE);
+}
+
+static LPC_GPDMACH_TypeDef* channel(uint32_t ch)
+{
+    return SIM_REGS(LPC_GPDMACH_TypeDef, LPC_GPDMACH0_BASE + ch * CH_SIZE);
+}
+
+static void publish(void)
+{
+    LPC_GPDMA_TypeDef* regs = gpdma();
+    uint32_t tc_mask = 0;
+    uint32_t err_mask = 0;
+    uint32_t enabled = 0;
+
+    for (uint32_t ch = 0; ch < GPDMA_CHANNELS; ch++)
+    {
+        uint32_t config = channel(ch)->DMACCConfig;
+        tc_mask |= (config & CCFG_ITC) ? 1UL << ch : 0;
+        err_mask |= (config & CCFG_IE) ? 1UL << ch : 0;
+        enabled |= (config & CCFG_E) ? 1UL << ch : 0;
+    }
+
+    *(volatile uint32_t*)&regs->DMACRawIntTCStat = raw_tc;
+    *(volatile uint32_t*)&regs->DMACRawIntErrStat = raw_err;
+    *(volatile uint32_t*)&regs->DMACIntTCStat = raw_tc & tc_mask;
+    *(volatile uint32_t*)&regs->DMACIntErrStat = raw_err & err_mask;
+    *(volatile uint32_t*)&regs->DMACIntStat = (raw_tc & tc_mask) | (raw_err & err_mask);
+    *(volatile uint32_t*)&regs->DMACEnbldChns = enabled;
+    regs->DMACSoftBReq = requests;
+    regs->DMACSoftSReq = requests;
+
+    lpc_sim_irq_line(DMA_IRQn, regs->DMACIntStat != 0);
+}
+
+static uint32_t burst_items(uint32_t code)
+{
+    return (code == 0) ? 1U : (2U << code); /* 1, 4, 8, 16, 32, 64, 128, 256 */
+}
+
+/* End of the current descriptor: raise the terminal count, then follow the linked list or stop the channel */
+static void terminal_count(uint32_t ch)
+{
+    LPC_GPDMACH_TypeDef* regs = channel(ch);
+
+    if (regs->DMACCControl & CTRL_I)
+    {
+        raw_tc |= 1UL << ch;
+    }
+
+    if (regs->DMACCLLI != 0)
+    {
+        const volatile uint32_t* lli = (const volatile uint32_t*)(uintptr_t)(regs->DMACCLLI & ~3U);
+        regs->DMACCSrcAddr = lli[0];
+        regs->DMACCDestAddr = lli[1];
+        regs->DMACCLLI = lli[2];
+        regs->DMACCControl = lli[3];
+    }
+    else
+    {
+        regs->DMACCConfig &= ~CCFG_E;
+    }
+}
+
+static void transfer(uint32_t ch, uint32_t items)
+{
+    LPC_GPDMACH_TypeDef* regs = channel(ch);
+
+    while (items-- > 0 && (regs->DMACCConfig & CCFG_E))
+    {
+        uint32_t control = regs->DMACCControl;
+        uint32_t size = control & CTRL_SIZE_MASK;
+
+        if (size != 0)
+        {
+            uint32_t swidth = 1U << CTRL_SWIDTH(control);
+            uint32_t dwidth = 1U << CTRL_DWIDTH(control);
+            uint32_t value = sim_bus_read(regs->DMACCSrcAddr, swidth);
+
+            sim_bus_write(regs->DMACCDestAddr, dwidth, value);
+            regs->DMACCSrcAddr += (control & CTRL_SI) ? swidth : 0;
+            regs->DMACCDestAddr += (control & CTRL_DI) ? dwidth : 0;
+            regs->DMACCControl = (control & ~CTRL_SIZE_MASK) | (size - 1);
+            size--;
+        }
+
+        if (size == 0)
+        {
+            terminal_count(ch);
+        }
+    }
+}
+
+static void service(void)
+{
+    LPC_GPDMA_TypeDef* regs = gpdma();
+    uint32_t progress;
+
+    if (servicing)
+    {
+        /* A transfer touched a peripheral that asserted a request: the outer loop picks it up */
+        return;
+    }
+    servicing = 1;
+
+    do
+    {
+        progress = 0;
+        for (uint32_t ch = 0; ch < GPDMA_CHANNELS && (regs->DMACConfig & CONFIG_E); ch++)
+        {
+            uint32_t config = channel(ch)->DMACCConfig;
+            uint32_t control = channel(ch)->DMACCControl;
+            uint32_t line;
+
+            if (!(config & CCFG_E) || (config & CCFG_H))
+            {
+                m2m_end[ch] = SIM_NEVER;
+                continue;
+            }
+
+            switch (CCFG_TYPE(config))
+            {
+                case FLOW_M2M:
+                    if (m2m_end[ch] == SIM_NEVER)
+                    {
+                        uint32_t items = control & CTRL_SIZE_MASK;
+                        m2m_end[ch] = sim_now() + (items ? items : 1U) * GPDMA_ITEM_CYCLES;
+                    }
+                    continue;
+                case FLOW_M2P:
+                    line = CCFG_DST_PER(config);
+                    break;
+                default:
+                    line = CCFG_SRC_PER(config);
+                    break;
+            }
+
+            if (line < GPDMA_LINES && (requests & (1UL << line)))
+            {
+                uint32_t burst = (CCFG_TYPE(config) == FLOW_M2P) ? CTRL_DBSIZE(control) : CTRL_SBSIZE(control);
+                requests &= ~(1UL << line);
+                transfer(ch, burst_items(burst));
+                progress = 1;
+            }
+        }
+    } while (progress);
+
+    servicing = 0;
+    publish();
+}
+
+static uint64_t gpdma_next(uint64_t now)
+{
+    uint64_t due = SIM_NEVER;
+
+    (void)now;
+    for (uint32_t ch = 0; ch < GPDMA_CHANNELS; ch++)
+    {
+        due = (m2m_end[ch] < due) ? m2m_end[ch] : due;
+    }
+    return due;
+}
+
+static void gpdma_fire(uint64_t now)
+{
+    for (uint32_t ch = 0; ch < GPDMA_CHANNELS; ch++)
+    {
+        if (m2m_end[ch] == now)
+        {
+            uint32_t items = channel(ch)->DMACCControl & CTRL_SIZE_MASK;
+            m2m_end[ch] = SIM_NEVER;
+            transfer(ch, items ? items : 1U);
+        }
+    }
+    /* Schedule the next item of the channels that follow a linked list */
+    service();
+}
+
+void sim_gpdma_request(uint8_t line)
+{
+    if (line < GPDMA_LINES)
+    {
+        requests |= 1UL << line;
+        service();
+    }
+}
+
+void lpc_sim_dma_request(uint8_t request)
+{
+    sim_gpdma_request(request);
+    sim_irq_check();
+}
+
+static void gpdma_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)model;
+    (void)old;
+
+    if (offset == GPDMA_OFS(DMACIntTCClear))
+    {
+        raw_tc &= ~value;
+    }
+    else if (offset == GPDMA_OFS(DMACIntErrClr))
+    {
+        raw_err &= ~value;
+    }
+    else if (offset == GPDMA_OFS(DMACSoftBReq) || offset == GPDMA_OFS(DMACSoftSReq) ||
+             offset == GPDMA_OFS(DMACSoftLBReq) || offset == GPDMA_OFS(DMACSoftLSReq))
+    {
+        requests |= value & ((1UL << GPDMA_LINES) - 1);
+    }
+    else if (offset >= CH_FIRST_OFFSET && offset < CH_FIRST_OFFSET + GPDMA_CHANNELS * CH_SIZE &&
+             (offset - CH_FIRST_OFFSET) % CH_SIZE == CH_OFS(DMACCConfig))
+    {
+        /* The active flag is read-only and always reads as idle: transfers complete within one request */
+        *(volatile uint32_t*)sim_shadow(LPC_GPDMA_BASE + offset) = value & ~(1UL << 17);
+    }
+
+    service();
+}
+
+static void gpdma_reset(const sim_model_t* model)
+{
+    (void)model;
+
+    requests = 0;
+    raw_tc = 0;
+    raw_err = 0;
+    servicing = 0;
+    for (uint32_t ch = 0; ch < GPDMA_CHANNELS; ch++)
+    {
+        m2m_end[ch] = SIM_NEVER;
+    }
+    publish();
+}
+
+const sim_model_t sim_gpdma_model = {"GPDMA", LPC_GPDMA_BASE, SIM_PAGE_SIZE, 0, gpdma_reset, NULL, NULL, gpdma_write};
+
+const sim_event_source_t sim_gpdma_events = {gpdma_next, gpdma_fire};
@@ -0,0 +1,345 @@
+/*
+ * @file sim_gpio.c
+ * @brief Fast GPIO and GPIO interrupt model
+ *
+ * Each port keeps its output latch and the level driven on its inputs by the test bench. FIOSET and FIOCLR act on
+ * the latch through FIOMASK, FIOPIN reads back the pins, and edges on ports 0 and 2 latch the rising/falling status
+ * registers that share the EINT3 interrupt line. P2.10-P2.13 also feed the EINT0-3 inputs when selected in PINSEL4,
+ * and the CAP0.0-CAP3.1 pins the capture inputs of the timers when selected in PINSEL (function 3). Every pin edge is
+ * recorded in the trace, including the edges of the external match outputs on the MATn.m pins and of the PWM1 outputs
+ * on the PWM1.n pins selected in PINSEL.
+ */
+
+#include <stddef.h>
+
+#include "sim_internal.h"
+
+#define GPIO_PORTS      5
+#define GPIO_PORT_SIZE  0x20U
+#define GPIO_OFS(reg)   offsetof(LPC_GPIO_TypeDef, reg)
+#define GPIOINT_OFFSET  (LPC_GPIOINT_BASE & (SIM_PAGE_SIZE - 1))
+#define GPIOINT_OFS(r)  (GPIOINT_OFFSET + offsetof(LPC_GPIOINT_TypeDef, r))
+#define EINT_FIRST_PIN  10
+#define CAP_FUNC        3U
+
+typedef struct
+{
+    uint32_t latch; /* Output register */
+    uint32_t input; /* Level driven from outside */
+} gpio_port_t;
+
+typedef struct
+{
+    uint8_t port;
+    uint8_t pin;
+    uint8_t unit;
+    uint8_t channel;
+} cap_pin_t;
+
+/* CAPn.m inputs, all on function 3 */
+static const cap_pin_t cap_pins[] = {
+    {1, 26, 0, 0}, {1, 27, 0, 1}, /* CAP0.0, CAP0.1 */
+    {1, 18, 1, 0}, {1, 19, 1, 1}, /* CAP1.0, CAP1.1 */
+    {0, 4, 2, 0},  {0, 5, 2, 1},  /* CAP2.0, CAP2.1 */
+    {0, 23, 3, 0}, {0, 24, 3, 1}, /* CAP3.0, CAP3.1 */
+};
+
+typedef struct
+{
+    uint8_t port;
+    uint8_t pin;
+    uint8_t func;
+    uint8_t unit;
+    uint8_t match;
+} mat_pin_t;
+
+/* MATn.m outputs and their PINSEL function */
+static const mat_pin_t mat_pins[] = {
+    {1, 28, 3, 0, 0}, {1, 29, 3, 0, 1}, {3, 25, 2, 0, 0}, {3, 26, 2, 0, 1}, /* MAT0.0, MAT0.1 */
+    {1, 22, 3, 1, 0}, {1, 25, 3, 1, 1},                                     /* MAT1.0, MAT1.1 */
+    {0, 6, 3, 2, 0},  {0, 7, 3, 2, 1},  {0, 8, 3, 2, 2},  {0, 9, 3, 2, 3},  /* MAT2.0 to MAT2.3 */
+    {4, 28, 2, 2, 0}, {4, 29, 2, 2, 1},                                     /* MAT2.0, MAT2.1 */
+    {0, 10, 3, 3, 0}, {0, 11, 3, 3, 1},                                     /* MAT3.0, MAT3.1 */
+};
+
+typedef struct
+{
+    uint8_t port;
+    uint8_t pin;
+    uint8_t func;
+    uint8_t channel;
+} pwm_pin_t;
+
+/* PWM1.n outputs and their PINSEL function */
+static const pwm_pin_t pwm_pins[] = {
+    {2, 0, 1, 1}, {1, 18, 2, 1}, {3, 25, 3, 1}, /* PWM1.1 */
+    {2, 1, 1, 2}, {1, 20, 2, 2}, {3, 26, 3, 2}, /* PWM1.2 */
+    {2, 2, 1, 3}, {1, 21, 2, 3},                /* PWM1.3 */
+    {2, 3, 1, 4}, {1, 23, 2, 4},                /* PWM1.4 */
+    {2, 4, 1, 5}, {1, 24, 2, 5},                /* PWM1.5 */
+    {2, 5, 1, 6}, {1, 26, 2, 6},                /* PWM1.6 */
+};
+
+static gpio_port_t ports[GPIO_PORTS];
+static uint32_t rise_status[2]; /* Port 0 and port 2 */
+static uint32_t fall_status[2];
+
+static LPC_GPIO_TypeDef* gpio(uint32_t port)
+{
+    return SIM_REGS(LPC_GPIO_TypeDef, LPC_GPIO0_BASE + port * GPIO_PORT_SIZE);
+}
+
+static LPC_GPIOINT_TypeDef* gpioint(void)
+{
+    return SIM_REGS(LPC_GPIOINT_TypeDef, LPC_GPIOINT_BASE);
+}
+
+static uint32_t pin_levels(uint32_t port)
+{
+    uint32_t dir = gpio(port)->FIODIR;
+    return (ports[port].latch & dir) | (ports[port].input & ~dir);
+}
+
+void sim_update_eint3_line(void)
+{
+    uint32_t gpio_pending = rise_status[0] | fall_status[0] | rise_status[1] | fall_status[1];
+    uint32_t eint3 = (SIM_REGS(LPC_SC_TypeDef, LPC_SC_BASE)->EXTINT >> 3) & 1U;
+
+    lpc_sim_irq_line(EINT3_IRQn, (gpio_pending != 0) || eint3);
+}
+
+static void detect_edges(uint32_t port, uint32_t before, uint32_t after)
+{
+    uint32_t changed = before ^ after;
+
+    if (changed == 0)
+    {
+        return;
+    }
+
+    for (uint32_t pin = 0; pin < 32; pin++)
+    {
+        if ((changed >> pin) & 1U)
+        {
+            sim_trace(LPC_SIM_TRACE_GPIO, port * 32 + pin, (after >> pin) & 1U);
+        }
+    }
+
+    if (port == 0 || port == 2)
+    {
+        const LPC_GPIOINT_TypeDef* regs = gpioint();
+        uint32_t index = port / 2;
+        uint32_t enable_rise = (port == 0) ? regs->IO0IntEnR : regs->IO2IntEnR;
+        uint32_t enable_fall = (port == 0) ? regs->IO0IntEnF : regs->IO2IntEnF;
+
+        rise_status[index] |= changed & after & enable_rise;
+        fall_status[index] |= changed & before & enable_fall;
+        sim_update_eint3_line();
+    }
+
+    for (uint32_t i = 0; i < sizeof(cap_pins) / sizeof(cap_pins[0]); i++)
+    {
+        const cap_pin_t* cap = &cap_pins[i];
+        const volatile uint32_t* pinsel = &SIM_REGS(LPC_PINCON_TypeDef, LPC_PINCON_BASE)->PINSEL0;
+        uint32_t pin = cap->pin;
+
+        if (cap->port == port && ((changed >> pin) & 1U) &&
+            ((pinsel[port * 2 + pin / 16] >> ((pin % 16) * 2)) & 3U) == CAP_FUNC)
+        {
+            sim_timer_capture_pin(cap->unit, cap->channel, (after >> pin) & 1U);
+        }
+    }
+
+    if (port == 2)
+    {
+        uint32_t pinsel4 = SIM_REGS(LPC_PINCON_TypeDef, LPC_PINCON_BASE)->PINSEL4;
+        for (uint32_t eint = 0; eint < 4; eint++)
+        {
+            uint32_t pin = EINT_FIRST_PIN + eint;
+            if (((changed >> pin) & 1U) && ((pinsel4 >> (pin * 2)) & 3U) == 1U)
+            {
+                sim_gpio_eint_pin((uint8_t)eint, (after >> pin) & 1U);
+            }
+        }
+    }
+}
+
+/* Function of a pin in PINSEL */
+static uint32_t pin_function(uint32_t port, uint32_t pin)
+{
+    const volatile uint32_t* pinsel = &SIM_REGS(LPC_PINCON_TypeDef, LPC_PINCON_BASE)->PINSEL0;
+
+    return (pinsel[port * 2 + pin / 16] >> ((pin % 16) * 2)) & 3U;
+}
+
+void sim_gpio_match_pin(uint8_t unit, uint8_t match, uint32_t level)
+{
+    for (uint32_t i = 0; i < sizeof(mat_pins) / sizeof(mat_pins[0]); i++)
+    {
+        const mat_pin_t* mat = &mat_pins[i];
+
+        if (mat->unit == unit && mat->match == match && pin_function(mat->port, mat->pin) == mat->func)
+        {
+            sim_trace(LPC_SIM_TRACE_GPIO, mat->port * 32U + mat->pin, level);
+        }
+    }
+}
+
+void sim_gpio_pwm_pin(uint8_t channel, uint32_t level)
+{
+    for (uint32_t i = 0; i < sizeof(pwm_pins) / sizeof(pwm_pins[0]); i++)
+    {
+        const pwm_pin_t* pwm = &pwm_pins[i];
+
+        if (pwm->channel == channel && pin_function(pwm->port, pwm->pin) == pwm->func)
+        {
+            sim_trace(LPC_SIM_TRACE_GPIO, pwm->port * 32U + pwm->pin, level);
+        }
+    }
+}
+
+static void gpio_read(const sim_model_t* model, uint32_t offset)
+{
+    uint32_t port = offset / GPIO_PORT_SIZE;
+    uint32_t reg = offset % GPIO_PORT_SIZE;
+
+    (void)model;
+    if (port >= GPIO_PORTS)
+    {
+        return;
+    }
+
+    LPC_GPIO_TypeDef* regs = gpio(port);
+    if (reg == GPIO_OFS(FIOPIN))
+    {
+        regs->FIOPIN = pin_levels(port) & ~regs->FIOMASK;
+    }
+    else if (reg == GPIO_OFS(FIOSET))
+    {
+        regs->FIOSET = ports[port].latch & ~regs->FIOMASK;
+    }
+}
+
+static void gpio_read_done(const sim_model_t* model, uint32_t offset)
+{
+    uint32_t port = offset / GPIO_PORT_SIZE;
+
+    (void)model;
+    if (port < GPIO_PORTS && offset % GPIO_PORT_SIZE == GPIO_OFS(FIOSET))
+    {
+        /* Keep the write-only view at zero so byte and half-word stores merge correctly */
+        gpio(port)->FIOSET = 0;
+    }
+}
+
+static void gpio_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    uint32_t port = offset / GPIO_PORT_SIZE;
+    uint32_t reg = offset % GPIO_PORT_SIZE;
+
+    (void)model;
+    (void)old;
+    if (port >= GPIO_PORTS)
+    {
+        return;
+    }
+
+    LPC_GPIO_TypeDef* regs = gpio(port);
+    uint32_t before = pin_levels(port);
+    uint32_t writable = ~regs->FIOMASK;
+
+    if (reg == GPIO_OFS(FIOPIN))
+    {
+        ports[port].latch = (ports[port].latch & ~writable) | (value & writable);
+    }
+    else if (reg == GPIO_OFS(FIOSET))
+    {
+        ports[port].latch |= value & writable;
+        regs->FIOSET = 0;
+    }
+    else if (reg == GPIO_OFS(FIOCLR))
+    {
+        ports[port].latch &= ~(value & writable);
+        regs->FIOCLR = 0;
+    }
+
+    /* Byte and half-word stores to FIOPIN merge with this word: keep it equal to the pins */
+    regs->FIOPIN = pin_levels(port) & writable;
+    detect_edges(port, before, pin_levels(port));
+}
+
+static void gpioint_read(const sim_model_t* model, uint32_t offset)
+{
+    LPC_GPIOINT_TypeDef* regs = gpioint();
+
+    (void)model;
+    (void)offset;
+    *(volatile uint32_t*)&regs->IO0IntStatR = rise_status[0];
+    *(volatile uint32_t*)&regs->IO0IntStatF = fall_status[0];
+    *(volatile uint32_t*)&regs->IO2IntStatR = rise_status[1];
+    *(volatile uint32_t*)&regs->IO2IntStatF = fall_status[1];
+    *(volatile uint32_t*)&regs->IntStatus =
+        ((rise_status[0] | fall_status[0]) ? 1U : 0U) | ((rise_status[1] | fall_status[1]) ? 4U : 0U);
+}
+
+static void gpioint_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)model;
+    (void)old;
+
+    if (offset == GPIOINT_OFS(IO0IntClr))
+    {
+        rise_status[0] &= ~value;
+        fall_status[0] &= ~value;
+        gpioint()->IO0IntClr = 0;
+    }
+    else if (offset == GPIOINT_OFS(IO2IntClr))
+    {
+        rise_status[1] &= ~value;
+        fall_status[1] &= ~value;
+        gpioint()->IO2IntClr = 0;
+    }
+    sim_update_eint3_line();
+}
+
+static void gpio_reset(const sim_model_t* model)
+{
+    (void)model;
+
+    for (uint32_t port = 0; port < GPIO_PORTS; port++)
+    {
+        ports[port].latch = 0;
+        ports[port].input = 0xFFFFFFFFU; /* Pull-ups are enabled out of reset */
+        gpio(port)->FIOPIN = ports[port].input;
+    }
+    rise_status[0] = rise_status[1] = 0;
+    fall_status[0] = fall_status[1] = 0;
+}
+
+void lpc_sim_gpio_drive(uint8_t port, uint32_t mask, uint32_t level)
+{
+    if (port >= GPIO_PORTS)
+    {
+        return;
+    }
+
+    uint32_t before = pin_levels(port);
+    ports[port].input = (ports[port].input & ~mask) | (level & mask);
+    detect_edges(port, before, pin_levels(port));
+    if (!sim_critical)
+    {
+        /* From a stimulus or a trace hook, the interrupts are taken when the simulator returns from it */
+        sim_irq_check();
+    }
+}
+
+uint32_t lpc_sim_gpio_output(uint8_t port)
+{
+    return (port < GPIO_PORTS) ? ports[port].latch & gpio(port)->FIODIR : 0;
+}
+
+const sim_model_t sim_gpio_model = {
+    "GPIO", LPC_GPIO_BASE, SIM_PAGE_SIZE, 0, gpio_reset, gpio_read, gpio_read_done, gpio_write};
+
+const sim_model_t sim_gpioint_model = {
+    "GPIOINT", LPC_GPIOINT_BASE & ~(SIM_PAGE_SIZE - 1), SIM_PAGE_SIZE, 0, NULL, gpioint_read, NULL, gpioint_write};
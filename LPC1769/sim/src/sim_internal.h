@@ -0,0 +1,106 @@
+/*
+ * @file sim_internal.h
+ * @brief Interface between the simulator bus and the peripheral models
+ *
+ * Every 4 KiB page of the simulated address space belongs to exactly one model. A model sees CPU accesses as word
+ * sized events: read() runs before the CPU loads the word (to publish status bits or FIFO heads), read_done() runs
+ * after the load (to implement read-to-clear and FIFO pops) and write() runs after the store with both the previous
+ * and the new content of the word. Models access their registers through the shadow view returned by sim_shadow(),
+ * which never traps.
+ */
+
+#ifndef SIM_INTERNAL_H
+#define SIM_INTERNAL_H
+
+#include <signal.h>
+#include <stdint.h>
+
+#include "LPC17xx.h"
+
+#define SIM_PAGE_SIZE 4096U
+
+typedef struct sim_model sim_model_t;
+
+struct sim_model
+{
+    const char* name;
+    uint32_t base;  /* First address served by the model, page aligned */
+    uint32_t size;  /* Size of the served range, multiple of the page size */
+    uint8_t unit;   /* Instance number for peripherals with several copies (TIM0-3, UART0-3, ...) */
+    void (*reset)(const sim_model_t* model);
+    void (*read)(const sim_model_t* model, uint32_t offset);
+    void (*read_done)(const sim_model_t* model, uint32_t offset);
+    void (*write)(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value);
+};
+
+/* Shadow (non trapping) view of a simulated register */
+void* sim_shadow(uint32_t addr);
+#define SIM_REGS(type, base) ((type*)sim_shadow((uint32_t)(base)))
+
+/* Bus master accesses (GPDMA): peripheral side effects are applied, RAM is accessed directly */
+uint32_t sim_bus_read(uint32_t addr, uint32_t width);
+void sim_bus_write(uint32_t addr, uint32_t width, uint32_t value);
+
+/* Virtual time, counted in core clock cycles. Each source of timed events reports the cycle of its next event and
+ * handles it when the scheduler reaches that cycle. */
+#define SIM_NEVER UINT64_MAX
+
+typedef struct
+{
+    uint64_t (*next)(uint64_t now); /* Cycle of the next event, SIM_NEVER when nothing is scheduled */
+    void (*fire)(uint64_t now);     /* Handle the events due at now */
+} sim_event_source_t;
+
+uint64_t sim_now(void);
+void sim_time_reset(void);
+void sim_time_init(void);
+void sim_time_access(void);  /* Charge one CPU register access and run the events due meanwhile */
+uint32_t sim_idle(void);     /* Jump to the next event; 0 when nothing can happen any more */
+uint32_t sim_pclk_divider(uint32_t pclksel); /* CCLK / PCLK for a CLKPWR_PCLKSEL_* selector */
+void sim_trace(uint32_t kind, uint32_t id, uint32_t value);
+const char* sim_exception_name(uint32_t exception);
+
+/* Model state must not be touched by the idle detector while this is non zero */
+extern volatile sig_atomic_t sim_critical;
+extern volatile uint64_t sim_activity;
+#define SIM_ENTER() (sim_critical++)
+#define SIM_LEAVE() (sim_critical--)
+
+/* Interrupt controller */
+void sim_nvic_reset(void);
+void sim_irq_check(void);
+void sim_nvic_pend_systick(void);
+
+/* Cross-model hooks */
+void sim_gpdma_request(uint8_t line);
+void sim_gpio_eint_pin(uint8_t eint, uint32_t level);
+void sim_timer_capture_pin(uint8_t unit, uint8_t channel, uint32_t level); /* Edge on CAPunit.channel */
+void sim_gpio_match_pin(uint8_t unit, uint8_t match, uint32_t level);      /* Edge of MATunit.match */
+void sim_gpio_pwm_pin(uint8_t channel, uint32_t level);                     /* Edge of PWM1.channel */
+void sim_update_eint3_line(void);
+void sim_adc_start_edge(uint32_t start, uint32_t level); /* ADCR START code of the signal, new level */
+void sim_dwt_trace_enable(void);                         /* DEMCR written */
+
+/* Models, one instance per served page range */
+extern const sim_model_t sim_core_model;
+extern const sim_model_t sim_dwt_model;
+extern const sim_model_t sim_sc_model;
+extern const sim_model_t sim_gpio_model;
+extern const sim_model_t sim_gpioint_model;
+extern const sim_model_t sim_timer_models[4];
+extern const sim_model_t sim_pwm_model;
+extern const sim_model_t sim_uart_models[4];
+extern const sim_model_t sim_ssp_models[2];
+extern const sim_model_t sim_adc_model;
+extern const sim_model_t sim_dac_model;
+extern const sim_model_t sim_gpdma_model;
+
+/* Sources of timed events */
+extern const sim_event_source_t sim_systick_events;
+extern const sim_event_source_t sim_timer_events;
+extern const sim_event_source_t sim_pwm_events;
+extern const sim_event_source_t sim_adc_events;
+extern const sim_event_source_t sim_dac_events;
+extern const sim_event_source_t sim_gpdma_events;
+
+#endif /* SIM_INTERNAL_H */
@@ -0,0 +1,450 @@
+/*
+ * @file sim_nvic.c
+ * @brief System Control Space model: NVIC, SysTick registers and the SCB interrupt control bits
+ *
+ * Interrupts are taken at instruction boundaries that follow a peripheral access, when PRIMASK is cleared and in
+ * __WFI(). __WFI() with PRIMASK set returns once an interrupt is pending, without taking it. Device interrupt lines
+ * are level sensitive: a handler that returns with its source still asserted is entered again, exactly as on the
+ * Cortex-M3. SysTick counts core clock cycles in virtual time.
+ */
+
+#include <stdlib.h>
+
+#include "sim_internal.h"
+
+#define SCS_BASE_ADDR   0xE000E000UL
+#define NUM_EXCEPTIONS  (16 + 35) /* 16 system exceptions plus the LPC17xx device interrupts */
+#define EXC_PENDSV      14
+#define EXC_SYSTICK     15
+#define NO_PRIORITY     0x100U
+
+/* Offsets inside the System Control Space */
+#define OFS_SYST_CSR    0x010
+#define OFS_SYST_RVR    0x014
+#define OFS_SYST_CVR    0x018
+#define OFS_NVIC_ISER   0x100
+#define OFS_NVIC_ICER   0x180
+#define OFS_NVIC_ISPR   0x200
+#define OFS_NVIC_ICPR   0x280
+#define OFS_NVIC_IABR   0x300
+#define OFS_NVIC_IP     0x400
+#define OFS_SCB_ICSR    0xD04
+#define OFS_SCB_AIRCR   0xD0C
+#define OFS_SCB_SHP     0xD18
+#define OFS_DEMCR       0xDFC
+#define OFS_NVIC_STIR   0xF00
+
+#define ICSR_PENDSTCLR  (1UL << 25)
+#define ICSR_PENDSTSET  (1UL << 26)
+#define ICSR_PENDSVCLR  (1UL << 27)
+#define ICSR_PENDSVSET  (1UL << 28)
+
+extern void (*const sim_vectors[NUM_EXCEPTIONS])(void);
+
+static uint8_t enabled[NUM_EXCEPTIONS];
+static uint8_t pended[NUM_EXCEPTIONS];
+static uint8_t active[NUM_EXCEPTIONS];
+static uint8_t line[NUM_EXCEPTIONS];
+static uint32_t primask = 0;
+static uint32_t current_exception = 0;
+static int (*idle_hook)(void) = NULL;
+static uint32_t systick_enabled = 0;
+static uint32_t systick_cvr = 0;
+static uint64_t systick_sync = 0;
+
+static volatile uint32_t* scs(uint32_t offset)
+{
+    return (volatile uint32_t*)sim_shadow(SCS_BASE_ADDR + offset);
+}
+
+static uint32_t raw_priority(uint32_t exception)
+{
+    const volatile uint8_t* bytes = (const volatile uint8_t*)sim_shadow(SCS_BASE_ADDR);
+
+    if (exception >= 16)
+    {
+        return bytes[OFS_NVIC_IP + exception - 16];
+    }
+    if (exception >= 4)
+    {
+        return bytes[OFS_SCB_SHP + exception - 4];
+    }
+    return 0; /* Reset, NMI and HardFault have fixed negative priorities */
+}
+
+static uint32_t group_priority(uint32_t exception)
+{
+    uint32_t prigroup = (*scs(OFS_SCB_AIRCR) >> 8) & 7U;
+    return raw_priority(exception) >> (prigroup + 1);
+}
+
+static uint32_t execution_priority(void)
+{
+    uint32_t best = NO_PRIORITY;
+
+    for (uint32_t exception = 0; exception < NUM_EXCEPTIONS; exception++)
+    {
+        if (active[exception] && group_priority(exception) < best)
+        {
+            best = group_priority(exception);
+        }
+    }
+    return best;
+}
+
+/* Highest priority pending exception that can preempt the current execution priority, whatever PRIMASK */
+static int32_t pending_exception(void)
+{
+    uint32_t threshold = execution_priority();
+    int32_t best = -1;
+
+    for (uint32_t exception = 0; exception < NUM_EXCEPTIONS; exception++)
+    {
+        if (!pended[exception] || active[exception] || (exception >= 16 && !enabled[exception]))
+        {
+            continue;
+        }
+        if (group_priority(exception) >= threshold)
+        {
+            continue;
+        }
+        if (best < 0 || raw_priority(exception) < raw_priority((uint32_t)best))
+        {
+            best = (int32_t)exception;
+        }
+    }
+    return best;
+}
+
+static int32_t next_exception(void)
+{
+    return primask ? -1 : pending_exception();
+}
+
+static void take_exception(uint32_t exception)
+{
+    uint32_t preempted = current_exception;
+
+    pended[exception] = 0;
+    active[exception] = 1;
+    current_exception = exception;
+    sim_trace(LPC_SIM_TRACE_ISR_ENTER, exception, 0);
+    SIM_LEAVE();
+
+    sim_vectors[exception]();
+
+    SIM_ENTER();
+    sim_trace(LPC_SIM_TRACE_ISR_EXIT, exception, 0);
+    active[exception] = 0;
+    current_exception = preempted;
+
+    /* Level sensitive source still asserted on exception return: pend it again */
+    if (exception >= 16 && line[exception])
+    {
+        pended[exception] = 1;
+    }
+}
+
+uint32_t lpc_sim_service_irqs(void)
+{
+    uint32_t taken = 0;
+    int32_t exception;
+
+    SIM_ENTER();
+    while ((exception = next_exception()) >= 0)
+    {
+        take_exception((uint32_t)exception);
+        taken++;
+    }
+    SIM_LEAVE();
+    return taken;
+}
+
+void sim_irq_check(void)
+{
+    lpc_sim_service_irqs();
+}
+
+void lpc_sim_irq_line(int32_t irq, uint32_t level)
+{
+    uint32_t exception = (uint32_t)(irq + 16);
+
+    if (irq < 0 || exception >= NUM_EXCEPTIONS)
+    {
+        return;
+    }
+    line[exception] = level ? 1 : 0;
+    if (level)
+    {
+        pended[exception] = 1;
+    }
+}
+
+void sim_nvic_pend_systick(void)
+{
+    pended[EXC_SYSTICK] = 1;
+}
+
+void lpc_sim_enable_irq(void)
+{
+    primask = 0;
+    lpc_sim_service_irqs();
+}
+
+void lpc_sim_disable_irq(void)
+{
+    primask = 1;
+}
+
+uint32_t lpc_sim_get_primask(void)
+{
+    return primask;
+}
+
+void lpc_sim_set_primask(uint32_t value)
+{
+    if (value & 1U)
+    {
+        lpc_sim_disable_irq();
+    }
+    else
+    {
+        lpc_sim_enable_irq();
+    }
+}
+
+void lpc_sim_set_idle_hook(int (*hook)(void))
+{
+    idle_hook = hook;
+}
+
+void lpc_sim_wfi(void)
+{
+    /* A pending interrupt wakes the core up even with PRIMASK set, it is then taken when PRIMASK is cleared */
+    while (lpc_sim_service_irqs() == 0 && pending_exception() < 0)
+    {
+        if (!sim_idle() && (idle_hook == NULL || !idle_hook()))
+        {
+            /* Nothing can wake the core up any more: the simulated firmware is done */
+            exit(EXIT_SUCCESS);
+        }
+    }
+}
+
+/* Bring the SysTick current value up to cycle t. The counter reloads on the cycle after it reaches zero. */
+static void systick_update(uint64_t t)
+{
+    if (systick_enabled && t > systick_sync)
+    {
+        uint64_t elapsed = t - systick_sync;
+        uint64_t reload = *scs(OFS_SYST_RVR) & SysTick_LOAD_RELOAD_Msk;
+
+        if (elapsed <= systick_cvr)
+        {
+            systick_cvr -= (uint32_t)elapsed;
+        }
+        else
+        {
+            elapsed -= systick_cvr + 1ULL;
+            systick_cvr = (uint32_t)(reload - elapsed % (reload + 1));
+        }
+    }
+    systick_sync = t;
+    *scs(OFS_SYST_CVR) = systick_cvr;
+}
+
+static uint64_t systick_next(uint64_t now)
+{
+    uint64_t reload = *scs(OFS_SYST_RVR) & SysTick_LOAD_RELOAD_Msk;
+
+    if (!systick_enabled)
+    {
+        return SIM_NEVER;
+    }
+    systick_update(now);
+    if (systick_cvr != 0)
+    {
+        return now + systick_cvr;
+    }
+    return (reload != 0) ? now + 1 + reload : SIM_NEVER;
+}
+
+static void systick_fire(uint64_t now)
+{
+    systick_update(now);
+    if (systick_cvr == 0)
+    {
+        *scs(OFS_SYST_CSR) |= SysTick_CTRL_COUNTFLAG_Msk;
+        if (*scs(OFS_SYST_CSR) & SysTick_CTRL_TICKINT_Msk)
+        {
+            pended[EXC_SYSTICK] = 1;
+        }
+    }
+}
+
+void sim_nvic_reset(void)
+{
+    for (uint32_t exception = 0; exception < NUM_EXCEPTIONS; exception++)
+    {
+        enabled[exception] = 0;
+        pended[exception] = 0;
+        active[exception] = 0;
+        line[exception] = 0;
+    }
+    primask = 0;
+    current_exception = 0;
+    systick_enabled = 0;
+    systick_cvr = 0;
+    systick_sync = 0;
+}
+
+static void publish_bits(uint32_t offset, const uint8_t* state)
+{
+    uint32_t word = (offset & 0x7CU) / 4;
+    uint32_t value = 0;
+
+    for (uint32_t bit = 0; bit < 32; bit++)
+    {
+        uint32_t exception = 16 + word * 32 + bit;
+        if (exception < NUM_EXCEPTIONS && state[exception])
+        {
+            value |= 1UL << bit;
+        }
+    }
+    *scs(offset) = value;
+}
+
+static void apply_bits(uint32_t offset, uint32_t value, uint8_t* state, uint8_t level)
+{
+    uint32_t word = (offset & 0x7CU) / 4;
+
+    for (uint32_t bit = 0; bit < 32; bit++)
+    {
+        uint32_t exception = 16 + word * 32 + bit;
+        if ((value & (1UL << bit)) && exception < NUM_EXCEPTIONS)
+        {
+            state[exception] = level;
+        }
+    }
+}
+
+static void core_read(const sim_model_t* model, uint32_t offset)
+{
+    (void)model;
+
+    if (offset >= OFS_NVIC_ISER && offset < OFS_NVIC_ISER + 0x20)
+    {
+        publish_bits(offset, enabled);
+    }
+    else if (offset >= OFS_NVIC_ICER && offset < OFS_NVIC_ICER + 0x20)
+    {
+        publish_bits(offset, enabled);
+    }
+    else if (offset >= OFS_NVIC_ISPR && offset < OFS_NVIC_ICPR + 0x20)
+    {
+        publish_bits(offset, pended);
+    }
+    else if (offset >= OFS_NVIC_IABR && offset < OFS_NVIC_IABR + 0x20)
+    {
+        publish_bits(offset, active);
+    }
+    else if (offset == OFS_SYST_CVR)
+    {
+        systick_update(sim_now());
+    }
+    else if (offset == OFS_SCB_ICSR)
+    {
+        uint32_t icsr = current_exception & 0x1FFU;
+        icsr |= pended[EXC_SYSTICK] ? ICSR_PENDSTSET : 0;
+        icsr |= pended[EXC_PENDSV] ? ICSR_PENDSVSET : 0;
+        *scs(OFS_SCB_ICSR) = icsr;
+    }
+}
+
+static void core_read_done(const sim_model_t* model, uint32_t offset)
+{
+    (void)model;
+
+    if (offset == OFS_SYST_CSR)
+    {
+        *scs(OFS_SYST_CSR) &= ~SysTick_CTRL_COUNTFLAG_Msk; /* COUNTFLAG clears on read */
+    }
+}
+
+static void core_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    (void)model;
+
+    if (offset == OFS_SYST_CSR)
+    {
+        /* Count with the previous enable state up to now */
+        systick_update(sim_now());
+        systick_enabled = value & SysTick_CTRL_ENABLE_Msk;
+        *scs(OFS_SYST_CSR) = (value & ~SysTick_CTRL_COUNTFLAG_Msk) | (old & SysTick_CTRL_COUNTFLAG_Msk);
+    }
+    else if (offset == OFS_SYST_CVR)
+    {
+        /* Any write clears the current value and COUNTFLAG */
+        systick_update(sim_now());
+        systick_cvr = 0;
+        *scs(OFS_SYST_CVR) = 0;
+        *scs(OFS_SYST_CSR) &= ~SysTick_CTRL_COUNTFLAG_Msk;
+    }
+    else if (offset >= OFS_NVIC_ISER && offset < OFS_NVIC_ISER + 0x20)
+    {
+        apply_bits(offset, value, enabled, 1);
+    }
+    else if (offset >= OFS_NVIC_ICER && offset < OFS_NVIC_ICER + 0x20)
+    {
+        apply_bits(offset, value, enabled, 0);
+    }
+    else if (offset >= OFS_NVIC_ISPR && offset < OFS_NVIC_ISPR + 0x20)
+    {
+        apply_bits(offset, value, pended, 1);
+    }
+    else if (offset >= OFS_NVIC_ICPR && offset < OFS_NVIC_ICPR + 0x20)
+    {
+        apply_bits(offset, value, pended, 0);
+    }
+    else if (offset == OFS_SCB_ICSR)
+    {
+        if (value & ICSR_PENDSTSET)
+        {
+            pended[EXC_SYSTICK] = 1;
+        }
+        if (value & ICSR_PENDSTCLR)
+        {
+            pended[EXC_SYSTICK] = 0;
+        }
+        if (value & ICSR_PENDSVSET)
+        {
+            pended[EXC_PENDSV] = 1;
+        }
+        if (value & ICSR_PENDSVCLR)
+        {
+            pended[EXC_PENDSV] = 0;
+        }
+    }
+    else if (offset == OFS_NVIC_STIR)
+    {
+        if (16 + (value & 0x1FFU) < NUM_EXCEPTIONS)
+        {
+            pended[16 + (value & 0x1FFU)] = 1;
+        }
+    }
+    else if (offset == OFS_DEMCR)
+    {
+        sim_dwt_trace_enable();
+    }
+}
+
+static void core_reset(const sim_model_t* model)
+{
+    (void)model;
+    *scs(0xD00) = 0x412FC230; /* CPUID: Cortex-M3 r2p0 */
+}
+
+const sim_model_t sim_core_model = {
+    "SCS", SCS_BASE_ADDR, SIM_PAGE_SIZE, 0, core_reset, core_read, core_read_done, core_write};
+
+const sim_event_source_t sim_systick_events = {systick_next, systick_fire};
@@ -0,0 +1,338 @@
+/*
+ * @file sim_pwm.c
+ * @brief PWM1 model in virtual time
+ *
+ * The counter is the one of the timers (lazy TC and PC, match interrupt/reset/stop), with seven match registers. In
+ * PWM mode (TCR bit 3), the match registers written by the CPU are shadow registers: the ones set in LER are copied
+ * to the active match registers when the TC goes back to 0 after a match of MR0 with reset, and LER is cleared. A
+ * PWM cycle then starts: the single edge outputs enabled in PCR rise, unless their match value is 0, and fall at the
+ * match of MRn. A double edge output rises at the match of MRn-1 and falls at the match of MRn, the fall winning
+ * when both come together. Output edges are recorded in the trace on the PWM1.n pins selected in PINSEL, once per
+ * cycle of virtual time. The counter mode (CTCR) and the capture inputs are not modeled.
+ */
+
+#include <stddef.h>
+
+#include "lpc17xx_clkpwr.h"
+#include "sim_internal.h"
+
+#define PWM_OFS(reg)    offsetof(LPC_PWM_TypeDef, reg)
+#define PWM_MATCHES     7U
+#define PWM_CHANNELS    6U
+#define TCR_ENABLE      (1UL << 0)
+#define TCR_RESET       (1UL << 1)
+#define TCR_PWM         (1UL << 3)
+#define MCR_INT(i)      (1UL << (3 * (i)))
+#define MCR_RESET(i)    (2UL << (3 * (i)))
+#define MCR_STOP(i)     (4UL << (3 * (i)))
+#define MCR_ANY(i)      (7UL << (3 * (i)))
+#define IR_MATCH(i)     (((i) < 4) ? (1UL << (i)) : (1UL << ((i) + 4)))
+#define PCR_DOUBLE(n)   (1UL << (n))
+#define PCR_ENABLE(n)   (1UL << ((n) + 8))
+#define LER_MASK        0x7FU
+
+typedef struct
+{
+    uint32_t tc;
+    uint32_t pc;
+    uint32_t pr;
+    uint32_t running;
+    uint32_t reset_pending;    /* Matched MR0 with reset: the next increment goes to 0 */
+    uint32_t wrapped;          /* The TC went back to 0 in PWM mode, the new cycle is not started yet */
+    uint64_t sync;             /* Cycle at which tc and pc are valid */
+    uint64_t due;              /* Cycle of the next match or cycle start */
+    uint32_t active[PWM_MATCHES];
+    uint32_t outputs;          /* Bit n: level of PWM1.n */
+} pwm_state_t;
+
+static pwm_state_t state;
+
+static LPC_PWM_TypeDef* pwm(void)
+{
+    return SIM_REGS(LPC_PWM_TypeDef, LPC_PWM1_BASE);
+}
+
+/* Match register written by the CPU: the shadow register in PWM mode */
+static volatile uint32_t* match_register(uint32_t match)
+{
+    LPC_PWM_TypeDef* regs = pwm();
+
+    return (match < 4) ? &regs->MR0 + match : &regs->MR4 + (match - 4);
+}
+
+static uint32_t pwm_mode(void)
+{
+    return (pwm()->TCR & TCR_PWM) != 0;
+}
+
+static void update_line(void)
+{
+    lpc_sim_irq_line(PWM1_IRQn, pwm()->IR != 0);
+}
+
+/* Bring TC and PC up to cycle t */
+static void sync(uint64_t t)
+{
+    LPC_PWM_TypeDef* regs = pwm();
+
+    if (state.running && t > state.sync)
+    {
+        uint64_t div = sim_pclk_divider(CLKPWR_PCLKSEL_PWM1);
+        uint64_t total = state.pc + (t / div - state.sync / div);
+        uint64_t increments = total / (state.pr + 1ULL);
+
+        state.pc = (uint32_t)(total % (state.pr + 1ULL));
+        if (increments && state.reset_pending)
+        {
+            state.tc = 0;
+            state.reset_pending = 0;
+            state.wrapped = pwm_mode();
+            increments--;
+        }
+        state.tc += (uint32_t)increments;
+    }
+    state.sync = t;
+    regs->TC = state.tc;
+    regs->PC = state.pc;
+}
+
+/* Cycle at which TC reaches value, counted from the synchronized state */
+static uint64_t match_time(uint32_t value)
+{
+    uint64_t div = sim_pclk_divider(CLKPWR_PCLKSEL_PWM1);
+    uint64_t period = state.pr + 1ULL;
+    uint64_t increments;
+    uint64_t edges;
+
+    if (state.reset_pending)
+    {
+        increments = 1ULL + value;
+    }
+    else
+    {
+        uint32_t distance = value - state.tc;
+        increments = distance ? distance : (1ULL << 32);
+    }
+
+    edges = (period - state.pc) + (increments - 1) * period;
+    return (state.sync / div + edges) * div;
+}
+
+static uint64_t pwm_next(uint64_t now)
+{
+    LPC_PWM_TypeDef* regs = pwm();
+
+    if (state.running && state.due <= now)
+    {
+        /* Reached but not fired yet, behind another event of the same cycle */
+        return state.due;
+    }
+    state.due = SIM_NEVER;
+    if (!state.running)
+    {
+        return SIM_NEVER;
+    }
+
+    sync(now);
+    if (state.wrapped)
+    {
+        state.due = now;
+        return now;
+    }
+    for (uint32_t match = 0; match < PWM_MATCHES; match++)
+    {
+        if ((regs->MCR & MCR_ANY(match)) || pwm_mode())
+        {
+            uint64_t when = match_time(state.active[match]);
+            state.due = (when < state.due) ? when : state.due;
+        }
+    }
+    if (state.reset_pending && pwm_mode())
+    {
+        /* Start of the next cycle */
+        uint64_t when = match_time(0);
+        state.due = (when < state.due) ? when : state.due;
+    }
+    return state.due;
+}
+
+/* Outputs changed by a match: the fall of the single edge output n, the rise or fall of a double edge output */
+static void match_outputs(uint32_t match)
+{
+    uint32_t pcr = pwm()->PCR;
+
+    for (uint32_t n = 1; n <= PWM_CHANNELS; n++)
+    {
+        uint32_t dual = (n >= 2) && (pcr & PCR_DOUBLE(n));
+
+        if (!(pcr & PCR_ENABLE(n)))
+        {
+            continue;
+        }
+        if (dual && match == n - 1)
+        {
+            state.outputs |= 1UL << n;
+        }
+        if (match == n)
+        {
+            state.outputs &= ~(1UL << n);
+        }
+    }
+}
+
+/* Actions of a match: interrupt flag, reset, stop and outputs */
+static void match_event(uint32_t match)
+{
+    LPC_PWM_TypeDef* regs = pwm();
+
+    if (regs->MCR & MCR_INT(match))
+    {
+        regs->IR |= IR_MATCH(match);
+    }
+    if (regs->MCR & MCR_RESET(match))
+    {
+        state.reset_pending = 1;
+    }
+    if (regs->MCR & MCR_STOP(match))
+    {
+        state.running = 0;
+        regs->TCR &= ~TCR_ENABLE;
+    }
+    if (pwm_mode())
+    {
+        match_outputs(match);
+    }
+}
+
+/* Start of a PWM cycle: latch the shadow registers enabled in LER, raise the single edge outputs */
+static void start_cycle(void)
+{
+    LPC_PWM_TypeDef* regs = pwm();
+    uint32_t pcr = regs->PCR;
+
+    for (uint32_t match = 0; match < PWM_MATCHES; match++)
+    {
+        if (regs->LER & (1UL << match))
+        {
+            state.active[match] = *match_register(match);
+        }
+    }
+    regs->LER &= ~LER_MASK;
+
+    for (uint32_t n = 1; n <= PWM_CHANNELS; n++)
+    {
+        if ((pcr & PCR_ENABLE(n)) && !((n >= 2) && (pcr & PCR_DOUBLE(n))) && state.active[n] != 0)
+        {
+            state.outputs |= 1UL << n;
+        }
+    }
+}
+
+static void pwm_fire(uint64_t now)
+{
+    uint32_t before = state.outputs;
+    uint32_t changed;
+
+    if (state.due != now)
+    {
+        return;
+    }
+
+    sync(now);
+    if (state.wrapped)
+    {
+        state.wrapped = 0;
+        start_cycle();
+    }
+    for (uint32_t match = 0; match < PWM_MATCHES; match++)
+    {
+        if (state.active[match] == state.tc && ((pwm()->MCR & MCR_ANY(match)) || pwm_mode()))
+        {
+            match_event(match);
+        }
+    }
+    state.due = SIM_NEVER;
+    update_line();
+
+    /* Edges of this cycle only: an output rising and falling at once does not move */
+    changed = before ^ state.outputs;
+    for (uint32_t n = 1; n <= PWM_CHANNELS; n++)
+    {
+        if (changed & (1UL << n))
+        {
+            sim_gpio_pwm_pin((uint8_t)n, (state.outputs >> n) & 1U);
+        }
+    }
+}
+
+static void pwm_read(const sim_model_t* model, uint32_t offset)
+{
+    (void)model;
+    if (offset == PWM_OFS(TC) || offset == PWM_OFS(PC))
+    {
+        sync(sim_now());
+    }
+}
+
+static void pwm_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    LPC_PWM_TypeDef* regs = pwm();
+
+    (void)model;
+    /* Count with the configuration in force before the write */
+    sync(sim_now());
+
+    if (offset == PWM_OFS(IR))
+    {
+        regs->IR = old & ~value;
+        update_line();
+    }
+    else if (offset == PWM_OFS(TCR))
+    {
+        state.running = (value & (TCR_ENABLE | TCR_RESET)) == TCR_ENABLE;
+        if (value & TCR_RESET)
+        {
+            state.tc = 0;
+            state.pc = 0;
+            state.reset_pending = 0;
+            state.wrapped = 0;
+        }
+    }
+    else if (offset == PWM_OFS(PR))
+    {
+        state.pr = value;
+    }
+    else if (offset == PWM_OFS(TC))
+    {
+        state.tc = value;
+        state.reset_pending = 0;
+    }
+    else if (offset == PWM_OFS(PC))
+    {
+        state.pc = value;
+    }
+    else if (!pwm_mode())
+    {
+        /* Outside PWM mode, the match registers take the values written at once */
+        for (uint32_t match = 0; match < PWM_MATCHES; match++)
+        {
+            if (match_register(match) == (volatile uint32_t*)((uintptr_t)regs + offset))
+            {
+                state.active[match] = value;
+            }
+        }
+    }
+    regs->TC = state.tc;
+    regs->PC = state.pc;
+}
+
+static void pwm_reset(const sim_model_t* model)
+{
+    (void)model;
+    state = (pwm_state_t){0};
+    state.due = SIM_NEVER;
+}
+
+const sim_model_t sim_pwm_model = {"PWM1", LPC_PWM1_BASE, SIM_PAGE_SIZE, 0, pwm_reset, pwm_read, NULL, pwm_write};
+
+const sim_event_source_t sim_pwm_events = {pwm_next, pwm_fire};
@@ -0,0 +1,161 @@
+/*
+ * @file sim_sc.c
+ * @brief System control model: PLL feed sequences and lock status, main oscillator, external interrupts
+ */
+
+#include <stddef.h>
+
+#include "sim_internal.h"
+
+#define SC_OFS(reg) offsetof(LPC_SC_TypeDef, reg)
+
+#define SCS_OSCEN    (1UL << 5)
+#define SCS_OSCSTAT  (1UL << 6)
+#define PLL0_PLOCK   (1UL << 26)
+#define PLL1_PLOCK   (1UL << 10)
+#define PCONP_RESET  0x042887DEUL
+
+typedef struct
+{
+    uint32_t feed_step; /* 0: idle, 1: 0xAA seen */
+    uint32_t con;
+    uint32_t cfg;
+} pll_state_t;
+
+static pll_state_t pll[2];
+static uint32_t eint_level[4];
+
+static LPC_SC_TypeDef* sc(void)
+{
+    return SIM_REGS(LPC_SC_TypeDef, LPC_SC_BASE);
+}
+
+static void pll_feed(uint32_t index, uint32_t value)
+{
+    LPC_SC_TypeDef* regs = sc();
+    pll_state_t* state = &pll[index];
+
+    if (value == 0xAA)
+    {
+        state->feed_step = 1;
+        return;
+    }
+    if (value != 0x55 || state->feed_step != 1)
+    {
+        state->feed_step = 0;
+        return;
+    }
+    state->feed_step = 0;
+
+    /* A valid feed sequence latches the pending control and configuration values */
+    if (index == 0)
+    {
+        state->con = regs->PLL0CON & 3U;
+        state->cfg = regs->PLL0CFG & 0x00FF7FFFU;
+        *(volatile uint32_t*)&regs->PLL0STAT = state->cfg | (state->con << 24) | ((state->con & 1U) ? PLL0_PLOCK : 0);
+    }
+    else
+    {
+        state->con = regs->PLL1CON & 3U;
+        state->cfg = regs->PLL1CFG & 0x7FU;
+        *(volatile uint32_t*)&regs->PLL1STAT = state->cfg | (state->con << 8) | ((state->con & 1U) ? PLL1_PLOCK : 0);
+    }
+}
+
+static void update_eint_lines(void)
+{
+    for (uint32_t eint = 0; eint < 3; eint++)
+    {
+        lpc_sim_irq_line(EINT0_IRQn + (int32_t)eint, (sc()->EXTINT >> eint) & 1U);
+    }
+    sim_update_eint3_line(); /* EINT3 is shared with the GPIO interrupts */
+}
+
+static uint32_t eint_active(uint32_t eint)
+{
+    uint32_t polarity = (sc()->EXTPOLAR >> eint) & 1U;
+    return eint_level[eint] == polarity;
+}
+
+void sim_gpio_eint_pin(uint8_t eint, uint32_t level)
+{
+    LPC_SC_TypeDef* regs = sc();
+    uint32_t previous = eint_level[eint];
+
+    eint_level[eint] = level ? 1 : 0;
+    if (eint == 0 && previous != eint_level[eint])
+    {
+        sim_adc_start_edge(2, eint_level[eint]); /* EINT0 can start ADC conversions */
+    }
+
+    if ((regs->EXTMODE >> eint) & 1U)
+    {
+        /* Edge sensitive: only the edge selected by EXTPOLAR sets the flag */
+        if (previous != eint_level[eint] && eint_active(eint))
+        {
+            regs->EXTINT |= 1UL << eint;
+        }
+    }
+    else if (eint_active(eint))
+    {
+        regs->EXTINT |= 1UL << eint;
+    }
+    update_eint_lines();
+}
+
+static void sc_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    LPC_SC_TypeDef* regs = sc();
+
+    (void)model;
+
+    if (offset == SC_OFS(PLL0FEED))
+    {
+        pll_feed(0, value);
+    }
+    else if (offset == SC_OFS(PLL1FEED))
+    {
+        pll_feed(1, value);
+    }
+    else if (offset == SC_OFS(SCS))
+    {
+        regs->SCS = (value & ~SCS_OSCSTAT) | ((value & SCS_OSCEN) ? SCS_OSCSTAT : 0);
+    }
+    else if (offset == SC_OFS(EXTINT))
+    {
+        /* Write one to clear; a level sensitive input that is still active sets the flag again */
+        uint32_t flags = old & ~value;
+        for (uint32_t eint = 0; eint < 4; eint++)
+        {
+            if (!((regs->EXTMODE >> eint) & 1U) && eint_active(eint))
+            {
+                flags |= 1UL << eint;
+            }
+        }
+        regs->EXTINT = flags;
+        update_eint_lines();
+    }
+}
+
+static void sc_reset(const sim_model_t* model)
+{
+    (void)model;
+
+    pll[0] = (pll_state_t){0, 0, 0};
+    pll[1] = (pll_state_t){0, 0, 0};
+    for (uint32_t eint = 0; eint < 4; eint++)
+    {
+        eint_level[eint] = 1; /* Pull-ups keep the inputs high */
+    }
+    sc()->PCONP = PCONP_RESET;
+}
+
+uint32_t sim_pclk_divider(uint32_t pclksel)
+{
+    static const uint32_t dividers[4] = {4, 1, 2, 8};
+    uint32_t reg = (pclksel < 32) ? sc()->PCLKSEL0 : sc()->PCLKSEL1;
+
+    return dividers[(reg >> (pclksel % 32)) & 3U];
+}
+
+const sim_model_t sim_sc_model = {"SC", LPC_SC_BASE, SIM_PAGE_SIZE, 0, sc_reset, NULL, NULL, sc_write};
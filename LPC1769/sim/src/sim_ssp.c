@@ -0,0 +1,140 @@
+/*
+ * @file sim_ssp.c
+ * @brief SSP0/SSP1 model
+ *
+ * A frame written to DR is shifted out at once. The frame received in exchange comes from the responder installed by
+ * the test bench, or is the transmitted frame itself (loopback) when there is none. Received frames wait in an 8 entry
+ * FIFO, as on the device.
+ */
+
+#include <stddef.h>
+
+#include "sim_internal.h"
+
+#define SSP_OFS(reg)  offsetof(LPC_SSP_TypeDef, reg)
+#define SSP_FIFO_SIZE 8U
+
+#define CR1_SSE  (1UL << 1)
+#define SR_TFE   (1UL << 0)
+#define SR_TNF   (1UL << 1)
+#define SR_RNE   (1UL << 2)
+#define SR_RFF   (1UL << 3)
+#define RIS_ROR  (1UL << 0)
+#define RIS_RX   (1UL << 2)
+#define RIS_TX   (1UL << 3)
+#define DMA_RXE  (1UL << 0)
+#define DMA_TXE  (1UL << 1)
+
+typedef struct
+{
+    uint16_t rx[SSP_FIFO_SIZE];
+    uint32_t head;
+    uint32_t count;
+    uint32_t overrun;
+    uint16_t (*responder)(uint16_t mosi);
+} ssp_state_t;
+
+static const uint32_t ssp_base[2] = {LPC_SSP0_BASE, LPC_SSP1_BASE};
+static const int32_t ssp_irq[2] = {SSP0_IRQn, SSP1_IRQn};
+static ssp_state_t ssps[2];
+
+static LPC_SSP_TypeDef* ssp(uint32_t unit)
+{
+    return SIM_REGS(LPC_SSP_TypeDef, ssp_base[unit]);
+}
+
+static void publish(uint32_t unit)
+{
+    ssp_state_t* state = &ssps[unit];
+    LPC_SSP_TypeDef* regs = ssp(unit);
+    uint32_t ris = RIS_TX | (state->overrun ? RIS_ROR : 0) | ((state->count >= SSP_FIFO_SIZE / 2) ? RIS_RX : 0);
+
+    *(volatile uint32_t*)&regs->SR =
+        SR_TFE | SR_TNF | (state->count ? SR_RNE : 0) | ((state->count == SSP_FIFO_SIZE) ? SR_RFF : 0);
+    *(volatile uint32_t*)&regs->RIS = ris;
+    *(volatile uint32_t*)&regs->MIS = ris & regs->IMSC;
+    regs->DR = state->count ? state->rx[state->head] : 0;
+
+    lpc_sim_irq_line(ssp_irq[unit], (ris & regs->IMSC) != 0);
+
+    /* SSP0 uses request lines 0 (TX) and 1 (RX), SSP1 lines 2 and 3 */
+    if ((regs->DMACR & DMA_RXE) && state->count)
+    {
+        sim_gpdma_request((uint8_t)(unit * 2 + 1));
+    }
+    if (regs->DMACR & DMA_TXE)
+    {
+        sim_gpdma_request((uint8_t)(unit * 2));
+    }
+}
+
+static void ssp_read_done(const sim_model_t* model, uint32_t offset)
+{
+    ssp_state_t* state = &ssps[model->unit];
+
+    if (offset == SSP_OFS(DR) && state->count)
+    {
+        state->head = (state->head + 1) % SSP_FIFO_SIZE;
+        state->count--;
+        publish(model->unit);
+    }
+}
+
+static void ssp_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    ssp_state_t* state = &ssps[model->unit];
+    LPC_SSP_TypeDef* regs = ssp(model->unit);
+
+    (void)old;
+
+    if (offset == SSP_OFS(DR))
+    {
+        if (regs->CR1 & CR1_SSE)
+        {
+            uint32_t bits = (regs->CR0 & 0x0FU) + 1;
+            uint16_t mosi = (uint16_t)(value & ((1UL << bits) - 1));
+            uint16_t miso = (state->responder != NULL) ? state->responder(mosi) : mosi;
+
+            if (state->count < SSP_FIFO_SIZE)
+            {
+                state->rx[(state->head + state->count) % SSP_FIFO_SIZE] = miso;
+                state->count++;
+            }
+            else
+            {
+                state->overrun = 1;
+            }
+        }
+    }
+    else if (offset == SSP_OFS(ICR))
+    {
+        if (value & RIS_ROR)
+        {
+            state->overrun = 0;
+        }
+        regs->ICR = 0;
+    }
+    publish(model->unit);
+}
+
+static void ssp_reset(const sim_model_t* model)
+{
+    ssp_state_t* state = &ssps[model->unit];
+
+    state->head = 0;
+    state->count = 0;
+    state->overrun = 0;
+    publish(model->unit);
+}
+
+void lpc_sim_ssp_set_responder(uint8_t unit, uint16_t (*responder)(uint16_t mosi))
+{
+    if (unit < 2)
+    {
+        ssps[unit].responder = responder;
+    }
+}
+
+#define SSP_MODEL(n) {"SSP" #n, LPC_SSP##n##_BASE, SIM_PAGE_SIZE, n, ssp_reset, NULL, ssp_read_done, ssp_write}
+
+const sim_model_t sim_ssp_models[2] = {SSP_MODEL(0), SSP_MODEL(1)};
@@ -0,0 +1,319 @@
+/*
+ * @file sim_time.c
+ * @brief Virtual time: discrete-event scheduler, idle detection and trace
+ *
+ * The clock is a cycle counter that only moves forward when the firmware accesses a peripheral (a fixed cost per
+ * access), when it waits for an interrupt, or when it spins without touching any peripheral. In the last two cases the
+ * scheduler jumps straight to the next event, which is what lets a firmware that waits for a 60 s timer match run in
+ * microseconds.
+ *
+ * Events are not queued: every source reports when its next event is due from its current state, so reprogramming a
+ * peripheral never leaves a stale event behind. There are only a handful of sources, polling them is cheap.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "sim_internal.h"
+
+#define SIM_DEFAULT_ACCESS_CYCLES 4U
+#define SIM_DEFAULT_SPIN_US       1000U
+
+static uint64_t stimulus_next(uint64_t now);
+static void stimulus_fire(uint64_t now);
+
+static const sim_event_source_t stimulus_events = {stimulus_next, stimulus_fire};
+
+static const sim_event_source_t* const sources[] = {
+    &stimulus_events,
+    &sim_systick_events,
+    &sim_timer_events,
+    &sim_pwm_events,
+    &sim_adc_events,
+    &sim_dac_events,
+    &sim_gpdma_events,
+};
+
+static const char* const trace_kinds[] = {"isr_enter", "isr_exit", "gpio", "dac"};
+
+static uint64_t now = 0;
+static uint32_t access_cycles = SIM_DEFAULT_ACCESS_CYCLES;
+static uint64_t limit_ns = 0;
+static uint64_t spin_seen = 0;
+static FILE* trace_file = NULL;
+static void (*trace_hook)(const lpc_sim_trace_event_t* event) = NULL;
+static uint64_t (*stimulus)(uint64_t cycle) = NULL;
+static uint64_t stimulus_due = SIM_NEVER;
+
+volatile sig_atomic_t sim_critical = 0;
+volatile uint64_t sim_activity = 0;
+
+uint64_t sim_now(void)
+{
+    return now;
+}
+
+static uint64_t cycles_to_ns(uint64_t cycles)
+{
+    return (uint64_t)((unsigned __int128)cycles * 1000000000U / SystemCoreClock);
+}
+
+static uint64_t limit_cycles(void)
+{
+    return limit_ns ? (uint64_t)((unsigned __int128)limit_ns * SystemCoreClock / 1000000000U) : SIM_NEVER;
+}
+
+/* Test bench stimulus: one event, at the cycle returned by its previous call */
+static uint64_t stimulus_next(uint64_t now)
+{
+    (void)now;
+    return (stimulus != NULL) ? stimulus_due : SIM_NEVER;
+}
+
+static void stimulus_fire(uint64_t now)
+{
+    uint64_t due = stimulus(now);
+
+    stimulus_due = (due > now) ? due : now + 1;
+}
+
+static uint64_t next_event(const sim_event_source_t** source)
+{
+    uint64_t due = SIM_NEVER;
+
+    for (uint32_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++)
+    {
+        uint64_t when = sources[i]->next(now);
+        if (when < due)
+        {
+            due = when;
+            *source = sources[i];
+        }
+    }
+    return due;
+}
+
+/* Run every event due up to target, in time order; interrupts are taken between events when service is set */
+static void run_until(uint64_t target, uint32_t service)
+{
+    uint64_t limit = limit_cycles();
+
+    for (;;)
+    {
+        const sim_event_source_t* source = NULL;
+
+        SIM_ENTER();
+        uint64_t due = next_event(&source);
+        if (due > target || due > limit)
+        {
+            uint64_t end = (target < limit) ? target : limit;
+            now = (end > now) ? end : now;
+            SIM_LEAVE();
+            if (now >= limit)
+            {
+                /* End of the run: exit() flushes the trace */
+                exit(EXIT_SUCCESS);
+            }
+            return;
+        }
+
+        now = (due > now) ? due : now;
+        source->fire(now);
+        SIM_LEAVE();
+
+        if (service)
+        {
+            sim_irq_check();
+        }
+    }
+}
+
+void sim_time_access(void)
+{
+    sim_activity++;
+    run_until(now + access_cycles, 0);
+}
+
+uint32_t sim_idle(void)
+{
+    const sim_event_source_t* source = NULL;
+    uint64_t due;
+
+    SIM_ENTER();
+    due = next_event(&source);
+    SIM_LEAVE();
+
+    if (due == SIM_NEVER && limit_ns == 0)
+    {
+        return 0;
+    }
+    run_until(due, 0);
+    return 1;
+}
+
+/* Host CPU time tick: a program that did not touch any peripheral since the previous tick is waiting for an interrupt */
+static void on_spin_tick(int sig)
+{
+    (void)sig;
+
+    if (sim_critical || sim_activity != spin_seen)
+    {
+        spin_seen = sim_activity;
+        return;
+    }
+
+    if (!sim_idle())
+    {
+        /* Spinning forever with nothing scheduled: the simulated firmware is done */
+        exit(EXIT_SUCCESS);
+    }
+    sim_irq_check();
+    spin_seen = ++sim_activity;
+}
+
+void lpc_sim_set_spin_timeout(uint32_t host_us)
+{
+    struct itimerval period;
+
+    memset(&period, 0, sizeof(period));
+    period.it_interval.tv_sec = host_us / 1000000U;
+    period.it_interval.tv_usec = host_us % 1000000U;
+    period.it_value = period.it_interval;
+    setitimer(ITIMER_VIRTUAL, &period, NULL);
+}
+
+static void trace_close(void)
+{
+    if (trace_file != NULL)
+    {
+        fclose(trace_file);
+        trace_file = NULL;
+    }
+}
+
+int lpc_sim_trace_open(const char* path)
+{
+    static uint32_t registered = 0;
+
+    trace_close();
+    if (path == NULL)
+    {
+        return 0;
+    }
+
+    trace_file = fopen(path, "w");
+    if (trace_file == NULL)
+    {
+        return -1;
+    }
+    if (!registered)
+    {
+        atexit(trace_close);
+        registered = 1;
+    }
+    fprintf(trace_file, "# time_ns event source value\n");
+    return 0;
+}
+
+void lpc_sim_set_trace_hook(void (*hook)(const lpc_sim_trace_event_t* event))
+{
+    trace_hook = hook;
+}
+
+void lpc_sim_set_stimulus(uint64_t (*callback)(uint64_t cycle), uint64_t first)
+{
+    stimulus = callback;
+    stimulus_due = first;
+}
+
+void sim_trace(uint32_t kind, uint32_t id, uint32_t value)
+{
+    lpc_sim_trace_event_t event = {now, kind, id, value};
+    char source[16];
+
+    if (trace_hook != NULL)
+    {
+        trace_hook(&event);
+    }
+    if (trace_file == NULL)
+    {
+        return;
+    }
+
+    if (kind == LPC_SIM_TRACE_GPIO)
+    {
+        snprintf(source, sizeof(source), "P%u.%u", id / 32, id % 32);
+    }
+    else if (kind == LPC_SIM_TRACE_DAC)
+    {
+        snprintf(source, sizeof(source), "DAC");
+    }
+    else
+    {
+        snprintf(source, sizeof(source), "%s", sim_exception_name(id));
+    }
+    fprintf(trace_file, "%llu %s %s %u\n", (unsigned long long)cycles_to_ns(now), trace_kinds[kind], source, value);
+}
+
+uint64_t lpc_sim_cycles(void)
+{
+    return now;
+}
+
+uint64_t lpc_sim_time_ns(void)
+{
+    return cycles_to_ns(now);
+}
+
+void lpc_sim_advance(uint64_t cycles)
+{
+    run_until(now + cycles, 1);
+}
+
+void lpc_sim_set_access_cycles(uint32_t cycles)
+{
+    access_cycles = cycles;
+}
+
+void lpc_sim_set_time_limit(uint64_t ns)
+{
+    limit_ns = ns;
+}
+
+void sim_time_reset(void)
+{
+    now = 0;
+}
+
+void sim_time_init(void)
+{
+    const char* value;
+    struct sigaction action;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = on_spin_tick;
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGVTALRM, &action, NULL);
+
+    value = getenv("LPC_SIM_ACCESS_CYCLES");
+    if (value != NULL)
+    {
+        access_cycles = (uint32_t)strtoul(value, NULL, 0);
+    }
+    value = getenv("LPC_SIM_TIME_LIMIT");
+    if (value != NULL)
+    {
+        limit_ns = (uint64_t)(strtod(value, NULL) * 1e9);
+    }
+    value = getenv("LPC_SIM_TRACE");
+    if (value != NULL && lpc_sim_trace_open(value) != 0)
+    {
+        fprintf(stderr, "lpc_sim: cannot create the trace file %s\n", value);
+    }
+    value = getenv("LPC_SIM_SPIN_US");
+    lpc_sim_set_spin_timeout((value != NULL) ? (uint32_t)strtoul(value, NULL, 0) : SIM_DEFAULT_SPIN_US);
+}
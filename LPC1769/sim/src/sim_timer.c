@@ -0,0 +1,364 @@
+/*
+ * @file sim_timer.c
+ * @brief TIM0-TIM3 model in virtual time
+ *
+ * TC and PC are computed lazily from the virtual time of the last synchronization, so a timer costs nothing while the
+ * firmware sleeps. The next match that has an effect (interrupt, reset, stop, external match output or DMA request)
+ * is reported to the scheduler, which jumps straight to it. IR is write-one-to-clear and drives the interrupt line.
+ * An edge on a CAPn.m pin selected in PINSEL loads CRm with the TC, as enabled in CCR. In counter mode (CTCR), the
+ * edges of the selected CAPn.m input go through the prescaler to the TC instead of the peripheral clock.
+ */
+
+#include <stddef.h>
+
+#include "lpc17xx_clkpwr.h"
+#include "sim_internal.h"
+
+#define TIM_OFS(reg)   offsetof(LPC_TIM_TypeDef, reg)
+#define TIM_MATCHES    4U
+#define TCR_ENABLE     (1UL << 0)
+#define TCR_RESET      (1UL << 1)
+#define MCR_INT(i)     (1UL << (3 * (i)))
+#define MCR_RESET(i)   (2UL << (3 * (i)))
+#define MCR_STOP(i)    (4UL << (3 * (i)))
+#define MCR_ANY(i)     (7UL << (3 * (i)))
+#define EMR_CTRL(e, i) (((e) >> (4 + 2 * (i))) & 3U)
+#define CCR_RISING(i)  (1UL << (3 * (i)))
+#define CCR_FALLING(i) (2UL << (3 * (i)))
+#define CCR_INT(i)     (4UL << (3 * (i)))
+#define IR_CAPTURE(i)  (1UL << (4 + (i)))
+#define CTCR_MODE      3U
+#define CTCR_RISING    1U
+#define CTCR_FALLING   2U
+#define CTCR_INPUT(c)  (((c) >> 2) & 3U)
+
+typedef struct
+{
+    uint32_t tc;
+    uint32_t pc;
+    uint32_t pr;
+    uint32_t running;
+    uint32_t reset_pending; /* Matched with reset: the next increment goes to 0 */
+    uint64_t sync;          /* Cycle at which tc and pc are valid */
+    uint64_t due;           /* Cycle of the next effective match */
+    uint32_t due_mask;      /* Match registers reached at due */
+} timer_state_t;
+
+static const uint32_t timer_base[4] = {LPC_TIM0_BASE, LPC_TIM1_BASE, LPC_TIM2_BASE, LPC_TIM3_BASE};
+static const uint32_t timer_pclksel[4] = {
+    CLKPWR_PCLKSEL_TIMER0, CLKPWR_PCLKSEL_TIMER1, CLKPWR_PCLKSEL_TIMER2, CLKPWR_PCLKSEL_TIMER3};
+static timer_state_t timers[4];
+
+static LPC_TIM_TypeDef* timer(uint32_t unit)
+{
+    return SIM_REGS(LPC_TIM_TypeDef, timer_base[unit]);
+}
+
+static uint32_t match_value(uint32_t unit, uint32_t match)
+{
+    return (&timer(unit)->MR0)[match];
+}
+
+static void update_line(uint32_t unit)
+{
+    lpc_sim_irq_line(TIMER0_IRQn + (int32_t)unit, timer(unit)->IR != 0);
+}
+
+/* Bring TC and PC up to cycle t */
+static void sync(uint32_t unit, uint64_t t)
+{
+    timer_state_t* state = &timers[unit];
+    LPC_TIM_TypeDef* regs = timer(unit);
+
+    if (state->running && (regs->CTCR & CTCR_MODE) == 0 && t > state->sync)
+    {
+        uint64_t div = sim_pclk_divider(timer_pclksel[unit]);
+        uint64_t total = state->pc + (t / div - state->sync / div);
+        uint64_t increments = total / (state->pr + 1ULL);
+
+        state->pc = (uint32_t)(total % (state->pr + 1ULL));
+        if (increments && state->reset_pending)
+        {
+            state->tc = 0;
+            state->reset_pending = 0;
+            increments--;
+        }
+        state->tc += (uint32_t)increments;
+    }
+    state->sync = t;
+    regs->TC = state->tc;
+    regs->PC = state->pc;
+}
+
+static uint32_t match_has_effect(uint32_t unit, uint32_t match)
+{
+    const LPC_TIM_TypeDef* regs = timer(unit);
+    uint32_t dma = (match < 2) && ((SIM_REGS(LPC_SC_TypeDef, LPC_SC_BASE)->DMAREQSEL >> (unit * 2 + match)) & 1U);
+
+    return (regs->MCR & MCR_ANY(match)) || EMR_CTRL(regs->EMR, match) || dma;
+}
+
+/* Cycle at which TC reaches value, counted from the synchronized state */
+static uint64_t match_time(uint32_t unit, uint32_t value)
+{
+    const timer_state_t* state = &timers[unit];
+    uint64_t div = sim_pclk_divider(timer_pclksel[unit]);
+    uint64_t period = state->pr + 1ULL;
+    uint64_t increments;
+    uint64_t edges;
+
+    if (state->reset_pending)
+    {
+        increments = 1ULL + value;
+    }
+    else
+    {
+        uint32_t distance = value - state->tc;
+        increments = distance ? distance : (1ULL << 32);
+    }
+
+    edges = (period - state->pc) + (increments - 1) * period;
+    return (state->sync / div + edges) * div;
+}
+
+static uint64_t timer_next(uint64_t now)
+{
+    uint64_t best = SIM_NEVER;
+
+    for (uint32_t unit = 0; unit < 4; unit++)
+    {
+        timer_state_t* state = &timers[unit];
+
+        if (state->running && state->due <= now)
+        {
+            /* Reached but not fired yet, behind another event of the same cycle: TC already equals MR */
+            best = (state->due < best) ? state->due : best;
+            continue;
+        }
+        state->due = SIM_NEVER;
+        state->due_mask = 0;
+        if (!state->running || (timer(unit)->CTCR & CTCR_MODE) != 0)
+        {
+            continue;
+        }
+
+        sync(unit, now);
+        for (uint32_t match = 0; match < TIM_MATCHES; match++)
+        {
+            if (!match_has_effect(unit, match))
+            {
+                continue;
+            }
+            uint64_t when = match_time(unit, match_value(unit, match));
+            if (when < state->due)
+            {
+                state->due = when;
+                state->due_mask = 1UL << match;
+            }
+            else if (when == state->due)
+            {
+                state->due_mask |= 1UL << match;
+            }
+        }
+        best = (state->due < best) ? state->due : best;
+    }
+    return best;
+}
+
+static void external_match(uint32_t unit, uint32_t match)
+{
+    static const uint32_t adc_start[4][TIM_MATCHES] = {{0, 4, 0, 5}, {6, 7, 0, 0}, {0}, {0}};
+    LPC_TIM_TypeDef* regs = timer(unit);
+    uint32_t before = (regs->EMR >> match) & 1U;
+    uint32_t after = before;
+
+    switch (EMR_CTRL(regs->EMR, match))
+    {
+        case 1: after = 0; break;
+        case 2: after = 1; break;
+        case 3: after = !before; break;
+        default: break;
+    }
+
+    if (after != before)
+    {
+        regs->EMR ^= 1UL << match;
+        sim_gpio_match_pin((uint8_t)unit, (uint8_t)match, after);
+        if (adc_start[unit][match])
+        {
+            /* MAT0.1, MAT0.3, MAT1.0 and MAT1.1 can start ADC conversions */
+            sim_adc_start_edge(adc_start[unit][match], after);
+        }
+    }
+}
+
+/* Actions of a match: interrupt flag, reset, stop, external match output and DMA request */
+static void match_event(uint32_t unit, uint32_t match)
+{
+    timer_state_t* state = &timers[unit];
+    LPC_TIM_TypeDef* regs = timer(unit);
+
+    if (regs->MCR & MCR_INT(match))
+    {
+        regs->IR |= 1UL << match;
+    }
+    if (regs->MCR & MCR_RESET(match))
+    {
+        state->reset_pending = 1;
+    }
+    if (regs->MCR & MCR_STOP(match))
+    {
+        state->running = 0;
+        regs->TCR &= ~TCR_ENABLE;
+    }
+    external_match(unit, match);
+    if (match < 2 && ((SIM_REGS(LPC_SC_TypeDef, LPC_SC_BASE)->DMAREQSEL >> (unit * 2 + match)) & 1U))
+    {
+        sim_gpdma_request((uint8_t)(8 + unit * 2 + match));
+    }
+}
+
+static void timer_fire(uint64_t now)
+{
+    for (uint32_t unit = 0; unit < 4; unit++)
+    {
+        timer_state_t* state = &timers[unit];
+
+        if (state->due != now)
+        {
+            continue;
+        }
+
+        sync(unit, now);
+        for (uint32_t match = 0; match < TIM_MATCHES; match++)
+        {
+            if (state->due_mask & (1UL << match))
+            {
+                match_event(unit, match);
+            }
+        }
+        state->due = SIM_NEVER;
+        update_line(unit);
+    }
+}
+
+/* Counter mode: one edge of the CAPn.m input selected in CTCR, through the prescaler */
+static void count_edge(uint32_t unit)
+{
+    timer_state_t* state = &timers[unit];
+    LPC_TIM_TypeDef* regs = timer(unit);
+
+    if (++state->pc <= state->pr)
+    {
+        regs->PC = state->pc;
+        return;
+    }
+    state->pc = 0;
+    state->tc = state->reset_pending ? 0 : state->tc + 1;
+    state->reset_pending = 0;
+    regs->TC = state->tc;
+    regs->PC = 0;
+    for (uint32_t match = 0; match < TIM_MATCHES; match++)
+    {
+        if (match_value(unit, match) == state->tc && match_has_effect(unit, match))
+        {
+            match_event(unit, match);
+        }
+    }
+    update_line(unit);
+}
+
+void sim_timer_capture_pin(uint8_t unit, uint8_t channel, uint32_t level)
+{
+    LPC_TIM_TypeDef* regs = timer(unit);
+    uint32_t mode = regs->CTCR & CTCR_MODE;
+
+    if (mode != 0 && timers[unit].running && CTCR_INPUT(regs->CTCR) == channel &&
+        (mode & (level ? CTCR_RISING : CTCR_FALLING)))
+    {
+        count_edge(unit);
+    }
+
+    if (!(regs->CCR & (level ? CCR_RISING(channel) : CCR_FALLING(channel))))
+    {
+        return;
+    }
+
+    sync(unit, sim_now());
+    *((volatile uint32_t*)&regs->CR0 + channel) = timers[unit].tc;
+    if (regs->CCR & CCR_INT(channel))
+    {
+        regs->IR |= IR_CAPTURE(channel);
+        update_line(unit);
+    }
+}
+
+static void timer_read(const sim_model_t* model, uint32_t offset)
+{
+    if (offset == TIM_OFS(TC) || offset == TIM_OFS(PC))
+    {
+        sync(model->unit, sim_now());
+    }
+}
+
+static void timer_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    timer_state_t* state = &timers[model->unit];
+    LPC_TIM_TypeDef* regs = timer(model->unit);
+
+    /* Count with the configuration in force before the write */
+    sync(model->unit, sim_now());
+
+    if (offset == TIM_OFS(IR))
+    {
+        regs->IR = old & ~value;
+        update_line(model->unit);
+    }
+    else if (offset == TIM_OFS(TCR))
+    {
+        state->running = (value & (TCR_ENABLE | TCR_RESET)) == TCR_ENABLE;
+        if (value & TCR_RESET)
+        {
+            state->tc = 0;
+            state->pc = 0;
+            state->reset_pending = 0;
+        }
+    }
+    else if (offset == TIM_OFS(PR))
+    {
+        state->pr = value;
+    }
+    else if (offset == TIM_OFS(TC))
+    {
+        state->tc = value;
+        state->reset_pending = 0;
+    }
+    else if (offset == TIM_OFS(PC))
+    {
+        state->pc = value;
+    }
+    else if (offset == TIM_OFS(EMR))
+    {
+        /* The external match outputs follow the bits written */
+        for (uint32_t match = 0; match < TIM_MATCHES; match++)
+        {
+            if (((old ^ value) >> match) & 1U)
+            {
+                sim_gpio_match_pin((uint8_t)model->unit, (uint8_t)match, (value >> match) & 1U);
+            }
+        }
+    }
+    regs->TC = state->tc;
+    regs->PC = state->pc;
+}
+
+static void timer_reset(const sim_model_t* model)
+{
+    timers[model->unit] = (timer_state_t){0, 0, 0, 0, 0, 0, SIM_NEVER, 0};
+}
+
+#define TIMER_MODEL(n) {"TIM" #n, LPC_TIM##n##_BASE, SIM_PAGE_SIZE, n, timer_reset, timer_read, NULL, timer_write}
+
+const sim_model_t sim_timer_models[4] = {TIMER_MODEL(0), TIMER_MODEL(1), TIMER_MODEL(2), TIMER_MODEL(3)};
+
+const sim_event_source_t sim_timer_events = {timer_next, timer_fire};
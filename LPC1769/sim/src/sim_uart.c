@@ -0,0 +1,278 @@
+/*
+ * @file sim_uart.c
+ * @brief UART0-UART3 model
+ *
+ * Transmission is instantaneous: every byte written to THR is appended to a capture buffer read by the test bench
+ * and THR is immediately empty again. Received bytes are pushed by the test bench into a receive FIFO that RBR pops.
+ * The divisor latches, the IIR interrupt identification, LSR status and the DMA requests follow the user manual.
+ */
+
+#include <stddef.h>
+
+#include "sim_internal.h"
+
+#define UART_OFS_RBR     0x00U
+#define UART_OFS_IER     0x04U
+#define UART_OFS_IIR     0x08U
+#define UART_OFS_LSR     0x14U
+#define UART_OFS_FIFOLVL 0x58U
+
+#define LCR_DLAB     0x80U
+#define LSR_RDR      0x01U
+#define LSR_OE       0x02U
+#define LSR_THRE     0x20U
+#define LSR_TEMT     0x40U
+#define IER_RBR      0x01U
+#define IER_THRE     0x02U
+#define IER_RLS      0x04U
+#define IIR_NONE     0x01U
+#define IIR_THRE     0x02U
+#define IIR_RDA      0x04U
+#define IIR_RLS      0x06U
+#define IIR_FIFO_ON  0xC0U
+#define FCR_ENABLE   0x01U
+#define FCR_RX_RESET 0x02U
+#define FCR_TX_RESET 0x04U
+#define FCR_DMA      0x08U
+
+typedef struct
+{
+    uint8_t data[LPC_SIM_UART_BUFFER_SIZE];
+    uint32_t head;
+    uint32_t count;
+} byte_ring_t;
+
+typedef struct
+{
+    byte_ring_t rx;
+    byte_ring_t tx;
+    uint8_t dll;
+    uint8_t dlm;
+    uint32_t ier;
+    uint32_t fcr;
+    uint32_t thre_pending;
+    uint32_t overrun;
+} uart_state_t;
+
+static const uint32_t uart_base[4] = {LPC_UART0_BASE, LPC_UART1_BASE, LPC_UART2_BASE, LPC_UART3_BASE};
+static const int32_t uart_irq[4] = {UART0_IRQn, UART1_IRQn, UART2_IRQn, UART3_IRQn};
+static uart_state_t uarts[4];
+
+static volatile uint32_t* reg(uint32_t unit, uint32_t offset)
+{
+    return (volatile uint32_t*)sim_shadow(uart_base[unit] + offset);
+}
+
+static uint32_t dlab(uint32_t unit)
+{
+    return (*reg(unit, 0x0C) & LCR_DLAB) != 0;
+}
+
+static uint32_t ring_push(byte_ring_t* ring, uint8_t byte)
+{
+    if (ring->count == LPC_SIM_UART_BUFFER_SIZE)
+    {
+        return 0;
+    }
+    ring->data[(ring->head + ring->count) % LPC_SIM_UART_BUFFER_SIZE] = byte;
+    ring->count++;
+    return 1;
+}
+
+static uint8_t ring_pop(byte_ring_t* ring)
+{
+    uint8_t byte = ring->data[ring->head];
+    ring->head = (ring->head + 1) % LPC_SIM_UART_BUFFER_SIZE;
+    ring->count--;
+    return byte;
+}
+
+static uint32_t dma_line(uint32_t unit, uint32_t rx)
+{
+    uint32_t line = 8 + unit * 2 + rx;
+    uint32_t timer_selected = (SIM_REGS(LPC_SC_TypeDef, LPC_SC_BASE)->DMAREQSEL >> (line - 8)) & 1U;
+    return timer_selected ? 0xFF : line;
+}
+
+static void update(uint32_t unit)
+{
+    uart_state_t* uart = &uarts[unit];
+    uint32_t level = ((uart->ier & IER_RBR) && uart->rx.count) || ((uart->ier & IER_THRE) && uart->thre_pending) ||
+                     ((uart->ier & IER_RLS) && uart->overrun);
+
+    lpc_sim_irq_line(uart_irq[unit], level);
+
+    if (uart->fcr & FCR_DMA)
+    {
+        if (uart->rx.count && dma_line(unit, 1) != 0xFF)
+        {
+            sim_gpdma_request((uint8_t)dma_line(unit, 1));
+        }
+        if (dma_line(unit, 0) != 0xFF)
+        {
+            sim_gpdma_request((uint8_t)dma_line(unit, 0));
+        }
+    }
+}
+
+static void uart_read(const sim_model_t* model, uint32_t offset)
+{
+    uint32_t unit = model->unit;
+    uart_state_t* uart = &uarts[unit];
+
+    switch (offset)
+    {
+        case UART_OFS_RBR:
+            *reg(unit, offset) = dlab(unit) ? uart->dll : (uart->rx.count ? uart->rx.data[uart->rx.head] : 0);
+            break;
+        case UART_OFS_IER: *reg(unit, offset) = dlab(unit) ? uart->dlm : uart->ier; break;
+        case UART_OFS_IIR:
+        {
+            uint32_t iir = IIR_NONE;
+            if ((uart->ier & IER_RLS) && uart->overrun)
+            {
+                iir = IIR_RLS;
+            }
+            else if ((uart->ier & IER_RBR) && uart->rx.count)
+            {
+                iir = IIR_RDA;
+            }
+            else if ((uart->ier & IER_THRE) && uart->thre_pending)
+            {
+                iir = IIR_THRE;
+            }
+            *reg(unit, offset) = iir | ((uart->fcr & FCR_ENABLE) ? IIR_FIFO_ON : 0);
+            break;
+        }
+        case UART_OFS_LSR:
+            *reg(unit, offset) =
+                (uart->rx.count ? LSR_RDR : 0) | (uart->overrun ? LSR_OE : 0) | LSR_THRE | LSR_TEMT;
+            break;
+        case UART_OFS_FIFOLVL: *reg(unit, offset) = (uart->rx.count > 16) ? 16 : uart->rx.count; break;
+        default: break;
+    }
+}
+
+static void uart_read_done(const sim_model_t* model, uint32_t offset)
+{
+    uint32_t unit = model->unit;
+    uart_state_t* uart = &uarts[unit];
+
+    if (offset == UART_OFS_RBR && !dlab(unit) && uart->rx.count)
+    {
+        ring_pop(&uart->rx);
+    }
+    else if (offset == UART_OFS_IIR && (*reg(unit, offset) & 0x0FU) == IIR_THRE)
+    {
+        uart->thre_pending = 0; /* Reading IIR acknowledges the THRE interrupt */
+    }
+    else if (offset == UART_OFS_LSR)
+    {
+        uart->overrun = 0;
+    }
+    else
+    {
+        return;
+    }
+    update(unit);
+}
+
+static void uart_write(const sim_model_t* model, uint32_t offset, uint32_t old, uint32_t value)
+{
+    uint32_t unit = model->unit;
+    uart_state_t* uart = &uarts[unit];
+
+    (void)old;
+
+    switch (offset)
+    {
+        case UART_OFS_RBR:
+            if (dlab(unit))
+            {
+                uart->dll = (uint8_t)value;
+            }
+            else
+            {
+                ring_push(&uart->tx, (uint8_t)value);
+                uart->thre_pending = 1; /* The byte leaves at once, THR is empty again */
+            }
+            break;
+        case UART_OFS_IER:
+            if (dlab(unit))
+            {
+                uart->dlm = (uint8_t)value;
+            }
+            else
+            {
+                if ((value & IER_THRE) && !(uart->ier & IER_THRE))
+                {
+                    uart->thre_pending = 1;
+                }
+                uart->ier = value & 0x307U;
+            }
+            break;
+        case UART_OFS_IIR:
+            uart->fcr = value & 0xFFU;
+            if (value & FCR_RX_RESET)
+            {
+                uart->rx.head = uart->rx.count = 0;
+            }
+            break;
+        default: return;
+    }
+    update(unit);
+}
+
+static void uart_reset(const sim_model_t* model)
+{
+    uart_state_t* uart = &uarts[model->unit];
+
+    uart->rx.head = uart->rx.count = 0;
+    uart->tx.head = uart->tx.count = 0;
+    uart->dll = 1;
+    uart->dlm = 0;
+    uart->ier = 0;
+    uart->fcr = 0;
+    uart->thre_pending = 0;
+    uart->overrun = 0;
+}
+
+uint32_t lpc_sim_uart_rx_push(uint8_t unit, const uint8_t* data, uint32_t len)
+{
+    uint32_t accepted = 0;
+
+    if (unit > 3)
+    {
+        return 0;
+    }
+    while (accepted < len && ring_push(&uarts[unit].rx, data[accepted]))
+    {
+        accepted++;
+    }
+    if (accepted < len)
+    {
+        uarts[unit].overrun = 1;
+    }
+    update(unit);
+    sim_irq_check();
+    return accepted;
+}
+
+uint32_t lpc_sim_uart_tx_pop(uint8_t unit, uint8_t* data, uint32_t max)
+{
+    uint32_t copied = 0;
+
+    if (unit > 3)
+    {
+        return 0;
+    }
+    while (copied < max && uarts[unit].tx.count)
+    {
+        data[copied++] = ring_pop(&uarts[unit].tx);
+    }
+    return copied;
+}
+
+#define UART_MODEL(n) {"UART" #n, LPC_UART##n##_BASE, SIM_PAGE_SIZE, n, uart_reset, uart_read, uart_read_done, uart_write}
+
+const sim_model_t sim_uart_models[4] = {UART_MODEL(0), UART_MODEL(1), UART_MODEL(2), UART_MODEL(3)};
@@ -0,0 +1,140 @@
+/*
+ * @file sim_vectors.c
+ * @brief Host vector table, the counterpart of startup_LPC17xx.c
+ *
+ * Handlers are weak aliases of a default handler, so the firmware overrides them simply by defining a function with
+ * the same name, as it does on the target.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim_internal.h"
+
+#define ALIAS(f) __attribute__((weak, alias(#f)))
+
+static void sim_default_handler(void)
+{
+    fprintf(stderr, "lpc_sim: unhandled exception\n");
+    abort();
+}
+
+void NMI_Handler(void) ALIAS(sim_default_handler);
+void HardFault_Handler(void) ALIAS(sim_default_handler);
+void MemManage_Handler(void) ALIAS(sim_default_handler);
+void BusFault_Handler(void) ALIAS(sim_default_handler);
+void UsageFault_Handler(void) ALIAS(sim_default_handler);
+void SVC_Handler(void) ALIAS(sim_default_handler);
+void DebugMon_Handler(void) ALIAS(sim_default_handler);
+void PendSV_Handler(void) ALIAS(sim_default_handler);
+void SysTick_Handler(void) ALIAS(sim_default_handler);
+
+void WDT_IRQHandler(void) ALIAS(sim_default_handler);
+void TIMER0_IRQHandler(void) ALIAS(sim_default_handler);
+void TIMER1_IRQHandler(void) ALIAS(sim_default_handler);
+void TIMER2_IRQHandler(void) ALIAS(sim_default_handler);
+void TIMER3_IRQHandler(void) ALIAS(sim_default_handler);
+void UART0_IRQHandler(void) ALIAS(sim_default_handler);
+void UART1_IRQHandler(void) ALIAS(sim_default_handler);
+void UART2_IRQHandler(void) ALIAS(sim_default_handler);
+void UART3_IRQHandler(void) ALIAS(sim_default_handler);
+void PWM1_IRQHandler(void) ALIAS(sim_default_handler);
+void I2C0_IRQHandler(void) ALIAS(sim_default_handler);
+void I2C1_IRQHandler(void) ALIAS(sim_default_handler);
+void I2C2_IRQHandler(void) ALIAS(sim_default_handler);
+void SPI_IRQHandler(void) ALIAS(sim_default_handler);
+void SSP0_IRQHandler(void) ALIAS(sim_default_handler);
+void SSP1_IRQHandler(void) ALIAS(sim_default_handler);
+void PLL0_IRQHandler(void) ALIAS(sim_default_handler);
+void RTC_IRQHandler(void) ALIAS(sim_default_handler);
+void EINT0_IRQHandler(void) ALIAS(sim_default_handler);
+void EINT1_IRQHandler(void) ALIAS(sim_default_handler);
+void EINT2_IRQHandler(void) ALIAS(sim_default_handler);
+void EINT3_IRQHandler(void) ALIAS(sim_default_handler);
+void ADC_IRQHandler(void) ALIAS(sim_default_handler);
+void BOD_IRQHandler(void) ALIAS(sim_default_handler);
+void USB_IRQHandler(void) ALIAS(sim_default_handler);
+void CAN_IRQHandler(void) ALIAS(sim_default_handler);
+void DMA_IRQHandler(void) ALIAS(sim_default_handler);
+void I2S_IRQHandler(void) ALIAS(sim_default_handler);
+void ENET_IRQHandler(void) ALIAS(sim_default_handler);
+void RIT_IRQHandler(void) ALIAS(sim_default_handler);
+void MCPWM_IRQHandler(void) ALIAS(sim_default_handler);
+void QEI_IRQHandler(void) ALIAS(sim_default_handler);
+void PLL1_IRQHandler(void) ALIAS(sim_default_handler);
+void USBActivity_IRQHandler(void) ALIAS(sim_default_handler);
+void CANActivity_IRQHandler(void) ALIAS(sim_default_handler);
+
+void (*const sim_vectors[16 + 35])(void) = {
+    /* Core exceptions, indexed by exception number */
+    sim_default_handler, /* 0, initial stack pointer slot */
+    sim_default_handler, /* 1, reset */
+    NMI_Handler,
+    HardFault_Handler,
+    MemManage_Handler,
+    BusFault_Handler,
+    UsageFault_Handler,
+    sim_default_handler,
+    sim_default_handler,
+    sim_default_handler,
+    sim_default_handler,
+    SVC_Handler,
+    DebugMon_Handler,
+    sim_default_handler,
+    PendSV_Handler,
+    SysTick_Handler,
+
+    /* Device interrupts, exception number 16 + IRQn */
+    WDT_IRQHandler,
+    TIMER0_IRQHandler,
+    TIMER1_IRQHandler,
+    TIMER2_IRQHandler,
+    TIMER3_IRQHandler,
+    UART0_IRQHandler,
+    UART1_IRQHandler,
+    UART2_IRQHandler,
+    UART3_IRQHandler,
+    PWM1_IRQHandler,
+    I2C0_IRQHandler,
+    I2C1_IRQHandler,
+    I2C2_IRQHandler,
+    SPI_IRQHandler,
+    SSP0_IRQHandler,
+    SSP1_IRQHandler,
+    PLL0_IRQHandler,
+    RTC_IRQHandler,
+    EINT0_IRQHandler,
+    EINT1_IRQHandler,
+    EINT2_IRQHandler,
+    EINT3_IRQHandler,
+    ADC_IRQHandler,
+    BOD_IRQHandler,
+    USB_IRQHandler,
+    CAN_IRQHandler,
+    DMA_IRQHandler,
+    I2S_IRQHandler,
+    ENET_IRQHandler,
+    RIT_IRQHandler,
+    MCPWM_IRQHandler,
+    QEI_IRQHandler,
+    PLL1_IRQHandler,
+    USBActivity_IRQHandler,
+    CANActivity_IRQHandler,
+};
+
+static const char* const exception_names[16 + 35] = {
+    /* Core exceptions */
+    "SP", "Reset", "NMI", "HardFault", "MemManage", "BusFault", "UsageFault", "Reserved",
+    "Reserved", "Reserved", "Reserved", "SVC", "DebugMon", "Reserved", "PendSV", "SysTick",
+    /* Device interrupts */
+    "WDT", "TIMER0", "TIMER1", "TIMER2", "TIMER3", "UART0", "UART1", "UART2",
+    "UART3", "PWM1", "I2C0", "I2C1", "I2C2", "SPI", "SSP0", "SSP1",
+    "PLL0", "RTC", "EINT0", "EINT1", "EINT2", "EINT3", "ADC", "BOD",
+    "USB", "CAN", "DMA", "I2S", "ENET", "RIT", "MCPWM", "QEI",
+    "PLL1", "USBActivity", "CANActivity",
+};
+
+const char* sim_exception_name(uint32_t exception)
+{
+    return (exception < sizeof(exception_names) / sizeof(exception_names[0])) ? exception_names[exception] : "?";
+}
@@ -0,0 +1,267 @@
+/*
+ * @file adcscan_test.c
+ * @brief Rings of the burst mode ADC scanner (lpc17xx_adcscan), run by 'make test'
+ *
+ * AD0.0, AD0.2, AD0.5 and AD0.7 are scanned at 200 kHz. The source of the ADC returns channel * 512 plus the number of
+ * the conversion of the channel modulo 512, so each sample tells its channel and its place in the stream:
+ * - 10 ms of scan: every word sorted lands in the ring of its channel, in order, and the channels out of the mask
+ *   stay empty. The numbers of conversions and DMA interrupts are printed;
+ * - READS reads of 1 to ADCSCAN_RING_SIZE samples at pseudo-random times, a third of them across the end of the ring:
+ *   ADCSCAN_GetLatest() returns the last samples stored, contiguous and oldest first;
+ * - a halt of the GPDMA channel leaves an OVERRUN word, and a DMA request without a conversion a word without DONE:
+ *   both are dropped and counted, and no other sample is lost;
+ * - an interrupt served 2.5 blocks late sorts the block the GPDMA completed last, not the one it is writing: one
+ *   block is lost, and no sample comes back or twice.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_adcscan.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_sim.h"
+
+#define MASK      (ADCSCAN_CH(0) | ADCSCAN_CH(2) | ADCSCAN_CH(5) | ADCSCAN_CH(7))
+#define RATE      200000U
+#define READS     5000U
+#define ADC_LINE  4U /* GPDMA request line of the ADC, GPDMA_CONN_ADC */
+#define BLOCK_US  (ADCSCAN_BLOCK_SIZE * 65U / 12U) /* A block of 65 clock conversions at 12.5 MHz, in us */
+#define CYCLES_US (SystemCoreClock / 1000000)
+
+static uint32_t conversions[ADCSCAN_CHANNELS];
+static volatile uint32_t dma_irqs;
+
+/* Samples read back per channel: the count seen, the last sample and the steps that were not +1 */
+static uint32_t seen[ADCSCAN_CHANNELS];
+static uint32_t last_code[ADCSCAN_CHANNELS];
+static uint32_t gaps;
+static uint32_t backward;
+static uint32_t misplaced;
+
+static uint32_t seed = 3;
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+void DMA_IRQHandler(void)
+{
+    dma_irqs++;
+    GPDMA_IntHandler();
+}
+
+static uint16_t source(uint8_t channel)
+{
+    return (uint16_t)(channel * 512U + conversions[channel]++ % 512U);
+}
+
+static uint32_t random_value(uint32_t range)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % range;
+}
+
+/* GPDMA channel the scanner got: the one enabled on the ADC request line */
+static LPC_GPDMACH_TypeDef* scan_channel(void)
+{
+    for (uint32_t n = 0; n < 8; n++)
+    {
+        LPC_GPDMACH_TypeDef* ch = (LPC_GPDMACH_TypeDef*)(LPC_GPDMACH0_BASE + (n << 5));
+
+        if ((ch->DMACCConfig & GPDMA_DMACCxConfig_E) &&
+            ((ch->DMACCConfig & GPDMA_DMACCxConfig_SrcPeripheral(0x1F)) == GPDMA_DMACCxConfig_SrcPeripheral(ADC_LINE)))
+        {
+            return ch;
+        }
+    }
+    return NULL;
+}
+
+/* Reads the samples stored since the last call, and checks each one against the previous one of its channel */
+static void collect(void)
+{
+    for (uint8_t c = 0; c < ADCSCAN_CHANNELS; c++)
+    {
+        uint32_t count = ADCSCAN_GetCount(c);
+        uint32_t fresh = count - seen[c];
+        const uint16_t* samples;
+
+        if (!(MASK & ADCSCAN_CH(c)) || (fresh == 0))
+        {
+            continue;
+        }
+        fresh = (fresh > ADCSCAN_RING_SIZE) ? ADCSCAN_RING_SIZE : fresh;
+        samples = ADCSCAN_GetLatest(c, fresh);
+        for (uint32_t i = 0; (samples != NULL) && (i < fresh); i++)
+        {
+            uint32_t step = (samples[i] + 512U - last_code[c]) % 512U;
+
+            misplaced += (samples[i] / 512U != c);
+            if (seen[c] + i > 0)
+            {
+                gaps += (step != 1);
+                backward += (step == 0) || (step >= 256);
+            }
+            last_code[c] = samples[i];
+        }
+        seen[c] = count;
+    }
+}
+
+/* Lets the scan run, reading the rings every 100 us */
+static void run(uint32_t us)
+{
+    for (uint32_t t = 0; t < us; t += 100)
+    {
+        lpc_sim_advance(100 * CYCLES_US);
+        collect();
+    }
+}
+
+static void test_demux(void)
+{
+    uint32_t total = 0;
+    uint32_t sorted = 0;
+    uint32_t dropped = 0;
+    uint32_t empty = 0;
+    char line[128];
+
+    run(10000);
+    for (uint8_t c = 0; c < ADCSCAN_CHANNELS; c++)
+    {
+        ADCSCAN_Stats_Type stats;
+
+        ADCSCAN_GetStats(c, &stats);
+        total += conversions[c];
+        sorted += stats.Samples + stats.Dropped;
+        dropped += stats.Dropped;
+        empty += !(MASK & ADCSCAN_CH(c)) && (stats.Samples == 0) && (ADCSCAN_GetLatest(c, 1) == NULL);
+    }
+
+    snprintf(line, sizeof(line), "10 ms: %lu conversions, %lu words sorted by %lu DMA interrupts, %lu dropped",
+             (unsigned long)total, (unsigned long)sorted, (unsigned long)dma_irqs, (unsigned long)dropped);
+    check((sorted == dma_irqs * ADCSCAN_BLOCK_SIZE) && (total - sorted < 2 * ADCSCAN_BLOCK_SIZE) && (dropped == 0),
+          line);
+    snprintf(line, sizeof(line), "every sample in the ring of its channel and in order: %lu misplaced, %lu gaps",
+             (unsigned long)misplaced, (unsigned long)gaps);
+    check((misplaced == 0) && (gaps == 0), line);
+    check(empty == ADCSCAN_CHANNELS - 4, "the channels out of the mask stay empty");
+    check((ADCSCAN_GetLatest(0, ADCSCAN_RING_SIZE + 1) == NULL) && (ADCSCAN_GetLatest(8, 1) == NULL),
+          "ADCSCAN_GetLatest() rejects ADCSCAN_RING_SIZE + 1 samples and channel 8");
+}
+
+/* Without drops, sample k of a channel is its conversion k */
+static void test_latest(void)
+{
+    static const uint8_t channels[4] = {0, 2, 5, 7};
+    uint32_t wrapped = 0;
+    uint32_t bad = 0;
+    char line[128];
+
+    for (uint32_t i = 0; i < READS; i++)
+    {
+        uint8_t c = channels[random_value(4)];
+        uint32_t count = 1 + random_value(ADCSCAN_RING_SIZE);
+        uint32_t head;
+        const uint16_t* samples;
+
+        lpc_sim_advance((1 + random_value(200)) * CYCLES_US);
+        head = ADCSCAN_GetCount(c);
+        samples = ADCSCAN_GetLatest(c, count);
+        wrapped += ((head - count) % ADCSCAN_RING_SIZE + count > ADCSCAN_RING_SIZE);
+        for (uint32_t k = 0; k < count; k++)
+        {
+            bad += (samples == NULL) || (samples[k] != c * 512U + (head - count + k) % 512U);
+        }
+    }
+    collect();
+
+    snprintf(line, sizeof(line), "%lu reads, %lu across the end of the ring: %lu samples not the last stored",
+             (unsigned long)READS, (unsigned long)wrapped, (unsigned long)bad);
+    check((bad == 0) && (wrapped > READS / 4), line);
+}
+
+static void test_drops(void)
+{
+    LPC_GPDMACH_TypeDef* ch = scan_channel();
+    uint32_t dropped = 0;
+    uint32_t on_channels = 0;
+    char line[128];
+
+    check(ch != NULL, "the scanner holds a GPDMA channel on the ADC request");
+    if (ch == NULL)
+    {
+        return;
+    }
+    gaps = 0;
+
+    // The ADC converts 6 times while the channel is halted: the first word read after it has OVERRUN set
+    ch->DMACCConfig |= GPDMA_DMACCxConfig_H;
+    lpc_sim_advance(30 * CYCLES_US);
+    ch->DMACCConfig &= ~GPDMA_DMACCxConfig_H;
+    run(2 * BLOCK_US);
+
+    // A request without a conversion reads ADGDR again, with DONE clear
+    lpc_sim_dma_request(ADC_LINE);
+    run(3 * BLOCK_US);
+
+    for (uint8_t c = 0; c < ADCSCAN_CHANNELS; c++)
+    {
+        ADCSCAN_Stats_Type stats;
+
+        ADCSCAN_GetStats(c, &stats);
+        dropped += stats.Dropped;
+        on_channels += (stats.Dropped != 0);
+    }
+    snprintf(line, sizeof(line), "%lu words dropped on %lu channels, %lu gaps in the samples, %lu misplaced",
+             (unsigned long)dropped, (unsigned long)on_channels, (unsigned long)gaps, (unsigned long)misplaced);
+    // The halt loses 6 conversions and the OVERRUN word: one gap in each of the 4 channels at most
+    check((dropped == 2) && (gaps <= 4) && (misplaced == 0), line);
+}
+
+static void test_late(void)
+{
+    uint32_t irqs;
+    char line[128];
+
+    gaps = 0;
+    backward = 0;
+    run(BLOCK_US);
+    irqs = dma_irqs;
+    __disable_irq();
+    lpc_sim_advance(BLOCK_US * 5 / 2 * CYCLES_US);
+    __enable_irq();
+    run(10 * BLOCK_US);
+
+    snprintf(line, sizeof(line), "an interrupt 2.5 blocks late: %lu gaps, %lu samples back or twice, %lu misplaced",
+             (unsigned long)gaps, (unsigned long)backward, (unsigned long)misplaced);
+    check((gaps >= 1) && (gaps <= 4) && (backward == 0) && (misplaced == 0) && (dma_irqs - irqs >= 10), line);
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    lpc_sim_adc_set_source(source);
+    GPDMA_Init();
+
+    check(ADCSCAN_Start() == ERROR, "ADCSCAN_Start() rejects a scan before ADCSCAN_Init()");
+    check(ADCSCAN_Init(0, RATE) == ERROR, "ADCSCAN_Init() rejects an empty mask");
+    check(ADCSCAN_Init(MASK, RATE) == SUCCESS, "ADCSCAN_Init() of AD0.0, AD0.2, AD0.5 and AD0.7 at 200 kHz");
+    NVIC_EnableIRQ(DMA_IRQn);
+    check(ADCSCAN_Start() == SUCCESS, "ADCSCAN_Start()");
+    check(ADCSCAN_GetLatest(0, 1) == NULL, "no sample before the first block");
+
+    test_demux();
+    test_latest();
+    test_drops();
+    test_late();
+    ADCSCAN_Stop();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
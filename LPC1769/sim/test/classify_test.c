@@ -0,0 +1,255 @@
+/*
+ * @file classify_test.c
+ * @brief Bands of the shared classifier (lib/band_classify) and of the lpc17xx_classify driver, run by 'make test'
+ *
+ * - BAND_Update() on tenths of a degree, as the STM32 DMA example calls it, negative readings included: a reading must
+ *   pass a threshold by the hysteresis on either side, may skip bands, and the debounce count restarts on a reading
+ *   back in the band or in another band;
+ * - READINGS noisy readings of three inputs of CLASSIFY_Update(), around the thresholds, with a debounce of 0, 1 and
+ *   4: the band follows a model of the rules at every reading, the pins of P0 show the band, and the pins are written
+ *   (one read of FIOMASK, three writes) only when the band changes, with one callback each;
+ * - CLASSIFY_SetTable() classifies the next reading at once, without hysteresis.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "band_classify.h"
+#include "lpc17xx_classify.h"
+#include "lpc17xx_gpio.h"
+#include "lpc17xx_sim.h"
+
+#define READINGS   200000U
+#define INPUTS     3U
+#define HYSTERESIS 30U
+
+/* Reference model of an input, written from the rules rather than from the code */
+typedef struct
+{
+    int32_t band;
+    int32_t candidate;
+    uint32_t seen;
+} model_t;
+
+static const uint16_t thresholds[3] = {1000, 2000, 3000};
+static const uint32_t pins[INPUTS][4] = {
+    {1UL << 0, 1UL << 1, 1UL << 2, 1UL << 3},
+    {1UL << 4, 1UL << 5, 1UL << 6, 1UL << 7},
+    {1UL << 8, 1UL << 9, 1UL << 10, 1UL << 11},
+};
+static const uint8_t channels[INPUTS] = {0, 3, 5};
+static const CLASSIFY_Table_Type tables[INPUTS] = {
+    {thresholds, pins[0], 4, 0, HYSTERESIS, 0},
+    {thresholds, pins[1], 4, 0, HYSTERESIS, 1},
+    {thresholds, pins[2], 4, 0, HYSTERESIS, 4},
+};
+
+static uint32_t callbacks[CLASSIFY_CHANNELS];
+static uint32_t bad_previous;
+static uint8_t last_band[CLASSIFY_CHANNELS];
+
+static uint32_t seed = 5;
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+static uint32_t random_value(uint32_t range)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % range;
+}
+
+static void on_change(uint8_t channel, uint8_t band, uint8_t previous, void* arg)
+{
+    (void)arg;
+    callbacks[channel]++;
+    bad_previous += (previous != last_band[channel]);
+    last_band[channel] = band;
+}
+
+/* Leaving band b upward takes thresholds[b] + hysteresis, downward thresholds[b - 1] - hysteresis - 1 */
+static int model_update(model_t* model, uint32_t debounce, int32_t reading)
+{
+    int32_t target = model->band;
+
+    if (model->band < 0)
+    {
+        model->band = 0;
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            model->band += (reading >= thresholds[i]);
+        }
+        model->seen = 0;
+        return 1;
+    }
+    for (uint32_t i = (uint32_t)model->band; i < 3; i++)
+    {
+        target += (reading >= (int32_t)(thresholds[i] + HYSTERESIS));
+    }
+    for (int32_t i = 0; i < model->band; i++)
+    {
+        target -= (reading < (int32_t)(thresholds[i] - HYSTERESIS));
+    }
+    if (target == model->band)
+    {
+        model->seen = 0;
+        return 0;
+    }
+    if ((model->seen == 0) || (target != model->candidate))
+    {
+        model->candidate = target;
+        model->seen = 0;
+    }
+    if (++model->seen < debounce)
+    {
+        return 0;
+    }
+    model->band = target;
+    model->seen = 0;
+    return 1;
+}
+
+/* The readings the STM32 DMA example classifies: tenths of a degree, thresholds at 40 and 70 degrees */
+static void test_shared(void)
+{
+    static const uint16_t oven[2] = {400, 700};
+    static const struct
+    {
+        int32_t reading;
+        int changed;
+        uint8_t band;
+    } steps[] = {
+        {395, 1, 0},  /* First reading, no hysteresis */
+        {419, 0, 0},  /* 40 degrees passed by less than 2 */
+        {420, 1, 1},  /* by 2 */
+        {381, 0, 1},  /* back under 40 by less than 2 */
+        {379, 1, 0},  /* by 2 and more */
+        {900, 1, 2},  /* two bands at once */
+        {-50, 1, 0},  /* below 0 */
+        {-400, 0, 0}, /* further below */
+    };
+    static const struct
+    {
+        int32_t reading;
+        int changed;
+    } debounced[] = {
+        {500, 0}, {500, 0}, {300, 0}, /* a reading back in the band restarts the count */
+        {500, 0}, {500, 0}, {800, 0}, /* another band restarts it too */
+        {800, 0}, {800, 1},           /* three readings in a row of band 2 */
+    };
+    BAND_State_Type state;
+    uint32_t bad = 0;
+
+    BAND_Reset(&state);
+    for (uint32_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++)
+    {
+        bad += (BAND_Update(&state, oven, 3, 20, 1, steps[i].reading) != steps[i].changed) ||
+               (state.Band != steps[i].band);
+    }
+    check(bad == 0, "BAND_Update(): hysteresis on both sides of a threshold, skipped bands, negative readings");
+
+    BAND_Reset(&state);
+    BAND_Update(&state, oven, 3, 20, 3, 300);
+    bad = 0;
+    for (uint32_t i = 0; i < sizeof(debounced) / sizeof(debounced[0]); i++)
+    {
+        bad += (BAND_Update(&state, oven, 3, 20, 3, debounced[i].reading) != debounced[i].changed);
+    }
+    check((bad == 0) && (state.Band == 2), "BAND_Update(): a debounce of 3 restarts on a reading of another band");
+    check(BAND_Of(oven, 3, 400) == 1, "BAND_Of(): a threshold belongs to the band above it");
+}
+
+static void test_driver(void)
+{
+    model_t models[INPUTS];
+    uint32_t changes[INPUTS] = {0, 0, 0};
+    uint32_t mismatches = 0;
+    uint32_t bad_pins = 0;
+    uint32_t bad_bus = 0;
+    uint32_t flips = 0;
+    uint8_t raw_band = 0;
+    int32_t base = 0;
+    int32_t drift = 3;
+    char line[160];
+
+    CLASSIFY_Init(on_change, NULL);
+    for (uint32_t n = 0; n < INPUTS; n++)
+    {
+        models[n].band = -1;
+        last_band[channels[n]] = CLASSIFY_BAND_NONE;
+        CLASSIFY_SetTable(channels[n], &tables[n]);
+    }
+
+    // A slow sweep from 0 to 4095 and back, with noise of +- 3 hysteresis
+    for (uint32_t i = 0; i < READINGS; i++)
+    {
+        uint32_t n = i % INPUTS;
+        int32_t reading = base + (int32_t)random_value(6 * HYSTERESIS + 1) - 3 * (int32_t)HYSTERESIS;
+        lpc_sim_bus_stats_t before;
+        lpc_sim_bus_stats_t after;
+        int changed;
+
+        reading = (reading < 0) ? 0 : (reading > 4095) ? 4095 : reading;
+        changed = model_update(&models[n], tables[n].Debounce, reading);
+        lpc_sim_bus_stats(&before);
+        CLASSIFY_Update(channels[n], (uint16_t)reading);
+        lpc_sim_bus_stats(&after);
+
+        changes[n] += changed;
+        if (n == 0)
+        {
+            flips += (i > 0) && (BAND_Of(thresholds, 4, reading) != raw_band);
+            raw_band = BAND_Of(thresholds, 4, reading);
+        }
+        mismatches += (CLASSIFY_GetBand(channels[n]) != models[n].band);
+        bad_pins += ((lpc_sim_gpio_output(0) & 0xFFF) >> (4 * n) & 0xF) != pins[0][models[n].band];
+        bad_bus += changed ? ((after.reads - before.reads != 1) || (after.writes - before.writes != 3))
+                           : ((after.reads != before.reads) || (after.writes != before.writes));
+        if (n == INPUTS - 1)
+        {
+            base += drift;
+            drift = ((base <= 0) || (base >= 4095)) ? -drift : drift;
+        }
+    }
+
+    snprintf(line, sizeof(line), "%lu readings: %lu band mismatches with the model, %lu wrong pins",
+             (unsigned long)READINGS, (unsigned long)mismatches, (unsigned long)bad_pins);
+    check((mismatches == 0) && (bad_pins == 0), line);
+    snprintf(line, sizeof(line), "pins written %lu, %lu and %lu times where the raw band of input 0 flips %lu times, "
+             "%lu readings with other bus accesses", (unsigned long)changes[0], (unsigned long)changes[1],
+             (unsigned long)changes[2], (unsigned long)flips, (unsigned long)bad_bus);
+    check((bad_bus == 0) && (changes[2] < changes[1]) && (changes[0] < flips), line);
+    check((callbacks[0] == changes[0]) && (callbacks[3] == changes[1]) && (callbacks[5] == changes[2]) &&
+              (CLASSIFY_GetChanges(3) == changes[1]) && (bad_previous == 0),
+          "one callback per change, with the previous band");
+}
+
+static void test_set_table(void)
+{
+    CLASSIFY_Update(0, 100);
+    CLASSIFY_Update(0, 100);
+    CLASSIFY_SetTable(0, &tables[2]);
+    CLASSIFY_Update(0, 1010);
+    check((CLASSIFY_GetBand(0) == 1) && (CLASSIFY_GetChanges(0) == 1) && ((lpc_sim_gpio_output(0) & 0xF00) == pins[2][1]),
+          "CLASSIFY_SetTable(): the next reading takes its band at once, debounce or not");
+    check(CLASSIFY_SetTable(CLASSIFY_CHANNELS, &tables[0]) == ERROR, "CLASSIFY_SetTable() rejects input 8");
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    GPIO_SetDir(0, 0xFFF, 1);
+
+    test_shared();
+    test_driver();
+    test_set_table();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,235 @@
+/*
+ * @file dacwave_test.c
+ * @brief Waveform switches of the DAC player (lpc17xx_dacwave) on an external interrupt, run by 'make test'
+ *
+ * Three waveforms at 60, 120 and 450 kHz are selected in turn by EINT0_IRQHandler(), on falling edges of P2.10 at
+ * pseudo-random times. Every sample of each table has its own DAC code, so each DAC output change of the trace tells
+ * the waveform and the sample played:
+ * - within a waveform, the samples follow each other and wrap at the end of the period;
+ * - a switch goes from the last sample of a period to the first sample of the next waveform;
+ * - each sample is held for the timeout of its waveform, the first one of a new waveform included;
+ * - once the edges stop, the player ends on the waveform selected last.
+ * The rates above DACWAVE_MAX_RATE, or DACWAVE_MAX_RATE_BIAS with DACWAVE_BIAS, are rejected.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_clkpwr.h"
+#include "lpc17xx_dacwave.h"
+#include "lpc17xx_exti.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_sim.h"
+
+#define WAVES       3U
+#define SWITCH_PIN  (1UL << 10) /* P2.10, EINT0 */
+#define EDGES       400U
+#define MIN_GAP_US  20U  /* Time between two falling edges, pseudo-random from MIN_GAP_US to MAX_GAP_US */
+#define MAX_GAP_US  1500U
+#define SETTLE_US   5000U /* Time left after the last edge for the queued waveform to start */
+
+/* First DAC code and step of the samples of each table, so that no code is used twice */
+static const uint32_t first_code[WAVES] = {0, 300, 600};
+static const uint32_t code_step[WAVES] = {4, 4, 8};
+
+static uint32_t table60[64];
+static uint32_t table120[32];
+static uint32_t table450[16];
+static uint32_t table_bias[16];
+
+static const DACWAVE_Type waves[WAVES] = {{table60, 64, 60000}, {table120, 32, 120000}, {table450, 16, 450000}};
+
+static volatile uint32_t selected;
+static uint32_t selects;
+static uint32_t select_errors;
+
+static uint32_t failures;
+
+/* State of the trace check */
+static uint64_t last_cycles;
+static int32_t last_wave = -1;
+static uint32_t last_index;
+static uint32_t samples;
+static uint32_t switches;
+static uint32_t bad_order;
+static uint32_t bad_interval;
+/* Core cycles a sample of each waveform is held, as DACWAVE rounds its timeout */
+static uint64_t hold_cycles[WAVES];
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+void EINT0_IRQHandler(void)
+{
+    EXTI_ClearEXTIFlag(EXTI_EINT0);
+    selected = (selected + 1) % WAVES;
+    selects++;
+    select_errors += (DACWAVE_Select(&waves[selected]) != SUCCESS);
+}
+
+void DMA_IRQHandler(void)
+{
+    GPDMA_IntHandler();
+}
+
+static void on_trace(const lpc_sim_trace_event_t* event)
+{
+    int32_t wave = -1;
+    uint32_t index = 0;
+
+    if (event->kind != LPC_SIM_TRACE_DAC)
+    {
+        return;
+    }
+    for (uint32_t w = 0; w < WAVES; w++)
+    {
+        uint32_t offset = event->value - first_code[w];
+
+        if ((event->value >= first_code[w]) && (offset % code_step[w] == 0) &&
+            (offset / code_step[w] < waves[w].Count))
+        {
+            wave = (int32_t)w;
+            index = offset / code_step[w];
+        }
+    }
+
+    if (last_wave >= 0)
+    {
+        if (wave == last_wave)
+        {
+            bad_order += (index != (last_index + 1) % waves[wave].Count);
+        }
+        else
+        {
+            bad_order += (wave < 0) || (index != 0) || (last_index != waves[last_wave].Count - 1U);
+            switches++;
+        }
+        bad_interval += (event->cycles - last_cycles != hold_cycles[last_wave]);
+    }
+    last_cycles = event->cycles;
+    last_wave = wave;
+    last_index = index;
+    samples++;
+}
+
+/* Falling edge then rising edge on P2.10, the edges EDGES apart by a pseudo-random time */
+static uint64_t press(uint64_t cycle)
+{
+    static uint32_t seed = 12345;
+    static uint32_t edges;
+    static uint32_t level = 1;
+    uint64_t us;
+
+    level = !level;
+    lpc_sim_gpio_drive(2, SWITCH_PIN, level ? SWITCH_PIN : 0);
+    if (level)
+    {
+        return cycle + SystemCoreClock / 1000000 * 2;
+    }
+    if (++edges == EDGES)
+    {
+        return UINT64_MAX;
+    }
+    seed = seed * 1103515245U + 12345U;
+    us = MIN_GAP_US + (seed >> 8) % (MAX_GAP_US - MIN_GAP_US);
+    return cycle + SystemCoreClock / 1000000 * us;
+}
+
+static void configure_eint(void)
+{
+    static const PINSEL_CFG_Type eint0 = {PINSEL_PORT_2, PINSEL_PIN_10, PINSEL_FUNC_1, PINSEL_PINMODE_PULLUP,
+                                          PINSEL_PINMODE_NORMAL};
+    EXTI_InitTypeDef exti_cfg;
+
+    lpc_sim_gpio_drive(2, SWITCH_PIN, SWITCH_PIN);
+    PINSEL_ConfigPins(&eint0, 1);
+    exti_cfg.EXTI_Line = EXTI_EINT0;
+    exti_cfg.EXTI_Mode = EXTI_MODE_EDGE_SENSITIVE;
+    exti_cfg.EXTI_polarity = EXTI_POLARITY_LOW_ACTIVE_OR_FALLING_EDGE;
+    EXTI_Config(&exti_cfg);
+    EXTI_ClearEXTIFlag(EXTI_EINT0);
+}
+
+static void test_switches(void)
+{
+    uint32_t pclk = CLKPWR_GetPCLK(CLKPWR_PCLKSEL_DAC);
+    char line[96];
+
+    // The trace hook cannot read registers: a peripheral access from it would run the simulator again
+    for (uint32_t w = 0; w < WAVES; w++)
+    {
+        uint32_t* samples_of = (uint32_t*)waves[w].Samples;
+
+        hold_cycles[w] = (uint64_t)((pclk + waves[w].Rate / 2) / waves[w].Rate) * (SystemCoreClock / pclk);
+
+        for (uint32_t i = 0; i < waves[w].Count; i++)
+        {
+            samples_of[i] = DACWAVE_VALUE(first_code[w] + i * code_step[w]);
+        }
+    }
+
+    GPDMA_Init();
+    check(DACWAVE_Init() == SUCCESS, "DACWAVE_Init() gets a GPDMA channel");
+    configure_eint();
+    // The terminal count must reload the DAC timeout within one sample: the DMA interrupt preempts EINT0
+    NVIC_SetPriority(DMA_IRQn, 0);
+    NVIC_SetPriority(EINT0_IRQn, 1);
+    NVIC_EnableIRQ(DMA_IRQn);
+    NVIC_EnableIRQ(EINT0_IRQn);
+
+    lpc_sim_set_trace_hook(on_trace);
+    check(DACWAVE_Start(&waves[0]) == SUCCESS, "DACWAVE_Start() at 60 kHz");
+    lpc_sim_set_stimulus(press, SystemCoreClock / 1000);
+    lpc_sim_advance((uint64_t)SystemCoreClock / 1000000 * (EDGES * MAX_GAP_US + SETTLE_US));
+    lpc_sim_set_trace_hook(NULL);
+
+    snprintf(line, sizeof(line), "%lu edges selected a waveform, %lu errors", (unsigned long)selects,
+             (unsigned long)select_errors);
+    check((selects == EDGES) && (select_errors == 0), line);
+    snprintf(line, sizeof(line), "%lu samples, %lu switches, %lu out of order", (unsigned long)samples,
+             (unsigned long)switches, (unsigned long)bad_order);
+    check((bad_order == 0) && (switches > EDGES / 2), line);
+    snprintf(line, sizeof(line), "%lu samples held for another time than the timeout of their waveform",
+             (unsigned long)bad_interval);
+    check(bad_interval == 0, line);
+    check((DACWAVE_GetWave() == &waves[selected]) && (last_wave == (int32_t)selected),
+          "the player ends on the waveform selected last");
+}
+
+static void test_rates(void)
+{
+    const DACWAVE_Type fast = {table450, 16, DACWAVE_MAX_RATE};
+    const DACWAVE_Type too_fast = {table450, 16, DACWAVE_MAX_RATE + 1};
+    const DACWAVE_Type bias = {table_bias, 16, DACWAVE_MAX_RATE_BIAS};
+    const DACWAVE_Type bias_too_fast = {table_bias, 16, 450000};
+
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        table_bias[i] = table450[i] | DACWAVE_BIAS;
+    }
+
+    check(DACWAVE_Select(&too_fast) == ERROR, "DACWAVE_Select() rejects 1 MHz + 1 Hz");
+    check(DACWAVE_Select(&bias_too_fast) == ERROR, "DACWAVE_Select() rejects 450 kHz with DACWAVE_BIAS");
+    check(DACWAVE_Start(&too_fast) == ERROR, "DACWAVE_Start() rejects 1 MHz + 1 Hz");
+    check(DACWAVE_Start(&bias_too_fast) == ERROR, "DACWAVE_Start() rejects 450 kHz with DACWAVE_BIAS");
+    check(DACWAVE_Start(&bias) == SUCCESS, "DACWAVE_Start() takes 400 kHz with DACWAVE_BIAS");
+    check(DACWAVE_Start(&fast) == SUCCESS, "DACWAVE_Start() takes 1 MHz");
+    DACWAVE_Stop();
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+
+    test_switches();
+    test_rates();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
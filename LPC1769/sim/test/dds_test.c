@@ -0,0 +1,242 @@
+/*
+ * @file dds_test.c
+ * @brief Output quality and cost of the DDS engine (lpc17xx_dds), run by 'make test'
+ *
+ * - SFDR and SINAD of a full scale sine, from the 10-bit DAC codes of DDS_FillBlock() over 65536 samples. The
+ *   frequency is a whole number of periods in the record, so the spectrum needs no window. The 1024 point table is read
+ *   without interpolation: the phase truncated to 10 bits gives spurs near -60 dBc, and a SINAD of about 54 dB, below
+ *   the 62 dB of an ideal 10-bit DAC.
+ * - Host instructions per sample of DDS_FillBlock(), in steady state and in a block that ramps.
+ * - A phase step of half a period: the block that takes it has no jump, and the blocks after it are the ones of an
+ *   engine started on the new offset.
+ * - DDS_Configure() rejects a NULL configuration.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lpc17xx_dds.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_sim.h"
+
+#define RATE          100000U
+#define RECORD_LOG2   16U
+#define RECORD        (1U << RECORD_LOG2)
+#define RECORD_CYCLES 1001U /* Periods of the sine in the record, odd so that the harmonics do not fold on it */
+
+#define MIN_SFDR_DB  58.0
+#define MIN_SINAD_DB 53.0
+/* Host instructions per sample, above the current counts (13 and 25): catches a division or a call per sample */
+#define MAX_INSNS_PER_SAMPLE      16U
+#define MAX_RAMP_INSNS_PER_SAMPLE 32U
+
+#define STEP_BLOCKS 8U
+
+static uint32_t words[RECORD];
+static double re[RECORD];
+static double im[RECORD];
+static uint32_t reference[STEP_BLOCKS * DDS_BLOCK_SIZE];
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+static uint32_t dac_code(uint32_t word)
+{
+    return (word >> 6) & 0x3FF;
+}
+
+/* In place radix-2 FFT */
+static void fft(double* x, double* y, uint32_t log2n)
+{
+    uint32_t n = 1U << log2n;
+
+    for (uint32_t i = 1, j = 0; i < n; i++)
+    {
+        uint32_t bit = n >> 1;
+
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j |= bit;
+        if (i < j)
+        {
+            double t = x[i];
+            x[i] = x[j];
+            x[j] = t;
+            t = y[i];
+            y[i] = y[j];
+            y[j] = t;
+        }
+    }
+    for (uint32_t len = 2; len <= n; len <<= 1)
+    {
+        double angle = -2.0 * M_PI / len;
+
+        for (uint32_t i = 0; i < n; i += len)
+        {
+            for (uint32_t k = 0; k < len / 2; k++)
+            {
+                double wr = cos(angle * k), wi = sin(angle * k);
+                double* ar = &x[i + k];
+                double* ai = &y[i + k];
+                double br = x[i + k + len / 2] * wr - y[i + k + len / 2] * wi;
+                double bi = x[i + k + len / 2] * wi + y[i + k + len / 2] * wr;
+
+                x[i + k + len / 2] = *ar - br;
+                y[i + k + len / 2] = *ai - bi;
+                *ar += br;
+                *ai += bi;
+            }
+        }
+    }
+}
+
+static void test_spectrum(void)
+{
+    const DDS_CFG_Type cfg = {RECORD_CYCLES << (32 - RECORD_LOG2), 0, DDS_AMPLITUDE_MAX};
+    double signal = 0.0, noise = 0.0, spur = 0.0;
+    char line[96];
+
+    DDS_Init(RATE);
+    DDS_Configure(&cfg);
+    for (uint32_t i = 0; i < RECORD; i += DDS_BLOCK_SIZE)
+    {
+        DDS_FillBlock(&words[i], DDS_BLOCK_SIZE);
+    }
+
+    for (uint32_t i = 0; i < RECORD; i++)
+    {
+        re[i] = dac_code(words[i]);
+        im[i] = 0.0;
+    }
+    fft(re, im, RECORD_LOG2);
+
+    // One sided spectrum without DC: the fundamental, and the largest other bin
+    for (uint32_t k = 1; k < RECORD / 2; k++)
+    {
+        double power = re[k] * re[k] + im[k] * im[k];
+
+        if (k == RECORD_CYCLES)
+        {
+            signal = power;
+            continue;
+        }
+        noise += power;
+        spur = (power > spur) ? power : spur;
+    }
+
+    snprintf(line, sizeof(line), "SFDR %.1f dBc, at least %.0f", 10.0 * log10(signal / spur), MIN_SFDR_DB);
+    check(10.0 * log10(signal / spur) >= MIN_SFDR_DB, line);
+    snprintf(line, sizeof(line), "SINAD %.1f dB (ENOB %.2f), at least %.0f", 10.0 * log10(signal / noise),
+             (10.0 * log10(signal / noise) - 1.76) / 6.02, MIN_SINAD_DB);
+    check(10.0 * log10(signal / noise) >= MIN_SINAD_DB, line);
+}
+
+static uint32_t insns_per_sample(void)
+{
+    uint64_t overhead, insns;
+
+    lpc_sim_insn_start();
+    overhead = lpc_sim_insn_stop();
+    lpc_sim_insn_start();
+    DDS_FillBlock(words, DDS_BLOCK_SIZE);
+    insns = lpc_sim_insn_stop() - overhead;
+    return (uint32_t)((insns + DDS_BLOCK_SIZE - 1) / DDS_BLOCK_SIZE);
+}
+
+static void test_cost(void)
+{
+    uint32_t steady, ramp;
+    char line[96];
+
+    DDS_Init(RATE);
+    DDS_SetFrequency(1234567);
+    DDS_FillBlock(words, DDS_BLOCK_SIZE);
+    steady = insns_per_sample();
+    DDS_SetAmplitude(DDS_AMPLITUDE_MAX / 2);
+    ramp = insns_per_sample();
+
+    snprintf(line, sizeof(line), "DDS_FillBlock %lu host instructions per sample, at most %u", (unsigned long)steady,
+             MAX_INSNS_PER_SAMPLE);
+    check(steady <= MAX_INSNS_PER_SAMPLE, line);
+    snprintf(line, sizeof(line), "DDS_FillBlock ramping %lu host instructions per sample, at most %u",
+             (unsigned long)ramp, MAX_RAMP_INSNS_PER_SAMPLE);
+    check(ramp <= MAX_RAMP_INSNS_PER_SAMPLE, line);
+}
+
+/* Largest difference between two consecutive DAC codes */
+static uint32_t max_step(const uint32_t* block, uint32_t count)
+{
+    uint32_t largest = 0;
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+        int32_t step = (int32_t)dac_code(block[i]) - (int32_t)dac_code(block[i - 1]);
+
+        largest = ((uint32_t)abs(step) > largest) ? (uint32_t)abs(step) : largest;
+    }
+    return largest;
+}
+
+static void test_phase_step(void)
+{
+    const DDS_CFG_Type shifted = {0, 0x80000000U, DDS_AMPLITUDE_MAX};
+    uint32_t steady, stepped;
+    char line[96];
+
+    // Reference: the engine started on the offset of half a period, 1 kHz
+    DDS_Init(RATE);
+    DDS_SetFrequency(1000000);
+    DDS_SetPhase(0x80000000U);
+    DDS_FillBlock(words, DDS_BLOCK_SIZE);
+    for (uint32_t b = 0; b < STEP_BLOCKS; b++)
+    {
+        DDS_FillBlock(&reference[b * DDS_BLOCK_SIZE], DDS_BLOCK_SIZE);
+    }
+
+    // Same start on offset 0, the step taken by the first block: the blocks after it must match the reference
+    DDS_Init(RATE);
+    DDS_SetFrequency(1000000);
+    DDS_FillBlock(words, DDS_BLOCK_SIZE - 1);
+    DDS_FillBlock(&words[DDS_BLOCK_SIZE - 1], 1);
+    steady = max_step(words, DDS_BLOCK_SIZE);
+    DDS_SetPhase(0x80000000U);
+    for (uint32_t b = 0; b < STEP_BLOCKS; b++)
+    {
+        DDS_FillBlock(&words[(b + 1) * DDS_BLOCK_SIZE], DDS_BLOCK_SIZE);
+    }
+    stepped = max_step(words, (STEP_BLOCKS + 1) * DDS_BLOCK_SIZE);
+
+    snprintf(line, sizeof(line), "phase step of 180 degrees: largest DAC step %lu codes, %lu without the phase step",
+             (unsigned long)stepped, (unsigned long)steady);
+    check(stepped < 2 * steady, line);
+    check(memcmp(&words[2 * DDS_BLOCK_SIZE], &reference[DDS_BLOCK_SIZE],
+                 (STEP_BLOCKS - 1) * DDS_BLOCK_SIZE * sizeof(uint32_t)) == 0,
+          "phase step of 180 degrees: the blocks after the ramp are on the new offset");
+
+    check(DDS_Configure(NULL) == ERROR, "DDS_Configure(NULL) returns ERROR");
+    check(DDS_Configure(&shifted) == SUCCESS, "DDS_Configure() returns SUCCESS");
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    GPDMA_Init();
+
+    test_spectrum();
+    test_cost();
+    test_phase_step();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,341 @@
+/*
+ * @file dsp_bitexact.c
+ * @brief Output of every function of the DSP library on pseudo-random inputs, run by 'make test'
+ *
+ * Linked once with build/libarm_math.a (Cortex-M3 code paths) and once with build/libarm_math_ref.a (portable C
+ * reference): the two programs must print the same lines. Each line is a function, a block size and a hash of all the
+ * output bits. The inputs mix random values with the extremes of the range, so that the saturations are exercised, and
+ * the block sizes cover the tails of the loops unrolled by 4.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#define MAX_BLOCK 1024U
+#define MAX_TAPS  40U
+
+static const uint32_t block_sizes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 13, 31, 64, 67, 255};
+#define BLOCK_SIZES (sizeof(block_sizes) / sizeof(block_sizes[0]))
+
+static q15_t q15_a[MAX_BLOCK];
+static q15_t q15_b[MAX_BLOCK];
+static q15_t q15_out[2 * MAX_BLOCK];
+static q31_t q31_a[MAX_BLOCK];
+static q31_t q31_b[MAX_BLOCK];
+static q31_t q31_out[MAX_BLOCK];
+
+static q15_t fir_coeffs_q15[MAX_TAPS];
+static q15_t fir_state_q15[MAX_TAPS + MAX_BLOCK];
+static q31_t fir_coeffs_q31[MAX_TAPS];
+static q31_t fir_state_q31[MAX_TAPS + MAX_BLOCK];
+
+static uint32_t rng_state = 0x12345678;
+
+/* xorshift32 */
+static uint32_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* Random value, one in eight at an extreme of the range or next to it */
+static uint32_t rng_edge(uint32_t min)
+{
+    uint32_t r = rng();
+
+    switch (r & 0x1F)
+    {
+        case 0: return min;
+        case 1: return min + 1;
+        case 2: return ~min;
+        case 3: return 0;
+        default: return rng();
+    }
+}
+
+/* Inputs scaled down by 2^shift, so that the filters see signals that do not all saturate */
+static void fill_inputs(uint32_t shift)
+{
+    for (uint32_t i = 0; i < MAX_BLOCK; i++)
+    {
+        q15_a[i] = (q15_t)((int16_t)rng_edge(0x8000) >> shift);
+        q15_b[i] = (q15_t)rng_edge(0x8000);
+        q31_a[i] = (q31_t)((int32_t)rng_edge(0x80000000U) >> shift);
+        q31_b[i] = (q31_t)rng_edge(0x80000000U);
+    }
+}
+
+/* FNV-1a */
+static uint32_t hash(const void* data, uint32_t bytes)
+{
+    const uint8_t* p = data;
+    uint32_t h = 2166136261U;
+
+    while (bytes--)
+    {
+        h = (h ^ *p++) * 16777619U;
+    }
+    return h;
+}
+
+static void print(const char* name, uint32_t n, const void* data, uint32_t bytes)
+{
+    printf("%s %lu %08lx\n", name, (unsigned long)n, (unsigned long)hash(data, bytes));
+}
+
+static void test_basic_math(void)
+{
+    for (uint32_t k = 0; k < BLOCK_SIZES; k++)
+    {
+        uint32_t n = block_sizes[k];
+        q63_t r63;
+        q31_t r31;
+        q15_t r15;
+        uint32_t index;
+
+        fill_inputs(0);
+
+        arm_add_q15(q15_a, q15_b, q15_out, n);
+        print("arm_add_q15", n, q15_out, n * 2);
+        arm_add_q31(q31_a, q31_b, q31_out, n);
+        print("arm_add_q31", n, q31_out, n * 4);
+        arm_sub_q15(q15_a, q15_b, q15_out, n);
+        print("arm_sub_q15", n, q15_out, n * 2);
+        arm_sub_q31(q31_a, q31_b, q31_out, n);
+        print("arm_sub_q31", n, q31_out, n * 4);
+        arm_mult_q15(q15_a, q15_b, q15_out, n);
+        print("arm_mult_q15", n, q15_out, n * 2);
+        arm_mult_q31(q31_a, q31_b, q31_out, n);
+        print("arm_mult_q31", n, q31_out, n * 4);
+        arm_abs_q15(q15_a, q15_out, n);
+        print("arm_abs_q15", n, q15_out, n * 2);
+        arm_abs_q31(q31_a, q31_out, n);
+        print("arm_abs_q31", n, q31_out, n * 4);
+
+        for (int8_t shift = -2; shift <= 2; shift += 2)
+        {
+            arm_scale_q15(q15_a, q15_b[n], shift, q15_out, n);
+            print("arm_scale_q15", n, q15_out, n * 2);
+            arm_scale_q31(q31_a, q31_b[n], shift, q31_out, n);
+            print("arm_scale_q31", n, q31_out, n * 4);
+        }
+        arm_offset_q15(q15_a, q15_b[n], q15_out, n);
+        print("arm_offset_q15", n, q15_out, n * 2);
+        arm_offset_q31(q31_a, q31_b[n], q31_out, n);
+        print("arm_offset_q31", n, q31_out, n * 4);
+
+        arm_dot_prod_q15(q15_a, q15_b, n, &r63);
+        print("arm_dot_prod_q15", n, &r63, sizeof(r63));
+        arm_dot_prod_q31(q31_a, q31_b, n, &r63);
+        print("arm_dot_prod_q31", n, &r63, sizeof(r63));
+
+        memset(q15_out, 0, sizeof(q15_out));
+        arm_copy_q15(q15_a, q15_out + 1, n);
+        print("arm_copy_q15", n, q15_out, (n + 2) * 2);
+        arm_copy_q31(q31_a, q31_out, n);
+        print("arm_copy_q31", n, q31_out, n * 4);
+        memset(q15_out, 0, sizeof(q15_out));
+        arm_fill_q15(q15_b[0], q15_out + 1, n);
+        print("arm_fill_q15", n, q15_out, (n + 2) * 2);
+        arm_fill_q31(q31_b[0], q31_out, n);
+        print("arm_fill_q31", n, q31_out, n * 4);
+        arm_q15_to_q31(q15_a, q31_out, n);
+        print("arm_q15_to_q31", n, q31_out, n * 4);
+        arm_q31_to_q15(q31_a, q15_out, n);
+        print("arm_q31_to_q15", n, q15_out, n * 2);
+
+        arm_mean_q15(q15_a, n, &r15);
+        print("arm_mean_q15", n, &r15, sizeof(r15));
+        arm_mean_q31(q31_a, n, &r31);
+        print("arm_mean_q31", n, &r31, sizeof(r31));
+        arm_power_q15(q15_a, n, &r63);
+        print("arm_power_q15", n, &r63, sizeof(r63));
+        arm_power_q31(q31_a, n, &r63);
+        print("arm_power_q31", n, &r63, sizeof(r63));
+        arm_rms_q15(q15_a, n, &r15);
+        print("arm_rms_q15", n, &r15, sizeof(r15));
+        arm_rms_q31(q31_a, n, &r31);
+        print("arm_rms_q31", n, &r31, sizeof(r31));
+        arm_min_q15(q15_a, n, &r15, &index);
+        printf("arm_min_q15 %lu %d %lu\n", (unsigned long)n, r15, (unsigned long)index);
+        arm_min_q31(q31_a, n, &r31, &index);
+        printf("arm_min_q31 %lu %ld %lu\n", (unsigned long)n, (long)r31, (unsigned long)index);
+        arm_max_q15(q15_a, n, &r15, &index);
+        printf("arm_max_q15 %lu %d %lu\n", (unsigned long)n, r15, (unsigned long)index);
+        arm_max_q31(q31_a, n, &r31, &index);
+        printf("arm_max_q31 %lu %ld %lu\n", (unsigned long)n, (long)r31, (unsigned long)index);
+    }
+}
+
+static void test_sqrt(void)
+{
+    q15_t out15[0x10000];
+    q31_t out31[4096];
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < 0x10000; i++)
+    {
+        errors += (arm_sqrt_q15((q15_t)i, &out15[i]) != ARM_MATH_SUCCESS);
+    }
+    print("arm_sqrt_q15", 0x10000, out15, sizeof(out15));
+    for (uint32_t i = 0; i < 4096; i++)
+    {
+        errors += (arm_sqrt_q31((q31_t)rng_edge(0x80000000U), &out31[i]) != ARM_MATH_SUCCESS);
+    }
+    print("arm_sqrt_q31", 4096, out31, sizeof(out31));
+    printf("arm_sqrt negative inputs %lu\n", (unsigned long)errors);
+}
+
+static void test_fir(void)
+{
+    static const uint16_t taps[] = {1, 2, 3, 4, 5, 8, 31, 32, MAX_TAPS};
+    arm_fir_instance_q15 fir_q15;
+    arm_fir_instance_q31 fir_q31;
+
+    for (uint32_t t = 0; t < sizeof(taps) / sizeof(taps[0]); t++)
+    {
+        for (uint32_t k = 0; k < BLOCK_SIZES; k++)
+        {
+            uint32_t n = block_sizes[k];
+
+            fill_inputs(2);
+            for (uint32_t i = 0; i < taps[t]; i++)
+            {
+                fir_coeffs_q15[i] = (q15_t)((int16_t)rng() >> 2);
+                fir_coeffs_q31[i] = (q31_t)((int32_t)rng() >> 2);
+            }
+            fir_coeffs_q15[0] = (q15_t)0x8000;
+            fir_coeffs_q31[0] = (q31_t)0x7FFFFFFF;
+
+            // Two blocks in a row: the second one starts from the state left by the first
+            arm_fir_init_q15(&fir_q15, taps[t], fir_coeffs_q15, fir_state_q15, n);
+            arm_fir_q15(&fir_q15, q15_a, q15_out, n);
+            arm_fir_q15(&fir_q15, q15_a + n, q15_out + n, n);
+            print("arm_fir_q15", taps[t] * 1000 + n, q15_out, n * 4);
+
+            arm_fir_init_q31(&fir_q31, taps[t], fir_coeffs_q31, fir_state_q31, n);
+            arm_fir_q31(&fir_q31, q31_a, q31_out, n);
+            print("arm_fir_q31", taps[t] * 1000 + n, q31_out, n * 4);
+            arm_fir_q31(&fir_q31, q31_a + n, q31_out, n);
+            print("arm_fir_q31", taps[t] * 1000 + n, q31_out, n * 4);
+        }
+    }
+}
+
+static void test_biquad(void)
+{
+    static q15_t coeffs_q15[6 * 3];
+    static q15_t state_q15[4 * 3];
+    static q31_t coeffs_q31[5 * 3];
+    static q31_t state_q31[4 * 3];
+    arm_biquad_casd_df1_inst_q15 biquad_q15;
+    arm_biquad_casd_df1_inst_q31 biquad_q31;
+
+    for (uint8_t stages = 1; stages <= 3; stages++)
+    {
+        for (int8_t post_shift = 0; post_shift <= 1; post_shift++)
+        {
+            for (uint32_t k = 0; k < BLOCK_SIZES; k++)
+            {
+                uint32_t n = block_sizes[k];
+
+                fill_inputs(1);
+                for (uint32_t s = 0; s < stages; s++)
+                {
+                    // Random sections: unstable ones saturate, which must saturate the same way
+                    coeffs_q15[6 * s + 0] = (q15_t)((int16_t)rng() >> 2);
+                    coeffs_q15[6 * s + 1] = 0;
+                    coeffs_q15[6 * s + 2] = (q15_t)((int16_t)rng() >> 2);
+                    coeffs_q15[6 * s + 3] = (q15_t)((int16_t)rng() >> 2);
+                    coeffs_q15[6 * s + 4] = (q15_t)rng();
+                    coeffs_q15[6 * s + 5] = (q15_t)((int16_t)rng() >> 1);
+                    for (uint32_t c = 0; c < 5; c++)
+                    {
+                        coeffs_q31[5 * s + c] = (q31_t)((int32_t)rng() >> ((c < 3) ? 2 : 1));
+                    }
+                }
+
+                arm_biquad_cascade_df1_init_q15(&biquad_q15, stages, coeffs_q15, state_q15, post_shift);
+                arm_biquad_cascade_df1_q15(&biquad_q15, q15_a, q15_out, n);
+                arm_biquad_cascade_df1_q15(&biquad_q15, q15_a + n, q15_out + n, n);
+                print("arm_biquad_cascade_df1_q15", stages * 1000 + n, q15_out, n * 4);
+                print("arm_biquad_cascade_df1_q15 state", stages * 1000 + n, state_q15, sizeof(state_q15));
+
+                arm_biquad_cascade_df1_init_q31(&biquad_q31, stages, coeffs_q31, state_q31, post_shift);
+                arm_biquad_cascade_df1_q31(&biquad_q31, q31_a, q31_out, n);
+                print("arm_biquad_cascade_df1_q31", stages * 1000 + n, q31_out, n * 4);
+                arm_biquad_cascade_df1_q31(&biquad_q31, q31_a + n, q31_out, n);
+                print("arm_biquad_cascade_df1_q31", stages * 1000 + n, q31_out, n * 4);
+            }
+        }
+    }
+}
+
+static void test_cfft(void)
+{
+    static const uint16_t lengths[] = {16, 64, 256, 1024};
+    arm_cfft_radix4_instance_q15 cfft;
+
+    printf("arm_cfft_radix4_init_q15 bad length %d\n", arm_cfft_radix4_init_q15(&cfft, 32, 0, 1));
+    for (uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        for (uint8_t ifft = 0; ifft <= 1; ifft++)
+        {
+            for (uint8_t bit_reverse = 0; bit_reverse <= 1; bit_reverse++)
+            {
+                fill_inputs(0);
+                memcpy(q15_out, q15_a, MAX_BLOCK * sizeof(q15_t));
+                memcpy(q15_out + MAX_BLOCK, q15_b, MAX_BLOCK * sizeof(q15_t));
+                arm_cfft_radix4_init_q15(&cfft, lengths[l], ifft, bit_reverse);
+                arm_cfft_radix4_q15(&cfft, q15_out);
+                print("arm_cfft_radix4_q15", lengths[l] * 10 + ifft * 2 + bit_reverse, q15_out,
+                      lengths[l] * 2 * sizeof(q15_t));
+            }
+        }
+    }
+}
+
+static void test_pid(void)
+{
+    arm_pid_instance_q15 pid_q15;
+    arm_pid_instance_q31 pid_q31;
+
+    // Cleared first: the hash covers the padding after A0, and the state the init keeps when resetStateFlag is 0
+    memset(&pid_q15, 0, sizeof(pid_q15));
+    memset(&pid_q31, 0, sizeof(pid_q31));
+    for (uint32_t k = 0; k < 16; k++)
+    {
+        pid_q15.Kp = (q15_t)rng_edge(0x8000);
+        pid_q15.Ki = (q15_t)rng_edge(0x8000);
+        pid_q15.Kd = (q15_t)rng_edge(0x8000);
+        pid_q15.state[2] = 1;
+        arm_pid_init_q15(&pid_q15, (int32_t)(k & 1));
+        print("arm_pid_init_q15", k, &pid_q15, sizeof(pid_q15));
+        arm_pid_reset_q15(&pid_q15);
+        print("arm_pid_reset_q15", k, &pid_q15, sizeof(pid_q15));
+
+        pid_q31.Kp = (q31_t)rng_edge(0x80000000U);
+        pid_q31.Ki = (q31_t)rng_edge(0x80000000U);
+        pid_q31.Kd = (q31_t)rng_edge(0x80000000U);
+        pid_q31.state[2] = 1;
+        arm_pid_init_q31(&pid_q31, (int32_t)(k & 1));
+        print("arm_pid_init_q31", k, &pid_q31, sizeof(pid_q31));
+        arm_pid_reset_q31(&pid_q31);
+        print("arm_pid_reset_q31", k, &pid_q31, sizeof(pid_q31));
+    }
+}
+
+int main(void)
+{
+    test_basic_math();
+    test_sqrt();
+    test_fir();
+    test_biquad();
+    test_cfft();
+    test_pid();
+    return 0;
+}
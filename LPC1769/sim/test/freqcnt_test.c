@@ -0,0 +1,255 @@
+/*
+ * @file freqcnt_test.c
+ * @brief Windows of the gated frequency counter (lpc17xx_freqcnt) on Timer2 and Timer0, run by 'make test'
+ *
+ * A stimulus drives a square wave on the input of the counter timer, CAP2.0 (P0.4) or CAP2.1 (P0.5), and on the
+ * capture input of the gate timer, CAP0.0 (P1.26). Windows of 20 ms are read as they end:
+ * - 15 segments from 0.5 Hz to 50 MHz, then no signal: every result holds the frequency driven within
+ *   FrequencyHz +- ErrorHz. The reciprocal method serves from 1 kHz to 3.3 MHz, the counting method from 12.5 MHz,
+ *   the stopped method a signal that stopped. Around 7.3 MHz, where the edges come about as fast as the handler reads
+ *   the registers, either method may serve, depending on the phase of the signal;
+ * - TIM_Init() in counter mode writes the mode and the input to CTCR and leaves CCR alone: CounterInput = 1 counts
+ *   CAP2.1;
+ * - FREQCNT_Init() rejects a window out of range before it changes PCLKSEL or a register of either timer.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_freqcnt.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_sim.h"
+#include "lpc17xx_timer.h"
+
+#define GATE_PIN  (1UL << 26) /* P1.26, CAP0.0 */
+#define WINDOW_US 20000U
+
+static const double segments_hz[] = {0.5,    3,     61.2,   1000,   12345.678, 250000, 1e6, 3.3e6,
+                                     7.3e6,  12.5e6, 20e6,  33.3e6, 50e6,      0,      440};
+
+/* State of the square wave, in Q32 cycles */
+static volatile uint32_t counter_pin = 1UL << 4; /* P0.4, CAP2.0 */
+static volatile int stopped = 1;
+static uint64_t phase_q32;
+static uint64_t half_period_q32;
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+void TIMER0_IRQHandler(void)
+{
+    FREQCNT_IntHandler();
+}
+
+static uint64_t drive(uint64_t cycle)
+{
+    static uint32_t level;
+    uint64_t next;
+
+    if (stopped)
+    {
+        return cycle + 1000000;
+    }
+    level = !level;
+    lpc_sim_gpio_drive(0, counter_pin, level ? counter_pin : 0);
+    lpc_sim_gpio_drive(1, GATE_PIN, level ? GATE_PIN : 0);
+    phase_q32 += half_period_q32;
+    if ((phase_q32 >> 32) <= cycle)
+    {
+        // First edge of a new frequency: the signal restarts here, without a glitch
+        phase_q32 = ((uint64_t)cycle << 32) + half_period_q32;
+    }
+    next = phase_q32 >> 32;
+    return next;
+}
+
+static void set_frequency(double hz)
+{
+    stopped = (hz == 0);
+    if (!stopped)
+    {
+        half_period_q32 = (uint64_t)((double)SystemCoreClock / hz / 2 * 4294967296.0);
+        phase_q32 = 0;
+    }
+}
+
+static Status init(uint8_t counter_input, uint32_t window_us)
+{
+    FREQCNT_CFG_Type cfg;
+
+    cfg.CounterTIM = LPC_TIM2;
+    cfg.CounterInput = counter_input;
+    cfg.GateTIM = LPC_TIM0;
+    cfg.GateCapture = 0;
+    cfg.GateMatch = 0;
+    cfg.Reserved = 0;
+    cfg.WindowUs = window_us;
+    return FREQCNT_Init(&cfg);
+}
+
+/* Reads the windows of one segment once the previous signal, and the two periods after it, have left them */
+static void segment(double hz, double previous_hz)
+{
+    uint64_t window = (uint64_t)SystemCoreClock / 1000000 * WINDOW_US;
+    uint64_t settle = lpc_sim_cycles() + 3 * window;
+    uint64_t end;
+    uint32_t windows = 0;
+    uint32_t outside = 0;
+    uint32_t methods[3] = {0, 0, 0};
+    uint32_t expected;
+    FREQCNT_Result_Type result;
+    char line[128];
+
+    settle += (previous_hz > 0) ? (uint64_t)(SystemCoreClock / previous_hz / 2) : 0;
+    settle += (hz > 0) ? (uint64_t)(SystemCoreClock / hz * 2) : 0;
+    end = settle + ((hz > 1e6) ? 6 * window : ((hz > 0) && (hz < 10)) ? (uint64_t)SystemCoreClock * 6 : 20 * window);
+    set_frequency(hz);
+    while (lpc_sim_cycles() < end)
+    {
+        uint32_t count = FREQCNT_GetWindowCount();
+        double frequency;
+        double error;
+
+        lpc_sim_advance(window / 10);
+        if ((FREQCNT_GetWindowCount() == count) || (lpc_sim_cycles() < settle) || (FREQCNT_Read(&result) != SUCCESS))
+        {
+            continue;
+        }
+        frequency = (double)result.FrequencyHz / FREQCNT_Q16_ONE;
+        error = (double)result.ErrorHz / FREQCNT_Q16_ONE;
+        outside += (frequency - error > hz) || (frequency + error < hz);
+        methods[result.Method % 3]++;
+        windows++;
+    }
+
+    // Below a few edges per window the methods alternate, and near 7.3 MHz the phase decides
+    expected = (hz == 0) ? FREQCNT_STOPPED : (hz <= 3.3e6) ? FREQCNT_RECIPROCAL : FREQCNT_COUNTING;
+    snprintf(line, sizeof(line), "%.1f Hz: %lu of %lu windows outside F +- E, %lu reciprocal, %lu counting, %lu stopped",
+             hz, (unsigned long)outside, (unsigned long)windows, (unsigned long)methods[FREQCNT_RECIPROCAL],
+             (unsigned long)methods[FREQCNT_COUNTING], (unsigned long)methods[FREQCNT_STOPPED]);
+    check((windows >= 3) && (outside == 0) &&
+              (((hz > 0) && (hz < 1000)) || ((hz > 3.3e6) && (hz < 12.5e6)) || (methods[expected] == windows)),
+          line);
+}
+
+/* Registers a rejected FREQCNT_Init() must not touch */
+typedef struct
+{
+    uint32_t pclksel0;
+    uint32_t tcr[2];
+    uint32_t ctcr[2];
+    uint32_t pr[2];
+    uint32_t mcr[2];
+    uint32_t ccr[2];
+    uint32_t mr0[2];
+} registers_t;
+
+static void read_registers(registers_t* regs)
+{
+    LPC_TIM_TypeDef* const timers[2] = {LPC_TIM0, LPC_TIM2};
+
+    regs->pclksel0 = LPC_SC->PCLKSEL0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        regs->tcr[i] = timers[i]->TCR;
+        regs->ctcr[i] = timers[i]->CTCR;
+        regs->pr[i] = timers[i]->PR;
+        regs->mcr[i] = timers[i]->MCR;
+        regs->ccr[i] = timers[i]->CCR;
+        regs->mr0[i] = timers[i]->MR0;
+    }
+}
+
+/* Both timers run as another driver left them, on CCLK / 4 with a prescale of 8, before the rejected calls */
+static void test_rejected(void)
+{
+    TIM_TIMERCFG_Type timer_cfg = {TIM_PRESCALE_TICKVAL, {0, 0, 0}, 8};
+    registers_t before;
+    registers_t after;
+    uint32_t pclksel1 = LPC_SC->PCLKSEL1;
+    uint32_t tc;
+    FREQCNT_CFG_Type cfg;
+
+    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &timer_cfg);
+    TIM_Init(LPC_TIM2, TIM_TIMER_MODE, &timer_cfg);
+    TIM_Cmd(LPC_TIM0, ENABLE);
+    TIM_Cmd(LPC_TIM2, ENABLE);
+    tc = LPC_TIM0->TC;
+    read_registers(&before);
+    check(init(0, 5) == ERROR, "FREQCNT_Init() rejects a 5 us window");
+    check(init(0, 30000000) == ERROR, "FREQCNT_Init() rejects a 30 s window");
+    cfg.CounterTIM = LPC_TIM0;
+    cfg.CounterInput = 0;
+    cfg.GateTIM = LPC_TIM0;
+    cfg.GateCapture = 0;
+    cfg.GateMatch = 0;
+    cfg.WindowUs = WINDOW_US;
+    check(FREQCNT_Init(&cfg) == ERROR, "FREQCNT_Init() rejects one timer for both roles");
+    lpc_sim_advance(1000);
+    read_registers(&after);
+    check((before.pclksel0 == after.pclksel0) && (LPC_SC->PCLKSEL1 == pclksel1) && (LPC_TIM0->TC != tc) &&
+              (before.tcr[0] == after.tcr[0]) && (before.tcr[1] == after.tcr[1]) &&
+              (before.ctcr[0] == after.ctcr[0]) && (before.ctcr[1] == after.ctcr[1]) &&
+              (before.pr[0] == after.pr[0]) && (before.pr[1] == after.pr[1]) && (before.mcr[0] == after.mcr[0]) &&
+              (before.mcr[1] == after.mcr[1]) && (before.ccr[0] == after.ccr[0]) &&
+              (before.ccr[1] == after.ccr[1]) && (before.mr0[0] == after.mr0[0]) && (before.mr0[1] == after.mr0[1]),
+          "a rejected window leaves PCLKSEL and both timers as they were");
+}
+
+static void test_ctcr(void)
+{
+    TIM_COUNTERCFG_Type cfg = {0, 0, {0, 0}};
+    char line[96];
+
+    LPC_TIM3->CCR = 0;
+    cfg.CountInputSelect = TIM_COUNTER_INCAP1;
+    TIM_Init(LPC_TIM3, TIM_COUNTER_RISING_MODE, &cfg);
+    snprintf(line, sizeof(line), "TIM_Init() in counter mode on CAP3.1: CTCR 0x%lx, CCR 0x%lx",
+             (unsigned long)LPC_TIM3->CTCR, (unsigned long)LPC_TIM3->CCR);
+    check((LPC_TIM3->CTCR == 0x5) && (LPC_TIM3->CCR == 0), line);
+    TIM_DeInit(LPC_TIM3);
+
+    check(init(TIM_COUNTER_INCAP1, WINDOW_US) == SUCCESS, "FREQCNT_Init() on CAP2.1");
+    snprintf(line, sizeof(line), "counter timer CTCR 0x%lx, CCR 0x%lx", (unsigned long)LPC_TIM2->CTCR,
+             (unsigned long)LPC_TIM2->CCR);
+    check((LPC_TIM2->CTCR == 0x5) && (LPC_TIM2->CCR == 0), line);
+}
+
+int main(void)
+{
+    static const PINSEL_CFG_Type pins[] = {
+        {PINSEL_PORT_0, PINSEL_PIN_4, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+        {PINSEL_PORT_0, PINSEL_PIN_5, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+        {PINSEL_PORT_1, PINSEL_PIN_26, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+    };
+    FREQCNT_Result_Type result;
+    double previous_hz = 0;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    PINSEL_ConfigPins(pins, sizeof(pins) / sizeof(pins[0]));
+
+    test_rejected();
+    check(init(0, WINDOW_US) == SUCCESS, "FREQCNT_Init() on CAP2.0, 20 ms windows");
+    check(FREQCNT_Read(&result) == ERROR, "no result before the end of the second window");
+
+    lpc_sim_set_stimulus(drive, lpc_sim_cycles() + 10);
+    for (uint32_t i = 0; i < sizeof(segments_hz) / sizeof(segments_hz[0]); i++)
+    {
+        segment(segments_hz[i], previous_hz);
+        previous_hz = segments_hz[i];
+    }
+
+    test_ctcr();
+    counter_pin = 1UL << 5;
+    segment(1e6, 0);
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,279 @@
+/*
+ * @file gpdma_test.c
+ * @brief Channel allocator and completion callbacks of the GPDMA driver (lpc17xx_gpdma), run by 'make test'
+ *
+ * - GPDMA_AllocChannel() gives each priority class the lowest free channel of its range and -1 when the range is
+ *   full; GPDMA_FreeChannel() gives a channel back with its counters cleared;
+ * - GPDMA_Submit() rejects channel 8 and 255 without a register access, even when CHECK_PARAM() returns as it does
+ *   without DEBUG, an unallocated channel, and a channel still busy;
+ * - memory to memory transfers on channels 0 and 6 that end before the interrupt is taken: one GPDMA_IntHandler()
+ *   serves both, channel 0 first, with the argument of each transfer, and the counters hold the bytes moved;
+ * - CHAIN blocks submitted one by one from the completion callback of their channel: every word copied;
+ * - a transfer stopped by GPDMA_FreeChannel() calls no callback.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_sim.h"
+
+#define WORDS 64U
+#define CHAIN 16U
+
+static uint32_t src[CHAIN * WORDS];
+static uint32_t dst[CHAIN * WORDS];
+static uint32_t dst_high[WORDS];
+
+static volatile uint32_t dma_irqs;
+static uint32_t param_failures;
+static volatile uint32_t done_count;
+static uint32_t done_channels[8];
+static uintptr_t done_args[8];
+
+static GPDMA_Channel_CFG_Type chain_cfg;
+static volatile uint32_t chain_blocks;
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+/* CHECK_PARAM() of the DEBUG build reports here and goes on, as a build without DEBUG does */
+void check_failed(uint8_t* file, uint32_t line)
+{
+    (void)file;
+    (void)line;
+    param_failures++;
+}
+
+void DMA_IRQHandler(void)
+{
+    dma_irqs++;
+    GPDMA_IntHandler();
+}
+
+static void on_done(uint32_t channel, void* arg)
+{
+    if (done_count < 8)
+    {
+        done_channels[done_count] = channel;
+        done_args[done_count] = (uintptr_t)arg;
+    }
+    done_count++;
+}
+
+/* Submits the next block of the chain from the callback of the block that ended */
+static void on_chain(uint32_t channel, void* arg)
+{
+    (void)channel;
+    (void)arg;
+    if (++chain_blocks < CHAIN)
+    {
+        chain_cfg.SrcMemAddr = (uint32_t)(uintptr_t)&src[chain_blocks * WORDS];
+        chain_cfg.DstMemAddr = (uint32_t)(uintptr_t)&dst[chain_blocks * WORDS];
+        (void)GPDMA_Submit(&chain_cfg, on_chain, NULL, NULL);
+    }
+}
+
+static void m2m(GPDMA_Channel_CFG_Type* cfg, uint32_t channel, const uint32_t* from, uint32_t* to, uint32_t words)
+{
+    cfg->ChannelNum = channel;
+    cfg->TransferSize = words;
+    cfg->TransferWidth = GPDMA_WIDTH_WORD;
+    cfg->SrcMemAddr = (uint32_t)(uintptr_t)from;
+    cfg->DstMemAddr = (uint32_t)(uintptr_t)to;
+    cfg->TransferType = GPDMA_TRANSFERTYPE_M2M;
+    cfg->SrcConn = 0;
+    cfg->DstConn = 0;
+    cfg->DMALLI = 0;
+}
+
+static void test_alloc(void)
+{
+    int32_t low[3];
+    int32_t medium[5];
+    int32_t high[3];
+    uint32_t bad = 0;
+    char line[160];
+
+    low[0] = GPDMA_AllocChannel(GPDMA_PRIO_LOW);
+    low[1] = GPDMA_AllocChannel(GPDMA_PRIO_LOW);
+    low[2] = GPDMA_AllocChannel(GPDMA_PRIO_LOW);
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        medium[i] = GPDMA_AllocChannel(GPDMA_PRIO_MEDIUM);
+        bad += (medium[i] != (int32_t)(i + 2)) && (i < 4);
+    }
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        high[i] = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    }
+    snprintf(line, sizeof(line), "low %ld %ld %ld, medium %ld to %ld then %ld, high %ld %ld then %ld",
+             (long)low[0], (long)low[1], (long)low[2], (long)medium[0], (long)medium[3], (long)medium[4],
+             (long)high[0], (long)high[1], (long)high[2]);
+    check((low[0] == 6) && (low[1] == 7) && (low[2] == -1) && (bad == 0) && (medium[4] == -1) && (high[0] == 0) &&
+              (high[1] == 1) && (high[2] == -1),
+          line);
+
+    GPDMA_FreeChannel(3);
+    check((GPDMA_AllocChannel(GPDMA_PRIO_LOW) == -1) && (GPDMA_AllocChannel(GPDMA_PRIO_HIGH) == 3),
+          "a freed channel 3 goes to the high class, not to the low one");
+    for (uint8_t channel = 0; channel < 8; channel++)
+    {
+        GPDMA_FreeChannel(channel);
+    }
+}
+
+static void test_rejected(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+    lpc_sim_bus_stats_t before;
+    lpc_sim_bus_stats_t after;
+    int32_t channel = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    Status eight;
+    Status last;
+
+    m2m(&cfg, 8, src, dst, WORDS);
+    lpc_sim_bus_stats(&before);
+    eight = GPDMA_Submit(&cfg, on_done, NULL, NULL);
+    cfg.ChannelNum = 255;
+    last = GPDMA_Submit(&cfg, on_done, NULL, NULL);
+    lpc_sim_bus_stats(&after);
+    check((eight == ERROR) && (last == ERROR) && (param_failures == 2) && (after.reads == before.reads) &&
+              (after.writes == before.writes),
+          "GPDMA_Submit() rejects channels 8 and 255 past CHECK_PARAM(), without a register access");
+
+    cfg.ChannelNum = 5;
+    check(GPDMA_Submit(&cfg, on_done, NULL, NULL) == ERROR, "GPDMA_Submit() rejects an unallocated channel");
+
+    __disable_irq();
+    m2m(&cfg, (uint32_t)channel, src, dst, CHAIN * WORDS);
+    check(GPDMA_Submit(&cfg, on_done, NULL, NULL) == SUCCESS, "GPDMA_Submit() of 1024 words");
+    check(GPDMA_Submit(&cfg, on_done, NULL, NULL) == ERROR, "GPDMA_Submit() rejects a channel still busy");
+    __enable_irq();
+    while (done_count == 0)
+    {
+        __WFI();
+    }
+    GPDMA_FreeChannel((uint8_t)channel);
+    done_count = 0;
+}
+
+static void test_order(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+    GPDMA_Stats_Type high_stats;
+    GPDMA_Stats_Type low_stats;
+    int32_t high = GPDMA_AllocChannel(GPDMA_PRIO_HIGH);
+    int32_t low = GPDMA_AllocChannel(GPDMA_PRIO_LOW);
+    uint32_t bad = 0;
+    uint32_t irqs;
+    char line[160];
+
+    for (uint32_t i = 0; i < CHAIN * WORDS; i++)
+    {
+        src[i] = i * 2654435761U;
+    }
+
+    // Both transfers end while the interrupts are disabled: one interrupt serves the two
+    __disable_irq();
+    m2m(&cfg, (uint32_t)low, src, dst, WORDS);
+    (void)GPDMA_Submit(&cfg, on_done, NULL, (void*)7);
+    m2m(&cfg, (uint32_t)high, src, dst_high, WORDS / 4);
+    (void)GPDMA_Submit(&cfg, on_done, NULL, (void*)1);
+    lpc_sim_advance(100000);
+    irqs = dma_irqs;
+    __enable_irq();
+
+    for (uint32_t i = 0; i < WORDS; i++)
+    {
+        bad += (dst[i] != src[i]) || ((i < WORDS / 4) && (dst_high[i] != src[i]));
+    }
+    GPDMA_GetStats((uint8_t)high, &high_stats);
+    GPDMA_GetStats((uint8_t)low, &low_stats);
+    snprintf(line, sizeof(line), "channels %ld and %ld in %lu interrupt: callbacks of channel %lu (arg %lu) then %lu "
+             "(arg %lu), %lu words wrong",
+             (long)high, (long)low, (unsigned long)(dma_irqs - irqs), (unsigned long)done_channels[0],
+             (unsigned long)done_args[0], (unsigned long)done_channels[1], (unsigned long)done_args[1],
+             (unsigned long)bad);
+    check((high == 0) && (low == 6) && (dma_irqs - irqs == 1) && (done_count == 2) && (done_channels[0] == 0) &&
+              (done_args[0] == 1) && (done_channels[1] == 6) && (done_args[1] == 7) && (bad == 0),
+          line);
+    check((high_stats.Transfers == 1) && (high_stats.Bytes == WORDS) && (low_stats.Transfers == 1) &&
+              (low_stats.Bytes == 4 * WORDS) && (high_stats.Errors == 0) && (low_stats.Errors == 0),
+          "GPDMA_GetStats(): one transfer of 64 bytes on channel 0, of 256 bytes on channel 6");
+
+    GPDMA_FreeChannel((uint8_t)high);
+    GPDMA_FreeChannel((uint8_t)low);
+}
+
+static void test_chain(void)
+{
+    GPDMA_Stats_Type stats;
+    int32_t channel = GPDMA_AllocChannel(GPDMA_PRIO_MEDIUM);
+    uint32_t bad = 0;
+    char line[128];
+
+    for (uint32_t i = 0; i < CHAIN * WORDS; i++)
+    {
+        dst[i] = 0;
+    }
+    chain_blocks = 0;
+    m2m(&chain_cfg, (uint32_t)channel, src, dst, WORDS);
+    check(GPDMA_Submit(&chain_cfg, on_chain, NULL, NULL) == SUCCESS, "GPDMA_Submit() of the first block of a chain");
+    while (chain_blocks < CHAIN)
+    {
+        __WFI();
+    }
+
+    for (uint32_t i = 0; i < CHAIN * WORDS; i++)
+    {
+        bad += (dst[i] != src[i]);
+    }
+    GPDMA_GetStats((uint8_t)channel, &stats);
+    snprintf(line, sizeof(line), "%lu blocks submitted from the callback: %lu transfers, %lu bytes, %lu words wrong",
+             (unsigned long)CHAIN, (unsigned long)stats.Transfers, (unsigned long)stats.Bytes, (unsigned long)bad);
+    check((stats.Transfers == CHAIN) && (stats.Bytes == CHAIN * WORDS * 4) && (bad == 0), line);
+    GPDMA_FreeChannel((uint8_t)channel);
+}
+
+static void test_free(void)
+{
+    GPDMA_Channel_CFG_Type cfg;
+    GPDMA_Stats_Type stats;
+    int32_t channel = GPDMA_AllocChannel(GPDMA_PRIO_LOW);
+
+    done_count = 0;
+    m2m(&cfg, (uint32_t)channel, src, dst, CHAIN * WORDS);
+    (void)GPDMA_Submit(&cfg, on_done, on_done, NULL);
+    GPDMA_FreeChannel((uint8_t)channel);
+    lpc_sim_advance(1000000);
+    check((done_count == 0) && !(LPC_GPDMA->DMACEnbldChns & (1UL << channel)),
+          "GPDMA_FreeChannel() stops the transfer, no callback");
+
+    check(GPDMA_AllocChannel(GPDMA_PRIO_LOW) == channel, "GPDMA_AllocChannel() gives the freed channel again");
+    GPDMA_GetStats((uint8_t)channel, &stats);
+    check((stats.Transfers == 0) && (stats.Bytes == 0) && (stats.Errors == 0), "with its counters cleared");
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    GPDMA_Init();
+    NVIC_EnableIRQ(DMA_IRQn);
+
+    test_alloc();
+    test_rejected();
+    test_order();
+    test_chain();
+    test_free();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
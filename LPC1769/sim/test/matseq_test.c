@@ -0,0 +1,248 @@
+/*
+ * @file matseq_test.c
+ * @brief Trains of edges of the DMA driven match sequencer (lpc17xx_matseq), run by 'make test'
+ *
+ * The trace records each edge of MAT1.0 (P1.22) and MAT3.1 (P0.11) with its cycle, and each interrupt entry:
+ * - trains played once, 1001 edges of 50 to 20050 cycles and 4095 edges of 50 to 250 cycles: every edge falls on the
+ *   cycle of its table entry, the level alternates from the idle level, and the seq_end item stops the timer after the
+ *   last edge, with no further edge;
+ * - a train of 3 edges played in a loop, odd, from idle level 1: 100 passes exact, then an entry changed while it
+ *   plays takes effect from the next pass; MATSEQ_Stop() leaves the idle level and no further edge;
+ * - a loop of 64 edges on MAT3.1 with a prescale of 7: every interval exact, MAT1.0 does not move;
+ * - MATSEQ_Init() and MATSEQ_Start() reject bad parameters, an interval shorter than MATSEQ_MIN_CYCLES included, and a
+ *   rejected train leaves the output alone;
+ * - no interrupt is taken.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_matseq.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_sim.h"
+
+#define MAT1_0_ID 54U /* Trace id of P1.22: port * 32 + pin */
+#define MAT3_1_ID 11U /* Trace id of P0.11 */
+#define EDGES     8192U
+
+/* Edges of the pin under test, from the trace */
+static volatile uint32_t pin_id;
+static uint64_t edge_cycles[EDGES];
+static uint8_t edge_levels[EDGES];
+static volatile uint32_t edge_count;
+static volatile uint32_t level;
+static volatile uint32_t other_edges;
+static volatile uint32_t interrupts;
+
+static uint32_t table[MATSEQ_MAX_EDGES];
+static uint32_t seed = 1;
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+static void on_trace(const lpc_sim_trace_event_t* event)
+{
+    if (event->kind == LPC_SIM_TRACE_ISR_ENTER)
+    {
+        interrupts++;
+        return;
+    }
+    if (event->kind != LPC_SIM_TRACE_GPIO)
+    {
+        return;
+    }
+    if (event->id != pin_id)
+    {
+        other_edges++;
+        return;
+    }
+    level = event->value;
+    if (edge_count < EDGES)
+    {
+        edge_cycles[edge_count] = event->cycles;
+        edge_levels[edge_count] = (uint8_t)event->value;
+    }
+    edge_count++;
+}
+
+static uint32_t random_value(uint32_t range)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % range;
+}
+
+/* Edges from the first one that do not follow the table: interval Intervals[k] + 1 ticks, alternate level */
+static uint32_t bad_edges(uint32_t count, const uint32_t* intervals, uint32_t n, uint32_t prescale, uint32_t idle)
+{
+    uint32_t bad = 0;
+
+    for (uint32_t k = 0; k < count; k++)
+    {
+        bad += (edge_levels[k] != ((idle ^ k ^ 1) & 1));
+        if (k > 0)
+        {
+            bad += (edge_cycles[k] - edge_cycles[k - 1] != ((uint64_t)intervals[k % n] + 1) * prescale);
+        }
+    }
+    return bad;
+}
+
+static void test_rejected(void)
+{
+    MATSEQ_Type train = {table, 10, DISABLE, 0};
+
+    check(MATSEQ_Start(&train) == ERROR, "MATSEQ_Start() rejects a train before MATSEQ_Init()");
+    check(MATSEQ_Init((LPC_TIM_TypeDef*)LPC_GPIO0, 0, 1) == ERROR, "MATSEQ_Init() rejects a non-timer");
+    check(MATSEQ_Init(LPC_TIM1, 2, 1) == ERROR, "MATSEQ_Init() rejects MR2");
+    check(MATSEQ_Init(LPC_TIM1, 0, 0) == ERROR, "MATSEQ_Init() rejects a prescale of 0");
+    check(MATSEQ_Init(LPC_TIM1, 0, 1) == SUCCESS, "MATSEQ_Init() on MR0 of Timer1, 1 cycle ticks");
+    check(MATSEQ_GetTickHz() == SystemCoreClock, "the ticks count CCLK / 1");
+
+    for (uint32_t k = 0; k < 10; k++)
+    {
+        table[k] = MATSEQ_TICKS(100);
+    }
+    train.Count = 1;
+    check(MATSEQ_Start(&train) == ERROR, "MATSEQ_Start() rejects a single edge");
+    train.Count = MATSEQ_MAX_EDGES + 1;
+    check(MATSEQ_Start(&train) == ERROR, "MATSEQ_Start() rejects MATSEQ_MAX_EDGES + 1 edges");
+    train.Count = 10;
+    train.IdleLevel = 2;
+    check(MATSEQ_Start(&train) == ERROR, "MATSEQ_Start() rejects an idle level of 2");
+    train.IdleLevel = 0;
+    table[5] = MATSEQ_TICKS(MATSEQ_MIN_CYCLES - 1);
+    check(MATSEQ_Start(&train) == ERROR, "MATSEQ_Start() rejects an interval of MATSEQ_MIN_CYCLES - 1 cycles");
+    table[5] = MATSEQ_TICKS(MATSEQ_MIN_CYCLES);
+    lpc_sim_advance(100000);
+    check((edge_count == 0) && !MATSEQ_IsBusy(), "a rejected train plays no edge");
+}
+
+/* One shot trains end with the transfer of seq_end, which writes 0 to TCR */
+static void test_once(uint32_t count, uint32_t spread, uint32_t idle)
+{
+    MATSEQ_Type train = {table, count, DISABLE, (uint8_t)idle};
+    uint64_t total = 0;
+    uint64_t start;
+    uint32_t bad;
+    uint32_t edges;
+    char line[128];
+
+    for (uint32_t k = 0; k < count; k++)
+    {
+        table[k] = MATSEQ_TICKS(MATSEQ_MIN_CYCLES + random_value(spread));
+        total += table[k] + 1;
+    }
+    check((MATSEQ_Start(&train) == SUCCESS) && (level == idle) && MATSEQ_IsBusy(), "MATSEQ_Start() of a train once");
+    edge_count = 0;
+    start = lpc_sim_cycles();
+    lpc_sim_advance(total + 100000);
+    edges = edge_count;
+    bad = bad_edges(edges, table, count, 1, idle);
+
+    snprintf(line, sizeof(line), "%lu edges played once: %lu played, %lu off the table, first after %llu of %lu cycles",
+             (unsigned long)count, (unsigned long)edges, (unsigned long)bad,
+             (unsigned long long)(edge_cycles[0] - start), (unsigned long)(table[0] + 1));
+    check((edges == count) && (bad == 0) && (edge_cycles[0] - start <= table[0] + 1), line);
+    check(!MATSEQ_IsBusy() && (LPC_TIM1->TCR == 0), "the seq_end item stops the timer after the last edge");
+    check(level == ((idle ^ count) & 1), "the output stays at the level of the last edge");
+    lpc_sim_advance(1000000);
+    check(edge_count == edges, "no edge after the end of the train");
+}
+
+/* An odd train in a loop, and an entry changed while it plays */
+static void test_loop(void)
+{
+    static uint32_t frame[3] = {MATSEQ_TICKS(1000), MATSEQ_TICKS(300), MATSEQ_TICKS(4000)};
+    static const uint32_t edited[3] = {MATSEQ_TICKS(1000), MATSEQ_TICKS(700), MATSEQ_TICKS(4000)};
+    MATSEQ_Type train = {frame, 3, ENABLE, 1};
+    uint32_t bad = 0;
+    uint32_t edges;
+    char line[96];
+
+    check((MATSEQ_Start(&train) == SUCCESS) && (level == 1), "MATSEQ_Start() of a loop from idle level 1");
+    edge_count = 0;
+    lpc_sim_advance(5300 * 100 + 10);
+    edges = edge_count;
+    snprintf(line, sizeof(line), "100 passes of 3 edges: %lu edges, %lu off the table", (unsigned long)edges,
+             (unsigned long)bad_edges(edges, frame, 3, 1, 1));
+    check((edges == 300) && (bad_edges(edges, frame, 3, 1, 1) == 0), line);
+
+    // The GPDMA has read the entry of the next edge already: the change shows from the pass after it
+    frame[1] = edited[1];
+    lpc_sim_advance(5700 * 50);
+    for (uint32_t k = edges + 4; k < edge_count; k++)
+    {
+        bad += (edge_cycles[k] - edge_cycles[k - 1] != (uint64_t)edited[k % 3] + 1);
+    }
+    snprintf(line, sizeof(line), "%lu edges after an entry changed while playing: %lu off the new table",
+             (unsigned long)(edge_count - edges - 4), (unsigned long)bad);
+    check((edge_count - edges > 140) && (bad == 0), line);
+
+    MATSEQ_Stop();
+    edges = edge_count;
+    check(!MATSEQ_IsBusy() && (level == 1), "MATSEQ_Stop() leaves the idle level");
+    lpc_sim_advance(1000000);
+    check(edge_count == edges, "no edge after MATSEQ_Stop()");
+}
+
+/* MAT3.1 counts 7 cycles per tick, MAT1.0 stays where it is */
+static void test_prescale(void)
+{
+    MATSEQ_Type train = {table, 64, ENABLE, 0};
+    uint32_t edges;
+    uint32_t bad;
+    char line[96];
+
+    check(MATSEQ_Init(LPC_TIM3, 1, 7) == SUCCESS, "MATSEQ_Init() on MR1 of Timer3, 7 cycle ticks");
+    check(MATSEQ_GetTickHz() == SystemCoreClock / 7, "the ticks count CCLK / 7");
+    for (uint32_t k = 0; k < 64; k++)
+    {
+        table[k] = MATSEQ_TICKS(8 + random_value(500));
+    }
+    pin_id = MAT3_1_ID;
+    edge_count = 0;
+    other_edges = 0;
+    check(MATSEQ_Start(&train) == SUCCESS, "MATSEQ_Start() of 64 edges in a loop");
+    lpc_sim_advance(64ULL * 510 * 7 * 20);
+    MATSEQ_Stop();
+    edges = edge_count;
+    bad = bad_edges(edges, table, 64, 7, 0);
+    snprintf(line, sizeof(line), "MAT3.1: %lu edges, %lu off the table, %lu edges on other pins", (unsigned long)edges,
+             (unsigned long)bad, (unsigned long)other_edges);
+    check((edges > 64 * 19) && (bad == 0) && (other_edges == 0), line);
+}
+
+int main(void)
+{
+    static const PINSEL_CFG_Type pins[] = {
+        {PINSEL_PORT_1, PINSEL_PIN_22, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL}, /* MAT1.0 */
+        {PINSEL_PORT_0, PINSEL_PIN_11, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL}, /* MAT3.1 */
+    };
+    char line[64];
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    GPDMA_Init();
+    PINSEL_ConfigPins(pins, sizeof(pins) / sizeof(pins[0]));
+    pin_id = MAT1_0_ID;
+    lpc_sim_set_trace_hook(on_trace);
+
+    test_rejected();
+    test_once(1001, 20000, 0);
+    test_once(MATSEQ_MAX_EDGES, 200, 1);
+    test_loop();
+    test_prescale();
+
+    lpc_sim_set_trace_hook(NULL);
+    snprintf(line, sizeof(line), "%lu interrupts taken", (unsigned long)interrupts);
+    check(interrupts == 0, line);
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+/*
+ * @file prof_test.c
+ * @brief Durations, latencies and CPU load of the DWT cycle counter profiler (lpc17xx_prof), run by 'make test'
+ *
+ * The handlers of Timer0 and Timer1 are pended through ISPR and do a known work in virtual time:
+ * - Timer1 preempts Timer0 in the middle of its work, RUNS times: the duration of Timer1 is its work, and the duration
+ *   of Timer0 is its own work without the cycles of Timer1;
+ * - LATENCIES triggers stamped 0 to 2^23 cycles before Timer0 is taken: every latency is the delay, and the log2
+ *   histogram holds each one in its bin;
+ * - PROF_GetLoad() over WINDOWS windows of random idle and busy cycles, then a window where an interrupt ends the idle
+ *   period: within 1 per mille of the busy share.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_prof.h"
+#include "lpc17xx_sim.h"
+
+#define OUTER_BEFORE 1000U /* Cycles of Timer0 before it pends Timer1 */
+#define OUTER_AFTER  2500U /* Cycles of Timer0 after Timer1 returns */
+#define INNER_WORK   7000U /* Cycles of Timer1 */
+#define ACCESS       4U    /* Cycles of a register access in the simulator */
+#define RUNS         200U
+#define LATENCIES    2000U
+#define WINDOWS      50U
+
+static volatile uint32_t outer_work = OUTER_BEFORE;
+static volatile uint32_t preempt;
+
+static uint32_t seed = 9;
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+static uint32_t random_value(uint32_t range)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % range;
+}
+
+void TIMER0_IRQHandler(void)
+{
+    PROF_IsrEnter(TIMER0_IRQn);
+    lpc_sim_advance(outer_work);
+    if (preempt)
+    {
+        NVIC_SetPendingIRQ(TIMER1_IRQn);
+        lpc_sim_advance(OUTER_AFTER);
+    }
+    PROF_IsrExit(TIMER0_IRQn);
+}
+
+void TIMER1_IRQHandler(void)
+{
+    PROF_IsrEnter(TIMER1_IRQn);
+    lpc_sim_advance(INNER_WORK);
+    PROF_IsrExit(TIMER1_IRQn);
+}
+
+/* Bin of a value in PROF_SERIES_Type.hist */
+static uint32_t bin_of(uint32_t cycles)
+{
+    uint32_t bin = 0;
+
+    while ((bin < 32) && (cycles >> bin) != 0)
+    {
+        bin++;
+    }
+    return bin;
+}
+
+static void test_nested(void)
+{
+    const PROF_SLOT_Type* outer = PROF_GetSlot(TIMER0_IRQn);
+    const PROF_SLOT_Type* inner = PROF_GetSlot(TIMER1_IRQn);
+    // Timer0 also holds its write to ISPR and the read of CYCCNT that enters Timer1
+    uint32_t expected = OUTER_BEFORE + OUTER_AFTER + 2 * ACCESS;
+    char line[160];
+
+    preempt = 1;
+    for (uint32_t i = 0; i < RUNS; i++)
+    {
+        NVIC_SetPendingIRQ(TIMER0_IRQn);
+    }
+    preempt = 0;
+
+    snprintf(line, sizeof(line), "%lu runs of Timer0 preempted by Timer1: Timer0 %lu to %lu cycles, Timer1 %lu to %lu",
+             (unsigned long)inner->duration.count, (unsigned long)outer->duration.min,
+             (unsigned long)outer->duration.max, (unsigned long)inner->duration.min,
+             (unsigned long)inner->duration.max);
+    check((outer->duration.count == RUNS) && (inner->duration.count == RUNS) && (outer->duration.min == expected) &&
+              (outer->duration.max == expected) && (inner->duration.min == INNER_WORK) &&
+              (inner->duration.max == INNER_WORK),
+          line);
+    check((PROF_GetMean(&outer->duration) == expected) && (outer->duration.hist[bin_of(expected)] == RUNS) &&
+              (inner->duration.hist[bin_of(INNER_WORK)] == RUNS) && (outer->latency.count == 0),
+          "mean and histogram of the durations, no latency without a trigger");
+}
+
+static void test_latency(void)
+{
+    const PROF_SLOT_Type* outer = PROF_GetSlot(TIMER0_IRQn);
+    uint32_t hist[PROF_HIST_BINS] = {0};
+    uint64_t sum = 0;
+    uint32_t max = 0;
+    uint32_t bad_bins = 0;
+    char line[160];
+
+    PROF_Reset();
+    outer_work = 100;
+    for (uint32_t i = 0; i < LATENCIES; i++)
+    {
+        uint32_t bin = random_value(24);
+        uint32_t delay = (bin == 0) ? 0 : (1UL << (bin - 1)) + random_value(1UL << (bin - 1));
+
+        // Stamped after the write to ISPR: the read of CYCCNT on entry is the overhead the profiler removes
+        __disable_irq();
+        NVIC_SetPendingIRQ(TIMER0_IRQn);
+        PROF_MarkTrigger(TIMER0_IRQn);
+        lpc_sim_advance(delay);
+        __enable_irq();
+
+        hist[bin]++;
+        sum += delay;
+        max = (delay > max) ? delay : max;
+    }
+
+    for (uint32_t bin = 0; bin < PROF_HIST_BINS; bin++)
+    {
+        bad_bins += (outer->latency.hist[bin] != hist[bin]);
+    }
+    snprintf(line, sizeof(line), "%lu latencies of 0 to %lu cycles: min %lu, max %lu, mean %lu of %lu, %lu bins off",
+             (unsigned long)outer->latency.count, (unsigned long)max, (unsigned long)outer->latency.min,
+             (unsigned long)outer->latency.max, (unsigned long)PROF_GetMean(&outer->latency),
+             (unsigned long)(sum / LATENCIES), (unsigned long)bad_bins);
+    check((outer->latency.count == LATENCIES) && (outer->latency.min == 0) && (outer->latency.max == max) &&
+              (outer->latency.sum == sum) && (bad_bins == 0),
+          line);
+}
+
+/* Load of a window of idle then busy cycles, against the busy share of its length in virtual time */
+static int32_t load_error(uint32_t idle, uint32_t busy, uint32_t handler)
+{
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t load;
+
+    (void)PROF_GetLoad();
+    start = lpc_sim_cycles();
+    PROF_IdleEnter();
+    lpc_sim_advance(idle);
+    if (handler != 0)
+    {
+        // The entry in Timer0 ends the idle period, as the interrupt that wakes __WFI() does
+        outer_work = handler;
+        NVIC_SetPendingIRQ(TIMER0_IRQn);
+    }
+    else
+    {
+        PROF_IdleExit();
+    }
+    lpc_sim_advance(busy);
+    load = PROF_GetLoad();
+    elapsed = lpc_sim_cycles() - start;
+    return (int32_t)load - (int32_t)(1000 - (uint64_t)idle * 1000 / elapsed);
+}
+
+static void test_load(void)
+{
+    int32_t worst = 0;
+    int32_t error;
+    char line[128];
+
+    check(load_error(0, 100000, 0) == 0, "PROF_GetLoad() of a busy window");
+    check(load_error(100000, 0, 0) == 0, "PROF_GetLoad() of an idle window");
+    for (uint32_t i = 0; i < WINDOWS; i++)
+    {
+        error = load_error(random_value(1000000), 1000 + random_value(1000000), 0);
+        worst = (abs(error) > abs(worst)) ? error : worst;
+    }
+    snprintf(line, sizeof(line), "%lu windows of random load: PROF_GetLoad() off by %ld per mille at most",
+             (unsigned long)WINDOWS, (long)worst);
+    check(abs(worst) <= 1, line);
+
+    error = load_error(300000, 100000, 600000);
+    snprintf(line, sizeof(line), "an interrupt ends the idle period: PROF_GetLoad() off by %ld per mille", (long)error);
+    check(abs(error) <= 1, line);
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    lpc_sim_set_access_cycles(ACCESS);
+    PROF_Init();
+    NVIC_SetPriority(TIMER0_IRQn, 4);
+    NVIC_SetPriority(TIMER1_IRQn, 2);
+    NVIC_EnableIRQ(TIMER0_IRQn);
+    NVIC_EnableIRQ(TIMER1_IRQn);
+    check((PROF_Attach(TIMER0_IRQn) == SUCCESS) && (PROF_Attach(TIMER1_IRQn) == SUCCESS),
+          "PROF_Attach() of Timer0 and Timer1");
+    check(PROF_GetSlot(TIMER2_IRQn) == NULL, "no profile of Timer2");
+
+    test_nested();
+    test_latency();
+    test_load();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
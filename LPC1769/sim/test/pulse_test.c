@@ -0,0 +1,244 @@
+/*
+ * @file pulse_test.c
+ * @brief Measurements of the capture based pulse engine (lpc17xx_pulse) on Timer1, run by 'make test'
+ *
+ * A stimulus drives the same signal on CAP1.0 (P1.18) and CAP1.1 (P1.19), and records the time of each edge. Timer1
+ * counts the core clock, so a tick is a cycle of the trace. Each measurement is compared with the recorded edges:
+ * - MEASURES pseudo-random measurements of 1 to PULSE_MAX_PERIODS periods of a 20 to 50 kHz signal with random duty
+ *   cycles: the duty cycle is exact, the period and the frequency within 1 LSB of Q16;
+ * - a falling edge that never reaches CAP1.1 makes PULSE_Measure() return ERROR until it leaves the periods measured;
+ * - 200 measurements of a 10 Hz signal, 0.5 s apart on average, take the TC over 2^32 twice: the time stamps of the
+ *   edges stay exact in 64 bits.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_pulse.h"
+#include "lpc17xx_sim.h"
+
+#define SIGNAL_PINS ((1UL << 18) | (1UL << 19)) /* P1.18 CAP1.0, P1.19 CAP1.1 */
+#define RISE_PIN    (1UL << 18)
+#define MEASURES    5000U
+#define EDGES       256U /* Edges recorded, a power of two larger than the ring of the driver */
+
+/* Signals the stimulus plays */
+typedef enum
+{
+    SIGNAL_RANDOM = 0, /* 20 to 50 kHz, random duty cycle, each period its own */
+    SIGNAL_FIXED,      /* 20 kHz, 50 % */
+    SIGNAL_SLOW        /* 10 Hz, 33 % */
+} signal_t;
+
+static volatile signal_t signal;
+static volatile uint32_t skip_fall; /* The next falling edge reaches CAP1.0 only, CAP1.1 misses it */
+static uint32_t seed = 7;
+
+/* Edges driven, in cycles */
+static uint64_t edge_cycles[EDGES];
+static uint8_t edge_rising[EDGES];
+static volatile uint32_t edge_count;
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+void TIMER1_IRQHandler(void)
+{
+    PULSE_IntHandler();
+}
+
+static uint32_t random_value(uint32_t range)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % range;
+}
+
+/* A rising edge starts a period and draws its high and low times */
+static uint64_t drive(uint64_t cycle)
+{
+    static uint32_t level;
+    static uint32_t high;
+    static uint32_t low;
+
+    level = !level;
+    if (!level && skip_fall)
+    {
+        lpc_sim_gpio_drive(1, RISE_PIN, 0);
+        skip_fall = 0;
+    }
+    else
+    {
+        lpc_sim_gpio_drive(1, SIGNAL_PINS, level ? SIGNAL_PINS : 0);
+    }
+    edge_cycles[edge_count % EDGES] = cycle;
+    edge_rising[edge_count % EDGES] = (uint8_t)level;
+    edge_count++;
+
+    if (!level)
+    {
+        return cycle + low;
+    }
+    if (signal == SIGNAL_RANDOM)
+    {
+        uint32_t period = 2000 + random_value(3000);
+
+        high = period / 10 + random_value(period * 8 / 10);
+        low = period - high;
+    }
+    else if (signal == SIGNAL_FIXED)
+    {
+        high = 2500;
+        low = 2500;
+    }
+    else
+    {
+        high = 3333333;
+        low = 6666667;
+    }
+    return cycle + high;
+}
+
+/*
+ * Expected results of the last periods ending on a rising edge, from the recorded edges. The Q16 period and frequency
+ * are left in floating point, to be compared within 1 LSB.
+ */
+static void expect(uint32_t periods, double* period_us, double* frequency_hz, uint32_t* duty, uint64_t* last)
+{
+    uint32_t index = edge_count - 1;
+    uint64_t high = 0;
+    uint64_t total;
+
+    index -= !edge_rising[index % EDGES];
+    *last = edge_cycles[index % EDGES];
+    for (uint32_t p = 0; p < periods; p++)
+    {
+        high += edge_cycles[(index - 1) % EDGES] - edge_cycles[(index - 2) % EDGES];
+        index -= 2;
+    }
+    total = *last - edge_cycles[index % EDGES];
+    *period_us = (double)total * 1e6 / SystemCoreClock / periods * 65536.0;
+    *frequency_hz = (double)periods * SystemCoreClock / (double)total * 65536.0;
+    *frequency_hz = (*frequency_hz > 4294967295.0) ? 4294967295.0 : *frequency_hz;
+    *duty = (uint32_t)((high << 16) / total);
+}
+
+static int within_lsb(double value, double expected)
+{
+    return (value >= expected - 1.0) && (value <= expected + 1.0);
+}
+
+/* Measures after a pseudo-random time each; LastEdge is checked against the edges offset by the TC at the start */
+static void measure(uint32_t count, uint64_t max_cycles, uint32_t max_periods, const char* what)
+{
+    static int64_t offset;
+    static int have_offset;
+    uint32_t errors = 0;
+    uint32_t bad_duty = 0;
+    uint32_t bad_period = 0;
+    uint32_t bad_frequency = 0;
+    uint32_t bad_edge = 0;
+    char line[128];
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint32_t periods = 1 + random_value(max_periods);
+        PULSE_Result_Type result;
+        double period_us;
+        double frequency_hz;
+        uint32_t duty;
+        uint64_t last;
+
+        lpc_sim_advance(1000 + random_value(1000) * (max_cycles / 1000));
+        if (PULSE_Measure(periods, &result) != SUCCESS)
+        {
+            errors++;
+            continue;
+        }
+        expect(periods, &period_us, &frequency_hz, &duty, &last);
+        if (!have_offset)
+        {
+            offset = (int64_t)(result.LastEdge - last);
+            have_offset = 1;
+        }
+        bad_duty += (result.Duty != duty);
+        bad_period += !within_lsb((double)result.PeriodUs, period_us);
+        bad_frequency += !within_lsb((double)result.FrequencyHz, frequency_hz);
+        bad_edge += (result.LastEdge != last + offset) || (result.Periods != periods);
+    }
+
+    snprintf(line, sizeof(line), "%s: %lu measurements, %lu errors, %lu duty, %lu period, %lu frequency, %lu edge "
+             "mismatches", what, (unsigned long)count, (unsigned long)errors, (unsigned long)bad_duty,
+             (unsigned long)bad_period, (unsigned long)bad_frequency, (unsigned long)bad_edge);
+    check((errors == 0) && (bad_duty == 0) && (bad_period == 0) && (bad_frequency == 0) && (bad_edge == 0), line);
+}
+
+static void test_missed(void)
+{
+    PULSE_Result_Type result;
+    Status before;
+    Status after;
+    Status cleared;
+
+    signal = SIGNAL_FIXED;
+    lpc_sim_advance(5000 * 8);
+    before = PULSE_Measure(4, &result);
+    skip_fall = 1;
+    lpc_sim_advance(5000 * 2);
+    after = PULSE_Measure(4, &result);
+    lpc_sim_advance(5000 * 5);
+    cleared = PULSE_Measure(4, &result);
+
+    check(before == SUCCESS, "4 periods measured before the missed edge");
+    check(after == ERROR, "a missed falling edge in the periods gives ERROR");
+    check((cleared == SUCCESS) && (result.Duty == PULSE_Q16_ONE / 2), "5 periods later, 4 periods at 50 % again");
+}
+
+static void test_wrap(void)
+{
+    char line[96];
+
+    signal = SIGNAL_SLOW;
+    lpc_sim_advance((uint64_t)SystemCoreClock);
+    measure(200, (uint64_t)SystemCoreClock, 3, "10 Hz over 100 s");
+    snprintf(line, sizeof(line), "PULSE_Now() at %llu ticks, TC wrapped %llu times",
+             (unsigned long long)PULSE_Now(), (unsigned long long)(PULSE_Now() >> 32));
+    check((PULSE_Now() >> 32) >= 2, line);
+}
+
+int main(void)
+{
+    static const PINSEL_CFG_Type pins[] = {
+        {PINSEL_PORT_1, PINSEL_PIN_18, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+        {PINSEL_PORT_1, PINSEL_PIN_19, PINSEL_FUNC_3, PINSEL_PINMODE_PULLUP, PINSEL_PINMODE_NORMAL},
+    };
+    PULSE_Result_Type result;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    lpc_sim_gpio_drive(1, SIGNAL_PINS, 0);
+    PINSEL_ConfigPins(pins, 2);
+
+    check(PULSE_Init(LPC_TIM1, 4, 1) == ERROR, "PULSE_Init() rejects MR4");
+    check(PULSE_Init(LPC_TIM1, 3, 0) == ERROR, "PULSE_Init() rejects a prescale of 0");
+    check(PULSE_Init((LPC_TIM_TypeDef*)LPC_GPIO0, 3, 1) == ERROR, "PULSE_Init() rejects a non-timer");
+    check(PULSE_Init(LPC_TIM1, 3, 1) == SUCCESS, "PULSE_Init() on Timer1, MR3, 1 cycle ticks");
+    check(PULSE_GetTickHz() == SystemCoreClock, "the ticks count CCLK / 1");
+    check(PULSE_Measure(1, &result) == ERROR, "no measurement without edges");
+    check(PULSE_Measure(PULSE_MAX_PERIODS + 1, &result) == ERROR, "PULSE_Measure() rejects PULSE_MAX_PERIODS + 1");
+
+    lpc_sim_set_stimulus(drive, lpc_sim_cycles() + 1000);
+    lpc_sim_advance(200000);
+    measure(MEASURES, 200000, PULSE_MAX_PERIODS, "20 to 50 kHz");
+    test_missed();
+    test_wrap();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,256 @@
+/*
+ * @file pwmsync_test.c
+ * @brief Frames of the synchronized PWM1 service (lpc17xx_pwmsync), run by 'make test'
+ *
+ * The six outputs of PWM1 (P2.0 to P2.5) run at 1 kHz. FRAMES frames are committed at pseudo-random times, one in
+ * three of them less than 64 ticks before the end of a period. Frame k sets the high time of PWM1.n to
+ * 100 + 1000 * (k % 90) + n - 1 ticks, so each falling edge of the trace tells the frame its output comes from:
+ * - with PWMSYNC_Commit(), no period mixes two frames, and a commit reads no register and writes 8;
+ * - the same commits done with PWM_MatchUpdate() on each channel, then with PWM_MultiMatchUpdate(), are counted for
+ *   comparison, and the per channel updates must mix periods: the check sees them;
+ * - PWMSYNC_Init() rejects a bad period before it changes PWM1: the outputs keep running on the previous frame.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_pwm.h"
+#include "lpc17xx_pwmsync.h"
+#include "lpc17xx_sim.h"
+
+#define FRAMES      3000U
+#define NEAR_TICKS  64U   /* A commit near the end of a period is less than NEAR_TICKS ticks before it */
+#define MAX_PERIODS 4096U /* Periods recorded per run */
+#define PWM_PIN_ID  64U   /* Trace id of P2.0, PWM1.1: port * 32 + pin */
+
+/* Ways to update the six match registers */
+typedef enum
+{
+    UPDATE_PWMSYNC = 0,
+    UPDATE_MATCH,
+    UPDATE_MULTI_MATCH,
+    UPDATES
+} update_t;
+
+static const char* const update_names[UPDATES] = {"PWMSYNC_Commit()", "PWM_MatchUpdate() per channel",
+                                                  "PWM_MultiMatchUpdate()"};
+
+static const PWMSYNC_CFG_Type cfg = {1000, 0x3F, 0, 0}; /* 1 kHz, PWM1.1 to PWM1.6 single edge */
+
+static uint32_t period;
+static uint32_t seed;
+static uint32_t failures;
+
+/* State of the trace record: high time of each output in each period, from the first rising edge of the run */
+static uint64_t first_rise;
+static uint64_t rise_cycles[PWMSYNC_CHANNELS];
+static uint32_t high_ticks[MAX_PERIODS][PWMSYNC_CHANNELS];
+static uint8_t seen[MAX_PERIODS][PWMSYNC_CHANNELS];
+static uint32_t last_period;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+/* PWM1 counts the core clock: trace cycles are ticks */
+static void on_trace(const lpc_sim_trace_event_t* event)
+{
+    uint32_t n = event->id - PWM_PIN_ID;
+    uint64_t p;
+
+    if ((event->kind != LPC_SIM_TRACE_GPIO) || (n >= PWMSYNC_CHANNELS))
+    {
+        return;
+    }
+    if (event->value)
+    {
+        rise_cycles[n] = event->cycles;
+        first_rise = (first_rise == 0) ? event->cycles : first_rise;
+        return;
+    }
+    if (first_rise == 0)
+    {
+        return;
+    }
+    p = (rise_cycles[n] - first_rise) / period;
+    if (p < MAX_PERIODS)
+    {
+        high_ticks[p][n] = (uint32_t)(event->cycles - rise_cycles[n]);
+        seen[p][n] = 1;
+        last_period = (p > last_period) ? (uint32_t)p : last_period;
+    }
+}
+
+static uint32_t random_ticks(void)
+{
+    seed = seed * 1103515245U + 12345U;
+    return seed >> 8;
+}
+
+static void update(update_t how, const PWMSYNC_Frame_Type* frame)
+{
+    PWM_Match_T matches[PWMSYNC_CHANNELS + 1] = {{0}};
+
+    switch (how)
+    {
+        case UPDATE_PWMSYNC:
+            PWMSYNC_Commit(frame);
+            break;
+        case UPDATE_MATCH:
+            for (uint32_t n = 1; n <= PWMSYNC_CHANNELS; n++)
+            {
+                PWM_MatchUpdate(LPC_PWM1, n, frame->High[n - 1], PWM_MATCH_UPDATE_NEXT_RST);
+            }
+            break;
+        default:
+            for (uint32_t n = 1; n <= PWMSYNC_CHANNELS; n++)
+            {
+                matches[n].Matchvalue = frame->High[n - 1];
+                matches[n].Status = SET;
+            }
+            PWM_MultiMatchUpdate(LPC_PWM1, matches, PWM_MATCH_UPDATE_NEXT_RST);
+            break;
+    }
+}
+
+/* Periods of the record that mix frames, or miss an output; the last period may be cut short */
+static uint32_t mixed_periods(uint32_t* periods)
+{
+    uint32_t mixed = 0;
+
+    *periods = 0;
+    for (uint32_t p = 0; p < last_period; p++)
+    {
+        int32_t frame = -1;
+        uint32_t bad = 0;
+
+        for (uint32_t n = 0; n < PWMSYNC_CHANNELS; n++)
+        {
+            uint32_t value = high_ticks[p][n] - 100 - n;
+
+            bad |= !seen[p][n] || (value % 1000 != 0) || ((frame >= 0) && (value / 1000 != (uint32_t)frame));
+            frame = (int32_t)(value / 1000);
+        }
+        mixed += bad;
+        (*periods)++;
+    }
+    return mixed;
+}
+
+/* Commits FRAMES frames one way, at the same times every run, and counts the mixed periods */
+static void run(update_t how)
+{
+    PWMSYNC_Frame_Type frame = {{0}, {0}};
+    lpc_sim_bus_stats_t before;
+    lpc_sim_bus_stats_t after;
+    uint64_t reads = 0;
+    uint64_t writes = 0;
+    uint32_t periods;
+    uint32_t mixed;
+    char line[128];
+
+    seed = 7;
+    for (uint32_t p = 0; p < MAX_PERIODS; p++)
+    {
+        for (uint32_t n = 0; n < PWMSYNC_CHANNELS; n++)
+        {
+            seen[p][n] = 0;
+        }
+    }
+    first_rise = 0;
+    last_period = 0;
+
+    PWMSYNC_Init((PWMSYNC_CFG_Type*)&cfg);
+    lpc_sim_set_trace_hook(on_trace);
+    for (uint32_t k = 1; k <= FRAMES; k++)
+    {
+        for (uint32_t n = 0; n < PWMSYNC_CHANNELS; n++)
+        {
+            frame.High[n] = 100 + 1000 * (k % 90) + n;
+        }
+        if (k % 3 == 0)
+        {
+            uint32_t tc = LPC_PWM1->TC;
+            uint32_t target = period - 1 - random_ticks() % NEAR_TICKS;
+
+            lpc_sim_advance((target > tc) ? target - tc : period + target - tc);
+        }
+        else
+        {
+            lpc_sim_advance(random_ticks() % (2 * period));
+        }
+        lpc_sim_bus_stats(&before);
+        update(how, &frame);
+        lpc_sim_bus_stats(&after);
+        reads += after.reads - before.reads;
+        writes += after.writes - before.writes;
+    }
+    lpc_sim_advance(3 * period);
+    lpc_sim_set_trace_hook(NULL);
+
+    mixed = mixed_periods(&periods);
+    snprintf(line, sizeof(line), "%s: %lu of %lu periods mixed, %.2f reads and %.2f writes per frame",
+             update_names[how], (unsigned long)mixed, (unsigned long)periods, (double)reads / FRAMES,
+             (double)writes / FRAMES);
+    if (how == UPDATE_PWMSYNC)
+    {
+        check((mixed == 0) && (periods > FRAMES / 2) && (reads == 0) && (writes == 8 * FRAMES), line);
+    }
+    else if (how == UPDATE_MATCH)
+    {
+        check(mixed != 0, line);
+    }
+    else
+    {
+        printf("INFO: %s\n", line);
+    }
+}
+
+static void test_init(void)
+{
+    PWMSYNC_CFG_Type bad = cfg;
+    uint32_t pclksel0 = LPC_SC->PCLKSEL0;
+    uint32_t tcr = LPC_PWM1->TCR;
+    uint32_t mr0 = LPC_PWM1->MR0;
+    uint32_t tc = LPC_PWM1->TC;
+
+    bad.PeriodUs = 0;
+    check(PWMSYNC_Init(&bad) == ERROR, "PWMSYNC_Init() rejects a period of 0");
+    bad.PeriodUs = 50000000;
+    check(PWMSYNC_Init(&bad) == ERROR, "PWMSYNC_Init() rejects a period of 2^32 ticks or more");
+    check((LPC_SC->PCLKSEL0 == pclksel0) && (LPC_PWM1->TCR == tcr) && (LPC_PWM1->MR0 == mr0) &&
+              (LPC_PWM1->TC != tc) && (PWMSYNC_GetPeriodTicks() == period),
+          "a rejected period leaves PWM1 running on its clock and period");
+}
+
+int main(void)
+{
+    static const PINSEL_CFG_Type pins = {PINSEL_PORT_2, PINSEL_PIN_0, PINSEL_FUNC_1, PINSEL_PINMODE_PULLUP,
+                                         PINSEL_PINMODE_NORMAL};
+    PINSEL_CFG_Type pin = pins;
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    for (uint8_t n = 0; n < PWMSYNC_CHANNELS; n++)
+    {
+        pin.Pinnum = n;
+        PINSEL_ConfigPin(&pin);
+    }
+
+    check(PWMSYNC_Init((PWMSYNC_CFG_Type*)&cfg) == SUCCESS, "PWMSYNC_Init() at 1 kHz");
+    period = PWMSYNC_GetPeriodTicks();
+    check(period == SystemCoreClock / 1000, "a period counts CCLK / 1000 ticks");
+
+    for (uint32_t how = 0; how < UPDATES; how++)
+    {
+        run((update_t)how);
+    }
+    test_init();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,181 @@
+/*
+ * @file recplay_test.c
+ * @brief DACR words of the record and playback engine (lpc17xx_recplay), run by 'make test'
+ *
+ * AD0.2 is recorded at 200 kHz into a buffer of three blocks, the last one shorter, and played at 1 MHz. Falling edges
+ * of P2.10 at pseudo-random times switch modes from EINT0_IRQHandler(), as in the RECPLAY example. The ADGDR words
+ * recorded carry DONE and the channel number in CHN:
+ * - when the playback starts, every word of the buffer holds the VALUE field of DACR only;
+ * - the words the GPDMA writes to DACR while playing have no other bit set;
+ * - the DAC outputs the 10 upper bits of the recorded results;
+ * - RECPLAY_SetPlayRate() takes 1 MHz and rejects more.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_adc.h"
+#include "lpc17xx_exti.h"
+#include "lpc17xx_gpdma.h"
+#include "lpc17xx_pinsel.h"
+#include "lpc17xx_recplay.h"
+#include "lpc17xx_sim.h"
+
+#define SWITCH_PIN (1UL << 10) /* P2.10, EINT0 */
+#define SAMPLES    (2 * RECPLAY_BLOCK_SIZE + 952)
+#define EDGES      60U
+#define MIN_GAP_US 500U /* Time between two falling edges, pseudo-random from MIN_GAP_US to MAX_GAP_US */
+#define MAX_GAP_US 30000U
+#define STEP_US    100U /* DACR is read back every STEP_US while playing */
+
+#define VALUE_MASK 0xFFC0U /* VALUE field of DACR, bits 15:6 */
+
+static RECPLAY_AHBRAM1 uint32_t samples[SAMPLES];
+static const RECPLAY_CFG_Type cfg = {samples, SAMPLES, ADC_CHANNEL_2, 200000, 1000000};
+
+static uint32_t plays;
+static uint32_t records;
+static uint32_t dirty_words;
+static uint32_t dirty_dacr;
+static uint32_t dacr_reads;
+static uint32_t bad_codes;
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+/* A ramp of 12-bit results, 4 DAC codes apart */
+static uint16_t ramp(uint8_t channel)
+{
+    static uint16_t code;
+
+    (void)channel;
+    code = (code + 16) & 0xFFF;
+    return code;
+}
+
+void EINT0_IRQHandler(void)
+{
+    EXTI_ClearEXTIFlag(EXTI_EINT0);
+
+    if (RECPLAY_GetMode() == RECPLAY_RECORD)
+    {
+        RECPLAY_Play();
+        plays++;
+        for (uint32_t i = 0; i < SAMPLES; i++)
+        {
+            dirty_words += ((samples[i] & ~VALUE_MASK) != 0);
+        }
+    }
+    else
+    {
+        RECPLAY_Record();
+        records++;
+    }
+}
+
+void DMA_IRQHandler(void)
+{
+    GPDMA_IntHandler();
+}
+
+/* DAC codes are the results of the ramp shifted down by 2: multiples of 4 */
+static void on_trace(const lpc_sim_trace_event_t* event)
+{
+    if (event->kind == LPC_SIM_TRACE_DAC)
+    {
+        bad_codes += ((event->value & 3U) != 0);
+    }
+}
+
+/* Falling edge then rising edge on P2.10, the falling edges EDGES apart by a pseudo-random time */
+static uint64_t press(uint64_t cycle)
+{
+    static uint32_t seed = 4321;
+    static uint32_t edges;
+    static uint32_t level = 1;
+    uint64_t us;
+
+    level = !level;
+    lpc_sim_gpio_drive(2, SWITCH_PIN, level ? SWITCH_PIN : 0);
+    if (level)
+    {
+        return cycle + SystemCoreClock / 1000000 * 2;
+    }
+    if (++edges == EDGES)
+    {
+        return UINT64_MAX;
+    }
+    seed = seed * 1103515245U + 12345U;
+    us = MIN_GAP_US + (seed >> 8) % (MAX_GAP_US - MIN_GAP_US);
+    return cycle + SystemCoreClock / 1000000 * us;
+}
+
+static void configure_eint(void)
+{
+    static const PINSEL_CFG_Type eint0 = {PINSEL_PORT_2, PINSEL_PIN_10, PINSEL_FUNC_1, PINSEL_PINMODE_PULLUP,
+                                          PINSEL_PINMODE_NORMAL};
+    EXTI_InitTypeDef exti_cfg;
+
+    lpc_sim_gpio_drive(2, SWITCH_PIN, SWITCH_PIN);
+    PINSEL_ConfigPins(&eint0, 1);
+    exti_cfg.EXTI_Line = EXTI_EINT0;
+    exti_cfg.EXTI_Mode = EXTI_MODE_EDGE_SENSITIVE;
+    exti_cfg.EXTI_polarity = EXTI_POLARITY_LOW_ACTIVE_OR_FALLING_EDGE;
+    EXTI_Config(&exti_cfg);
+    EXTI_ClearEXTIFlag(EXTI_EINT0);
+}
+
+int main(void)
+{
+    char line[96];
+
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+    lpc_sim_adc_set_source(ramp);
+
+    GPDMA_Init();
+    check(RECPLAY_Init(&cfg) == SUCCESS, "RECPLAY_Init() at 200 kHz and 1 MHz");
+    configure_eint();
+    NVIC_SetPriority(DMA_IRQn, 0);
+    NVIC_SetPriority(EINT0_IRQn, 1);
+    NVIC_EnableIRQ(DMA_IRQn);
+    NVIC_EnableIRQ(EINT0_IRQn);
+    check(RECPLAY_Record() == SUCCESS, "RECPLAY_Record()");
+
+    lpc_sim_set_trace_hook(on_trace);
+    lpc_sim_set_stimulus(press, SystemCoreClock / 1000 * 30);
+    for (uint32_t t = 0; t < EDGES * MAX_GAP_US; t += STEP_US)
+    {
+        lpc_sim_advance(SystemCoreClock / 1000000 * STEP_US);
+        if (RECPLAY_GetMode() == RECPLAY_PLAY)
+        {
+            dirty_dacr += ((LPC_DAC->DACR & ~VALUE_MASK) != 0);
+            dacr_reads++;
+        }
+    }
+    lpc_sim_set_trace_hook(NULL);
+
+    snprintf(line, sizeof(line), "%lu playbacks, %lu recordings", (unsigned long)plays, (unsigned long)records);
+    check((plays == EDGES / 2) && (records == EDGES / 2), line);
+    snprintf(line, sizeof(line), "%lu words of the buffer with bits outside VALUE when the playback starts",
+             (unsigned long)dirty_words);
+    check(dirty_words == 0, line);
+    snprintf(line, sizeof(line), "%lu of %lu DACR words read back with bits outside VALUE", (unsigned long)dirty_dacr,
+             (unsigned long)dacr_reads);
+    check((dirty_dacr == 0) && (dacr_reads != 0), line);
+    snprintf(line, sizeof(line), "%lu DAC codes not recorded", (unsigned long)bad_codes);
+    check(bad_codes == 0, line);
+
+    check(RECPLAY_SetPlayRate(RECPLAY_PLAY_RATE_MAX) == SUCCESS, "RECPLAY_SetPlayRate() takes 1 MHz");
+    check(RECPLAY_SetPlayRate(RECPLAY_PLAY_RATE_MAX + 1) == ERROR, "RECPLAY_SetPlayRate() rejects 1 MHz + 1 Hz");
+    RECPLAY_Stop();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+/*
+ * @file systime_test.c
+ * @brief Delays of the tickless SysTick time base (lpc17xx_systime), run by 'make test'
+ *
+ * Timer0 interrupts at 1 kHz, as an application would. Each delay is measured in virtual time:
+ * - DELAYS pseudo-random delays from 1 us to 300 ms, through SYSTIME_DelayUs(), SYSTIME_DelayMs() and
+ *   SYSTIME_SleepUntil(): none is early, none is more than MAX_LATE cycles late;
+ * - MASKED_DELAYS delays from 1 us to 1 s with the interrupts disabled, most of them over several full SysTick
+ *   periods: none is early or more than MAX_LATE_MASK cycles late, PRIMASK is still set, and the SysTick handler has
+ *   not run;
+ * - SYSTIME_Now() follows the virtual time, within a few cycles per reprogramming of the SysTick;
+ * - ten deadlines 1 s apart take at most 7 SysTick interrupts each, where a 1 ms tick would take 1000;
+ * - a deadline in the past returns at once.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_sim.h"
+#include "lpc17xx_systime.h"
+#include "lpc17xx_timer.h"
+
+#define DELAYS        2000U
+#define MASKED_DELAYS 100U
+#define MAX_LATE      64U /* Cycles a delay may end after its deadline */
+#define MAX_LATE_MASK 96U /* The same with the interrupts disabled: the delay counts the zeros of the counter */
+#define LOST_PER_LOAD 16U /* Cycles of the time base a reprogramming of the SysTick may lose */
+
+static uint32_t systicks;
+static uint32_t timer_irqs;
+static uint64_t start_cycles; /* Virtual time at SYSTIME_Init() */
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+void SysTick_Handler(void)
+{
+    systicks++;
+    SYSTIME_IntHandler();
+}
+
+void TIMER0_IRQHandler(void)
+{
+    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
+    timer_irqs++;
+}
+
+static void start_timer0(void)
+{
+    TIM_TIMERCFG_Type cfg;
+    TIM_MATCHCFG_Type match;
+
+    cfg.PrescaleOption = TIM_PRESCALE_USVAL;
+    cfg.PrescaleValue = 1;
+    TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &cfg);
+    match.MatchChannel = 0;
+    match.IntOnMatch = ENABLE;
+    match.StopOnMatch = DISABLE;
+    match.ResetOnMatch = ENABLE;
+    match.ExtMatchOutputType = TIM_EXTMATCH_NOTHING;
+    match.MatchValue = 999;
+    TIM_ConfigMatch(LPC_TIM0, &match);
+    NVIC_EnableIRQ(TIMER0_IRQn);
+    TIM_Cmd(LPC_TIM0, ENABLE);
+}
+
+/* Cycles the time base is behind the virtual time */
+static int64_t lag(void)
+{
+    return (int64_t)(lpc_sim_cycles() - start_cycles) - (int64_t)SYSTIME_Now();
+}
+
+/* One delay through each function in turn, with its length in cycles */
+static uint64_t delay(uint32_t i, uint32_t us, uint64_t* elapsed)
+{
+    uint64_t start = lpc_sim_cycles();
+    uint64_t wanted;
+
+    if (i % 3 == 0)
+    {
+        SYSTIME_DelayUs(us);
+        wanted = SYSTIME_US(us);
+    }
+    else if (i % 3 == 1)
+    {
+        SYSTIME_DelayMs(us / 1000 + 1);
+        wanted = SYSTIME_MS(us / 1000 + 1);
+    }
+    else
+    {
+        SYSTIME_SleepUntil(SYSTIME_Now() + SYSTIME_US(us));
+        wanted = SYSTIME_US(us);
+    }
+    *elapsed = lpc_sim_cycles() - start;
+    return wanted;
+}
+
+static void test_idle(void)
+{
+    uint64_t next = SYSTIME_Now();
+    uint32_t before = systicks;
+    char line[96];
+
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        next += SYSTIME_MS(1000);
+        SYSTIME_SleepUntil(next);
+    }
+    snprintf(line, sizeof(line), "ten 1 s deadlines: %lu SysTick interrupts", (unsigned long)(systicks - before));
+    check(systicks - before <= 70, line);
+}
+
+static void test_random(void)
+{
+    uint32_t seed = 7;
+    uint32_t early = 0;
+    uint64_t max_late = 0;
+    uint32_t before = systicks;
+    int64_t lag_before = lag();
+    int64_t lost;
+    char line[128];
+
+    start_timer0();
+    for (uint32_t i = 0; i < DELAYS; i++)
+    {
+        uint64_t elapsed;
+        uint64_t wanted;
+
+        seed = seed * 1103515245U + 12345U;
+        wanted = delay(i, (seed >> 8) % ((i & 1) ? 300000 : 2000) + 1, &elapsed);
+        early += (elapsed < wanted);
+        max_late = ((elapsed > wanted) && (elapsed - wanted > max_late)) ? elapsed - wanted : max_late;
+    }
+    TIM_Cmd(LPC_TIM0, DISABLE);
+    lost = lag() - lag_before;
+
+    snprintf(line, sizeof(line), "%lu delays from 1 us to 300 ms: %lu early, at most %lu cycles late",
+             (unsigned long)DELAYS, (unsigned long)early, (unsigned long)max_late);
+    check((early == 0) && (max_late <= MAX_LATE), line);
+    snprintf(line, sizeof(line), "%lu Timer0 interrupts served meanwhile", (unsigned long)timer_irqs);
+    check(timer_irqs > DELAYS, line);
+    // Each delay reprograms the SysTick twice at most, and each interrupt once
+    snprintf(line, sizeof(line), "time base %lld cycles behind after %lu delays and %lu SysTick interrupts",
+             (long long)lost, (unsigned long)DELAYS, (unsigned long)(systicks - before));
+    check((lost >= 0) && ((uint64_t)lost <= LOST_PER_LOAD * (2 * DELAYS + systicks - before)), line);
+}
+
+/* Without the SysTick handler, the delay counts the zeros of the counter itself */
+static void test_masked(void)
+{
+    uint32_t seed = 11;
+    uint32_t early = 0;
+    uint32_t long_delays = 0;
+    uint32_t unmasked = 0;
+    uint64_t max_late = 0;
+    uint32_t before = systicks;
+    char line[128];
+
+    __disable_irq();
+    for (uint32_t i = 0; i < MASKED_DELAYS; i++)
+    {
+        uint64_t elapsed;
+        uint64_t wanted;
+
+        seed = seed * 1103515245U + 12345U;
+        wanted = delay(i, (seed >> 8) % 1000000 + 1, &elapsed);
+        early += (elapsed < wanted);
+        max_late = ((elapsed > wanted) && (elapsed - wanted > max_late)) ? elapsed - wanted : max_late;
+        long_delays += (wanted > 2 * (SysTick_LOAD_RELOAD_Msk + 1));
+        unmasked += (__get_PRIMASK() == 0);
+    }
+    check(unmasked == 0, "the delays keep the interrupts disabled");
+    __enable_irq();
+
+    snprintf(line, sizeof(line), "%lu delays with the interrupts disabled, %lu over 2 SysTick periods: %lu early, "
+             "at most %lu cycles late", (unsigned long)MASKED_DELAYS, (unsigned long)long_delays,
+             (unsigned long)early, (unsigned long)max_late);
+    check((early == 0) && (max_late <= MAX_LATE_MASK) && (long_delays > MASKED_DELAYS / 2), line);
+    snprintf(line, sizeof(line), "%lu SysTick interrupts after the delays with the interrupts disabled",
+             (unsigned long)(systicks - before));
+    check(systicks - before <= 1, line);
+}
+
+static void test_past(void)
+{
+    uint64_t start = lpc_sim_cycles();
+    char line[96];
+
+    SYSTIME_SleepUntil(SYSTIME_Now() - 5);
+    snprintf(line, sizeof(line), "a deadline in the past returns after %lu cycles",
+             (unsigned long)(lpc_sim_cycles() - start));
+    check(lpc_sim_cycles() - start <= MAX_LATE, line);
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+
+    start_cycles = lpc_sim_cycles();
+    SYSTIME_Init();
+
+    test_idle();
+    test_random();
+    test_masked();
+    test_past();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,257 @@
+/*
+ * @file twheel_test.c
+ * @brief Deadlines of the timer wheel (lpc17xx_twheel) on MR1 of Timer0, run by 'make test'
+ *
+ * The wheel ticks every microsecond. Each callback compares TWHEEL_Now() with the deadline the test expects:
+ * - STEPS pseudo-random steps start, restart and stop TIMERS timers, one in ten of them deferred, with delays and
+ *   periods from a few ticks to 3 s, and let a pseudo-random time pass: no callback is early, none is more than one
+ *   tick late, a stopped timer is never called, and no timer is lost;
+ * - one timer per level of the wheel, up to TWHEEL_MAX_TICKS, fires on its tick after at most level + 2 interrupts:
+ *   one per cascade, one at TWHEEL_HORIZON, and the expiry;
+ * - a deadline that the TC has already reached when the match register is written pends the interrupt in the NVIC;
+ * - a deferred timer that expired several times is called once, and TWHEEL_Stop() or TWHEEL_Start() cancels its
+ *   pending call;
+ * - without a running timer, no interrupt occurs.
+ *
+ * Exit status 0 when every check passes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lpc17xx_sim.h"
+#include "lpc17xx_twheel.h"
+
+#define TIMERS   300U
+#define STEPS    20000U
+#define MAX_STEP 3000U /* Cycles between two steps, pseudo-random up to MAX_STEP */
+#define TICK_US  1U
+#define MAX_LATE 1U /* Ticks a TWHEEL_ISR callback may run after its deadline */
+
+static TWHEEL_Timer_Type timers[TIMERS];
+static uint32_t expected[TIMERS]; /* Tick of the next expiry */
+static uint32_t periods[TIMERS];
+static uint8_t running[TIMERS];
+
+static uint32_t seed = 12345;
+static uint32_t interrupts;
+static uint32_t calls;
+static uint32_t early;
+static uint32_t late;
+static uint32_t max_late;
+static uint32_t stopped_calls;
+
+static uint32_t failures;
+
+static void check(int ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    failures += !ok;
+}
+
+void TIMER0_IRQHandler(void)
+{
+    interrupts++;
+    TWHEEL_IntHandler();
+}
+
+static uint32_t random_value(uint32_t range)
+{
+    seed = seed * 1103515245U + 12345U;
+    return (seed >> 8) % range;
+}
+
+static void on_expiry(void* arg)
+{
+    uint32_t i = (uint32_t)(uintptr_t)arg;
+    int32_t delta = (int32_t)(TWHEEL_Now() - expected[i]);
+
+    calls++;
+    if (!running[i])
+    {
+        stopped_calls++;
+        return;
+    }
+    early += (delta < 0);
+    if (timers[i].Mode == TWHEEL_ISR)
+    {
+        late += (delta > (int32_t)MAX_LATE);
+        max_late = ((delta > 0) && ((uint32_t)delta > max_late)) ? (uint32_t)delta : max_late;
+    }
+    if (periods[i] == 0)
+    {
+        running[i] = 0;
+    }
+    else if (timers[i].Mode == TWHEEL_ISR)
+    {
+        expected[i] += periods[i];
+    }
+    else
+    {
+        expected[i] = timers[i].Expiry; // A deferred call stands for every expiry since the previous one
+    }
+}
+
+/* With the interrupts disabled, so that a pending expiry of the timer is not checked against the new deadline */
+static void start(uint32_t i, uint32_t delay, uint32_t period)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    expected[i] = TWHEEL_Now() + delay;
+    periods[i] = period;
+    running[i] = 1;
+    TWHEEL_Start(&timers[i], delay, period);
+    __set_PRIMASK(primask);
+}
+
+/* Ticks from 1 to 3 s, most of them short */
+static uint32_t random_delay(void)
+{
+    static const uint32_t ranges[4] = {40, 1000, 50000, 3000000};
+
+    return random_value(ranges[random_value(4)]);
+}
+
+static void test_random(void)
+{
+    uint32_t lost = 0;
+    char line[128];
+
+    for (uint32_t i = 0; i < TIMERS; i++)
+    {
+        TWHEEL_TimerInit(&timers[i], on_expiry, (void*)(uintptr_t)i, (i % 10 == 9) ? TWHEEL_DEFERRED : TWHEEL_ISR);
+    }
+    for (uint32_t step = 0; step < STEPS; step++)
+    {
+        uint32_t i = random_value(TIMERS);
+        uint32_t op = random_value(4);
+
+        if (op == 0)
+        {
+            TWHEEL_Stop(&timers[i]);
+            running[i] = 0;
+        }
+        else
+        {
+            uint32_t delay = random_delay();
+
+            start(i, delay, (op == 1) ? 0 : 100 + random_delay());
+        }
+        lpc_sim_advance(random_value(MAX_STEP));
+        TWHEEL_RunDeferred();
+    }
+    lpc_sim_advance(SystemCoreClock / 1000000 * 2 * TICK_US);
+    for (uint32_t i = 0; i < TIMERS; i++)
+    {
+        lost += running[i] && (!TWHEEL_IsActive(&timers[i]) || ((int32_t)(TWHEEL_Now() - expected[i]) > 1));
+    }
+
+    snprintf(line, sizeof(line), "%lu callbacks from %lu interrupts: %lu early, %lu late (max %lu ticks)",
+             (unsigned long)calls, (unsigned long)interrupts, (unsigned long)early, (unsigned long)late,
+             (unsigned long)max_late);
+    check((calls > STEPS) && (early == 0) && (late == 0), line);
+    snprintf(line, sizeof(line), "%lu calls of stopped timers, %lu timers lost", (unsigned long)stopped_calls,
+             (unsigned long)lost);
+    check((stopped_calls == 0) && (lost == 0), line);
+
+    for (uint32_t i = 0; i < TIMERS; i++)
+    {
+        TWHEEL_Stop(&timers[i]);
+        running[i] = 0;
+    }
+}
+
+/* One timer per level, from 2^(5 * level) ticks on: the last one waits TWHEEL_MAX_TICKS */
+static void test_levels(void)
+{
+    char line[128];
+
+    for (uint32_t level = 0; level < TWHEEL_LEVELS; level++)
+    {
+        uint32_t delay = (level == TWHEEL_LEVELS - 1) ? TWHEEL_MAX_TICKS : (1UL << (5 * level)) + random_value(1000);
+        uint32_t before = interrupts;
+
+        calls = 0;
+        early = 0;
+        late = 0;
+        start(0, delay, 0);
+        lpc_sim_advance((uint64_t)SystemCoreClock / 1000000 * TICK_US * (delay + 2));
+        snprintf(line, sizeof(line), "level %lu: %lu ticks, %lu call after %lu interrupts", (unsigned long)level,
+                 (unsigned long)delay, (unsigned long)calls, (unsigned long)(interrupts - before));
+        check((calls == 1) && (early == 0) && (late == 0) && (interrupts - before <= level + 2), line);
+    }
+    check(TWHEEL_Start(&timers[0], TWHEEL_MAX_TICKS + 1, 0) == ERROR, "TWHEEL_Start() rejects TWHEEL_MAX_TICKS + 1");
+    check(!TWHEEL_IsActive(&timers[0]), "a rejected start leaves the timer stopped");
+}
+
+/* A delay of 0 puts the deadline on the current TC: the match cannot occur before the TC wraps */
+static void test_missed(void)
+{
+    calls = 0;
+    early = 0;
+    late = 0;
+    start(0, 0, 0);
+    lpc_sim_advance(SystemCoreClock / 1000000 * TICK_US * 10);
+    check((calls == 1) && (early == 0) && (late == 0), "a deadline already reached pends the interrupt");
+
+    calls = 0;
+    __disable_irq();
+    start(0, 5, 0);
+    start(1, 20, 0);
+    lpc_sim_advance(SystemCoreClock / 1000000 * TICK_US * 100);
+    check(calls == 0, "no callback with the interrupts disabled");
+    __enable_irq();
+    check((calls == 2) && (early == 0), "deadlines passed with the interrupts disabled are served on enable");
+}
+
+static void test_deferred(void)
+{
+    TWHEEL_Timer_Type* timer = &timers[9];
+    uint32_t before;
+    uint32_t ran;
+    char line[96];
+
+    calls = 0;
+    start(9, 10, 10);
+    lpc_sim_advance(SystemCoreClock / 1000000 * TICK_US * 55);
+    check((calls == 0) && TWHEEL_IsActive(timer), "a deferred timer is queued, not called, by the interrupt");
+    ran = TWHEEL_RunDeferred();
+    snprintf(line, sizeof(line), "5 expiries give %lu deferred call", (unsigned long)ran);
+    check((ran == 1) && (calls == 1) && (early == 0), line);
+    check(TWHEEL_RunDeferred() == 0, "the queue is empty after TWHEEL_RunDeferred()");
+
+    lpc_sim_advance(SystemCoreClock / 1000000 * TICK_US * 10);
+    TWHEEL_Stop(timer);
+    running[9] = 0;
+    check((TWHEEL_RunDeferred() == 0) && !TWHEEL_IsActive(timer), "TWHEEL_Stop() cancels the pending call");
+
+    start(9, 10, 0);
+    lpc_sim_advance(SystemCoreClock / 1000000 * TICK_US * 20);
+    start(9, 1000, 0);
+    check(TWHEEL_RunDeferred() == 0, "TWHEEL_Start() cancels the pending call");
+    TWHEEL_Stop(timer);
+    running[9] = 0;
+
+    before = interrupts;
+    lpc_sim_advance((uint64_t)SystemCoreClock * 5);
+    snprintf(line, sizeof(line), "%lu interrupts in 5 s without a running timer", (unsigned long)(interrupts - before));
+    check(interrupts == before, line);
+}
+
+int main(void)
+{
+    setvbuf(stdout, NULL, _IONBF, 0);
+    lpc_sim_set_spin_timeout(0);
+
+    check(TWHEEL_Init(LPC_TIM0, 4, TICK_US) == ERROR, "TWHEEL_Init() rejects MR4");
+    check(TWHEEL_Init((LPC_TIM_TypeDef*)LPC_GPIO0, 1, TICK_US) == ERROR, "TWHEEL_Init() rejects a non-timer");
+    check(TWHEEL_Init(LPC_TIM0, 1, TICK_US) == SUCCESS, "TWHEEL_Init() on MR1 of Timer0, 1 us ticks");
+
+    test_random();
+    test_levels();
+    test_missed();
+    test_deferred();
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
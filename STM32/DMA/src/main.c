@@ -10,7 +10,13 @@
  *
  * Timer0 is used to trigger periodic ADC conversions every 60 seconds.
  * DMA is used to transfer ADC conversion data to a buffer automatically.
- * The temperature sensor is connected to ADC1 (PA1).
+ * The temperature sensor is connected to ADC1 (PA1). The readings are converted to tenths of a degree through the
+ * fixed-point table of sensor_lut.h, shared with the LPC1769 examples, so no floating-point code runs in the interrupt.
+ *
+ * The LEDs are only written when the temperature moves to another band: a reading must pass a threshold by
+ * TEMP_HYSTERESIS tenths of a degree, for TEMP_DEBOUNCE readings in a row, so the LEDs do not flicker around a
+ * threshold. The band table may be replaced at run time with set_band_table(). The state machine is the one of
+ * band_classify.h, in lib/band_classify, which the lpc17xx_classify driver of the LPC1769 examples uses as well.
  */
 
 #include <libopencm3/cm3/nvic.h>
@@ -20,6 +26,9 @@
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/timer.h>
 
+#include "band_classify.h" /* lib/band_classify at the root of the repository, portable */
+#include "sensor_lut.h"    /* lib/sensor_lut at the root of the repository, portable */
+
 /* Constants */
 #define GREEN_LED_PORT          GPIOA
 #define GREEN_LED_PIN           GPIO8 /* PA8 (Green LED) */
@@ -29,22 +38,61 @@
 #define RED_LED_PIN             GPIO14       /* PC14 (Red LED) */
 #define ADC_CHANNEL_TEMP_SENSOR ADC_CHANNEL1 /* PA1 ADC1 */
 
-#define TEMP_GREEN_THRESHOLD  40 /* 40 degrees */
-#define TEMP_YELLOW_THRESHOLD 70 /* 70 degrees */
+#define TEMP_GREEN_THRESHOLD  400 /* 40.0 degrees */
+#define TEMP_YELLOW_THRESHOLD 700 /* 70.0 degrees */
+#define TEMP_HYSTERESIS       20  /* Tenths of a degree a reading must pass a threshold by to leave its band */
+#define TEMP_DEBOUNCE         1   /* Readings in a row in a new band before the LEDs change */
+
+/* Transfer function of the sensor, in tenths of a degree: 10 mV per degree, 3.3 V reference */
+#define SENSOR_DECIDEGREES(code) ((int32_t)((code) * 3300.0 / 4096.0 + 0.5))
 
 #define ADC_BUFFER_SIZE 16 /* Buffer size for averaging */
 
 #define TRUE 1
 
+/* LED of a temperature band */
+typedef struct
+{
+    uint32_t port;
+    uint16_t pin;
+} band_led_t;
+
+/* Temperature bands: band i holds the temperatures from thresholds[i - 1] up to thresholds[i] excluded */
+typedef struct
+{
+    const uint16_t* thresholds; /* count - 1 ascending temperatures, in tenths of a degree */
+    const band_led_t* leds;     /* LED of each band */
+    uint8_t count;              /* Number of bands */
+    uint8_t hysteresis;         /* Tenths of a degree a reading must pass a threshold by to leave its band */
+    uint8_t debounce;           /* Readings in a row in a new band before it is taken */
+} band_table_t;
+
 /* Global Variables */
 uint16_t adc_buffer[ADC_BUFFER_SIZE]; // Buffer to store ADC values
 
+/* Sensor table, computed by the compiler, and calibration of the board (ADC code offset, temperature offset) */
+static const int32_t sensor_table[SENSOR_TABLE_POINTS] = SENSOR_TABLE(SENSOR_DECIDEGREES);
+static SENSOR_Type oven_sensor = {sensor_table, 0, 0, 0};
+
+static const uint16_t oven_thresholds[] = {TEMP_GREEN_THRESHOLD, TEMP_YELLOW_THRESHOLD};
+static const band_led_t oven_leds[] = {
+    {GREEN_LED_PORT, GREEN_LED_PIN},
+    {YELLOW_LED_PORT, YELLOW_LED_PIN},
+    {RED_LED_PORT, RED_LED_PIN},
+};
+static const band_table_t oven_bands = {oven_thresholds, oven_leds, 3, TEMP_HYSTERESIS, TEMP_DEBOUNCE};
+
+static const band_table_t* volatile next_table = &oven_bands; /* Table requested by set_band_table() */
+static const band_table_t* table;                             /* Table of the current band */
+static BAND_State_Type oven_state = {BAND_NONE, 0, 0};        /* Current band, its LED is on, and its debounce */
+
 /* Function Prototypes */
 void system_clock_setup(void);
 void gpio_setup(void);
 void adc_setup(void);
 void timer2_setup(void);
 void dma_setup(void);
+void set_band_table(const band_table_t* bands);
 void control_leds_based_on_temp(uint16_t temp);
 uint16_t average_adc_value(void);
 
@@ -163,31 +211,45 @@ uint16_t average_adc_value(void)
 }
 
 /**
- * @brief Control the LEDs based on the temperature reading.
+ * @brief Replace the temperature bands, from any context.
+ * @param bands The new table, kept in place while it is used.
+ * @note The next reading is classified without hysteresis or debounce, and turns the LED of its band on.
+ */
+void set_band_table(const band_table_t* bands)
+{
+    next_table = bands; /* Single store, taken by the next reading */
+}
+
+/**
+ * @brief Control the LEDs based on the temperature reading, only when the temperature changes band.
  * @param temp The averaged ADC value corresponding to the temperature.
+ * @note A reading in the current band touches no GPIO register. A change turns the old LED off and the new one on.
  */
 void control_leds_based_on_temp(uint16_t temp)
 {
-    uint16_t temperature = (temp * 3.3 / 4096.0) * 100; // Convert ADC value to temperature
+    int32_t temperature = SENSOR_Convert(&oven_sensor, temp); // Tenths of a degree, integer arithmetic only
+    const band_table_t* bands = next_table;
+    uint8_t previous;
 
-    /* Control LEDs based on temperature range */
-    if (temperature < TEMP_GREEN_THRESHOLD)
-    {
-        gpio_set(GREEN_LED_PORT, GREEN_LED_PIN);     /* Green LED on */
-        gpio_clear(YELLOW_LED_PORT, YELLOW_LED_PIN); /* Yellow LED off */
-        gpio_clear(RED_LED_PORT, RED_LED_PIN);       /* Red LED off */
-    }
-    else if (temperature < TEMP_YELLOW_THRESHOLD)
+    if (bands != table)
     {
-        gpio_clear(GREEN_LED_PORT, GREEN_LED_PIN); /* Green LED off */
-        gpio_set(YELLOW_LED_PORT, YELLOW_LED_PIN); /* Yellow LED on */
-        gpio_clear(RED_LED_PORT, RED_LED_PIN);     /* Red LED off */
+        /* New table: the LED of the old one goes off, the reading takes its band at once */
+        if (oven_state.Band != BAND_NONE)
+        {
+            gpio_clear(table->leds[oven_state.Band].port, table->leds[oven_state.Band].pin);
+        }
+        table = bands;
+        BAND_Reset(&oven_state);
     }
-    else
+
+    previous = oven_state.Band;
+    if (BAND_Update(&oven_state, bands->thresholds, bands->count, bands->hysteresis, bands->debounce, temperature))
     {
-        gpio_clear(GREEN_LED_PORT, GREEN_LED_PIN);   /* Green LED off */
-        gpio_clear(YELLOW_LED_PORT, YELLOW_LED_PIN); /* Yellow LED off */
-        gpio_set(RED_LED_PORT, RED_LED_PIN);         /* Red LED on */
+        if (previous != BAND_NONE)
+        {
+            gpio_clear(bands->leds[previous].port, bands->leds[previous].pin); /* Old LED off */
+        }
+        gpio_set(bands->leds[oven_state.Band].port, bands->leds[oven_state.Band].pin); /* New LED on */
     }
 }
 
@@ -3,15 +3,18 @@
  * @brief Toggles the LED on PC13 using a SysTick timer and EXTI0 interrupt.
  * Enable GPIO interrupt on PA0 to toggle the LED state on both rising and falling edges.
  * The onboard LED (connected to PC13 on STM32F103C8T6 Blue Pill) will blink using SysTick and toggle using EXTI0.
+ * The blinking runs in the main loop, which sleeps in WFI until the next deadline of the tickless SysTick time base
+ * (lib/systime) instead of taking a SysTick interrupt every 100 ms.
  * This file is based on examples from the libopencm3 project.
  */
 
 #include <libopencm3/cm3/nvic.h>
-#include <libopencm3/cm3/systick.h>
 #include <libopencm3/stm32/exti.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 
+#include "systime.h" /* ../lib/systime, tickless time base */
+
 /* Constants */
 #define TRUE    1
 #define FALLING 0
@@ -62,19 +65,11 @@ void gpio_setup(void)
 }
 
 /**
- * @brief Configures SysTick to generate interrupts every SYSTICK_INTERVAL_MS.
+ * @brief Starts the SysTick time base: it only interrupts at the deadlines of the main loop, and every 2^24 cycles.
  */
 void systick_setup(void)
 {
-    /* Set the SysTick reload value to trigger interrupts at the specified interval */
-    systick_set_reload(rcc_ahb_frequency / 1000 * SYSTICK_INTERVAL_MS - 1);
-
-    /* Set SysTick clock source to AHB (core clock) */
-    systick_set_clocksource(STK_CSR_CLKSOURCE_AHB);
-
-    /* Enable SysTick counter and interrupts */
-    systick_counter_enable();
-    systick_interrupt_enable();
+    systime_init();
 }
 
 /**
@@ -94,15 +89,6 @@ void exti_setup(void)
     exti_enable_request(EXTI0);                    /* Enable EXTI0 interrupt */
 }
 
-/**
- * @brief SysTick interrupt handler.
- * Toggles the onboard LED every SYSTICK_INTERVAL_MS.
- */
-void sys_tick_handler(void)
-{
-    toggle_led(); /* Toggle LED periodically */
-}
-
 /**
  * @brief EXTI0 interrupt handler for button press on PA0.
  * Toggles the LED state when the button is pressed (detects both falling and rising edges).
@@ -141,14 +127,22 @@ void toggle_led(void)
  */
 int main(void)
 {
+    uint64_t deadline;
+
     system_clock_setup(); /* Configure system clock */
     gpio_setup();         /* Configure GPIO pins */
     systick_setup();      /* Configure SysTick timer */
     exti_setup();         /* Configure EXTI for button press detection */
 
-    /* Main loop (the program relies on interrupts for operation) */
+    deadline = systime_now();
+
+    /* Main loop: blinks the LED every SYSTICK_INTERVAL_MS, the EXTI0 interrupt runs meanwhile */
     while (TRUE)
     {
+        deadline += SYSTIME_MS(SYSTICK_INTERVAL_MS);
+        systime_sleep_until(deadline);
+
+        toggle_led(); /* Toggle LED periodically */
     }
 
     return 0;
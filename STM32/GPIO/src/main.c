@@ -1,13 +1,19 @@
 /**
  * @file main.c
- * @brief Toggles the LED on PC13 using a simple delay loop.
+ * @brief Toggles the LED on PC13 every 100 ms.
+ *
+ * The delay sleeps in WFI on the tickless SysTick time base (lib/systime), where a busy loop took a time that depended
+ * on the optimization level.
  */
 
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 
+#include "systime.h" /* ../lib/systime, tickless time base */
+
 /* Constants */
-#define TRUE 1
+#define TRUE           1
+#define BLINK_DELAY_MS 100 /* Time between two toggles of the LED */
 
 /* Function Prototypes */
 void systemInit(void);
@@ -45,16 +51,13 @@ int main(void)
 {
     systemInit();     /* Initialize the system clock and GPIO peripherals */
     configure_gpio(); /* Configure the GPIO pin for the LED */
+    systime_init();   /* Start the time base of the delays */
 
     while (TRUE)
     {
         gpio_toggle(GPIOC, GPIO13); /* Toggle the LED on PC13 */
 
-        /* Simple delay loop */
-        for (volatile int i = 0; i < 1000000; i++)
-        {
-            __asm__("nop"); /* No operation */
-        }
+        delay_ms(BLINK_DELAY_MS); /* Sleep instead of spinning */
     }
 
     return 0; /* Program should never reach this point */
@@ -1,17 +1,20 @@
 /**
  * @file main.c
- * @brief Toggles the LED on PC13 using a systick. Enable GPIO interrupt on PA0 to toggle the LED state.
+ * @brief Toggles the LED on PC13 every 100 ms from the main loop. Enable GPIO interrupt on PA0 to toggle the LED state.
+ *
+ * The main loop sleeps in WFI until the next deadline of the tickless SysTick time base (lib/systime). The EXTI0
+ * interrupt wakes it up in between, and toggles the LED at once.
  */
 
 #include <libopencm3/cm3/nvic.h>
-#include <libopencm3/cm3/systick.h>
 #include <libopencm3/stm32/exti.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 
+#include "systime.h" /* ../lib/systime, tickless time base */
+
 /* Constants */
-#define TRUE         1
-#define RELOAD_COUNT 8999 /* SysTick interrupt every N clock pulses: set reload to N-1 */
+#define TRUE 1
 
 /* Pin Definitions */
 #define LED_PORT    GPIOC
@@ -19,7 +22,7 @@
 #define SWITCH_PORT GPIOA
 #define SWITCH_PIN  GPIO0 /* PA0 connected to switch */
 
-/* Define SysTick interval */
+/* Define the toggle period of the main loop */
 #define SYSTICK_INTERVAL_MS 100
 
 /* Function Prototypes */
@@ -72,18 +75,7 @@ void configure_gpio(void)
  */
 void configure_systick(void)
 {
-    systick_set_reload(rcc_ahb_frequency / 1000 * SYSTICK_INTERVAL_MS - 1); /* Set reload for SYSTICK_INTERVAL_MS */
-    systick_set_clocksource(STK_CSR_CLKSOURCE_AHB);
-    systick_counter_enable();
-    systick_interrupt_enable();
-}
-
-/**
- * @brief SysTick interrupt handler.
- */
-void sys_tick_handler(void)
-{
-    toggle_led();
+    systime_init(); /* Full 2^24 cycle periods on the AHB clock, the reload value follows the deadlines */
 }
 
 /**
@@ -111,6 +103,8 @@ void toggle_led(void)
  */
 int main(void)
 {
+    uint64_t deadline;
+
     rcc_clock_setup_in_hsi_out_48mhz(); /* Set up clock, running at 48 MHz */
 
     configure_gpio();    /* Configure GPIO pins */
@@ -118,8 +112,14 @@ int main(void)
 
     nvic_set_priority(EXTI0, 0); /* Set priority for EXTI0 interrupt */
 
+    deadline = systime_now();
+
     while (TRUE)
     {
+        deadline += SYSTIME_MS(SYSTICK_INTERVAL_MS);
+        systime_sleep_until(deadline); /* Sleep until the next toggle, EXTI0 runs meanwhile */
+
+        toggle_led();
     }
 
     return 0;
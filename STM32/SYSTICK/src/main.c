@@ -1,16 +1,20 @@
 /**
  * @file main.c
- * @brief Toggles the LED on PC13 using a systick.
+ * @brief Toggles the LED on PC13 every millisecond, on the tickless SysTick time base.
+ *
+ * The SysTick no longer interrupts every millisecond to toggle the LED: it counts the cycles of the time base
+ * (lib/systime), and its reload value is written with the next deadline of the main loop. Between two toggles the core
+ * sleeps in WFI.
  */
 
-#include <libopencm3/cm3/nvic.h>
-#include <libopencm3/cm3/systick.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/rcc.h>
 
+#include "systime.h" /* ../lib/systime, tickless time base */
+
 /* Constants */
 #define TRUE         1
-#define RELOAD_COUNT 8999 /* SysTick interrupt every N clock pulses: set reload to N-1 */
+#define TOGGLE_PERIOD_MS 1 /* Toggle period of the LED */
 
 /* Function Prototypes */
 void systemInit(void);
@@ -46,23 +50,8 @@ void configure_gpio(void)
  */
 void configure_systick(void)
 {
-    /* 72MHz / 8 => 9000000 counts per second */
-    systick_set_clocksource(STK_CSR_CLKSOURCE_AHB_DIV8);
-
-    /* 9000000/9000 = 1000 overflows per second - every 1ms one interrupt */
-    systick_set_reload(RELOAD_COUNT);
-
-    systick_interrupt_enable();
-
-    /* Start counting. */
-    systick_counter_enable();
-}
-
-// Override the weak definition of the systick handler
-void sys_tick_handler(void)
-{
-    /* Toggle the LED on PC13 */
-    gpio_toggle(GPIOC, GPIO13);
+    /* Full 2^24 cycle periods on the 72 MHz AHB clock, the reload value follows the deadlines of the delays */
+    systime_init();
 }
 
 /**
@@ -71,12 +60,21 @@ void sys_tick_handler(void)
  */
 int main(void)
 {
+    uint64_t deadline;
+
     systemInit();        /* Initialize the system clock and GPIO peripherals */
     configure_gpio();    /* Configure the GPIO pin for the LED */
     configure_systick(); /* Configure the SysTick timer */
 
+    deadline = systime_now();
+
     while (TRUE)
     {
+        /* Each deadline is the previous one plus the period, so the toggles do not drift */
+        deadline += SYSTIME_MS(TOGGLE_PERIOD_MS);
+        systime_sleep_until(deadline);
+
+        gpio_toggle(GPIOC, GPIO13); /* Toggle the LED on PC13 */
     }
 
     return 0; /* Program should never reach this point */
@@ -0,0 +1,164 @@
+/**
+ * @file systime.c
+ * @brief Tickless SysTick time base, see systime.h.
+ */
+
+#include "systime.h"
+
+#include <stdbool.h>
+
+#include <libopencm3/cm3/cortex.h>
+#include <libopencm3/cm3/scb.h>
+#include <libopencm3/cm3/systick.h>
+
+#define FULL_PERIOD (STK_RVR_RELOAD + 1) /* Cycles of a full SysTick period, without deadline */
+#define NO_DEADLINE UINT64_MAX           /* Deadline when no delay is running */
+
+static volatile uint64_t systime_base;                   /* Cycles at the last zero of the counter, or its clear */
+static volatile uint32_t systime_period;                 /* Cycles between two zeros of the counter: reload + 1 */
+static volatile uint64_t systime_deadline = NO_DEADLINE; /* End of the running delay */
+
+/**
+ * @brief Cycles since systime_init(), with the interrupts disabled.
+ * @note The counter goes from the reload value down to 0, where the interrupt becomes pending, and takes the reload
+ *       value on the next cycle. A zero not yet seen by the interrupt handler is counted.
+ */
+static uint64_t read_time(void)
+{
+    uint64_t cycles = systime_base;
+    uint32_t value = systick_get_value();
+
+    if (SCB_ICSR & SCB_ICSR_PENDSTSET)
+    {
+        /* The counter reached 0 before or after the first read: read it again after the zero */
+        cycles += systime_period;
+        value = systick_get_value();
+    }
+    return cycles + ((value == 0) ? 0 : systime_period - value);
+}
+
+/**
+ * @brief Restarts the counter for a period of cycles, from now on, with the interrupts disabled.
+ */
+static void reload(uint32_t cycles)
+{
+    uint64_t now = read_time();
+
+    systick_set_reload(cycles - 1);
+    systick_clear();               /* Cleared now, reload value on the next cycle */
+    SCB_ICSR = SCB_ICSR_PENDSTCLR; /* A pending zero is already counted in now */
+    systime_base = now;
+    systime_period = cycles;
+}
+
+/**
+ * @brief Sets the period of the counter to end at the deadline, or to the full period without a deadline in reach.
+ * @note The full period is left as it is, so that the time base does not lose cycles while no delay runs.
+ */
+static void program(void)
+{
+    uint64_t now = read_time();
+    uint64_t deadline = systime_deadline;
+    uint32_t cycles = FULL_PERIOD;
+
+    if ((deadline != NO_DEADLINE) && (deadline > now) && (deadline - now < FULL_PERIOD))
+    {
+        /* Two cycles at least: a reload value of 0 stops the interrupt */
+        cycles = (deadline - now < 2) ? 2 : (uint32_t)(deadline - now);
+    }
+    if ((cycles != FULL_PERIOD) || (systime_period != FULL_PERIOD))
+    {
+        reload(cycles);
+    }
+}
+
+/**
+ * @brief Counts the period that ended at a zero of the counter, and sets the next one, with the interrupts disabled.
+ */
+static void next_period(void)
+{
+    systime_base += systime_period;
+    program();
+}
+
+void systime_init(void)
+{
+    systick_counter_disable();
+    systick_set_clocksource(STK_CSR_CLKSOURCE_AHB);
+    systime_deadline = NO_DEADLINE;
+    systime_base = 0;
+    systime_period = FULL_PERIOD;
+    systick_set_reload(FULL_PERIOD - 1);
+    systick_clear();
+    systick_interrupt_enable();
+    systick_counter_enable();
+}
+
+uint64_t systime_now(void)
+{
+    bool masked = cm_is_masked_interrupts();
+    uint64_t now;
+
+    cm_disable_interrupts();
+    now = read_time();
+    if (!masked)
+    {
+        cm_enable_interrupts();
+    }
+    return now;
+}
+
+void systime_sleep_until(uint64_t deadline)
+{
+    bool masked = cm_is_masked_interrupts();
+
+    cm_disable_interrupts();
+    systime_deadline = deadline;
+    program();
+    /* WFI wakes up on a pending interrupt with PRIMASK set: no interrupt is lost between the test and the sleep */
+    while (read_time() < deadline)
+    {
+        __asm__ volatile("wfi");
+        if (!masked)
+        {
+            cm_enable_interrupts(); /* Run the handlers */
+            cm_disable_interrupts();
+        }
+        else if (SCB_ICSR & SCB_ICSR_PENDSTSET)
+        {
+            /* The caller masked the interrupts: count the zero in place of sys_tick_handler() */
+            SCB_ICSR = SCB_ICSR_PENDSTCLR;
+            next_period();
+        }
+    }
+    systime_deadline = NO_DEADLINE;
+    if (!masked)
+    {
+        cm_enable_interrupts();
+    }
+}
+
+void delay_us(uint32_t us)
+{
+    systime_sleep_until(systime_now() + SYSTIME_US(us));
+}
+
+void delay_ms(uint32_t ms)
+{
+    systime_sleep_until(systime_now() + SYSTIME_MS(ms));
+}
+
+/**
+ * @brief SysTick interrupt: counts the period that ended, and sets the next one.
+ */
+void sys_tick_handler(void)
+{
+    bool masked = cm_is_masked_interrupts();
+
+    cm_disable_interrupts();
+    next_period();
+    if (!masked)
+    {
+        cm_enable_interrupts();
+    }
+}
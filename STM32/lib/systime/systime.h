@@ -0,0 +1,55 @@
+/**
+ * @file systime.h
+ * @brief Tickless SysTick time base: a 64-bit count of AHB clock cycles, and delays that sleep instead of spinning.
+ *
+ * Without a pending deadline the SysTick counts its full 2^24 cycles: one interrupt every 233 ms at 72 MHz. A delay
+ * writes the reload value with the cycles left to its deadline and waits in WFI, so the core wakes up at the deadline
+ * and on the interrupts of the application. The delays count cycles, they do not depend on the optimization level.
+ * Each reprogramming of the SysTick loses the few cycles between the read and the write of its current value.
+ *
+ * Shared by the STM32 examples through lib_deps in their platformio.ini. The module defines sys_tick_handler().
+ */
+
+#ifndef SYSTIME_H
+#define SYSTIME_H
+
+#include <stdint.h>
+
+#include <libopencm3/stm32/rcc.h>
+
+/* Cycles of the AHB clock in us microseconds, or in ms milliseconds */
+#define SYSTIME_US(us) ((uint64_t)(us) * (rcc_ahb_frequency / 1000000))
+#define SYSTIME_MS(ms) ((uint64_t)(ms) * (rcc_ahb_frequency / 1000))
+
+/**
+ * @brief Starts the SysTick on the AHB clock, for a full period, and resets the time base to 0.
+ * @note Call it after the clock setup: the delays convert time with rcc_ahb_frequency.
+ */
+void systime_init(void);
+
+/**
+ * @brief Returns the cycles of the AHB clock since systime_init(), from any context.
+ */
+uint64_t systime_now(void);
+
+/**
+ * @brief Sleeps until the time base reaches a deadline.
+ * @param deadline Cycles since systime_init(), e.g. the previous deadline plus a period, for a periodic task without
+ *        drift. A deadline in the past returns at once.
+ * @note For the main loop, with the interrupts enabled: the interrupts of the application run meanwhile. Called with
+ *       the interrupts disabled, it returns with them disabled: the SysTick zeros are counted here, and the other
+ *       interrupts wake it up but wait until the caller enables them.
+ */
+void systime_sleep_until(uint64_t deadline);
+
+/**
+ * @brief Sleeps for a number of microseconds, see systime_sleep_until().
+ */
+void delay_us(uint32_t us);
+
+/**
+ * @brief Sleeps for a number of milliseconds, see systime_sleep_until().
+ */
+void delay_ms(uint32_t ms);
+
+#endif /* SYSTIME_H */
@@ -0,0 +1,180 @@
+/**
+ * @file band_classify.h
+ * @brief Classification of readings into bands with hysteresis and debounce (header only, shared by the LPC1769 and
+ *        STM32 examples)
+ */
+
+/** @defgroup BAND_CLASSIFY BAND_CLASSIFY (Band classifier)
+ * Sorts successive readings of one input into bands split by ascending thresholds, such as the temperature ranges
+ * shown by a set of LEDs, and tells the caller when the band changes:
+ * 	- a reading must pass the threshold beyond the current band by the hysteresis to leave it, and may skip bands;
+ * 	- the new band must hold for the debounce count of readings in a row before it is taken;
+ * 	- the first reading after BAND_Reset() is classified without hysteresis or debounce.
+ *
+ * The state is three bytes per input, and the caller drives its outputs only when BAND_Update() returns 1, so a
+ * reading that stays in its band costs two comparisons. The header only includes <stdint.h>: the LPC1769 driver
+ * lpc17xx_classify and the STM32 DMA example both use it.
+ * @code
+ * static const uint16_t limits[] = {400, 700};  // tenths of a degree
+ * static BAND_State_Type oven;
+ *
+ * BAND_Reset(&oven);
+ * ...
+ * if (BAND_Update(&oven, limits, 3, 20, 1, temperature))
+ * {
+ *     // oven.Band is the new band, 0 to 2
+ * }
+ * @endcode
+ * @{
+ */
+
+#ifndef BAND_CLASSIFY_H_
+#define BAND_CLASSIFY_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup BAND_CLASSIFY_Public_Macros BAND_CLASSIFY Public Macros
+ * @{
+ */
+
+/** Band of an input whose first reading is still to come */
+#define BAND_NONE 0xFF
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup BAND_CLASSIFY_Public_Types BAND_CLASSIFY Public Types
+ * @{
+ */
+
+/** @brief State of an input */
+typedef struct
+{
+    uint8_t Band;      /**< Current band, BAND_NONE before the first reading */
+    uint8_t Candidate; /**< Band of the last readings out of the current band */
+    uint8_t Seen;      /**< Consecutive readings in the candidate band */
+} BAND_State_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup BAND_CLASSIFY_Public_Functions BAND_CLASSIFY Public Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Forget the band of an input: the next reading is classified
+ * 				without hysteresis or debounce
+ * @param[out]	state	State of the input
+ * @return		None
+ **********************************************************************/
+static inline void BAND_Reset(BAND_State_Type* state)
+{
+    state->Band = BAND_NONE;
+    state->Candidate = 0;
+    state->Seen = 0;
+}
+
+/*********************************************************************/ /**
+ * @brief		Get the band of a reading, without hysteresis
+ * @param[in]	thresholds	count - 1 ascending values, band i holds the
+ * 							readings from thresholds[i - 1] up to
+ * 							thresholds[i] excluded
+ * @param[in]	count		Bands, at least 1
+ * @param[in]	reading		Reading, in the unit of the thresholds
+ * @return		Band, 0 to count - 1
+ **********************************************************************/
+static inline uint8_t BAND_Of(const uint16_t* thresholds, uint8_t count, int32_t reading)
+{
+    uint8_t band = 0;
+
+    while ((band + 1 < count) && (reading >= thresholds[band]))
+    {
+        band++;
+    }
+    return band;
+}
+
+/*********************************************************************/ /**
+ * @brief		Classify a reading of an input
+ * @param[in,out]	state		State of the input
+ * @param[in]	thresholds	count - 1 ascending values, see BAND_Of()
+ * @param[in]	count		Bands, at least 1
+ * @param[in]	hysteresis	Margin a reading must pass a threshold by to
+ * 							leave its band
+ * @param[in]	debounce	Consecutive readings of a new band before it is
+ * 							taken, 0 or 1 for the first
+ * @param[in]	reading		Reading, in the unit of the thresholds
+ * @return		1 when the band changed, state->Band is the new one, or 0
+ *
+ * Note: the first reading after BAND_Reset() always returns 1. Readings of
+ * an input must not be classified from two interrupt priorities.
+ **********************************************************************/
+static inline int BAND_Update(BAND_State_Type* state, const uint16_t* thresholds, uint8_t count, uint16_t hysteresis,
+                              uint8_t debounce, int32_t reading)
+{
+    uint8_t band = state->Band;
+    uint8_t target = band;
+
+    if (band == BAND_NONE)
+    {
+        state->Band = BAND_Of(thresholds, count, reading);
+        state->Seen = 0;
+        return 1;
+    }
+
+    // Leaving a band takes the hysteresis past its threshold, then each threshold passed moves one band further
+    while ((target < count - 1) && (reading >= (int32_t)thresholds[target] + hysteresis))
+    {
+        target++;
+    }
+    while ((target > 0) && (reading + hysteresis < (int32_t)thresholds[target - 1]))
+    {
+        target--;
+    }
+
+    if (target == band)
+    {
+        state->Seen = 0;
+        return 0;
+    }
+    if ((state->Seen == 0) || (target != state->Candidate))
+    {
+        state->Candidate = target;
+        state->Seen = 0;
+    }
+    if (++state->Seen < debounce)
+    {
+        return 0;
+    }
+    state->Band = target;
+    state->Seen = 0;
+    return 1;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BAND_CLASSIFY_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */
@@ -0,0 +1,144 @@
+/**
+ * @file sensor_lut.h
+ * @brief Fixed-point conversion of ADC codes to engineering units through piecewise-linear lookup tables (header only,
+ *        shared by the LPC1769 and STM32 examples)
+ */
+
+/** @defgroup SENSOR_LUT SENSOR_LUT (Sensor linearization tables)
+ * Converts the 12-bit codes of an ADC to engineering units (tenths of a degree, millivolts, ...) with integer
+ * arithmetic only, so that a conversion in an interrupt handler does not call the software floating-point library of
+ * a Cortex-M3:
+ * 	- the transfer function of the sensor is a table of SENSOR_TABLE_POINTS values, one every SENSOR_TABLE_STEP codes,
+ * 	  generated at compile time by SENSOR_TABLE() from a macro of the code. The macro may use floating-point constants:
+ * 	  they are folded by the compiler, and the table holds integers;
+ * 	- a conversion interpolates linearly between the two values around the code: one multiplication and two shifts;
+ * 	- SENSOR_Type adds the calibration of a device, an offset of the ADC codes and an offset of the result, which may
+ * 	  be changed at run time.
+ *
+ * The header has no dependency on a vendor library. It lives outside both trees, and the LPC1769 Makefiles and the
+ * STM32 platformio.ini files add its directory to the include path:
+ * @code
+ * #define LM35_DECIDEGREES(code) ((int32_t)((code) * 3300.0 / 4096.0 + 0.5))  // 10 mV per degree, 3.3 V reference
+ *
+ * static const int32_t lm35_table[SENSOR_TABLE_POINTS] = SENSOR_TABLE(LM35_DECIDEGREES);
+ * static SENSOR_Type oven = {lm35_table, 0, 0, 0};
+ *
+ * int32_t temperature = SENSOR_Convert(&oven, code);  // 400 is 40.0 degrees
+ * @endcode
+ * @{
+ */
+
+#ifndef SENSOR_LUT_H_
+#define SENSOR_LUT_H_
+
+/* Includes ------------------------------------------------------------------- */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Public Macros -------------------------------------------------------------- */
+/** @defgroup SENSOR_LUT_Public_Macros SENSOR_LUT Public Macros
+ * @{
+ */
+
+/** Bits of the ADC codes */
+#define SENSOR_CODE_BITS 12
+
+/** Codes between two values of a table, as a power of two */
+#define SENSOR_TABLE_SHIFT 7
+
+/** Codes between two values of a table */
+#define SENSOR_TABLE_STEP (1 << SENSOR_TABLE_SHIFT)
+
+/** Values of a table: 32 segments, the last value is the one of code 4096 */
+#define SENSOR_TABLE_POINTS ((1 << (SENSOR_CODE_BITS - SENSOR_TABLE_SHIFT)) + 1)
+
+/* Values i to i + 15 of a table, from the transfer function F */
+#define SENSOR_TABLE_1(F, i)  F((i) * SENSOR_TABLE_STEP)
+#define SENSOR_TABLE_4(F, i)  SENSOR_TABLE_1(F, i), SENSOR_TABLE_1(F, (i) + 1), SENSOR_TABLE_1(F, (i) + 2), \
+                              SENSOR_TABLE_1(F, (i) + 3)
+#define SENSOR_TABLE_16(F, i) SENSOR_TABLE_4(F, i), SENSOR_TABLE_4(F, (i) + 4), SENSOR_TABLE_4(F, (i) + 8), \
+                              SENSOR_TABLE_4(F, (i) + 12)
+
+/**
+ * Initializer of a table of SENSOR_TABLE_POINTS values: F(code) must be a constant expression giving the value of a
+ * code, from 0 to 4096 in steps of SENSOR_TABLE_STEP
+ */
+#define SENSOR_TABLE(F) {SENSOR_TABLE_16(F, 0), SENSOR_TABLE_16(F, 16), SENSOR_TABLE_1(F, 32)}
+
+/**
+ * @}
+ */
+
+/* Public Types --------------------------------------------------------------- */
+/** @defgroup SENSOR_LUT_Public_Types SENSOR_LUT Public Types
+ * @{
+ */
+
+/** @brief Sensor: transfer function and calibration of a device */
+typedef struct
+{
+    const int32_t* Table; /**< SENSOR_TABLE_POINTS values from SENSOR_TABLE(), increasing or decreasing */
+    uint8_t ExtraBits;    /**< Bits of the readings beyond SENSOR_CODE_BITS, from oversampling (0 for raw codes) */
+    int16_t CodeOffset;   /**< Added to the readings before the lookup: offset error of the ADC, in readings */
+    int32_t Offset;       /**< Added to the results: offset of the sensor, in output units */
+} SENSOR_Type;
+
+/**
+ * @}
+ */
+
+/* Public Functions ----------------------------------------------------------- */
+/** @defgroup SENSOR_LUT_Public_Functions SENSOR_LUT Public Functions
+ * @{
+ */
+
+/*********************************************************************/ /**
+ * @brief		Convert a reading to engineering units
+ * @param[in]	sensor		Sensor of the reading
+ * @param[in]	reading		ADC code, with ExtraBits more bits when oversampled
+ * @return		Value of the reading, in the unit of the table
+ *
+ * Note: the calibrated reading is clamped to the range of the ADC. The
+ * differences between two values of the table must stay below 2^24 / 2^ExtraBits.
+ **********************************************************************/
+static inline int32_t SENSOR_Convert(const SENSOR_Type* sensor, uint32_t reading)
+{
+    const uint32_t shift = SENSOR_TABLE_SHIFT + sensor->ExtraBits;
+    const int32_t max = (1 << (SENSOR_CODE_BITS + sensor->ExtraBits)) - 1;
+    int32_t code = (int32_t)reading + sensor->CodeOffset;
+    const int32_t* point;
+    int32_t frac;
+
+    if (code < 0)
+    {
+        code = 0;
+    }
+    else if (code > max)
+    {
+        code = max;
+    }
+
+    point = &sensor->Table[code >> shift];
+    frac = code & ((1 << shift) - 1);
+    return point[0] + (((point[1] - point[0]) * frac + (1 << (shift - 1))) >> shift) + sensor->Offset;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_LUT_H_ */
+
+/**
+ * @}
+ */
+
+/* --------------------------------- End Of File ------------------------------ */